@@ -210,21 +210,44 @@ def generateIncludesShadersStore(shaderFiles, outputDir,
     output = "#ifndef BABYLON_MATERIALS_EFFECT_INCLUDES_SHADERS_STORE_H%s" % eol
     output += "#define BABYLON_MATERIALS_EFFECT_INCLUDES_SHADERS_STORE_H%s%s"  \
                                                                     % (eol,eol)
+    output += "#include <memory>%s" % eol
     output += "#include <string>%s" % eol
     output += "#include <unordered_map>%s%s" % (eol, eol)
     output += "#include <babylon/babylon_api.h>%s%s" % (eol, eol)
     output += "namespace BABYLON {%s%s" % (eol, eol)
+    output += "/**%s" % eol
+    output += " * @brief Store of the included files of the shaders.%s" % eol
+    output += " *%s" % eol
+    output += " * The includes are published as an immutable snapshot, which the effects " \
+              "processed on the engine%s" % eol
+    output += " * thread pool keep for the duration of the processing. Registering an include " \
+              "copies the current%s" % eol
+    output += " * snapshot and publishes the copy (copy-on-write).%s" % eol
+    output += " */%s" % eol
     output += "class BABYLON_SHARED_EXPORT EffectIncludesShadersStore {"
     output += "%s%s" % (eol,eol)
     output += "public:%s" % eol
+    output += "  using IncludesMap = std::unordered_map<std::string, std::string>;%s%s" \
+                                                                    % (eol, eol)
+    output += "public:%s" % eol
     output += "  EffectIncludesShadersStore();%s" % eol
     output += "  ~EffectIncludesShadersStore(); // = default%s%s" % (eol,eol)
-    output += "  std::unordered_map<std::string, std::string>& "
-    output += "shaders();%s" % eol
-    output += "  [[nodiscard]] const std::unordered_map<std::string, std::string>& shaders() "
-    output += "const;%s%s" % (eol, eol)
+    output += "  /**%s" % eol
+    output += "   * @brief Returns the current snapshot of the includes, safe to read from " \
+              "any thread.%s" % eol
+    output += "   */%s" % eol
+    output += "  [[nodiscard]] std::shared_ptr<const IncludesMap> shaders() const;%s%s" \
+                                                                    % (eol, eol)
+    output += "  /**%s" % eol
+    output += "   * @brief Registers or replaces an include, the snapshots already handed " \
+              "out are not modified.%s" % eol
+    output += "   * @param name defines the name of the include%s" % eol
+    output += "   * @param source defines the source code of the include%s" % eol
+    output += "   */%s" % eol
+    output += "  void setShader(const std::string& name, const std::string& source);%s%s" \
+                                                                    % (eol, eol)
     output += "private:%s" % eol
-    output += "  static std::unordered_map<std::string, std::string> _shaders;"
+    output += "  static std::shared_ptr<const IncludesMap> _shaders;"
     output += "%s%s" % (eol,eol)
     output += "}; // end of class EffectIncludesShadersStore%s%s" % (eol, eol)
     output += "} // end of namespace BABYLON%s%s#endif " % (eol, eol)
@@ -237,6 +260,7 @@ def generateIncludesShadersStore(shaderFiles, outputDir,
         file.write(output)
     ### generate source file containg the shader map ###
     output = "#include <babylon/materials/%s>%s%s" % (headerFilename, eol, eol)
+    output += "#include <mutex>%s%s" % (eol, eol)
     shaderNames = []
     for shaderFile in shaderFiles:
         shaderFilename = os.path.basename(shaderFile)
@@ -245,21 +269,35 @@ def generateIncludesShadersStore(shaderFiles, outputDir,
         output += "#include <babylon/shaders/shadersinclude/%s>%s" % ("%s.h" % \
                                         shaderFilename.replace(".", "_"), eol)
     output += "%snamespace BABYLON {%s%s" % (eol, eol, eol)
+    output += "namespace {%s%s" % (eol, eol)
+    output += "// Guards the publication of the snapshots, not their content%s" % eol
+    output += "std::mutex& ShadersMutex()%s" % eol
+    output += "{%s  static std::mutex shadersMutex;%s  return shadersMutex;%s}%s%s" \
+                                                    % (eol, eol, eol, eol, eol)
+    output += "} // end of anonymous namespace%s%s" % (eol, eol)
     output += "EffectIncludesShadersStore::EffectIncludesShadersStore() = default;%s%s" % (eol, eol)
     output += "EffectIncludesShadersStore::~EffectIncludesShadersStore() = default;%s%s" % (eol, eol)
-    output += "std::unordered_map<std::string, std::string>&%s" % eol
-    output += "EffectIncludesShadersStore::shaders()%s" % eol
-    output += "{%s  return _shaders;%s}%s%s" % (eol, eol, eol, eol)
-    output += "const std::unordered_map<std::string, std::string>&%s" % eol
+    output += "std::shared_ptr<const EffectIncludesShadersStore::IncludesMap>%s" % eol
     output += "EffectIncludesShadersStore::shaders() const%s" % eol
-    output += "{%s  return _shaders;%s}%s%s" % (eol, eol, eol, eol)
+    output += "{%s  std::lock_guard<std::mutex> lock(ShadersMutex());%s" % (eol, eol)
+    output += "  return _shaders;%s}%s%s" % (eol, eol, eol)
+    output += "void EffectIncludesShadersStore::setShader(const std::string& name, " \
+              "const std::string& source)%s" % eol
+    output += "{%s  std::lock_guard<std::mutex> lock(ShadersMutex());%s" % (eol, eol)
+    output += "  auto shaders     = std::make_shared<IncludesMap>(*_shaders);%s" % eol
+    output += "  (*shaders)[name] = source;%s" % eol
+    output += "  _shaders         = std::move(shaders);%s}%s%s" % (eol, eol, eol)
     # create shader include name to shared source mapping
-    output += "std::unordered_map<std::string, std::string>%s" % eol
-    output += "  EffectIncludesShadersStore::_shaders%s" % eol
+    output += "// Moved into the first snapshot%s" % eol
+    output += "static EffectIncludesShadersStore::IncludesMap InitialShaders%s" % eol
     output += "  = {"
     for shaderName in shaderNames:
         output += "{\"%s\", %s},%s     " % (shaderName, shaderName, eol)
     output = "%s};%s%s" % (output[:-7], eol, eol)
+    output += "std::shared_ptr<const EffectIncludesShadersStore::IncludesMap> " \
+              "EffectIncludesShadersStore::_shaders%s" % eol
+    output += "  = std::make_shared<const EffectIncludesShadersStore::IncludesMap>" \
+              "(std::move(InitialShaders));%s%s" % (eol, eol)
     output += "} // end of namespace BABYLON%s" % eol
     # write output to file
     outputFileLocation = os.path.join(outputDir, outputFileName)
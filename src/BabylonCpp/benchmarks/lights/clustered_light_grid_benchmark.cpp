@@ -0,0 +1,69 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstdio>
+#include <random>
+
+#include <babylon/core/thread_pool.h>
+#include <babylon/lights/clustered/clustered_light_grid.h>
+#include <babylon/maths/vector3.h>
+
+namespace {
+
+void AddRandomLights(BABYLON::ClusteredLightGrid& grid, size_t count)
+{
+  std::mt19937 generator(42);
+  std::uniform_real_distribution<float> horizontal(-150.f, 150.f);
+  std::uniform_real_distribution<float> depth(0.f, 300.f);
+  std::uniform_real_distribution<float> range(1.f, 10.f);
+  grid.clearLights();
+  for (size_t i = 0; i < count; ++i) {
+    grid.addLight(
+      BABYLON::Vector3(horizontal(generator), horizontal(generator) * 0.5f, depth(generator)),
+      range(generator));
+  }
+}
+
+template <typename F>
+double MeasureMicroseconds(size_t iterations, F&& f)
+{
+  const auto start = std::chrono::high_resolution_clock::now();
+  for (size_t i = 0; i < iterations; ++i) {
+    f();
+  }
+  const auto end = std::chrono::high_resolution_clock::now();
+  return std::chrono::duration<double, std::micro>(end - start).count()
+         / static_cast<double>(iterations);
+}
+
+} // end of anonymous namespace
+
+TEST(BenchmarkClusteredLightGrid, Bin10kLights)
+{
+  using namespace BABYLON;
+
+  constexpr size_t count      = 10000;
+  constexpr size_t iterations = 20;
+
+  ClusteredLightGrid grid(16, 9, 24, 127);
+  grid.setPerspective(-0.8f, 0.8f, -0.45f, 0.45f, 0.5f, 300.f);
+  AddRandomLights(grid, count);
+
+  ThreadPool threadPool;
+  const auto scalarTime   = MeasureMicroseconds(iterations, [&]() { grid.bin(nullptr, true); });
+  const auto simdTime     = MeasureMicroseconds(iterations, [&]() { grid.bin(); });
+  const auto threadedTime = MeasureMicroseconds(iterations, [&]() { grid.bin(&threadPool); });
+
+  size_t references = 0;
+  for (size_t cluster = 0; cluster < grid.clusterCount(); ++cluster) {
+    references += grid.getClusterLightCount(cluster);
+  }
+
+  std::printf("Clustered binning (%zu lights, %zu clusters, %zu references, %zu dropped): "
+              "scalar %.1f us, simd %.1f us, simd + %zu workers %.1f us\n",
+              count, grid.clusterCount(), references, grid.overflowCount(), scalarTime, simdTime,
+              threadPool.workerCount(), threadedTime);
+
+  EXPECT_GT(references, 0ull);
+}
@@ -0,0 +1,92 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <functional>
+
+#include <babylon/maths/matrix.h>
+#include <babylon/meshes/optimization/index_optimizer.h>
+#include <babylon/meshes/optimization/meshlet_builder.h>
+
+namespace {
+
+// Height field of (size - 1)^2 * 2 triangles, the front faces look up (+y)
+void CreateTerrain(size_t size, BABYLON::Float32Array& positions, BABYLON::IndicesArray& indices)
+{
+  const auto scale = 100.f / static_cast<float>(size - 1);
+  for (size_t y = 0; y < size; ++y) {
+    for (size_t x = 0; x < size; ++x) {
+      const auto u = static_cast<float>(x) * scale;
+      const auto v = static_cast<float>(y) * scale;
+      positions.insert(positions.end(), {u, 2.f * std::sin(u * 0.2f) * std::cos(v * 0.15f), v});
+    }
+  }
+  for (size_t y = 0; y + 1 < size; ++y) {
+    for (size_t x = 0; x + 1 < size; ++x) {
+      const auto a = static_cast<uint32_t>(y * size + x);
+      const auto c = static_cast<uint32_t>(a + size);
+      indices.insert(indices.end(), {a, a + 1, c, a + 1, c + 1, c});
+    }
+  }
+}
+
+double MeasureMilliseconds(const std::function<void()>& f)
+{
+  const auto start = std::chrono::high_resolution_clock::now();
+  f();
+  const auto end = std::chrono::high_resolution_clock::now();
+  return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+} // end of anonymous namespace
+
+TEST(BenchmarkMeshletBuilder, BuildAndCull1MTriangles)
+{
+  using namespace BABYLON;
+
+  Float32Array positions;
+  IndicesArray indices;
+  CreateTerrain(708, positions, indices);
+  const auto triangleCount = indices.size() / 3;
+  IndexOptimizer::OptimizeVertexCache(indices, 0, indices.size());
+
+  std::vector<Meshlet> meshlets;
+  const auto buildTime = MeasureMilliseconds([&]() {
+    meshlets = MeshletBuilder::BuildMeshlets(indices, 0, indices.size(),
+                                             VertexDataView::FromArray(positions, 3));
+  });
+
+  // Camera above a quarter of the terrain, the frustum keeps x and z in [0, 50]
+  const auto world = Matrix::Identity();
+  std::array<Plane, 6> frustumPlanes{
+    {Plane(1.f, 0.f, 0.f, 0.f), Plane(0.f, 0.f, 1.f, 0.f), Plane(-1.f, 0.f, 0.f, 50.f),
+     Plane(0.f, 0.f, -1.f, 50.f), Plane(0.f, 0.f, 0.f, 1.f), Plane(0.f, 0.f, 0.f, 1.f)}};
+  const Vector3 cameraPosition(25.f, 60.f, 25.f);
+  MeshletCullingOptions options;
+  std::vector<MeshletDrawRange> ranges;
+  size_t visibleCount = 0;
+  constexpr size_t iterations = 100;
+  const auto cullTime = MeasureMilliseconds([&]() {
+    for (size_t i = 0; i < iterations; ++i) {
+      visibleCount = MeshletBuilder::CullMeshlets(meshlets, world, frustumPlanes, cameraPosition,
+                                                  options, ranges);
+    }
+  });
+
+  float averageRadius = 0.f;
+  for (const auto& meshlet : meshlets) {
+    averageRadius += meshlet.radius / static_cast<float>(meshlets.size());
+  }
+
+  std::printf("Meshlets (%zu triangles): %zu meshlets (%.1f triangles, radius %.2f) built in "
+              "%.1f ms, culled in %.3f ms: %zu visible in %zu ranges\n",
+              triangleCount, meshlets.size(),
+              static_cast<double>(triangleCount) / static_cast<double>(meshlets.size()),
+              static_cast<double>(averageRadius), buildTime,
+              cullTime / static_cast<double>(iterations), visibleCount, ranges.size());
+
+  EXPECT_GT(visibleCount, 0ull);
+  EXPECT_LT(visibleCount, meshlets.size());
+}
@@ -0,0 +1,95 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <future>
+
+#include <babylon/core/thread_pool.h>
+#include <babylon/meshes/simplification/quadratic_error_simplification.h>
+#include <babylon/meshes/simplification/simplification_settings.h>
+#include <babylon/meshes/vertex_data.h>
+
+namespace {
+
+// Height field of (size - 1)^2 * 2 triangles with normals and uvs
+void CreateTerrain(size_t size, BABYLON::VertexData& vertexData)
+{
+  const auto scale = 1.f / static_cast<float>(size - 1);
+  for (size_t y = 0; y < size; ++y) {
+    for (size_t x = 0; x < size; ++x) {
+      const auto u = static_cast<float>(x) * scale;
+      const auto v = static_cast<float>(y) * scale;
+      const auto h = 0.05f * std::sin(u * 12.f) * std::cos(v * 9.f) + 0.02f * std::sin(u * 40.f);
+      vertexData.positions.insert(vertexData.positions.end(), {u, h, v});
+      vertexData.uvs.insert(vertexData.uvs.end(), {u, v});
+    }
+  }
+  for (size_t y = 0; y + 1 < size; ++y) {
+    for (size_t x = 0; x + 1 < size; ++x) {
+      const auto a = static_cast<uint32_t>(y * size + x);
+      const auto c = static_cast<uint32_t>(a + size);
+      vertexData.indices.insert(vertexData.indices.end(), {a, c, a + 1, a + 1, c, c + 1});
+    }
+  }
+  BABYLON::VertexData::ComputeNormals(vertexData.positions, vertexData.indices,
+                                      vertexData.normals);
+}
+
+double MeasureMilliseconds(const std::function<void()>& f)
+{
+  const auto start = std::chrono::high_resolution_clock::now();
+  f();
+  const auto end = std::chrono::high_resolution_clock::now();
+  return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+} // end of anonymous namespace
+
+TEST(BenchmarkQuadraticErrorSimplification, Simplify1MTriangles)
+{
+  using namespace BABYLON;
+
+  VertexData terrain;
+  CreateTerrain(708, terrain);
+  const auto triangleCount = terrain.indices.size() / 3;
+
+  const std::array<float, 3> qualities{{0.5f, 0.25f, 0.1f}};
+  std::array<size_t, 3> simplifiedCounts{};
+
+  // One level on the calling thread
+  const auto singleTime = MeasureMilliseconds([&]() {
+    IndicesArray subMeshIndexCounts;
+    QuadraticErrorSimplification simplifier;
+    const auto result = simplifier.simplify(terrain, subMeshIndexCounts,
+                                            SimplificationSettings(qualities[2], 0.f, false));
+    simplifiedCounts[2] = result->indices.size() / 3;
+  });
+
+  // The three levels on the thread pool, as done by the simplification queue
+  ThreadPool threadPool;
+  const auto parallelTime = MeasureMilliseconds([&]() {
+    std::vector<std::future<size_t>> levels;
+    for (const auto quality : qualities) {
+      levels.emplace_back(threadPool.enqueue([&terrain, quality]() {
+        IndicesArray subMeshIndexCounts;
+        QuadraticErrorSimplification simplifier;
+        return simplifier
+                 .simplify(terrain, subMeshIndexCounts, SimplificationSettings(quality, 0.f, false))
+                 ->indices.size()
+               / 3;
+      }));
+    }
+    for (size_t i = 0; i < levels.size(); ++i) {
+      simplifiedCounts[i] = levels[i].get();
+    }
+  });
+
+  std::printf("Quadric simplification (%zu triangles): 10%% level in %.0f ms (%zu triangles), "
+              "50/25/10%% levels on %zu workers in %.0f ms (%zu, %zu, %zu triangles)\n",
+              triangleCount, singleTime, simplifiedCounts[2], threadPool.workerCount(),
+              parallelTime, simplifiedCounts[0], simplifiedCounts[1], simplifiedCounts[2]);
+
+  EXPECT_LE(simplifiedCounts[2], triangleCount / 5);
+}
@@ -0,0 +1,129 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <functional>
+#include <random>
+#include <vector>
+
+#include <babylon/rendering/render_sort_key.h>
+
+namespace {
+
+// Stand-in for the sub mesh data read by the sort comparators
+struct SortItem {
+  int alphaIndex;
+  float distanceToCamera;
+  unsigned int alphaMode;
+  size_t effectId;
+  size_t materialId;
+  size_t vertexArrayId;
+}; // end of struct SortItem
+
+std::vector<SortItem> CreateItems(size_t count)
+{
+  std::mt19937 generator(42);
+  std::uniform_real_distribution<float> distance(0.f, 1000.f);
+  std::uniform_int_distribution<size_t> id(0, 255);
+  std::vector<SortItem> items(count);
+  for (auto& item : items) {
+    item = SortItem{0, distance(generator), 0, id(generator), id(generator), id(generator)};
+  }
+  return items;
+}
+
+template <typename F>
+double MeasureMicroseconds(size_t iterations, F&& f)
+{
+  const auto start = std::chrono::high_resolution_clock::now();
+  for (size_t i = 0; i < iterations; ++i) {
+    f();
+  }
+  const auto end = std::chrono::high_resolution_clock::now();
+  return std::chrono::duration<double, std::micro>(end - start).count()
+         / static_cast<double>(iterations);
+}
+
+} // end of anonymous namespace
+
+TEST(BenchmarkRenderSort, TransparentQueue50k)
+{
+  using namespace BABYLON;
+
+  constexpr size_t count      = 50000;
+  constexpr size_t iterations = 20;
+  const auto items            = CreateItems(count);
+  std::vector<const SortItem*> queue(count);
+  for (size_t i = 0; i < count; ++i) {
+    queue[i] = &items[i];
+  }
+
+  // Previous path: copy of the queue + stable sort with a std::function comparator
+  const std::function<bool(const SortItem* a, const SortItem* b)> compareFn
+    = [](const SortItem* a, const SortItem* b) {
+        if (a->alphaIndex != b->alphaIndex) {
+          return a->alphaIndex < b->alphaIndex;
+        }
+        return a->distanceToCamera > b->distanceToCamera;
+      };
+  std::vector<const SortItem*> sortedQueue;
+  const auto comparatorTime = MeasureMicroseconds(iterations, [&]() {
+    sortedQueue = queue;
+    std::stable_sort(sortedQueue.begin(), sortedQueue.end(), compareFn);
+  });
+
+  // Packed keys + radix sort
+  std::vector<RenderSortKey> keys(count), scratch;
+  const auto radixTime = MeasureMicroseconds(iterations, [&]() {
+    for (size_t i = 0; i < count; ++i) {
+      const auto& item = *queue[i];
+      keys[i].index    = static_cast<uint32_t>(i);
+      keys[i].key      = RenderSortKey::Transparent(0, item.distanceToCamera / 1000.f,
+                                                    item.alphaMode, item.effectId, item.materialId);
+    }
+    RenderSortKey::RadixSort(keys, scratch);
+  });
+
+  std::printf("Transparent queue (%zu sub meshes): comparator %.1f us, radix %.1f us\n", count,
+              comparatorTime, radixTime);
+
+  // Back to front
+  for (size_t i = 1; i < count; ++i) {
+    EXPECT_GE(queue[keys[i - 1].index]->distanceToCamera + 1e-3f,
+              queue[keys[i].index]->distanceToCamera);
+  }
+}
+
+TEST(BenchmarkRenderSort, OpaqueQueue50k)
+{
+  using namespace BABYLON;
+
+  constexpr size_t count      = 50000;
+  constexpr size_t iterations = 20;
+  const auto items            = CreateItems(count);
+
+  std::vector<RenderSortKey> keys(count), scratch;
+  const auto radixTime = MeasureMicroseconds(iterations, [&]() {
+    for (size_t i = 0; i < count; ++i) {
+      const auto& item = items[i];
+      keys[i].index    = static_cast<uint32_t>(i);
+      keys[i].key = RenderSortKey::Opaque(0, item.alphaMode, item.effectId, item.materialId,
+                                          item.vertexArrayId, item.distanceToCamera / 1000.f);
+    }
+    RenderSortKey::RadixSort(keys, scratch);
+  });
+
+  std::printf("Opaque queue (%zu sub meshes): radix %.1f us\n", count, radixTime);
+
+  // Grouped by effect, then material, then vertex array
+  for (size_t i = 1; i < count; ++i) {
+    const auto& a = items[keys[i - 1].index];
+    const auto& b = items[keys[i].index];
+    EXPECT_LE(a.effectId, b.effectId);
+    if (a.effectId == b.effectId) {
+      EXPECT_LE(a.materialId, b.materialId);
+    }
+  }
+}
@@ -171,6 +171,7 @@ enum class Type : unsigned int {
   HEMISPHERICLIGHT = 52,
   POINTLIGHT       = 53,
   SPOTLIGHT        = 54,
+  CLUSTEREDLIGHT   = 55,
   // Materials
   MATERIAL         = 100,
   MULTIMATERIAL    = 101,
@@ -0,0 +1,104 @@
+#ifndef BABYLON_CORE_THREAD_POOL_H
+#define BABYLON_CORE_THREAD_POOL_H
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <babylon/babylon_api.h>
+
+namespace BABYLON {
+
+/**
+ * @brief Simple fixed-size pool of worker threads used to offload CPU-side engine work (culling,
+ * preprocessing, mesh processing).
+ *
+ * Two usage patterns are supported:
+ *  - parallelFor() splits an index range into chunks and blocks until all of them are processed.
+ *    The calling thread takes part in the work.
+ *  - enqueue() schedules a fire-and-forget task and returns a future to its result.
+ *
+ * When created with 0 workers (or when threads are not available, e.g. emscripten without pthread
+ * support) all work is executed inline on the calling thread.
+ */
+class BABYLON_SHARED_EXPORT ThreadPool {
+
+public:
+  /**
+   * @brief Creates a new thread pool.
+   * @param numWorkers defines the number of worker threads to spawn (defaults to the number of
+   * hardware threads minus one, the calling thread being used as an extra worker)
+   */
+  explicit ThreadPool(size_t numWorkers = DefaultWorkerCount());
+  ThreadPool(const ThreadPool& other) = delete;
+  ThreadPool(ThreadPool&& other)      = delete;
+  ThreadPool& operator=(const ThreadPool& other) = delete;
+  ThreadPool& operator=(ThreadPool&& other) = delete;
+  ~ThreadPool(); // = default
+
+  /**
+   * @brief Returns the number of worker threads owned by the pool.
+   */
+  [[nodiscard]] size_t workerCount() const;
+
+  /**
+   * @brief Splits the range [0, count) into contiguous chunks of at least grainSize items and
+   * processes them on the pool. Chunk i always covers a lower index range than chunk i + 1.
+   * @param count defines the number of items to process
+   * @param grainSize defines the minimum number of items per chunk
+   * @param func defines the function processing the chunk [begin, end) with the given chunk index
+   * @returns the number of chunks used
+   */
+  size_t parallelFor(size_t count, size_t grainSize,
+                     const std::function<void(size_t chunkIndex, size_t begin, size_t end)>& func);
+
+  /**
+   * @brief Computes the number of chunks parallelFor would use for the given range.
+   * @param count defines the number of items to process
+   * @param grainSize defines the minimum number of items per chunk
+   * @returns the number of chunks
+   */
+  [[nodiscard]] size_t chunkCount(size_t count, size_t grainSize) const;
+
+  /**
+   * @brief Schedules a task on the pool.
+   * @param task defines the task to execute
+   * @returns a future to the result of the task
+   */
+  template <typename F>
+  auto enqueue(F&& task) -> std::future<decltype(task())>
+  {
+    using R       = decltype(task());
+    auto packaged = std::make_shared<std::packaged_task<R()>>(std::forward<F>(task));
+    auto future   = packaged->get_future();
+    _push([packaged]() { (*packaged)(); });
+    return future;
+  }
+
+  /**
+   * @brief Returns the default number of worker threads.
+   */
+  static size_t DefaultWorkerCount();
+
+private:
+  void _push(std::function<void()>&& job);
+  void _workerLoop();
+
+private:
+  std::vector<std::thread> _workers;
+  std::deque<std::function<void()>> _jobs;
+  std::mutex _mutex;
+  std::condition_variable _condition;
+  bool _stopping;
+
+}; // end of class ThreadPool
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_CORE_THREAD_POOL_H
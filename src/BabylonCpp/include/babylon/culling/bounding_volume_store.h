@@ -0,0 +1,125 @@
+#ifndef BABYLON_CULLING_BOUNDING_VOLUME_STORE_H
+#define BABYLON_CULLING_BOUNDING_VOLUME_STORE_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include <babylon/babylon_api.h>
+
+namespace BABYLON {
+
+class BoundingInfo;
+class Plane;
+
+/**
+ * @brief Structure of arrays store of world space bounding volumes (bounding spheres and axis
+ * aligned bounding boxes) used to frustum cull many meshes in a single pass.
+ *
+ * Each mesh owns a slot in the store which is kept in sync with its bounding info. The culling
+ * kernel walks the contiguous arrays with SSE/AVX when available (scalar fallback otherwise) and
+ * outputs a visibility bitmask indexed by slot. The test is conservative: a cleared bit means that
+ * the volume is fully outside of the frustum, a set bit means that it is potentially visible.
+ */
+class BABYLON_SHARED_EXPORT BoundingVolumeStore {
+
+public:
+  /**
+   * Value used for meshes without slot in the store
+   */
+  static constexpr std::size_t InvalidSlot = std::numeric_limits<std::size_t>::max();
+
+public:
+  BoundingVolumeStore();
+  BoundingVolumeStore(const BoundingVolumeStore& other) = delete;
+  BoundingVolumeStore(BoundingVolumeStore&& other)      = default;
+  BoundingVolumeStore& operator=(const BoundingVolumeStore& other) = delete;
+  BoundingVolumeStore& operator=(BoundingVolumeStore&& other) = default;
+  ~BoundingVolumeStore(); // = default
+
+  /**
+   * @brief Allocates a new slot in the store. The slot is culled until it is updated.
+   * @returns the index of the slot
+   */
+  size_t allocate();
+
+  /**
+   * @brief Releases a slot previously returned by allocate().
+   * @param slot defines the slot to release
+   */
+  void release(size_t slot);
+
+  /**
+   * @brief Copies the world space bounding volumes of a bounding info into a slot.
+   * @param slot defines the slot to update
+   * @param boundingInfo defines the bounding info to copy the world space volumes from
+   */
+  void update(size_t slot, const BoundingInfo& boundingInfo);
+
+  /**
+   * @brief Marks a slot as having no bounding volume (always culled).
+   * @param slot defines the slot to invalidate
+   */
+  void invalidate(size_t slot);
+
+  /**
+   * @brief Returns the number of slots (used or free) in the store.
+   */
+  [[nodiscard]] size_t capacity() const;
+
+  /**
+   * @brief Returns the number of used slots in the store.
+   */
+  [[nodiscard]] size_t size() const;
+
+  /**
+   * @brief Tests all the slots of the store against the frustum planes.
+   * @param frustumPlanes defines the frustum planes to test
+   * @param visibility defines the bitmask receiving the result, bit (slot % 64) of word (slot / 64)
+   * is set if the slot is potentially visible
+   * @param forceScalar defines if the scalar kernel should be used even if SIMD is available
+   */
+  void cull(const std::array<Plane, 6>& frustumPlanes, std::vector<uint64_t>& visibility,
+            bool forceScalar = false) const;
+
+  /**
+   * @brief Reads the visibility of a slot from a bitmask computed by cull().
+   * @param visibility defines the bitmask to read from
+   * @param slot defines the slot to check
+   * @returns true if the slot is potentially visible
+   */
+  static bool IsVisible(const std::vector<uint64_t>& visibility, size_t slot)
+  {
+    return (visibility[slot >> 6] >> (slot & 63)) & 1ull;
+  }
+
+private:
+  void _cullScalar(const std::array<Plane, 6>& frustumPlanes,
+                   std::vector<uint64_t>& visibility) const;
+  void _cullSIMD(const std::array<Plane, 6>& frustumPlanes, std::vector<uint64_t>& visibility)
+    const;
+
+private:
+  // Bounding spheres
+  std::vector<float> _sphereCenterX;
+  std::vector<float> _sphereCenterY;
+  std::vector<float> _sphereCenterZ;
+  std::vector<float> _sphereRadius;
+  // Axis aligned bounding boxes
+  std::vector<float> _boxCenterX;
+  std::vector<float> _boxCenterY;
+  std::vector<float> _boxCenterZ;
+  std::vector<float> _boxExtendX;
+  std::vector<float> _boxExtendY;
+  std::vector<float> _boxExtendZ;
+  // Slots
+  size_t _capacity;
+  std::vector<size_t> _freeSlots;
+
+}; // end of class BoundingVolumeStore
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_CULLING_BOUNDING_VOLUME_STORE_H
@@ -0,0 +1,111 @@
+#ifndef BABYLON_CULLING_BVH_BVH_ACTIVE_MESH_CANDIDATE_PROVIDER_H
+#define BABYLON_CULLING_BVH_BVH_ACTIVE_MESH_CANDIDATE_PROVIDER_H
+
+#include <unordered_map>
+
+#include <babylon/babylon_api.h>
+#include <babylon/culling/bvh/dynamic_bvh.h>
+#include <babylon/culling/iactive_mesh_candidate_provider.h>
+#include <babylon/misc/observer.h>
+
+namespace BABYLON {
+
+class AbstractMesh;
+class Scene;
+
+/**
+ * @brief Active mesh candidate provider selecting the meshes of a scene with a dynamic bounding
+ * volume hierarchy.
+ *
+ * Unlike the selection octree, moving meshes do not need to be handled as "dynamic content": the
+ * world matrices are brought up to date before each evaluation and only the leaves of the meshes
+ * whose bounding info changed (reported by Scene::onMeshBoundingInfoChangedObservable) are
+ * refitted. The world matrices are synchronized by the provider itself, unless the transform
+ * system of the scene is enabled (which does it in a single pass over the hierarchy), the provider
+ * does not enable it.
+ *
+ * The alwaysSelectAsActiveMesh flag of a mesh is read when the mesh is added and when its bounding
+ * info changes, call updateMesh() after changing it on a static mesh. The always selected meshes
+ * are returned after the meshes of the hierarchy, in the order they were flagged.
+ *
+ * The provider stops tracking the scene when the scene is disposed.
+ *
+ * Usage:
+ * @code
+ *   scene->enableTransformSystem(); // optional
+ *   BVHActiveMeshCandidateProvider provider(scene);
+ *   scene->setActiveMeshCandidateProvider(&provider);
+ * @endcode
+ */
+class BABYLON_SHARED_EXPORT BVHActiveMeshCandidateProvider : public IActiveMeshCandidateProvider {
+
+public:
+  /**
+   * @brief Creates a new provider tracking all the meshes of a scene.
+   * @param scene defines the scene whose meshes are tracked
+   * @param margin defines the distance (in world units) the leaf boxes are enlarged by
+   */
+  BVHActiveMeshCandidateProvider(Scene* scene, float margin = 0.1f);
+  BVHActiveMeshCandidateProvider(const BVHActiveMeshCandidateProvider& other) = delete;
+  BVHActiveMeshCandidateProvider& operator=(const BVHActiveMeshCandidateProvider& other) = delete;
+  ~BVHActiveMeshCandidateProvider() override;
+
+  /**
+   * @brief Refits the moved meshes and returns the meshes intersecting the frustum of the scene.
+   * @param scene defines the scene being evaluated
+   * @returns the list of candidate meshes
+   */
+  std::vector<AbstractMesh*> getMeshes(Scene* scene) override;
+
+  /**
+   * @brief Starts tracking a mesh (called automatically for the meshes added to the scene).
+   * @param mesh defines the mesh to add
+   */
+  void addMesh(AbstractMesh* mesh);
+
+  /**
+   * @brief Stops tracking a mesh (called automatically for the meshes removed from the scene).
+   * @param mesh defines the mesh to remove
+   */
+  void removeMesh(AbstractMesh* mesh);
+
+  /**
+   * @brief Refits the leaf of a mesh on next evaluation (called automatically when the bounding
+   * info of the mesh changes).
+   * @param mesh defines the mesh to update
+   */
+  void updateMesh(AbstractMesh* mesh);
+
+  /**
+   * @brief Gets the underlying hierarchy.
+   */
+  [[nodiscard]] const DynamicBVH<AbstractMesh*>& bvh() const;
+
+private:
+  struct Proxy {
+    int proxyId;
+    bool isDirty;
+    // Index in _alwaysSelectedMeshes, -1 if not always selected
+    int alwaysSelectedIndex;
+  }; // end of struct Proxy
+
+  void _refit(AbstractMesh* mesh, Proxy& proxy);
+  void _setAlwaysSelected(AbstractMesh* mesh, Proxy& proxy, bool alwaysSelected);
+  void _detachFromScene();
+
+private:
+  Scene* _scene;
+  DynamicBVH<AbstractMesh*> _bvh;
+  std::unordered_map<AbstractMesh*, Proxy> _proxies;
+  std::vector<AbstractMesh*> _dirtyMeshes;
+  std::vector<AbstractMesh*> _alwaysSelectedMeshes;
+  Observer<AbstractMesh>::Ptr _onNewMeshAddedObserver;
+  Observer<AbstractMesh>::Ptr _onMeshRemovedObserver;
+  Observer<AbstractMesh>::Ptr _onMeshBoundingInfoChangedObserver;
+  Observer<Scene>::Ptr _onSceneDisposeObserver;
+
+}; // end of class BVHActiveMeshCandidateProvider
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_CULLING_BVH_BVH_ACTIVE_MESH_CANDIDATE_PROVIDER_H
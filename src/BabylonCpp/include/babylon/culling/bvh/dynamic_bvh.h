@@ -0,0 +1,154 @@
+#ifndef BABYLON_CULLING_BVH_DYNAMIC_BVH_H
+#define BABYLON_CULLING_BVH_DYNAMIC_BVH_H
+
+#include <array>
+#include <cstddef>
+#include <vector>
+
+#include <babylon/babylon_api.h>
+#include <babylon/maths/vector3.h>
+
+namespace BABYLON {
+
+class Plane;
+
+/**
+ * @brief Dynamic bounding volume hierarchy (AABB tree) supporting incremental insertion, removal
+ * and refit of its entries.
+ *
+ * Leaves store "fat" boxes (enlarged by a margin) so that small moves do not require any tree
+ * update. Insertion uses a surface area heuristic to pick the best sibling and the tree is kept
+ * balanced with rotations, which keeps the queries logarithmic even when entries move every frame.
+ */
+template <class T>
+class BABYLON_SHARED_EXPORT DynamicBVH {
+
+public:
+  /**
+   * Value used for invalid node / proxy indices
+   */
+  static constexpr int NullNode = -1;
+
+public:
+  /**
+   * @brief Creates a new dynamic BVH.
+   * @param margin defines the distance (in world units) the leaf boxes are enlarged by
+   */
+  explicit DynamicBVH(float margin = 0.1f);
+  DynamicBVH(const DynamicBVH& other) = default;
+  DynamicBVH(DynamicBVH&& other)      = default;
+  DynamicBVH& operator=(const DynamicBVH& other) = default;
+  DynamicBVH& operator=(DynamicBVH&& other) = default;
+  ~DynamicBVH(); // = default
+
+  /**
+   * @brief Adds an entry to the tree.
+   * @param minimum defines the minimum vector of the entry bounding box
+   * @param maximum defines the maximum vector of the entry bounding box
+   * @param userData defines the entry
+   * @returns the id of the proxy representing the entry in the tree
+   */
+  int createProxy(const Vector3& minimum, const Vector3& maximum, const T& userData);
+
+  /**
+   * @brief Removes an entry from the tree.
+   * @param proxyId defines the id of the proxy to remove
+   */
+  void destroyProxy(int proxyId);
+
+  /**
+   * @brief Updates the bounding box of an entry. The tree is only modified if the new box leaves
+   * the fat box of the proxy (or if it became much smaller than it).
+   * @param proxyId defines the id of the proxy to move
+   * @param minimum defines the new minimum vector of the entry bounding box
+   * @param maximum defines the new maximum vector of the entry bounding box
+   * @returns true if the proxy was reinserted in the tree
+   */
+  bool moveProxy(int proxyId, const Vector3& minimum, const Vector3& maximum);
+
+  /**
+   * @brief Gets the entry of a proxy.
+   * @param proxyId defines the id of the proxy
+   * @returns the entry
+   */
+  const T& getUserData(int proxyId) const;
+
+  /**
+   * @brief Collects the entries whose boxes intersect the frustum.
+   * @param frustumPlanes defines the frustum planes to test
+   * @param selection defines the list receiving the selected entries
+   */
+  void select(const std::array<Plane, 6>& frustumPlanes, std::vector<T>& selection) const;
+
+  /**
+   * @brief Collects the entries whose boxes intersect a box.
+   * @param minimum defines the minimum vector of the box
+   * @param maximum defines the maximum vector of the box
+   * @param selection defines the list receiving the selected entries
+   */
+  void intersectsMinMax(const Vector3& minimum, const Vector3& maximum,
+                        std::vector<T>& selection) const;
+
+  /**
+   * @brief Collects the entries whose boxes intersect a sphere.
+   * @param center defines the center of the sphere
+   * @param radius defines the radius of the sphere
+   * @param selection defines the list receiving the selected entries
+   */
+  void intersectsSphere(const Vector3& center, float radius, std::vector<T>& selection) const;
+
+  /**
+   * @brief Returns the number of proxies in the tree.
+   */
+  [[nodiscard]] size_t size() const;
+
+  /**
+   * @brief Returns the height of the tree (0 for a single leaf, -1 when empty).
+   */
+  [[nodiscard]] int height() const;
+
+  /**
+   * @brief Hidden
+   * Checks the structural invariants of the tree (parent links, heights and box containment).
+   */
+  [[nodiscard]] bool _validate() const;
+
+private:
+  struct Node {
+    Vector3 minimum;
+    Vector3 maximum;
+    T userData;
+    // Parent node, or next free node when in the free list
+    int parent;
+    int child1;
+    int child2;
+    // Leaf = 0, free node = -1
+    int height;
+
+    [[nodiscard]] bool isLeaf() const
+    {
+      return child1 == NullNode;
+    }
+  }; // end of struct Node
+
+  int _allocateNode();
+  void _freeNode(int nodeId);
+  void _insertLeaf(int leaf);
+  void _removeLeaf(int leaf);
+  int _balance(int iA);
+  void _refitNode(int nodeId);
+  void _collectLeaves(int nodeId, std::vector<T>& selection, std::vector<int>& stack) const;
+  bool _validateNode(int nodeId) const;
+
+private:
+  float _margin;
+  std::vector<Node> _nodes;
+  int _root;
+  int _freeList;
+  size_t _proxyCount;
+
+}; // end of class DynamicBVH
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_CULLING_BVH_DYNAMIC_BVH_H
@@ -0,0 +1,33 @@
+#ifndef BABYLON_CULLING_IACTIVE_MESH_CANDIDATE_PROVIDER_H
+#define BABYLON_CULLING_IACTIVE_MESH_CANDIDATE_PROVIDER_H
+
+#include <vector>
+
+#include <babylon/babylon_api.h>
+
+namespace BABYLON {
+
+class AbstractMesh;
+class Scene;
+
+/**
+ * @brief Interface used to provide the list of potentially active meshes of a scene (spatial
+ * structures, custom visibility systems...).
+ * @see Scene::setActiveMeshCandidateProvider
+ */
+struct BABYLON_SHARED_EXPORT IActiveMeshCandidateProvider {
+
+  virtual ~IActiveMeshCandidateProvider() = default;
+
+  /**
+   * @brief Returns the meshes that are potentially active for the current frame.
+   * @param scene defines the scene being evaluated (frustum planes are up to date)
+   * @returns the list of candidate meshes
+   */
+  virtual std::vector<AbstractMesh*> getMeshes(Scene* scene) = 0;
+
+}; // end of struct IActiveMeshCandidateProvider
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_CULLING_IACTIVE_MESH_CANDIDATE_PROVIDER_H
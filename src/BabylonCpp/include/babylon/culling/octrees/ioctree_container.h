@@ -1,6 +1,7 @@
 #ifndef BABYLON_CULLING_OCTREES_IOCTREE_CONTAINER_H
 #define BABYLON_CULLING_OCTREES_IOCTREE_CONTAINER_H
 
+#include <memory>
 #include <vector>
 
 #include <babylon/babylon_api.h>
@@ -18,12 +19,9 @@ struct BABYLON_SHARED_EXPORT IOctreeContainer {
   /**
    * Blocks within the octree
    */
-  static std::vector<OctreeBlock<T>> blocks;
+  std::vector<std::unique_ptr<OctreeBlock<T>>> blocks;
 }; // end of struct IOctreeContainer<T>
 
-template <class T>
-std::vector<OctreeBlock<T>> IOctreeContainer<T>::blocks;
-
 } // end of namespace BABYLON
 
 #endif // end of BABYLON_CULLING_OCTREES_IOCTREE_CONTAINER_H
@@ -2,6 +2,7 @@
 #define BABYLON_CULLING_OCTREES_OCTREE_H
 
 #include <functional>
+#include <unordered_map>
 
 #include <babylon/babylon_api.h>
 #include <babylon/culling/octrees/ioctree_container.h>
@@ -61,6 +62,13 @@ public:
    */
   void removeMesh(T& entry);
 
+  /**
+   * @brief Updates the location of an element in the octree after it moved. With loose bounds,
+   * this is O(depth).
+   * @param entry defines the element to update
+   */
+  void updateMesh(T& entry);
+
   /**
    * @brief Selects an array of meshes within the frustum.
    * @param frustumPlanes The frustum planes to use which will select all meshes within it
@@ -112,8 +120,20 @@ public:
    */
   std::size_t maxDepth;
 
+  /**
+   * Defines if the octree uses loose bounds (must be set before calling update). Each element is
+   * then stored in a single block (the deepest block whose loose bounds contain it) so adding,
+   * removing and updating elements is O(depth) and selections never contain duplicates. Elements
+   * outside of the world bounds are stored in dynamicContent.
+   */
+  bool looseBounds;
+
+private:
+  void _addDynamicContent(size_t generation);
+
 private:
   std::size_t _maxBlockCapacity;
+  std::unordered_map<T, OctreeBlock<T>*> _looseEntryBlocks;
 
   std::vector<T> _selectionContent;
   std::function<void(T&, OctreeBlock<T>&)> _creationFunc;
@@ -2,6 +2,7 @@
 #define BABYLON_CULLING_OCTREES_OCTREE_BLOCK_H
 
 #include <functional>
+#include <unordered_map>
 
 #include <babylon/babylon_api.h>
 #include <babylon/culling/octrees/ioctree_container.h>
@@ -29,9 +30,14 @@ public:
    * @param depth defines the current depth of this block in the octree
    * @param maxDepth defines the maximal depth allowed (beyond this value, the capacity is ignored)
    * @param creationFunc defines a callback to call when an element is added to the block
+   * @param loose defines if the block uses loose bounds (twice the size of the block, each element
+   * is then stored in a single block)
    */
   OctreeBlock(const Vector3& minPoint, const Vector3& maxPoint, size_t capacity, size_t depth,
-              size_t maxDepth, const std::function<void(T&, OctreeBlock<T>&)>& creationFunc);
+              size_t maxDepth, const std::function<void(T&, OctreeBlock<T>&)>& creationFunc,
+              bool loose = false);
+  OctreeBlock(const OctreeBlock& other) = delete;
+  OctreeBlock& operator=(const OctreeBlock& other) = delete;
   ~OctreeBlock(); // = default
 
   /** Properties **/
@@ -51,6 +57,18 @@ public:
    */
   Vector3& maxPoint();
 
+  /**
+   * @brief Gets the minimum vector (in world space) of the volume used to test the block (equal to
+   * minPoint unless the block is loose).
+   */
+  [[nodiscard]] const Vector3& looseMinPoint() const;
+
+  /**
+   * @brief Gets the maximum vector (in world space) of the volume used to test the block (equal to
+   * maxPoint unless the block is loose).
+   */
+  [[nodiscard]] const Vector3& looseMaxPoint() const;
+
   /** Methods **/
 
   /**
@@ -111,7 +129,56 @@ public:
   static void _CreateBlocks(const Vector3& worldMin, const Vector3& worldMax,
                             std::vector<T>& entries, size_t maxBlockCapacity, size_t currentDepth,
                             size_t maxDepth, IOctreeContainer<T>& target,
-                            const std::function<void(T&, OctreeBlock<T>&)>& creationFunc);
+                            const std::function<void(T&, OctreeBlock<T>&)>& creationFunc,
+                            bool loose = false);
+
+  /**
+   * @brief Hidden
+   * Returns a new selection generation used to stamp the already selected entries (0 means that
+   * duplicates are allowed).
+   */
+  static size_t _NewSelectionGeneration();
+
+  /**
+   * @brief Hidden
+   * Stamps an entry as selected for the given generation.
+   * @returns false if the entry was already selected for this generation
+   */
+  static bool _MarkAsSelected(const T& entry, size_t generation);
+
+  /**
+   * @brief Hidden
+   * Frustum selection without duplicates for the entries stamped with the given generation.
+   */
+  void _select(const std::array<Plane, 6>& frustumPlanes, std::vector<T>& selection,
+               size_t generation);
+
+  /**
+   * @brief Hidden
+   * Sphere selection without duplicates for the entries stamped with the given generation.
+   */
+  void _intersects(const Vector3& sphereCenter, float sphereRadius, std::vector<T>& selection,
+                   size_t generation);
+
+  /**
+   * @brief Hidden
+   * Ray selection without duplicates for the entries stamped with the given generation.
+   */
+  void _intersectsRay(const Ray& ray, std::vector<T>& selection, size_t generation);
+
+  /**
+   * @brief Hidden
+   * Adds an element to the deepest loose block able to contain it.
+   * @returns false if the center of the element is not in this block or if the element does not
+   * fit in its loose bounds
+   */
+  bool _addLooseEntry(T& entry, std::unordered_map<T, OctreeBlock<T>*>& entryBlocks);
+
+  /**
+   * @brief Hidden
+   * Returns the child block containing the given point.
+   */
+  OctreeBlock<T>* _getChildBlock(const Vector3& point);
 
 public:
   /**
@@ -119,12 +186,20 @@ public:
    */
   std::vector<T> entries;
 
+private:
+  template <typename Predicate>
+  void _collect(const Predicate& intersects, std::vector<T>& selection, size_t generation);
+  void _createLooseInnerBlocks(std::unordered_map<T, OctreeBlock<T>*>& entryBlocks);
+
 private:
   size_t _depth;
   size_t _maxDepth;
   size_t _capacity;
   Vector3 _minPoint;
   Vector3 _maxPoint;
+  Vector3 _looseMinPoint;
+  Vector3 _looseMaxPoint;
+  bool _loose;
   std::array<Vector3, 8> _boundingVectors;
   std::function<void(T&, OctreeBlock<T>&)> _creationFunc;
 
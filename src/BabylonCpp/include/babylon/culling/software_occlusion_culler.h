@@ -0,0 +1,184 @@
+#ifndef BABYLON_CULLING_SOFTWARE_OCCLUSION_CULLER_H
+#define BABYLON_CULLING_SOFTWARE_OCCLUSION_CULLER_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include <babylon/babylon_api.h>
+#include <babylon/babylon_common.h>
+
+namespace BABYLON {
+
+class AbstractMesh;
+class Matrix;
+class Vector3;
+
+/**
+ * @brief CPU occlusion culling against a low resolution depth buffer.
+ *
+ * Every frame the designated occluder meshes are rasterized on the CPU into a small tiled depth
+ * buffer (8x8 pixels tiles, SSE when available) from which a hierarchical depth is built (the
+ * farthest depth of each tile). The screen space bounds of the candidate bounding boxes are then
+ * tested against it: a mesh is occluded when all the pixels covered by its bounding box already
+ * contain a closer occluder. The tiles are tested first, the pixels are only read for the tiles
+ * that are not fully in front of the box.
+ *
+ * Unlike occlusion queries there is no GPU round trip, so the result is available in the same
+ * frame and the occluded meshes never reach the material or draw stages. The test is conservative
+ * for the bounding boxes: boxes crossing the near plane or outside of the screen are never
+ * reported as occluded. Occluders should be simple, closed and opaque meshes (walls, buildings,
+ * terrain chunks...).
+ * @see Scene::enableSoftwareOcclusionCulling
+ */
+class BABYLON_SHARED_EXPORT SoftwareOcclusionCuller {
+
+public:
+  /**
+   * Size in pixels of the side of a depth buffer tile
+   */
+  static constexpr size_t TileSize = 8;
+
+public:
+  /**
+   * @brief Creates a new software occlusion culler.
+   * @param width defines the width of the depth buffer (rounded up to a multiple of the tile size)
+   * @param height defines the height of the depth buffer (rounded up to a multiple of the tile
+   * size)
+   */
+  SoftwareOcclusionCuller(size_t width = 256, size_t height = 128);
+  SoftwareOcclusionCuller(const SoftwareOcclusionCuller& other) = delete;
+  SoftwareOcclusionCuller& operator=(const SoftwareOcclusionCuller& other) = delete;
+  ~SoftwareOcclusionCuller(); // = default
+
+  /**
+   * @brief Adds a mesh to the occluders. Its positions and indices are copied, re-add the mesh if
+   * its geometry changes.
+   * @param mesh defines the occluder mesh
+   */
+  void addOccluder(AbstractMesh* mesh);
+
+  /**
+   * @brief Removes a mesh from the occluders.
+   * @param mesh defines the occluder mesh
+   */
+  void removeOccluder(AbstractMesh* mesh);
+
+  /**
+   * @brief Returns true if the mesh is an occluder.
+   */
+  [[nodiscard]] bool isOccluder(AbstractMesh* mesh) const;
+
+  /**
+   * @brief Returns the number of occluders.
+   */
+  [[nodiscard]] size_t occluderCount() const;
+
+  /**
+   * @brief Clears the depth buffer and rasterizes the enabled occluders.
+   * @param viewProjection defines the view projection matrix of the camera
+   * @param reverseDepth defines if the projection matrix uses a reversed depth range
+   */
+  void render(const Matrix& viewProjection, bool reverseDepth = false);
+
+  /**
+   * @brief Clears the depth buffer.
+   * @param viewProjection defines the view projection matrix used by the next rasterizations and
+   * tests
+   * @param reverseDepth defines if the projection matrix uses a reversed depth range
+   */
+  void clear(const Matrix& viewProjection, bool reverseDepth = false);
+
+  /**
+   * @brief Rasterizes a list of triangles into the depth buffer.
+   * @param positions defines the local space positions (x, y, z)
+   * @param indices defines the triangle indices
+   * @param world defines the world matrix of the triangles
+   */
+  void rasterizeTriangles(const Float32Array& positions, const IndicesArray& indices,
+                          const Matrix& world);
+
+  /**
+   * @brief Updates the hierarchical depth, to call once all the occluders are rasterized.
+   */
+  void updateHierarchicalDepth();
+
+  /**
+   * @brief Tests a world space axis aligned bounding box against the depth buffer.
+   * @param minimumWorld defines the minimum of the box
+   * @param maximumWorld defines the maximum of the box
+   * @returns true if the box is fully hidden by the occluders
+   */
+  [[nodiscard]] bool isOccluded(const Vector3& minimumWorld, const Vector3& maximumWorld) const;
+
+  /**
+   * @brief Tests the bounding box of a mesh against the depth buffer. Occluders are never
+   * occluded.
+   * @param mesh defines the mesh to test
+   * @returns true if the mesh is fully hidden by the occluders
+   */
+  bool isOccluded(AbstractMesh* mesh);
+
+  /**
+   * @brief Returns the width of the depth buffer.
+   */
+  [[nodiscard]] size_t width() const;
+
+  /**
+   * @brief Returns the height of the depth buffer.
+   */
+  [[nodiscard]] size_t height() const;
+
+  /**
+   * @brief Returns the depth stored for a pixel (the maximum float value if nothing was drawn).
+   */
+  [[nodiscard]] float depthAt(size_t x, size_t y) const;
+
+  /**
+   * @brief Returns the number of triangles rasterized by the last render.
+   */
+  [[nodiscard]] size_t rasterizedTriangleCount() const;
+
+  /**
+   * @brief Returns the number of meshes reported as occluded since the last render.
+   */
+  [[nodiscard]] size_t occludedMeshCount() const;
+
+  /**
+   * @brief Gets or sets a boolean indicating that the scalar rasterizer should be used even if
+   * SIMD is available.
+   */
+  bool forceScalar;
+
+private:
+  struct Occluder {
+    Float32Array positions;
+    IndicesArray indices;
+  }; // end of struct Occluder
+
+  [[nodiscard]] size_t _pixelIndex(size_t x, size_t y) const;
+  void _rasterizeTriangle(const float* v0, const float* v1, const float* v2);
+
+private:
+  size_t _width;
+  size_t _height;
+  size_t _tilesX;
+  size_t _tilesY;
+  // Depth buffer stored tile by tile, each tile row by row
+  std::vector<float> _depth;
+  // Farthest depth of each tile
+  std::vector<float> _tileMaxDepth;
+  std::array<float, 16> _viewProjection;
+  float _depthSign;
+  std::unordered_map<AbstractMesh*, Occluder> _occluders;
+  std::vector<float> _clipSpacePositions;
+  size_t _rasterizedTriangleCount;
+  size_t _occludedMeshCount;
+
+}; // end of class SoftwareOcclusionCuller
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_CULLING_SOFTWARE_OCCLUSION_CULLER_H
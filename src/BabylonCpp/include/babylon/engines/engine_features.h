@@ -46,6 +46,12 @@ struct BABYLON_SHARED_EXPORT EngineFeatures {
    */
   bool checkUbosContentBeforeUpload;
 
+  /**
+   * Indicates that the ubos are sub-allocated in per frame ring buffers and bound by range
+   * instead of owning a GPU buffer each
+   */
+  bool uniformBufferRing;
+
   /** Indicates that the Cascaded Shadow Map technic is supported */
   bool supportCSM;
 
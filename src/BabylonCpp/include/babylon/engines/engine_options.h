@@ -2,6 +2,7 @@
 #define BABYLON_ENGINES_ENGINE_OPTIONS_H
 
 #include <optional>
+#include <string>
 
 #include <babylon/babylon_api.h>
 
@@ -89,6 +90,18 @@ struct BABYLON_SHARED_EXPORT EngineOptions {
    * Defines whether to adapt to the device's viewport characteristics (default: false)
    */
   bool adaptToDeviceRatio = false;
+
+  /**
+   * Defines the directory of the on-disk program binary cache, linked shader programs are stored
+   * there and reloaded on the next runs instead of being compiled again (default: empty, disabled)
+   */
+  std::string programBinaryCachePath = "";
+
+  /**
+   * Defines the maximum size in bytes of the program binary cache, the least recently used
+   * programs are evicted above it (default: 64MB)
+   */
+  size_t programBinaryCacheMaxSize = 64 * 1024 * 1024;
 }; // end of struct EngineOptions
 
 } // end of namespace BABYLON
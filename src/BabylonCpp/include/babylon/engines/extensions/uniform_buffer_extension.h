@@ -65,6 +65,16 @@ public:
   void bindUniformBufferBase(const WebGLDataBufferPtr& buffer, unsigned int location,
                              const std::string& name);
 
+  /**
+   * @brief Bind a range of a buffer to the current webGL context at a given location.
+   * @param buffer defines the buffer to bind
+   * @param location defines the index where to bind the buffer
+   * @param byteOffset defines the offset in bytes of the range
+   * @param byteLength defines the size in bytes of the range
+   */
+  void bindUniformBufferRange(const WebGLDataBufferPtr& buffer, unsigned int location,
+                              size_t byteOffset, size_t byteLength);
+
   /**
    * @brief Bind a specific block at a given index in a specific shader program.
    * @param pipelineContext defines the pipeline context to use
@@ -285,6 +285,54 @@ public:
    */
   virtual void setDirectColor4(const std::string& uniformName, const Color4& color4) = 0;
 
+  /**
+   * @brief Sets an integer value on a uniform variable.
+   * @param uniformHandle Handle of the variable, as returned by Effect::getUniformHandle.
+   * @param value Value to be set.
+   */
+  virtual void setInt(int uniformHandle, int value) = 0;
+
+  /**
+   * @brief Sets matrix on a uniform variable.
+   * @param uniformHandle Handle of the variable, as returned by Effect::getUniformHandle.
+   * @param matrix matrix to be set.
+   */
+  virtual void setMatrix(int uniformHandle, const Matrix& matrix) = 0;
+
+  /**
+   * @brief Sets a float on a uniform variable.
+   * @param uniformHandle Handle of the variable, as returned by Effect::getUniformHandle.
+   * @param value value to be set.
+   */
+  virtual void setFloat(int uniformHandle, float value) = 0;
+
+  /**
+   * @brief Sets a float2 on a uniform variable.
+   * @param uniformHandle Handle of the variable, as returned by Effect::getUniformHandle.
+   * @param x First float in float2.
+   * @param y Second float in float2.
+   */
+  virtual void setFloat2(int uniformHandle, float x, float y) = 0;
+
+  /**
+   * @brief Sets a float3 on a uniform variable.
+   * @param uniformHandle Handle of the variable, as returned by Effect::getUniformHandle.
+   * @param x First float in float3.
+   * @param y Second float in float3.
+   * @param z Third float in float3.
+   */
+  virtual void setFloat3(int uniformHandle, float x, float y, float z) = 0;
+
+  /**
+   * @brief Sets a float4 on a uniform variable.
+   * @param uniformHandle Handle of the variable, as returned by Effect::getUniformHandle.
+   * @param x First float in float4.
+   * @param y Second float in float4.
+   * @param z Third float in float4.
+   * @param w Fourth float in float4.
+   */
+  virtual void setFloat4(int uniformHandle, float x, float y, float z, float w) = 0;
+
 public:
   /** @hidden */
   std::string _name;
@@ -203,6 +203,13 @@ public:
    */
   void _markSyncedWithParent();
 
+  /**
+   * @brief Hidden
+   * Returns true if the world matrix of the parent did not change since the last call to
+   * _markSyncedWithParent (the ancestors of the parent are not checked).
+   */
+  [[nodiscard]] bool _isSyncedWithParent() const;
+
   /**
    * @brief Hidden
    */
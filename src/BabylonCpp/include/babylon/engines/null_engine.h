@@ -255,6 +255,14 @@ public:
    */
   bool setMatrices(const WebGLUniformLocationPtr& uniform, const Float32Array& matrices) override;
 
+  /**
+   * @brief Set the value of an uniform to a matrix without copying it to an intermediate array.
+   * @param uniform defines the webGL uniform location where to store the value
+   * @param matrix defines the matrix to store
+   * @returns true if the value was set
+   */
+  bool setMatrix(const WebGLUniformLocationPtr& uniform, const Matrix& matrix) override;
+
   /**
    * @brief Set the value of an uniform to a matrix (3x3).
    * @param uniform defines the webGL uniform location where to store the value
@@ -526,6 +534,39 @@ public:
   void updateDynamicVertexBuffer(const WebGLDataBufferPtr& vertexBuffer, const Float32Array& data,
                                  int byteOffset = -1, int byteLength = -1) override;
 
+  /**
+   * @brief Bind a buffer to the current webGL context at a given location.
+   * @param buffer defines the buffer to bind
+   * @param location defines the index where to bind the buffer
+   * @param name Name of the uniform variable to bind
+   */
+  void bindUniformBufferBase(const WebGLDataBufferPtr& buffer, unsigned int location,
+                             const std::string& name = "") override;
+
+  /**
+   * @brief Create an uniform buffer.
+   * @param elements defines the content of the uniform buffer
+   * @returns the webGL uniform buffer
+   */
+  WebGLDataBufferPtr createUniformBuffer(const Float32Array& elements) override;
+
+  /**
+   * @brief Create a dynamic uniform buffer.
+   * @param elements defines the content of the uniform buffer
+   * @returns the webGL uniform buffer
+   */
+  WebGLDataBufferPtr createDynamicUniformBuffer(const Float32Array& elements) override;
+
+  /**
+   * @brief Update an existing uniform buffer.
+   * @param uniformBuffer defines the target uniform buffer
+   * @param elements defines the content to update
+   * @param offset defines the offset in the uniform buffer where update should start
+   * @param count defines the size of the data to update
+   */
+  void updateUniformBuffer(const WebGLDataBufferPtr& uniformBuffer, const Float32Array& elements,
+                           int offset = -1, int count = -1) override;
+
   /**
    * @brief Hidden
    */
@@ -591,7 +632,7 @@ protected:
    */
   WebGLTexturePtr _createTexture() override;
 
-  void _deleteBuffer(GL::IGLBuffer* buffer);
+  void _deleteBuffer(const WebGLDataBufferPtr& buffer) override;
 
 private:
   NullEngineOptions _options;
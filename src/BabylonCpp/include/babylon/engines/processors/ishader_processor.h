@@ -12,7 +12,7 @@
 
 namespace BABYLON {
 
-class ThinEngine;
+struct ShaderProcessorParameters;
 FWD_STRUCT_SPTR(ShaderProcessingContext)
 
 /**
@@ -46,7 +46,7 @@ struct BABYLON_SHARED_EXPORT IShaderProcessor {
     preProcessor = nullptr;
   std::function<std::string(const std::string& code, const std::vector<std::string>& defines,
                             bool isFragment, const ShaderProcessingContextPtr& processingContext,
-                            ThinEngine* engine)>
+                            const ShaderProcessorParameters& parameters)>
     postProcessor = nullptr;
   std::function<void(const ShaderProcessingContextPtr& processingContext)> initializeShaders
     = nullptr;
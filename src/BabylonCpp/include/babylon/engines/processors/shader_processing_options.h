@@ -25,6 +25,15 @@ FWD_STRUCT_SPTR(ShaderProcessingContext)
 struct BABYLON_SHARED_EXPORT ShaderProcessingContext {
 }; // end of struct ShaderProcessingContext
 
+/**
+ * @brief Hidden
+ * Engine state read by the post processors. It is captured on the engine thread, the shaders can
+ * then be processed on any thread.
+ */
+struct BABYLON_SHARED_EXPORT ShaderProcessorParameters {
+  bool drawBuffersExtensionDisabled{false};
+}; // end of struct ShaderProcessorParameters
+
 /**
  * @brief Hidden
  */
@@ -35,12 +44,14 @@ struct BABYLON_SHARED_EXPORT ProcessingOptions {
   bool shouldUseHighPrecisionShader{false};
   bool supportsUniformBuffers{false};
   std::string shadersRepository{""};
-  std::unordered_map<std::string, std::string> includesShadersStore{};
+  // Immutable snapshot of the includes store (Effect::IncludesShadersStore), not copied per effect
+  std::shared_ptr<const std::unordered_map<std::string, std::string>> includesShadersStore{nullptr};
   IShaderProcessorPtr processor{nullptr};
   std::string version{""};
   std::string platformName{""};
   std::optional<bool> lookForClosingBracketForUniformBuffer{std::nullopt};
   ShaderProcessingContextPtr processingContext{nullptr};
+  ShaderProcessorParameters processorParameters{};
 }; // end of struct ProcessingOptions
 
 } // end of namespace BABYLON
@@ -18,7 +18,6 @@ class ArrayBufferView;
 struct ProcessingOptions;
 class ProgressEvent;
 class ShaderCodeCursor;
-class ThinEngine;
 FWD_STRUCT_SPTR(ShaderCodeConditionNode)
 FWD_STRUCT_SPTR(ShaderCodeNode)
 FWD_STRUCT_SPTR(ShaderCodeTestNode)
@@ -37,8 +36,7 @@ public:
 public:
   static void Initialize(ProcessingOptions& options);
   static void Process(const std::string& sourceCode, ProcessingOptions& options,
-                      const std::function<void(const std::string& migratedCode)>& callback,
-                      ThinEngine* engine);
+                      const std::function<void(const std::string& migratedCode)>& callback);
   static std::unordered_map<std::string, std::string> Finalize(const std::string& vertexCode,
                                                                const std::string& fragmentCode,
                                                                ProcessingOptions& options);
@@ -63,6 +61,9 @@ public:
     const std::function<void(const std::string& message, const std::string& exception)>& onError
     = nullptr);
 
+private:
+  enum class Keyword { None, Ifdef, Else, Elif, Endif, Ifndef, If };
+
 private:
   static std::string _ProcessPrecision(std::string source, const ProcessingOptions& options);
   static ShaderDefineExpressionPtr _ExtractOperation(const std::string& expression);
@@ -71,6 +72,7 @@ private:
   static void _MoveCursorWithinIf(ShaderCodeCursor& cursor,
                                   const ShaderCodeConditionNodePtr& rootNode,
                                   ShaderCodeNodePtr ifNode);
+  static Keyword _FindKeyword(const std::string& line);
   static bool _MoveCursor(ShaderCodeCursor& cursor, const ShaderCodeNodePtr& rootNode);
   static std::vector<std::string>
   _removeCommentsAndEmptyLines(const std::vector<std::string>& sourceCodeLines);
@@ -81,9 +83,29 @@ private:
   static std::unordered_map<std::string, std::string>
   _PreparePreProcessors(const ProcessingOptions& options);
   static std::string _ProcessShaderConversion(const std::string& sourceCode,
-                                              ProcessingOptions& options, ThinEngine* engine);
+                                              ProcessingOptions& options);
   static void _ProcessIncludes(const std::string& sourceCode, ProcessingOptions& options,
                                const std::function<void(const std::string& data)>& callback);
+  /**
+   * @brief Hidden
+   * Expands the includes and the nested includes of a shader code in a single pass.
+   * @param missingInclude receives the name of the first include missing from the store, the
+   * returned code is then empty
+   */
+  static std::string _ExpandIncludes(const std::string& sourceCode,
+                                     const ProcessingOptions& options,
+                                     std::string& missingInclude);
+  static size_t _FindOnLine(const std::string& code, char character, size_t from);
+  /**
+   * @brief Hidden
+   * Substitutes the parameters and the indices of an include, memoized per (include name,
+   * parameters, indices).
+   */
+  static std::string _SubstituteInclude(const std::string& includeFile,
+                                        const std::string& includeSource,
+                                        const std::string& parameters, bool hasIndices,
+                                        bool isRange, const std::string& indices, int minIndex,
+                                        int maxIndex);
 
 }; // end of class ShaderProcessor
 
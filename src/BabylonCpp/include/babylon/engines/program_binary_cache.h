@@ -0,0 +1,152 @@
+#ifndef BABYLON_ENGINES_PROGRAM_BINARY_CACHE_H
+#define BABYLON_ENGINES_PROGRAM_BINARY_CACHE_H
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <babylon/babylon_api.h>
+#include <babylon/babylon_common.h>
+
+namespace BABYLON {
+
+/**
+ * @brief On-disk cache of linked shader program binaries.
+ *
+ * Each entry is stored in its own file named after the entry key, a hash of the final vertex
+ * and fragment sources and of the GL implementation identity (vendor, renderer and version). An
+ * index file keeps the size and the last use of the entries so that the least recently used ones
+ * are evicted when the cache exceeds its size limit.
+ */
+class BABYLON_SHARED_EXPORT ProgramBinaryCache {
+
+public:
+  /**
+   * @brief Creates a cache stored in the given directory, the directory is created if needed.
+   * @param directory defines the directory holding the cached binaries
+   * @param maxSize defines the maximum size in bytes of the cached binaries
+   */
+  ProgramBinaryCache(const std::string& directory, size_t maxSize = 64 * 1024 * 1024);
+  ~ProgramBinaryCache(); // = default
+
+  /**
+   * @brief Computes the key of a program.
+   * @param vertexSource defines the final vertex shader source
+   * @param fragmentSource defines the final fragment shader source
+   * @param glIdentity defines the GL vendor, renderer and version
+   * @param transformFeedbackVaryings defines the varyings captured by transform feedback
+   * @returns the program key
+   */
+  static std::string ComputeKey(const std::string& vertexSource,
+                                const std::string& fragmentSource, const std::string& glIdentity,
+                                const std::vector<std::string>& transformFeedbackVaryings = {});
+
+  /**
+   * @brief Gets the directory holding the cached binaries.
+   */
+  [[nodiscard]] const std::string& directory() const
+  {
+    return _directory;
+  }
+
+  /**
+   * @brief Gets the maximum size in bytes of the cached binaries.
+   */
+  [[nodiscard]] size_t maxSize() const
+  {
+    return _maxSize;
+  }
+
+  /**
+   * @brief Gets the current size in bytes of the cached binaries.
+   */
+  [[nodiscard]] size_t size() const
+  {
+    return _size;
+  }
+
+  /**
+   * @brief Gets the number of cached binaries.
+   */
+  [[nodiscard]] size_t count() const
+  {
+    return _entries.size();
+  }
+
+  /**
+   * @brief Gets the number of programs loaded from the cache.
+   */
+  [[nodiscard]] size_t hits() const
+  {
+    return _hits;
+  }
+
+  /**
+   * @brief Gets the number of programs not found in the cache.
+   */
+  [[nodiscard]] size_t misses() const
+  {
+    return _misses;
+  }
+
+  /**
+   * @brief Loads a cached program binary.
+   * @param key defines the program key
+   * @param binaryFormat receives the format of the binary
+   * @param binary receives the program binary
+   * @returns true if the binary was found
+   */
+  bool load(const std::string& key, unsigned int& binaryFormat, ArrayBuffer& binary);
+
+  /**
+   * @brief Stores a program binary, evicting the least recently used binaries if the cache
+   * exceeds its size limit. The index file is only written by flush.
+   * @param key defines the program key
+   * @param binaryFormat defines the format of the binary
+   * @param binary defines the program binary
+   * @returns true if the binary was stored
+   */
+  bool store(const std::string& key, unsigned int binaryFormat, const ArrayBuffer& binary);
+
+  /**
+   * @brief Removes a cached binary, used when the driver rejects it.
+   * @param key defines the program key
+   */
+  void remove(const std::string& key);
+
+  /**
+   * @brief Removes all the cached binaries.
+   */
+  void clear();
+
+  /**
+   * @brief Writes the index file if the entries changed since the last write. Called when the
+   * cache is destroyed and when the engine is disposed.
+   */
+  void flush();
+
+private:
+  struct Entry {
+    size_t size       = 0;
+    uint64_t lastUsed = 0;
+  }; // end of struct Entry
+
+  std::string _entryPath(const std::string& key) const;
+  void _readIndex();
+  void _evict(size_t requiredSize);
+
+private:
+  std::string _directory;
+  size_t _maxSize;
+  size_t _size;
+  uint64_t _useCounter;
+  size_t _hits;
+  size_t _misses;
+  bool _indexIsDirty;
+  std::unordered_map<std::string, Entry> _entries;
+
+}; // end of class ProgramBinaryCache
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_ENGINES_PROGRAM_BINARY_CACHE_H
@@ -13,6 +13,7 @@
 #include <babylon/culling/octrees/octree.h>
 #include <babylon/engines/abstract_scene.h>
 #include <babylon/engines/scene_options.h>
+#include <babylon/engines/shader_warm_up.h>
 #include <babylon/engines/stage.h>
 #include <babylon/events/pointer_event_types.h>
 #include <babylon/events/pointer_info.h>
@@ -32,6 +33,7 @@ using json = nlohmann::json;
 namespace BABYLON {
 
 struct AnimationPropertiesOverride;
+class BoundingVolumeStore;
 class ClickInfo;
 class Collider;
 class DebugLayer;
@@ -44,11 +46,15 @@ struct IPhysicsEnginePlugin;
 struct IRenderingManagerAutoClearSetup;
 class KeyboardInfo;
 class KeyboardInfoPre;
+class LightSpatialIndex;
 class PostProcessManager;
 class PostProcessRenderPipelineManager;
 struct RenderingGroupInfo;
 class RenderingManager;
 class RuntimeAnimation;
+class SnapshotRenderingStream;
+class SoftwareOcclusionCuller;
+class TransformSystem;
 class UniformBuffer;
 FWD_CLASS_SPTR(Animatable)
 FWD_CLASS_SPTR(Bone)
@@ -468,6 +474,16 @@ public:
    */
   void _checkIsReady();
 
+  /**
+   * @brief Prepares up front the effects of every submesh, material, instancing and shadow
+   * generator combination of the scene, to avoid compiling them when the meshes are first drawn.
+   * The effects are prepared immediately or, with a frame time budget, spread across the next
+   * frames. A new warm-up replaces the previous one.
+   * @param options defines the options of the warm-up
+   * @returns the warm-up, reporting the progress and the shader compilation time
+   */
+  ShaderWarmUp* warmUpShaders(const IShaderWarmUpOptions& options = IShaderWarmUpOptions{});
+
   /** Animations **/
 
   /**
@@ -1260,6 +1276,86 @@ public:
    */
   IActiveMeshCandidateProvider* getActiveMeshCandidateProvider() const;
 
+  /**
+   * @brief Defines the spatial index used to assign the lights to the meshes. When set, the light
+   * sources of the meshes are the ranked lights reaching them, resynchronized incrementally.
+   * @param index defines the index to use (nullptr to iterate all the lights)
+   */
+  void setLightSpatialIndex(LightSpatialIndex* index);
+
+  /**
+   * @brief Gets the spatial index used to assign the lights to the meshes.
+   * @returns the light spatial index or nullptr if none
+   */
+  [[nodiscard]] LightSpatialIndex* getLightSpatialIndex() const;
+
+  /**
+   * @brief Enables the bounding volume store of the scene. The world space bounding volumes of all
+   * the meshes are then mirrored in a structure of arrays store and frustum culled in a single SIMD
+   * pass when evaluating the active meshes.
+   * @returns the bounding volume store
+   */
+  BoundingVolumeStore* enableBoundingVolumeStore();
+
+  /**
+   * @brief Disables the bounding volume store of the scene.
+   */
+  void disableBoundingVolumeStore();
+
+  /**
+   * @brief Gets the bounding volume store of the scene.
+   * @returns the bounding volume store or nullptr if not enabled
+   */
+  [[nodiscard]] BoundingVolumeStore* getBoundingVolumeStore() const;
+
+  /**
+   * @brief Enables the transform system of the scene. The world matrices of all the transform
+   * nodes are then updated in a single pass over the flattened hierarchy at the beginning of the
+   * active meshes evaluation, only recomputing the dirty sub trees.
+   * @returns the transform system
+   */
+  TransformSystem* enableTransformSystem();
+
+  /**
+   * @brief Disables the transform system of the scene.
+   */
+  void disableTransformSystem();
+
+  /**
+   * @brief Gets the transform system of the scene.
+   * @returns the transform system or nullptr if not enabled
+   */
+  [[nodiscard]] TransformSystem* getTransformSystem() const;
+
+  /**
+   * @brief Enables the CPU occlusion culling of the scene. The occluders registered on the culler
+   * are rasterized into a low resolution depth buffer after the frustum culling and the meshes
+   * hidden behind them are discarded before being activated.
+   * @param width defines the width of the depth buffer
+   * @param height defines the height of the depth buffer
+   * @returns the software occlusion culler
+   */
+  SoftwareOcclusionCuller* enableSoftwareOcclusionCulling(size_t width = 256, size_t height = 128);
+
+  /**
+   * @brief Disables the CPU occlusion culling of the scene.
+   */
+  void disableSoftwareOcclusionCulling();
+
+  /**
+   * @brief Gets the software occlusion culler of the scene.
+   * @returns the software occlusion culler or nullptr if not enabled
+   */
+  [[nodiscard]] SoftwareOcclusionCuller* getSoftwareOcclusionCuller() const;
+
+  /**
+   * @brief Gets the draw stream recorded for a camera when the engine snapshot rendering mode is
+   * enabled.
+   * @param camera defines the camera
+   * @returns the snapshot rendering stream or nullptr if none was recorded for the camera
+   */
+  [[nodiscard]] SnapshotRenderingStream* getSnapshotRenderingStream(Camera* camera) const;
+
   /**
    * @brief Use this function to stop evaluating active meshes. The current list will be keep alive
    * between frames.
@@ -1881,7 +1977,10 @@ private:
   void _processLateAnimationBindings();
   GeometryPtr _getGeometryByUniqueID(size_t uniqueId);
   void _evaluateSubMesh(SubMesh* subMesh, AbstractMesh* mesh, AbstractMesh* initialMesh);
+  bool _cullMeshlets(SubMesh* subMesh, AbstractMesh* mesh, AbstractMesh* initialMesh,
+                     const MaterialPtr& material);
   void _evaluateActiveMeshes();
+  void _evaluateActiveMeshCandidates(const std::vector<AbstractMesh*>& candidates);
   void _activeMesh(AbstractMesh* sourceMesh, AbstractMesh* mesh);
   void _renderForCamera(const CameraPtr& camera, const CameraPtr& rigParent = nullptr);
   void _bindFrameBuffer();
@@ -2625,6 +2724,12 @@ public:
    */
   Observable<AbstractMesh> onMeshRemovedObservable;
 
+  /**
+   * An event triggered when the bounding info of a mesh changed (world matrix update, geometry
+   * update or new bounding info), always raised on the thread evaluating the scene
+   */
+  Observable<AbstractMesh> onMeshBoundingInfoChangedObservable;
+
   /**
    * An event triggered when a skeleton is created
    */
@@ -2774,6 +2879,26 @@ public:
    */
   Property<Scene, bool> skipFrustumClipping;
 
+  /**
+   * Gets or sets a boolean indicating if the world matrices update and the frustum clipping of the
+   * active meshes selection should be split across the engine thread pool. Activation and dispatch
+   * to the rendering manager still happen on the calling thread, in the candidates order.
+   */
+  bool parallelActiveMeshesEvaluation;
+
+  /**
+   * Gets or sets the minimum number of active mesh candidates required before the parallel active
+   * meshes evaluation is used (default is 1024).
+   */
+  size_t parallelActiveMeshesEvaluationThreshold;
+
+  /**
+   * Gets or sets a boolean indicating if the opaque sub meshes sharing the same geometry, material
+   * and draw state should be rendered with a single instanced draw call. The meshes are grouped
+   * when dispatched to the rendering groups, no InstancedMesh has to be created.
+   */
+  bool automaticInstancing;
+
   /**
    * Gets a boolean indicating if all rendering must be done in point cloud
    */
@@ -3730,12 +3855,20 @@ private:
   bool _isDisposed;
   std::vector<AbstractMesh*> _activeMeshes;
   IActiveMeshCandidateProvider* _activeMeshCandidateProvider;
+  LightSpatialIndex* _lightSpatialIndex;
   bool _preventFreeActiveMeshesAndRenderingGroups;
   bool _skipEvaluateActiveMeshesCompletely;
   std::vector<MaterialPtr> _processedMaterials;
   std::vector<RenderTargetTexturePtr> _renderTargets;
   std::vector<SkeletonPtr> _activeSkeletons;
   std::vector<Mesh*> _softwareSkinnedMeshes;
+  std::vector<uint8_t> _activeMeshCandidatesStates;
+  std::unique_ptr<BoundingVolumeStore> _boundingVolumeStore;
+  std::vector<uint64_t> _boundingVolumesVisibility;
+  std::unique_ptr<TransformSystem> _transformSystem;
+  std::unique_ptr<SoftwareOcclusionCuller> _softwareOcclusionCuller;
+  std::unordered_map<Camera*, std::unique_ptr<SnapshotRenderingStream>> _snapshotRenderingStreams;
+  std::unique_ptr<ShaderWarmUp> _shaderWarmUp;
   std::unique_ptr<RenderingManager> _renderingManager;
   Matrix _transformMatrix;
   std::unique_ptr<UniformBuffer> _sceneUbo;
@@ -0,0 +1,180 @@
+#ifndef BABYLON_ENGINES_SHADER_WARM_UP_H
+#define BABYLON_ENGINES_SHADER_WARM_UP_H
+
+#include <deque>
+#include <functional>
+#include <memory>
+
+#include <babylon/babylon_api.h>
+#include <babylon/babylon_fwd.h>
+
+namespace BABYLON {
+
+class EngineInstrumentation;
+class Scene;
+class ShaderWarmUp;
+FWD_CLASS_SPTR(AbstractMesh)
+FWD_CLASS_SPTR(Effect)
+FWD_STRUCT_SPTR(IShadowGenerator)
+FWD_CLASS_SPTR(Material)
+FWD_CLASS_SPTR(SubMesh)
+
+/**
+ * @brief Options of the shader warm-up of a scene.
+ */
+struct BABYLON_SHARED_EXPORT IShaderWarmUpOptions {
+  /**
+   * Time in milliseconds spent each frame preparing the effects (0 prepares all the pending
+   * effects in the first frame)
+   */
+  float frameTimeBudget = 0.f;
+  /**
+   * Number of checks after which a combination which is still not ready is counted as failed,
+   * in case its effect never reports its state (0 waits indefinitely)
+   */
+  size_t maxAttempts = 600;
+  /**
+   * Defines if the effects of the shadow generators are prepared as well
+   */
+  bool shadowGenerators = true;
+  /**
+   * Callback called after each frame of the warm-up
+   */
+  std::function<void(const ShaderWarmUp& warmUp)> onProgress = nullptr;
+  /**
+   * Callback called when all the effects are prepared
+   */
+  std::function<void(const ShaderWarmUp& warmUp)> onCompleted = nullptr;
+}; // end of struct IShaderWarmUpOptions
+
+/**
+ * @brief Prepares up front the effects used to render the meshes of a scene.
+ *
+ * The warm-up enumerates the combinations rendered by the scene: every submesh of every mesh
+ * with its effective material, with hardware instancing when the mesh has instances, and with
+ * the shadow generators of the lights affecting the mesh. The light configuration and the
+ * skinning or morphing flags are the ones of the mesh, the material computes the same defines as
+ * when the submesh is rendered. The effects are created and compiled through the readiness
+ * checks of the materials and of the shadow generators, they are then found in the engine cache
+ * when the meshes are first drawn.
+ */
+class BABYLON_SHARED_EXPORT ShaderWarmUp {
+
+public:
+  /**
+   * @brief Enumerates the combinations to prepare.
+   * @param scene defines the scene to warm up
+   * @param options defines the options of the warm-up
+   */
+  ShaderWarmUp(Scene* scene, const IShaderWarmUpOptions& options = IShaderWarmUpOptions{});
+  ~ShaderWarmUp(); // = default
+
+  /**
+   * @brief Prepares the pending combinations within the frame time budget, called once per frame
+   * by the scene.
+   * @returns whether all the combinations are prepared
+   */
+  bool step();
+
+  /**
+   * @brief Gets whether all the combinations are prepared.
+   */
+  [[nodiscard]] bool isDone() const
+  {
+    return _pending.empty();
+  }
+
+  /**
+   * @brief Gets the number of combinations enumerated in the scene.
+   */
+  [[nodiscard]] size_t totalCount() const
+  {
+    return _totalCount;
+  }
+
+  /**
+   * @brief Gets the number of combinations whose effect is ready.
+   */
+  [[nodiscard]] size_t readyCount() const
+  {
+    return _readyCount;
+  }
+
+  /**
+   * @brief Gets the number of combinations whose effect failed to compile.
+   */
+  [[nodiscard]] size_t failedCount() const
+  {
+    return _failedCount;
+  }
+
+  /**
+   * @brief Gets the progress of the warm-up, between 0 and 1.
+   */
+  [[nodiscard]] float progress() const;
+
+  /**
+   * @brief Gets the number of shader programs compiled since the beginning of the warm-up.
+   */
+  [[nodiscard]] size_t compiledProgramCount() const;
+
+  /**
+   * @brief Gets the time in milliseconds spent compiling shader programs since the beginning of
+   * the warm-up, measured by EngineInstrumentation::shaderCompilationTimeCounter.
+   */
+  [[nodiscard]] size_t shaderCompilationTime() const;
+
+  /**
+   * @brief Gets the time in milliseconds spent in the warm-up steps.
+   */
+  [[nodiscard]] double elapsedTime() const
+  {
+    return _elapsedTime;
+  }
+
+  /**
+   * @brief Gets the instrumentation measuring the shader compilation time.
+   */
+  [[nodiscard]] EngineInstrumentation* instrumentation() const
+  {
+    return _instrumentation.get();
+  }
+
+private:
+  struct Combination {
+    AbstractMeshPtr mesh                = nullptr;
+    SubMeshPtr subMesh                  = nullptr;
+    MaterialPtr material                = nullptr;
+    IShadowGeneratorPtr shadowGenerator = nullptr;
+    bool useInstances                   = false;
+    bool isTransparent                  = false;
+    size_t attempts                     = 0;
+  }; // end of struct Combination
+
+  enum class State {
+    Pending,
+    Ready,
+    Failed,
+  }; // end of enum class State
+
+  void _enumerate();
+  static State _Prepare(const Combination& combination);
+  static EffectPtr _GetEffect(const Combination& combination);
+
+private:
+  Scene* _scene;
+  IShaderWarmUpOptions _options;
+  std::deque<Combination> _pending;
+  size_t _totalCount;
+  size_t _readyCount;
+  size_t _failedCount;
+  double _elapsedTime;
+  size_t _compiledProgramCount;
+  size_t _shaderCompilationTime;
+  std::unique_ptr<EngineInstrumentation> _instrumentation;
+
+}; // end of class ShaderWarmUp
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_ENGINES_SHADER_WARM_UP_H
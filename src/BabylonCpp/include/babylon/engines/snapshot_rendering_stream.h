@@ -0,0 +1,257 @@
+#ifndef BABYLON_ENGINES_SNAPSHOT_RENDERING_STREAM_H
+#define BABYLON_ENGINES_SNAPSHOT_RENDERING_STREAM_H
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <babylon/babylon_api.h>
+#include <babylon/babylon_common.h>
+#include <babylon/babylon_fwd.h>
+
+namespace BABYLON {
+
+namespace GL {
+class IGLUniformLocation;
+class IGLVertexArrayObject;
+} // end of namespace GL
+
+class AbstractMesh;
+class AlphaState;
+class Camera;
+class DepthCullingState;
+class ThinEngine;
+FWD_CLASS_SPTR(Effect)
+FWD_CLASS_SPTR(ThinTexture)
+FWD_CLASS_SPTR(VertexBuffer)
+FWD_CLASS_SPTR(WebGLDataBuffer)
+
+using WebGLUniformLocationPtr   = std::shared_ptr<GL::IGLUniformLocation>;
+using WebGLVertexArrayObjectPtr = std::shared_ptr<GL::IGLVertexArrayObject>;
+
+/**
+ * @brief Compact command stream of the effect binds, uniform and uniform buffer updates, vertex
+ * array binds, render states and draw calls issued by the engine while rendering a camera.
+ *
+ * The stream is recorded once by the engine (see ThinEngine::_snapshotRecorder) and replayed on
+ * the following frames through the engine GL wrappers, skipping the active meshes evaluation,
+ * the readiness checks and the sorting done by the scene. The commands are fixed size and index
+ * the objects and the payloads stored in pools, the GL objects are kept alive by the stream.
+ *
+ * The uniform buffers flagged as live (the scene uniform buffer holding the camera matrices) are
+ * not recorded, they are updated by the scene before each replay. Everything else is frozen:
+ * camera dependent per mesh data (billboards, LODs, depth sorted transparent meshes) keep the
+ * value they had when the stream was recorded.
+ * @see Scene::_renderForCamera
+ */
+class BABYLON_SHARED_EXPORT SnapshotRenderingStream {
+
+public:
+  enum class UniformType : uint8_t {
+    Int,
+    Int2,
+    Int3,
+    Int4,
+    IntArray,
+    IntArray2,
+    IntArray3,
+    IntArray4,
+    Float,
+    Float2,
+    Float3,
+    Float4,
+    Array,
+    Array2,
+    Array3,
+    Array4,
+    Matrices,
+    Matrix3x3,
+    Matrix2x2,
+  }; // end of enum class UniformType
+
+public:
+  /**
+   * @brief Creates an empty stream.
+   * @param camera defines the camera rendered by the stream
+   */
+  SnapshotRenderingStream(Camera* camera);
+  SnapshotRenderingStream(const SnapshotRenderingStream& other) = delete;
+  SnapshotRenderingStream& operator=(const SnapshotRenderingStream& other) = delete;
+  ~SnapshotRenderingStream(); // = default
+
+  /**
+   * @brief Returns whether the stream can be replayed for a camera.
+   * @param camera defines the camera to render
+   * @param generation defines the current engine snapshot generation
+   */
+  [[nodiscard]] bool isValidFor(Camera* camera, size_t generation) const;
+
+  /**
+   * @brief Returns whether the stream is fully recorded.
+   */
+  [[nodiscard]] bool isRecorded() const;
+
+  /**
+   * @brief Flags a buffer whose updates must not be recorded until the end of the recording.
+   * @param buffer defines the buffer updated outside of the stream
+   */
+  void addLiveBuffer(const WebGLDataBufferPtr& buffer);
+
+  /**
+   * @brief Starts recording the stream, clearing the previous content.
+   * @param generation defines the engine snapshot generation the stream is recorded for
+   */
+  void beginRecording(size_t generation);
+
+  /**
+   * @brief Ends recording the stream.
+   * @param meshes defines the meshes rendered by the stream, their world matrices are tracked to
+   * detect moving meshes in standard mode
+   */
+  void endRecording(const std::vector<AbstractMesh*>& meshes);
+
+  /**
+   * @brief Returns whether one of the meshes rendered by the stream moved since the recording.
+   * The world matrices of the meshes are computed by this call.
+   */
+  bool hasMovedMeshes() const;
+
+  /**
+   * @brief Replays the recorded commands.
+   * @param engine defines the engine used to issue the commands
+   */
+  void replay(ThinEngine& engine) const;
+
+  /**
+   * @brief Returns the number of recorded commands.
+   */
+  [[nodiscard]] size_t commandCount() const;
+
+  /**
+   * @brief Returns the number of recorded draw calls.
+   */
+  [[nodiscard]] size_t drawCount() const;
+
+  /** Recording, called by the engine **/
+
+  /** @hidden */
+  void recordEnableEffect(const EffectPtr& effect);
+  /** @hidden */
+  void recordUniform(UniformType type, const WebGLUniformLocationPtr& uniform, int x,
+                     int y = 0, int z = 0, int w = 0);
+  /** @hidden */
+  void recordUniform(UniformType type, const WebGLUniformLocationPtr& uniform, float x,
+                     float y = 0.f, float z = 0.f, float w = 0.f);
+  /** @hidden */
+  void recordUniform(UniformType type, const WebGLUniformLocationPtr& uniform,
+                     const Int32Array& array);
+  /** @hidden */
+  void recordUniform(UniformType type, const WebGLUniformLocationPtr& uniform,
+                     const Float32Array& array);
+  /** @hidden */
+  void recordTexture(int channel, const WebGLUniformLocationPtr& uniform,
+                     const ThinTexturePtr& texture);
+  /** @hidden */
+  void recordTextureArray(int channel, const WebGLUniformLocationPtr& uniform,
+                          const std::vector<ThinTexturePtr>& textures);
+  /** @hidden */
+  void recordBindVertexArray(const WebGLVertexArrayObjectPtr& vertexArrayObject,
+                             const WebGLDataBufferPtr& indexBuffer);
+  /** @hidden */
+  void recordBindBuffers(const std::unordered_map<std::string, VertexBufferPtr>& vertexBuffers,
+                         const WebGLDataBufferPtr& indexBuffer, const EffectPtr& effect,
+                         const std::unordered_map<std::string, VertexBufferPtr>& overrides);
+  /** @hidden */
+  void recordUpdateUniformBuffer(const WebGLDataBufferPtr& buffer, const Float32Array& elements,
+                                 int offset, int count);
+  /** @hidden */
+  void recordBindUniformBufferBase(const WebGLDataBufferPtr& buffer, unsigned int location,
+                                   const std::string& name);
+  /** @hidden */
+  void recordUpdateDynamicVertexBuffer(const WebGLDataBufferPtr& buffer, const Float32Array& data,
+                                       int byteOffset, int byteLength);
+  /** @hidden */
+  void recordDraw(bool indexed, unsigned int fillMode, int start, int count, int instancesCount,
+                  const DepthCullingState& depthCullingState, const AlphaState& alphaState,
+                  bool colorWrite, bool statesDirty);
+
+private:
+  enum class Op : uint8_t {
+    EnableEffect,
+    Uniform,
+    Texture,
+    TextureArray,
+    BindVertexArray,
+    BindBuffers,
+    UpdateUniformBuffer,
+    BindUniformBufferBase,
+    UpdateDynamicVertexBuffer,
+    States,
+    DrawElements,
+    DrawArrays,
+  }; // end of enum class Op
+
+  // Fixed size command, "object" and "payload" index the pools
+  struct Command {
+    Op op;
+    UniformType uniformType;
+    uint32_t object;
+    uint32_t payload;
+    int32_t args[4];
+  }; // end of struct Command
+
+  struct VertexBuffersBinding {
+    std::unordered_map<std::string, VertexBufferPtr> vertexBuffers;
+    std::unordered_map<std::string, VertexBufferPtr> overrides;
+    EffectPtr effect;
+  }; // end of struct VertexBuffersBinding
+
+  struct States {
+    std::unique_ptr<DepthCullingState> depthCulling;
+    std::unique_ptr<AlphaState> alpha;
+    bool colorWrite;
+  }; // end of struct States
+
+  template <typename T>
+  static uint32_t _indexOf(std::vector<T>& pool, std::unordered_map<const void*, uint32_t>& indices,
+                           const T& object);
+  Command& _push(Op op, uint32_t object = 0, uint32_t payload = 0);
+  uint32_t _uniformIndex(const WebGLUniformLocationPtr& uniform);
+  uint32_t _bufferIndex(const WebGLDataBufferPtr& buffer);
+  [[nodiscard]] bool _isLiveBuffer(const WebGLDataBufferPtr& buffer) const;
+
+private:
+  Camera* _camera;
+  size_t _generation;
+  bool _recorded;
+  size_t _drawCount;
+  std::vector<Command> _commands;
+  // Pools
+  std::vector<EffectPtr> _effects;
+  std::vector<WebGLUniformLocationPtr> _uniforms;
+  std::vector<ThinTexturePtr> _textures;
+  std::vector<std::vector<ThinTexturePtr>> _textureArrays;
+  std::vector<WebGLVertexArrayObjectPtr> _vertexArrays;
+  std::vector<WebGLDataBufferPtr> _buffers;
+  std::vector<VertexBuffersBinding> _vertexBuffersBindings;
+  std::vector<States> _states;
+  std::vector<float> _floats;
+  std::vector<Float32Array> _floatArrays;
+  std::vector<Int32Array> _intArrays;
+  std::vector<std::string> _names;
+  std::unordered_map<const void*, uint32_t> _effectIndices;
+  std::unordered_map<const void*, uint32_t> _uniformIndices;
+  std::unordered_map<const void*, uint32_t> _textureIndices;
+  std::unordered_map<const void*, uint32_t> _vertexArrayIndices;
+  std::unordered_map<const void*, uint32_t> _bufferIndices;
+  std::vector<WebGLDataBufferPtr> _liveBuffers;
+  // Meshes rendered by the stream with the update flag of their world matrix
+  std::vector<AbstractMesh*> _meshes;
+  std::vector<int> _worldMatrixFlags;
+
+}; // end of class SnapshotRenderingStream
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_ENGINES_SNAPSHOT_RENDERING_STREAM_H
@@ -30,6 +30,8 @@ class DepthCullingState;
 struct DepthTextureCreationOptions;
 class DynamicBufferExtension;
 class DynamicTextureExtension;
+class GLStateCache;
+struct GLStateCounters;
 class Color4;
 class ICanvasRenderingContext2D;
 struct IEffectCreationOptions;
@@ -39,17 +41,22 @@ struct InstancingAttributeInfo;
 struct RenderTargetCreationOptions;
 struct IRenderTargetOptions;
 struct ISize;
+class Matrix;
 class MultiRenderExtension;
+class ProgramBinaryCache;
 class ProgressEvent;
 class RawTextureExtension;
 class ReadTextureExtension;
 class RenderTargetCubeExtension;
 class RenderTargetExtension;
 class Scene;
+class SnapshotRenderingStream;
 class StencilState;
 class Texture;
+class ThreadPool;
 class UniformBuffer;
 class UniformBufferExtension;
+class UniformBufferRing;
 using ArrayBufferViewArray = std::vector<ArrayBufferView>;
 FWD_CLASS_SPTR(BaseTexture)
 FWD_STRUCT_SPTR(DrawWrapper)
@@ -171,6 +178,22 @@ public:
   virtual void _debugInsertMarker(const std::string& text,
                                   const std::optional<int> targetObject = std::nullopt);
 
+  /**
+   * @brief Invalidates the recorded snapshot rendering streams, they are recorded again on the
+   * next frame. Call it after changing the content of a scene rendered in snapshot mode.
+   */
+  void snapshotRenderingReset();
+
+  /**
+   * @brief Hidden
+   */
+  void _beginSnapshotRecording(SnapshotRenderingStream* stream);
+
+  /**
+   * @brief Hidden
+   */
+  void _endSnapshotRecording();
+
   /**
    * @brief Hidden
    */
@@ -235,6 +258,13 @@ public:
    */
   EngineCapabilities& getCaps();
 
+  /**
+   * @brief Gets the pool of worker threads used to offload CPU-side work (culling, shader
+   * preprocessing, mesh processing). The pool is created on first use.
+   * @returns the engine thread pool
+   */
+  ThreadPool& getThreadPool();
+
   /**
    * @brief Stop executing a render loop function and remove it from the execution array.
    */
@@ -482,6 +512,14 @@ public:
    */
   bool _releaseBuffer(const WebGLDataBufferPtr& buffer);
 
+  /**
+   * @brief Hidden
+   * @returns the ring sub-allocating the uniform buffers of the frame, or nullptr when the uniform
+   * buffers own their GL buffer (no uniform buffers support, feature disabled or snapshot
+   * rendering enabled)
+   */
+  UniformBufferRing* _getUniformBufferRing();
+
   /**
    * @brief Update the content of a webGL buffer used with instantiation and bind it to the webGL
    * context.
@@ -647,6 +685,13 @@ public:
   IPipelineContextPtr
   createPipelineContext(const ShaderProcessingContextPtr& shaderProcessingContext);
 
+  /**
+   * @brief Gets the on-disk program binary cache.
+   * @returns the cache, nullptr if it is disabled (no EngineOptions::programBinaryCachePath) or if
+   * the GL implementation does not support program binaries
+   */
+  [[nodiscard]] ProgramBinaryCache* programBinaryCache() const;
+
   /**
    * @brief Creates a new material context.
    * @returns the new context
@@ -815,6 +860,14 @@ public:
    */
   virtual bool setMatrices(const WebGLUniformLocationPtr& uniform, const Float32Array& matrices);
 
+  /**
+   * @brief Set the value of an uniform to a matrix without copying it to an intermediate array.
+   * @param uniform defines the webGL uniform location where to store the value
+   * @param matrix defines the matrix to store
+   * @returns true if the value was set
+   */
+  virtual bool setMatrix(const WebGLUniformLocationPtr& uniform, const Matrix& matrix);
+
   /**
    * @brief Set the value of an uniform to a matrix (3x3).
    * @param uniform defines the webGL uniform location where to store the value
@@ -889,6 +942,13 @@ public:
    */
   bool getColorWrite() const;
 
+  /**
+   * @brief Gets the GL calls statistics of the current frame (GL calls issued and filtered as
+   * redundant, programs switches and textures binds).
+   * @returns the counters, reset at the beginning of each frame
+   */
+  [[nodiscard]] const GLStateCounters& getGLStateCounters() const;
+
   /** Textures **/
 
   /**
@@ -1756,7 +1816,7 @@ public:
    * @param elements defines the content of the uniform buffer
    * @returns the webGL uniform buffer
    */
-  WebGLDataBufferPtr createUniformBuffer(const Float32Array& elements);
+  virtual WebGLDataBufferPtr createUniformBuffer(const Float32Array& elements);
 
   /**
    * @brief Create a dynamic uniform buffer.
@@ -1764,7 +1824,7 @@ public:
    * @param elements defines the content of the uniform buffer
    * @returns the webGL uniform buffer
    */
-  WebGLDataBufferPtr createDynamicUniformBuffer(const Float32Array& elements);
+  virtual WebGLDataBufferPtr createDynamicUniformBuffer(const Float32Array& elements);
 
   /**
    * @brief Update an existing uniform buffer.
@@ -1774,8 +1834,8 @@ public:
    * @param offset defines the offset in the uniform buffer where update should start
    * @param count defines the size of the data to update
    */
-  void updateUniformBuffer(const WebGLDataBufferPtr& uniformBuffer, const Float32Array& elements,
-                           int offset = -1, int count = -1);
+  virtual void updateUniformBuffer(const WebGLDataBufferPtr& uniformBuffer,
+                                   const Float32Array& elements, int offset = -1, int count = -1);
 
   /**
    * @brief Bind an uniform buffer to the current webGL context
@@ -1789,8 +1849,18 @@ public:
    * @param location defines the index where to bind the buffer
    * @param name Name of the uniform variable to bind
    */
-  void bindUniformBufferBase(const WebGLDataBufferPtr& buffer, unsigned int location,
-                             const std::string& name = "");
+  virtual void bindUniformBufferBase(const WebGLDataBufferPtr& buffer, unsigned int location,
+                                     const std::string& name = "");
+
+  /**
+   * @brief Bind a range of a buffer to the current webGL context at a given location.
+   * @param buffer defines the buffer to bind
+   * @param location defines the index where to bind the buffer
+   * @param byteOffset defines the offset in bytes of the range
+   * @param byteLength defines the size in bytes of the range
+   */
+  void bindUniformBufferRange(const WebGLDataBufferPtr& buffer, unsigned int location,
+                              size_t byteOffset, size_t byteLength);
 
   /**
    * @brief Bind a specific block at a given index in a specific shader program.
@@ -1907,16 +1977,13 @@ protected:
   std::string get_shaderPlatformName() const;
 
   /**
-   * @brief Enables or disables the snapshot rendering mode.
-   * Note that the WebGL engine does not support snapshot rendering so setting the value won't have
-   * any effect for this engine
+   * @brief Gets whether the snapshot rendering mode is enabled.
    */
   virtual bool get_snapshotRendering() const;
 
   /**
-   * @brief Enables or disables the snapshot rendering mode.
-   * Note that the WebGL engine does not support snapshot rendering so setting the value won't have
-   * any effect for this engine
+   * @brief Enables or disables the snapshot rendering mode. When enabled, the draw stream of each
+   * camera is recorded on the next frame and replayed on the following ones.
    */
   virtual void set_snapshotRendering(bool activate);
 
@@ -1982,7 +2049,7 @@ protected:
   void _normalizeIndexData(const IndicesArray& indices, Uint16Array& uint16ArrayResult,
                            Uint32Array& uint32ArrayResult);
   void bindIndexBuffer(const WebGLDataBufferPtr& buffer);
-  void _deleteBuffer(const WebGLDataBufferPtr& buffer);
+  virtual void _deleteBuffer(const WebGLDataBufferPtr& buffer);
   /** @hidden */
   virtual void _reportDrawCall();
   static std::string _ConcatenateShader(const std::string& source, const std::string& defines,
@@ -2028,9 +2095,13 @@ private:
     const std::unordered_map<std::string, VertexBufferPtr>& overrideVertexBuffers = {});
   void _unbindVertexArrayObject();
   unsigned int _drawMode(unsigned int fillMode) const;
-  WebGLShaderPtr _compileShader(const std::string& source, const std::string& type,
-                                const std::string& defines, const std::string& shaderVersion);
   WebGLShaderPtr _compileRawShader(const std::string& source, const std::string& type);
+  WebGLProgramPtr _loadProgramBinary(const WebGLPipelineContextPtr& pipelineContext,
+                                     const std::string& vertexSource,
+                                     const std::string& fragmentSource,
+                                     WebGLRenderingContext* context,
+                                     const std::vector<std::string>& transformFeedbackVaryings);
+  void _storeProgramBinary(WebGLPipelineContext* pipelineContext);
   unsigned int _getTextureTarget(const InternalTexturePtr& texture) const;
   void _prepareWebGLTexture(
     const InternalTexturePtr& texture, Scene* scene, int width, int height,
@@ -2093,6 +2164,14 @@ public:
    */
   bool validateShaderPrograms = false;
 
+  /**
+   * Gets or sets a boolean indicating if the preprocessing of the effects shaders (includes,
+   * defines evaluation and conversion) should run on the engine thread pool. Effects are then not
+   * ready until their processed code is available and compiled on the GL thread. Effects using a
+   * processFinalCode callback are always processed on the calling thread.
+   */
+  bool parallelShaderProcessing = true;
+
   /**
    * Gets or sets a boolean indicating if depth buffer should be reverse, going from far to near.
    * This can provide greater z depth for distant objects.
@@ -2201,6 +2280,11 @@ public:
   /** @hidden */
   unsigned int _alphaEquation = Constants::ALPHA_DISABLE;
 
+  /** @hidden */
+  SnapshotRenderingStream* _snapshotRecorder = nullptr;
+  /** @hidden */
+  size_t _snapshotRenderingGeneration = 0;
+
   // Cache
   /** @hidden */
   std::vector<InternalTexturePtr> _internalTexturesCache;
@@ -2281,9 +2365,10 @@ public:
   ReadOnlyProperty<ThinEngine, std::string> shaderPlatformName;
 
   /**
-   * Enables or disables the snapshot rendering mode
-   * Note that the WebGL engine does not support snapshot rendering so setting the value won't have
-   * any effect for this engine
+   * Enables or disables the snapshot rendering mode. In this mode the scenes record the draw
+   * stream of a camera once and replay it until the snapshot is reset, skipping the active meshes
+   * evaluation, the readiness checks and the sorting. In standard mode the snapshot is also reset
+   * when a rendered mesh moves, in fast mode only the camera is updated.
    */
   Property<ThinEngine, bool> snapshotRendering;
 
@@ -2357,6 +2442,14 @@ protected:
   /** @hidden */
   std::unique_ptr<StencilState> _stencilState;
   /** @hidden */
+  std::unique_ptr<GLStateCache> _glStateCache;
+  /** @hidden */
+  std::unique_ptr<ProgramBinaryCache> _programBinaryCache;
+  /** @hidden */
+  std::unique_ptr<UniformBufferRing> _uniformBufferRing;
+  /** @hidden GL vendor, renderer and version, part of the program binary keys */
+  std::string _glIdentity;
+  /** @hidden */
   int _activeChannel = 0;
   /** @hidden */
   std::unordered_map<int, InternalTexturePtr> _boundTexturesCache;
@@ -2364,7 +2457,8 @@ protected:
   EffectPtr _currentEffect = nullptr;
   /** @hidden */
   WebGLProgramPtr _currentProgram = nullptr;
-  std::unordered_map<std::string, EffectPtr> _compiledEffects;
+  /** @hidden Compiled effects, keyed on a 64-bit hash of their shader names and defines */
+  std::unordered_map<uint64_t, EffectPtr> _compiledEffects;
   /** @hidden */
   std::optional<Viewport> _cachedViewport = std::nullopt;
   /** @hidden */
@@ -2440,6 +2534,9 @@ private:
   std::unique_ptr<RenderTargetCubeExtension> _renderTargetCubeExtension;
   std::unique_ptr<UniformBufferExtension> _uniformBufferExtension;
 
+  /** Worker threads */
+  std::unique_ptr<ThreadPool> _threadPool;
+
   // Friend classes
   friend class DynamicBufferExtension;
   friend class ReadTextureExtension;
@@ -0,0 +1,144 @@
+#ifndef BABYLON_ENGINES_UNIFORM_BUFFER_RING_H
+#define BABYLON_ENGINES_UNIFORM_BUFFER_RING_H
+
+#include <memory>
+#include <vector>
+
+#include <babylon/babylon_api.h>
+#include <babylon/babylon_common.h>
+
+namespace BABYLON {
+
+class ThinEngine;
+class WebGLDataBuffer;
+using WebGLDataBufferPtr = std::shared_ptr<WebGLDataBuffer>;
+
+/**
+ * @brief Frame scoped allocator of uniform buffer ranges.
+ *
+ * The uniform buffers are sub-allocated in a few large GL buffers instead of owning one GL buffer
+ * each. Every frame in flight has its own set of GL buffers (the chunks) and of CPU copies of
+ * their content: an allocation only copies the data in the CPU copy, the pending data is uploaded
+ * with a single buffer update before the next draw call. The ranges are valid until the end of
+ * the frame they were allocated in, the chunks are recycled once the frames in flight are over.
+ */
+class BABYLON_SHARED_EXPORT UniformBufferRing {
+
+public:
+  /**
+   * @brief Range of a chunk holding the data of a uniform buffer.
+   */
+  struct Range {
+    /**
+     * GL buffer holding the data
+     */
+    WebGLDataBufferPtr buffer = nullptr;
+    /**
+     * Offset in bytes of the data in the buffer
+     */
+    size_t byteOffset = 0;
+    /**
+     * Size in bytes of the data
+     */
+    size_t byteLength = 0;
+    /**
+     * Frame the range was allocated in
+     */
+    size_t frame = 0;
+  }; // end of struct Range
+
+public:
+  /**
+   * @brief Creates a ring allocating in the given engine.
+   * @param engine defines the engine creating the GL buffers
+   * @param offsetAlignment defines the alignment in bytes of the ranges
+   * (UNIFORM_BUFFER_OFFSET_ALIGNMENT)
+   * @param chunkByteLength defines the size in bytes of the GL buffers
+   * @param framesInFlight defines the number of frames using distinct GL buffers
+   */
+  UniformBufferRing(ThinEngine* engine, size_t offsetAlignment = 256,
+                    size_t chunkByteLength = 1024 * 1024, size_t framesInFlight = 3);
+  ~UniformBufferRing(); // = default
+
+  /**
+   * @brief Copies the data of a uniform buffer in a new range of the current frame.
+   * @param data defines the data of the uniform buffer
+   * @returns the allocated range
+   */
+  Range allocate(const Float32Array& data);
+
+  /**
+   * @brief Returns whether a range was allocated in the current frame and can still be bound.
+   * @param range defines the range to check
+   */
+  bool isValid(const Range& range);
+
+  /**
+   * @brief Uploads the data allocated since the last flush, called before each draw call.
+   */
+  void flush();
+
+  /**
+   * @brief Forgets the GL buffers, called when the GL context was lost.
+   */
+  void _rebuild();
+
+  /**
+   * @brief Releases the GL buffers.
+   */
+  void dispose();
+
+  /**
+   * @brief Gets the number of bytes allocated in the current frame.
+   */
+  [[nodiscard]] size_t allocatedBytes() const
+  {
+    return _allocatedBytes;
+  }
+
+  /**
+   * @brief Gets the number of buffer uploads of the current frame.
+   */
+  [[nodiscard]] size_t uploads() const
+  {
+    return _uploads;
+  }
+
+  /**
+   * @brief Gets the number of GL buffers created by the ring.
+   */
+  [[nodiscard]] size_t chunkCount() const;
+
+private:
+  struct Chunk {
+    WebGLDataBufferPtr buffer = nullptr;
+    Float32Array data;
+  }; // end of struct Chunk
+
+  struct FrameChunks {
+    std::vector<Chunk> chunks;
+    size_t chunkIndex    = 0;
+    size_t offset        = 0;
+    size_t flushedOffset = 0;
+  }; // end of struct FrameChunks
+
+  void _checkNewFrame();
+  Chunk& _getChunk(size_t elementCount);
+
+private:
+  ThinEngine* _engine;
+  size_t _alignment;
+  size_t _chunkLength;
+  std::vector<FrameChunks> _frames;
+  size_t _frameIndex;
+  size_t _frame;
+  size_t _engineFrameId;
+  size_t _allocatedBytes;
+  size_t _uploads;
+  Float32Array _uploadData;
+
+}; // end of class UniformBufferRing
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_ENGINES_UNIFORM_BUFFER_RING_H
@@ -15,7 +15,7 @@ struct BABYLON_SHARED_EXPORT WebGL2ShaderProcessor : public IShaderProcessor {
   std::string _varyingProcessor(const std::string& varying, bool isFragment);
   std::string _postProcessor(std::string code, const std::vector<std::string>& defines,
                              bool isFragment, const ShaderProcessingContextPtr&,
-                             ThinEngine* engine);
+                             const ShaderProcessorParameters& parameters);
 }; // end of struct WebGL2ShaderProcessor
 
 } // end of namespace BABYLON
@@ -1,6 +1,7 @@
 #ifndef BABYLON_ENGINES_WEBGL_WEBGL_PIPELINE_CONTEXT_H
 #define BABYLON_ENGINES_WEBGL_WEBGL_PIPELINE_CONTEXT_H
 
+#include <array>
 #include <functional>
 
 #include <babylon/babylon_api.h>
@@ -73,24 +74,10 @@ public:
   WebGLUniformLocationPtr getUniform(const std::string& uniformName);
 
   /**
-   * @brief Hidden
-   **/
-  bool _cacheMatrix(const std::string& uniformName, const Matrix& matrix);
-
-  /**
-   * @brief Hidden
-   **/
-  bool _cacheFloat2(const std::string& uniformName, float x, float y);
-
-  /**
-   * @brief Hidden
-   **/
-  bool _cacheFloat3(const std::string& uniformName, float x, float y, float z);
-
-  /**
-   * @brief Hidden
-   **/
-  bool _cacheFloat4(const std::string& uniformName, float x, float y, float z, float w);
+   * @brief Forgets the cached uniform values, used when the uniforms were set without the
+   * pipeline context.
+   */
+  void _clearValueCache();
 
   /**
    * @brief Sets an integer value on a uniform variable.
@@ -298,6 +285,54 @@ public:
    */
   void setDirectColor4(const std::string& uniformName, const Color4& color4) override;
 
+  /**
+   * @brief Sets an integer value on a uniform variable.
+   * @param uniformHandle Handle of the variable, as returned by Effect::getUniformHandle.
+   * @param value Value to be set.
+   */
+  void setInt(int uniformHandle, int value) override;
+
+  /**
+   * @brief Sets matrix on a uniform variable.
+   * @param uniformHandle Handle of the variable, as returned by Effect::getUniformHandle.
+   * @param matrix matrix to be set.
+   */
+  void setMatrix(int uniformHandle, const Matrix& matrix) override;
+
+  /**
+   * @brief Sets a float on a uniform variable.
+   * @param uniformHandle Handle of the variable, as returned by Effect::getUniformHandle.
+   * @param value value to be set.
+   */
+  void setFloat(int uniformHandle, float value) override;
+
+  /**
+   * @brief Sets a float2 on a uniform variable.
+   * @param uniformHandle Handle of the variable, as returned by Effect::getUniformHandle.
+   * @param x First float in float2.
+   * @param y Second float in float2.
+   */
+  void setFloat2(int uniformHandle, float x, float y) override;
+
+  /**
+   * @brief Sets a float3 on a uniform variable.
+   * @param uniformHandle Handle of the variable, as returned by Effect::getUniformHandle.
+   * @param x First float in float3.
+   * @param y Second float in float3.
+   * @param z Third float in float3.
+   */
+  void setFloat3(int uniformHandle, float x, float y, float z) override;
+
+  /**
+   * @brief Sets a float4 on a uniform variable.
+   * @param uniformHandle Handle of the variable, as returned by Effect::getUniformHandle.
+   * @param x First float in float4.
+   * @param y Second float in float4.
+   * @param z Third float in float4.
+   * @param w Fourth float in float4.
+   */
+  void setFloat4(int uniformHandle, float x, float y, float z, float w) override;
+
   /**
    * @brief Hidden
    */
@@ -308,9 +343,42 @@ public:
    */
   std::string _getFragmentShaderCode() const override;
 
+private:
+  /**
+   * Location and last value of an uniform of the program, slots are stored in the order of the
+   * uniform names of the effect so that the index of a slot is the handle of the uniform.
+   */
+  struct UniformSlot {
+    WebGLUniformLocationPtr location = nullptr;
+    // Number of cached components, 0 when the value is unknown
+    size_t cachedSize = 0;
+    std::array<float, 4> cache{};
+    // Update flag of the cached matrix
+    bool hasMatrixFlag   = false;
+    int matrixUpdateFlag = 0;
+  }; // end of struct UniformSlot
+
+  UniformSlot* _getSlot(const std::string& uniformName);
+  UniformSlot* _getSlot(int uniformHandle);
+  WebGLUniformLocationPtr _invalidateSlot(const std::string& uniformName);
+  bool _cacheMatrix(UniformSlot& slot, const Matrix& matrix);
+  bool _cacheFloats(UniformSlot& slot, size_t size, float x, float y = 0.f, float z = 0.f,
+                    float w = 0.f);
+  void _setMatrix(UniformSlot* slot, const Matrix& matrix);
+  void _setInt(UniformSlot* slot, int value);
+  void _setInt2(UniformSlot* slot, int x, int y);
+  void _setInt3(UniformSlot* slot, int x, int y, int z);
+  void _setInt4(UniformSlot* slot, int x, int y, int z, int w);
+  void _setFloat(UniformSlot* slot, float value);
+  void _setFloat2(UniformSlot* slot, float x, float y);
+  void _setFloat3(UniformSlot* slot, float x, float y, float z);
+  void _setFloat4(UniformSlot* slot, float x, float y, float z, float w);
+
+private:
+  std::vector<UniformSlot> _uniformSlots;
+  std::unordered_map<std::string, size_t> _uniformSlotIndices;
+
 public:
-  std::unordered_map<std::string, Float32Array> _valueCache;
-  std::unordered_map<std::string, WebGLUniformLocationPtr> _uniforms;
   ThinEngine* engine;
   WebGLProgramPtr program;
   WebGLRenderingContext* context;
@@ -319,6 +387,8 @@ public:
   bool isParallelCompiled;
   std::function<void()> onCompiled;
   WebGLTransformFeedbackPtr transformFeedback;
+  /** @hidden Key of the program in the program binary cache, empty when not cached */
+  std::string _programBinaryKey;
 
   std::string vertexCompilationError;
   std::string fragmentCompilationError;
@@ -13,7 +13,7 @@ struct BABYLON_SHARED_EXPORT WebGLShaderProcessor : public IShaderProcessor {
   WebGLShaderProcessor();
   std::string _postProcessor(std::string code, const std::vector<std::string>& defines,
                              bool isFragment, const ShaderProcessingContextPtr&,
-                             ThinEngine* engine);
+                             const ShaderProcessorParameters& parameters);
 }; // end of struct WebGLShaderProcessor
 
 } // end of namespace BABYLON
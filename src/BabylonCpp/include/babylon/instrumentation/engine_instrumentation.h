@@ -64,6 +64,36 @@ protected:
    */
   void set_captureShaderCompilationTime(bool value);
 
+  /**
+   * @brief Gets the perf counter used for the GL calls issued per frame.
+   */
+  PerfCounter& get_glCallsCounter();
+
+  /**
+   * @brief Gets the perf counter used for the redundant GL calls filtered per frame.
+   */
+  PerfCounter& get_filteredGLCallsCounter();
+
+  /**
+   * @brief Gets the perf counter used for the programs switches per frame.
+   */
+  PerfCounter& get_programSwitchesCounter();
+
+  /**
+   * @brief Gets the perf counter used for the textures binds per frame.
+   */
+  PerfCounter& get_textureBindsCounter();
+
+  /**
+   * @brief Gets the GL state statistics capture status.
+   */
+  [[nodiscard]] bool get_captureGLStateStatistics() const;
+
+  /**
+   * @brief Enable or disable the GL state statistics capture.
+   */
+  void set_captureGLStateStatistics(bool value);
+
 public:
   // Properties
   /**
@@ -86,6 +116,31 @@ public:
    */
   Property<EngineInstrumentation, bool> captureShaderCompilationTime;
 
+  /**
+   * Perf counter used for the GL calls issued per frame.
+   */
+  ReadOnlyProperty<EngineInstrumentation, PerfCounter> glCallsCounter;
+
+  /**
+   * Perf counter used for the redundant GL calls filtered per frame.
+   */
+  ReadOnlyProperty<EngineInstrumentation, PerfCounter> filteredGLCallsCounter;
+
+  /**
+   * Perf counter used for the programs switches per frame.
+   */
+  ReadOnlyProperty<EngineInstrumentation, PerfCounter> programSwitchesCounter;
+
+  /**
+   * Perf counter used for the textures binds per frame.
+   */
+  ReadOnlyProperty<EngineInstrumentation, PerfCounter> textureBindsCounter;
+
+  /**
+   * Enable or disable the GL state statistics capture.
+   */
+  Property<EngineInstrumentation, bool> captureGLStateStatistics;
+
 private:
   /**
    * Define the instrumented engine.
@@ -99,11 +154,18 @@ private:
   bool _captureShaderCompilationTime;
   PerfCounter _shaderCompilationTime;
 
+  bool _captureGLStateStatistics;
+  PerfCounter _glCalls;
+  PerfCounter _filteredGLCalls;
+  PerfCounter _programSwitches;
+  PerfCounter _textureBinds;
+
   // Observers
   Observer<Engine>::Ptr _onBeginFrameObserver;
   Observer<Engine>::Ptr _onEndFrameObserver;
   Observer<Engine>::Ptr _onBeforeShaderCompilationObserver;
   Observer<Engine>::Ptr _onAfterShaderCompilationObserver;
+  Observer<Engine>::Ptr _onEndFrameGLStateObserver;
 
 }; // end of class EngineInstrumentation
 
@@ -218,7 +218,8 @@ enum GLEnums : GLenum {
   /* RGB 16-bit floating-point color-renderable internal sized format */
   RGB16F = 0x881B,
   /* Uniform Buffers */
-  UNIFORM_BUFFER = 0x8A11,
+  UNIFORM_BUFFER                  = 0x8A11,
+  UNIFORM_BUFFER_OFFSET_ALIGNMENT = 0x8A34,
   /* Shaders */
   FRAGMENT_SHADER                  = 0x8B30,
   VERTEX_SHADER                    = 0x8B31,
@@ -238,6 +239,10 @@ enum GLEnums : GLenum {
   ACTIVE_ATTRIBUTES                = 0x8B89,
   SHADING_LANGUAGE_VERSION         = 0x8B8C,
   CURRENT_PROGRAM                  = 0x8B8D,
+  /* Program binaries */
+  PROGRAM_BINARY_RETRIEVABLE_HINT = 0x8257,
+  PROGRAM_BINARY_LENGTH           = 0x8741,
+  NUM_PROGRAM_BINARY_FORMATS      = 0x87FE,
   /* Algorithm types */
   ANY_SAMPLES_PASSED              = 0x8C2F,
   ANY_SAMPLES_PASSED_CONSERVATIVE = 0x8D6A,
@@ -746,7 +751,8 @@ public:
 
 public:
   GLint value;
-  int _currentState;
+  // Last value written in the location, used to filter the redundant uniform writes
+  std::vector<uint8_t> _cachedValue;
 
 }; // end of class IGLUniformLocation
 
@@ -843,6 +849,18 @@ public:
    */
   virtual void bindBufferBase(GLenum target, GLuint index, IGLBuffer* buffer) = 0;
 
+  /**
+   * @brief Binds a range of a given IGLBuffer to an indexed buffer target.
+   * @param target A GLenum specifying the target of the bind operation.
+   * @param index A GLuint specifying the index of the target.
+   * @param buffer A IGLBuffer to bind.
+   * @param offset A GLintptr specifying the starting offset in bytes of the range.
+   * @param size A GLsizeiptr specifying the size in bytes of the range.
+   */
+  virtual void bindBufferRange(GLenum target, GLuint index, IGLBuffer* buffer, GLintptr offset,
+                               GLsizeiptr size)
+    = 0;
+
   /**
    * @brief Binds a IGLRenderbuffer object to a given target.
    * @param target A GLenum specifying the binding point (target).
@@ -1650,6 +1668,14 @@ public:
    */
   virtual std::string getProgramInfoLog(IGLProgram* program) = 0;
 
+  /**
+   * @brief Returns the binary representation of a linked program.
+   * @param program A linked IGLProgram to query.
+   * @param binaryFormat Receives the implementation specific format of the binary.
+   * @return The program binary, empty when the binary could not be retrieved.
+   */
+  virtual ArrayBuffer getProgramBinary(IGLProgram* program, GLenum& binaryFormat) = 0;
+
   /**
    * @brief Returns information about the renderbuffer.
    * @param target A Glenum specifying the target renderbuffer object.
@@ -1785,6 +1811,25 @@ public:
    */
   virtual bool linkProgram(IGLProgram* program) = 0;
 
+  /**
+   * @brief Loads a program binary previously returned by getProgramBinary, the link status of the
+   * program tells if the binary was accepted.
+   * @param program An IGLProgram to load the binary into.
+   * @param binaryFormat A GLenum specifying the format of the binary.
+   * @param binary The program binary.
+   * @return Whether or not the binary was accepted.
+   */
+  virtual bool programBinary(IGLProgram* program, GLenum binaryFormat, const ArrayBuffer& binary)
+    = 0;
+
+  /**
+   * @brief Sets a program parameter.
+   * @param program An IGLProgram to modify.
+   * @param pname A GLenum specifying the parameter to set (PROGRAM_BINARY_RETRIEVABLE_HINT).
+   * @param value A GLint specifying the parameter value.
+   */
+  virtual void programParameteri(IGLProgram* program, GLenum pname, GLint value) = 0;
+
   /**
    * @brief Specifies the pixel storage modes.
    * @param pname A Glenum specifying which parameter to set. See below for
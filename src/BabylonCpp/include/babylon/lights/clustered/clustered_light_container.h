@@ -0,0 +1,213 @@
+#ifndef BABYLON_LIGHTS_CLUSTERED_CLUSTERED_LIGHT_CONTAINER_H
+#define BABYLON_LIGHTS_CLUSTERED_CLUSTERED_LIGHT_CONTAINER_H
+
+#include <array>
+
+#include <babylon/babylon_api.h>
+#include <babylon/babylon_fwd.h>
+#include <babylon/core/array_buffer_view.h>
+#include <babylon/lights/clustered/clustered_light_grid.h>
+#include <babylon/lights/light.h>
+#include <babylon/misc/observer.h>
+
+namespace BABYLON {
+
+class Camera;
+FWD_CLASS_SPTR(ClusteredLightContainer)
+FWD_CLASS_SPTR(RawTexture)
+
+/**
+ * @brief Light rendering many point and spot lights through clustered forward lighting.
+ *
+ * The lights added to the container are removed from the scene lights: the container takes a
+ * single light slot in the materials (it does not count against maxSimultaneousLights for each of
+ * its lights) and defines CLUSTLIGHT{X} instead of a light type. Before each camera render, the
+ * enabled lights are binned in a ClusteredLightGrid built from the camera frustum, their data is
+ * packed in a float texture (5 texels per light) and the light list of each cluster is packed in a
+ * second float texture (count followed by the light indices, 4 per texel). The standard and PBR
+ * shaders find the cluster of the fragment from gl_FragCoord and its view depth, and loop over its
+ * lights.
+ *
+ * The lights need a finite range (the radius used to bin them) and do not cast shadows. The
+ * clusters are computed for the camera being rendered, the textures require WebGL2 / GL3.
+ */
+class BABYLON_SHARED_EXPORT ClusteredLightContainer : public Light {
+
+public:
+  /**
+   * Number of texels used by each light in the light data texture
+   */
+  static constexpr size_t LightDataTexelCount = 5;
+
+public:
+  template <typename... Ts>
+  static ClusteredLightContainerPtr New(Ts&&... args)
+  {
+    auto light = std::shared_ptr<ClusteredLightContainer>(
+      new ClusteredLightContainer(std::forward<Ts>(args)...));
+    light->addToScene(light);
+
+    return light;
+  }
+  ~ClusteredLightContainer() override; // = default
+
+  /**
+   * @brief Checks if a light can be rendered through a container.
+   * @param light defines the light to check
+   * @returns true for the point and spot lights
+   */
+  static bool IsLightSupported(const LightPtr& light);
+
+  /**
+   * @brief Returns the string "ClusteredLightContainer".
+   * @return The class name
+   */
+  std::string getClassName() const override;
+
+  Type type() const override;
+
+  /**
+   * @brief Returns the integer 5.
+   * @return The light Type id as a constant defines in Light.LIGHTTYPEID_x
+   */
+  unsigned int getTypeID() const override;
+
+  /**
+   * @brief Gets whether the engine supports the textures used by the container.
+   */
+  [[nodiscard]] bool isSupported() const;
+
+  /**
+   * @brief Adds a light to the container, the light is removed from the scene lights.
+   * @param light defines the point or spot light to add
+   */
+  void addLight(const LightPtr& light);
+
+  /**
+   * @brief Removes a light from the container, the light is added back to the scene lights.
+   * @param light defines the light to remove
+   */
+  void removeLight(Light* light);
+
+  /**
+   * @brief Gets the lights rendered by the container.
+   */
+  [[nodiscard]] const std::vector<LightPtr>& lights() const
+  {
+    return _lights;
+  }
+
+  /**
+   * @brief Changes the dimensions of the cluster grid.
+   * @param horizontalTiles defines the number of tiles along the width of the screen
+   * @param verticalTiles defines the number of tiles along the height of the screen
+   * @param depthSlices defines the number of depth slices
+   * @param maxLightsPerCluster defines the capacity of the light list of each cluster
+   */
+  void setGridSize(size_t horizontalTiles, size_t verticalTiles, size_t depthSlices,
+                   size_t maxLightsPerCluster);
+
+  /**
+   * @brief Gets the grid the lights are binned in.
+   */
+  [[nodiscard]] const ClusteredLightGrid& grid() const
+  {
+    return _grid;
+  }
+
+  /**
+   * @brief Bins the lights in the frustum of a camera and updates the textures, called before
+   * each camera render.
+   * @param camera defines the camera whose frustum is clustered
+   */
+  void update(Camera* camera);
+
+  /**
+   * @brief Returns the shadow generator associated to the light.
+   * @returns Always null because the clustered lights do not support shadows.
+   */
+  IShadowGeneratorPtr getShadowGenerator() override;
+
+  /**
+   * @brief Sets the passed Effect object with the cluster lookup information.
+   * @param effect The effect to update
+   * @param lightIndex The index of the light in the effect to update
+   */
+  void transferToEffect(Effect* effect, const std::string& lightIndex) override;
+
+  /**
+   * @brief Sets the passed Effect "effect" with the light and cluster textures.
+   * @param effect The effect to update
+   * @param lightIndex The index of the light in the effect to update
+   * @returns The light
+   */
+  ClusteredLightContainer& transferTexturesToEffect(Effect* effect,
+                                                    const std::string& lightIndex) override;
+
+  /**
+   * @brief Node materials do not support clustered lights, does nothing.
+   * @param effect The effect to update
+   * @param lightDataUniformName The uniform used to store light data (position or direction)
+   * @returns The light
+   */
+  ClusteredLightContainer& transferToNodeMaterialEffect(
+    Effect* effect, const std::string& lightDataUniformName) override;
+
+  /**
+   * @brief Prepares the list of defines specific to the light type.
+   * @param defines the list of defines
+   * @param lightIndex defines the index of the light for the effect
+   */
+  void prepareLightSpecificDefines(MaterialDefines& defines, unsigned int lightIndex) override;
+
+  /**
+   * @brief Releases the textures and the lights of the container.
+   * @param doNotRecurse Set to true to not recurse into each children (recurse into each children
+   * by default)
+   * @param disposeMaterialAndTextures Set to true to also dispose referenced materials and
+   * textures (false by default)
+   */
+  void dispose(bool doNotRecurse = false, bool disposeMaterialAndTextures = false) override;
+
+protected:
+  /**
+   * @brief Creates a container rendering the given lights.
+   * @param name The friendly name of the light
+   * @param lights The point and spot lights to render through the container
+   * @param scene The scene the light belongs to
+   */
+  ClusteredLightContainer(const std::string& name, const std::vector<LightPtr>& lights,
+                          Scene* scene);
+
+  void _buildUniformLayout() override;
+
+private:
+  void _packLights(size_t lightCount);
+  void _packClusters();
+
+public:
+  /**
+   * Defines if the lights are binned on the engine thread pool
+   */
+  bool useThreadPool;
+
+private:
+  std::vector<LightPtr> _lights;
+  std::vector<Light*> _binnedLights;
+  ClusteredLightGrid _grid;
+  size_t _lightCapacity;
+  ArrayBufferView _lightData;
+  ArrayBufferView _clusterData;
+  RawTexturePtr _lightDataTexture;
+  RawTexturePtr _clusterTexture;
+  // Cluster lookup: view depth row, slice data and cluster info
+  std::array<float, 4> _depthRow;
+  std::array<float, 4> _sliceData;
+  std::array<float, 4> _clusterInfo;
+  Observer<Camera>::Ptr _onBeforeCameraRenderObserver;
+
+}; // end of class ClusteredLightContainer
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_LIGHTS_CLUSTERED_CLUSTERED_LIGHT_CONTAINER_H
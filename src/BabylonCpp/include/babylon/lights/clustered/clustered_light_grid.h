@@ -0,0 +1,266 @@
+#ifndef BABYLON_LIGHTS_CLUSTERED_CLUSTERED_LIGHT_GRID_H
+#define BABYLON_LIGHTS_CLUSTERED_CLUSTERED_LIGHT_GRID_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <babylon/babylon_api.h>
+
+namespace BABYLON {
+
+class ThreadPool;
+class Vector3;
+
+/**
+ * @brief Grid of clusters subdividing a view frustum, used to bin many local lights so that each
+ * fragment only evaluates the lights of its cluster.
+ *
+ * The frustum is split in tilesX x tilesY screen tiles and in slicesZ depth slices distributed
+ * exponentially between the near and far planes (slice = log(depth / near) * slicesZ /
+ * log(far / near)). The lights are spheres given in view space, with the depth along +z. Binning
+ * tests the bounding sphere of each light against the axis aligned box of each cluster it may
+ * overlap: the per slice and per row candidate lists are computed once, then the clusters of a row
+ * are tested against their candidates with SSE/AVX when available (scalar fallback otherwise).
+ * The depth slices are distributed over a thread pool, each slice only writing its own clusters.
+ *
+ * The light lists are stored with a fixed capacity per cluster and are sorted by light index. The
+ * grid does not depend on the engine and can be used (and benchmarked) without a GPU.
+ */
+class BABYLON_SHARED_EXPORT ClusteredLightGrid {
+
+public:
+  /**
+   * @brief Creates a new grid.
+   * @param tilesX defines the number of tiles along the width of the screen
+   * @param tilesY defines the number of tiles along the height of the screen
+   * @param slicesZ defines the number of depth slices
+   * @param maxLightsPerCluster defines the capacity of the light list of each cluster
+   */
+  ClusteredLightGrid(size_t tilesX = 16, size_t tilesY = 9, size_t slicesZ = 24,
+                     size_t maxLightsPerCluster = 63);
+  ClusteredLightGrid(const ClusteredLightGrid& other) = delete;
+  ClusteredLightGrid(ClusteredLightGrid&& other)      = default;
+  ClusteredLightGrid& operator=(const ClusteredLightGrid& other) = delete;
+  ClusteredLightGrid& operator=(ClusteredLightGrid&& other) = default;
+  ~ClusteredLightGrid(); // = default
+
+  /**
+   * @brief Changes the dimensions of the grid.
+   * @param tilesX defines the number of tiles along the width of the screen
+   * @param tilesY defines the number of tiles along the height of the screen
+   * @param slicesZ defines the number of depth slices
+   * @param maxLightsPerCluster defines the capacity of the light list of each cluster
+   */
+  void resize(size_t tilesX, size_t tilesY, size_t slicesZ, size_t maxLightsPerCluster);
+
+  /**
+   * @brief Defines a perspective frustum from the slopes of its side planes.
+   * @param left defines the x / z ratio of the left plane
+   * @param right defines the x / z ratio of the right plane
+   * @param bottom defines the y / z ratio of the bottom plane
+   * @param top defines the y / z ratio of the top plane
+   * @param znear defines the depth of the near plane
+   * @param zfar defines the depth of the far plane
+   */
+  void setPerspective(float left, float right, float bottom, float top, float znear, float zfar);
+
+  /**
+   * @brief Defines an orthographic frustum.
+   * @param left defines the x coordinate of the left plane
+   * @param right defines the x coordinate of the right plane
+   * @param bottom defines the y coordinate of the bottom plane
+   * @param top defines the y coordinate of the top plane
+   * @param znear defines the depth of the near plane
+   * @param zfar defines the depth of the far plane
+   */
+  void setOrthographic(float left, float right, float bottom, float top, float znear, float zfar);
+
+  /**
+   * @brief Removes all the lights from the grid.
+   */
+  void clearLights();
+
+  /**
+   * @brief Adds a light to bin.
+   * @param viewPosition defines the position of the light in view space (depth along +z)
+   * @param range defines the radius of the sphere of influence of the light
+   * @returns the index of the light in the cluster lists
+   */
+  uint32_t addLight(const Vector3& viewPosition, float range);
+
+  /**
+   * @brief Bins the lights in the clusters.
+   * @param threadPool defines the pool used to distribute the depth slices (optional)
+   * @param forceScalar defines if the scalar kernel should be used even if SIMD is available
+   */
+  void bin(ThreadPool* threadPool = nullptr, bool forceScalar = false);
+
+  /**
+   * @brief Gets the number of tiles along the width of the screen.
+   */
+  [[nodiscard]] size_t tilesX() const
+  {
+    return _tilesX;
+  }
+
+  /**
+   * @brief Gets the number of tiles along the height of the screen.
+   */
+  [[nodiscard]] size_t tilesY() const
+  {
+    return _tilesY;
+  }
+
+  /**
+   * @brief Gets the number of depth slices.
+   */
+  [[nodiscard]] size_t slicesZ() const
+  {
+    return _slicesZ;
+  }
+
+  /**
+   * @brief Gets the capacity of the light list of each cluster.
+   */
+  [[nodiscard]] size_t maxLightsPerCluster() const
+  {
+    return _maxLightsPerCluster;
+  }
+
+  /**
+   * @brief Gets the number of clusters.
+   */
+  [[nodiscard]] size_t clusterCount() const
+  {
+    return _tilesX * _tilesY * _slicesZ;
+  }
+
+  /**
+   * @brief Gets the number of lights added since the last call to clearLights().
+   */
+  [[nodiscard]] size_t lightCount() const
+  {
+    return _lightX.size();
+  }
+
+  /**
+   * @brief Gets the index of a cluster in the cluster lists.
+   * @param x defines the tile column (from the left)
+   * @param y defines the tile row (from the bottom)
+   * @param z defines the depth slice (from the near plane)
+   * @returns the cluster index
+   */
+  [[nodiscard]] size_t getClusterIndex(size_t x, size_t y, size_t z) const
+  {
+    return (z * _tilesY + y) * _tilesX + x;
+  }
+
+  /**
+   * @brief Gets the number of lights binned in a cluster.
+   * @param cluster defines the cluster index
+   */
+  [[nodiscard]] uint32_t getClusterLightCount(size_t cluster) const
+  {
+    return _clusterLightCounts[cluster];
+  }
+
+  /**
+   * @brief Gets the sorted light indices binned in a cluster.
+   * @param cluster defines the cluster index
+   */
+  [[nodiscard]] const uint32_t* getClusterLights(size_t cluster) const
+  {
+    return _clusterLights.data() + cluster * _maxLightsPerCluster;
+  }
+
+  /**
+   * @brief Gets the number of light references dropped by the last binning because a cluster was
+   * full.
+   */
+  [[nodiscard]] size_t overflowCount() const
+  {
+    return _overflowCount;
+  }
+
+  /**
+   * @brief Gets the scale applied to log(depth) to compute the depth slice.
+   */
+  [[nodiscard]] float sliceScale() const
+  {
+    return _sliceScale;
+  }
+
+  /**
+   * @brief Gets the bias added to log(depth) * sliceScale() to compute the depth slice.
+   */
+  [[nodiscard]] float sliceBias() const
+  {
+    return _sliceBias;
+  }
+
+  /**
+   * @brief Computes the depth slice containing a view space depth.
+   * @param depth defines the view space depth
+   * @returns the slice index, clamped to the grid
+   */
+  [[nodiscard]] size_t computeSlice(float depth) const;
+
+private:
+  // Scratch data of a binning chunk, the candidate arrays are padded to the SIMD batch size
+  struct Candidates {
+    std::vector<uint32_t> sliceLights;
+    std::vector<float> tileMinX;
+    std::vector<float> tileMaxX;
+    std::vector<float> x;
+    std::vector<float> distanceSquaredYZ;
+    std::vector<float> rangeSquared;
+    std::vector<uint32_t> index;
+  }; // end of struct Candidates
+
+  void _computeLightBounds(size_t begin, size_t end);
+  void _binSlice(size_t slice, Candidates& candidates, bool forceScalar, size_t& overflowCount);
+  void _testRowScalar(const Candidates& candidates, size_t candidateCount, size_t firstCluster,
+                      size_t& overflowCount);
+  void _testRowSIMD(const Candidates& candidates, size_t candidateCount, size_t firstCluster,
+                    size_t& overflowCount);
+  void _appendLight(size_t cluster, uint32_t lightIndex, size_t& overflowCount);
+
+private:
+  // Grid
+  size_t _tilesX;
+  size_t _tilesY;
+  size_t _slicesZ;
+  size_t _maxLightsPerCluster;
+  // Frustum
+  bool _orthographic;
+  float _left;
+  float _right;
+  float _bottom;
+  float _top;
+  float _near;
+  float _far;
+  float _sliceScale;
+  float _sliceBias;
+  // Lights (view space bounding spheres)
+  std::vector<float> _lightX;
+  std::vector<float> _lightY;
+  std::vector<float> _lightZ;
+  std::vector<float> _lightRange;
+  // Tile rows and depth slices overlapped by each light (first > last when culled)
+  std::vector<int32_t> _lightFirstRow;
+  std::vector<int32_t> _lightLastRow;
+  std::vector<int32_t> _lightFirstSlice;
+  std::vector<int32_t> _lightLastSlice;
+  // Clusters
+  std::vector<uint32_t> _clusterLightCounts;
+  std::vector<uint32_t> _clusterLights;
+  size_t _overflowCount;
+  // Scratch candidate lists, one per binning chunk
+  std::vector<Candidates> _candidates;
+
+}; // end of class ClusteredLightGrid
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_LIGHTS_CLUSTERED_CLUSTERED_LIGHT_GRID_H
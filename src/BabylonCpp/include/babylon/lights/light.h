@@ -121,6 +121,11 @@ public:
    */
   static constexpr unsigned int LIGHTTYPEID_HEMISPHERICLIGHT = 3;
 
+  /**
+   * Light type const id of the clustered light container.
+   */
+  static constexpr unsigned int LIGHTTYPEID_CLUSTERED_CONTAINER = 5;
+
 public:
   ~Light() override; // = default
 
@@ -0,0 +1,150 @@
+#ifndef BABYLON_LIGHTS_LIGHT_SPATIAL_INDEX_H
+#define BABYLON_LIGHTS_LIGHT_SPATIAL_INDEX_H
+
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include <babylon/babylon_api.h>
+#include <babylon/babylon_fwd.h>
+#include <babylon/culling/bvh/dynamic_bvh.h>
+#include <babylon/misc/observer.h>
+
+namespace BABYLON {
+
+class AbstractMesh;
+class Light;
+class Scene;
+FWD_CLASS_SPTR(Light)
+
+/**
+ * @brief Spatial index of the lights of a scene used to assign the lights to the meshes.
+ *
+ * The point and spot lights with a finite range are stored in a dynamic bounding volume hierarchy
+ * by the box of their sphere of influence, the other lights affect every mesh. The light sources
+ * of a mesh are the lights whose influence reaches its bounding box, ranked by contribution
+ * (intensity / distance²) after the priority of the lights: the materials binding the first
+ * maxSimultaneousLights lights then use the most contributing ones.
+ *
+ * The index is updated once per frame: the meshes whose world matrix changed and the meshes in the
+ * influence of the lights which moved or changed are the only ones resynchronized.
+ *
+ * Usage:
+ * @code
+ *   LightSpatialIndex index(scene);
+ *   scene->setLightSpatialIndex(&index);
+ * @endcode
+ */
+class BABYLON_SHARED_EXPORT LightSpatialIndex {
+
+public:
+  /**
+   * @brief Creates a new index tracking all the lights and meshes of a scene.
+   * @param scene defines the scene whose lights are indexed
+   * @param margin defines the distance (in world units) the leaf boxes are enlarged by
+   */
+  LightSpatialIndex(Scene* scene, float margin = 0.1f);
+  LightSpatialIndex(const LightSpatialIndex& other) = delete;
+  LightSpatialIndex& operator=(const LightSpatialIndex& other) = delete;
+  ~LightSpatialIndex();
+
+  /**
+   * @brief Starts tracking a light (called automatically for the lights added to the scene).
+   * @param light defines the light to add
+   */
+  void addLight(const LightPtr& light);
+
+  /**
+   * @brief Stops tracking a light (called automatically for the lights removed from the scene).
+   * @param light defines the light to remove
+   */
+  void removeLight(Light* light);
+
+  /**
+   * @brief Starts tracking a mesh (called automatically for the meshes added to the scene).
+   * @param mesh defines the mesh to add
+   */
+  void addMesh(AbstractMesh* mesh);
+
+  /**
+   * @brief Stops tracking a mesh (called automatically for the meshes removed from the scene).
+   * @param mesh defines the mesh to remove
+   */
+  void removeMesh(AbstractMesh* mesh);
+
+  /**
+   * @brief Refits the moved lights and meshes and resynchronizes the light sources of the
+   * impacted meshes, called once per frame by the scene.
+   */
+  void update();
+
+  /**
+   * @brief Computes the ranked list of the lights affecting a mesh.
+   * @param mesh defines the mesh
+   * @param lightSources defines the list receiving the lights
+   */
+  void getLightSources(AbstractMesh* mesh, std::vector<LightPtr>& lightSources) const;
+
+  /**
+   * @brief Gets the number of lights stored in the hierarchy.
+   */
+  [[nodiscard]] size_t localLightCount() const
+  {
+    return _bvh.size();
+  }
+
+  /**
+   * @brief Gets the number of lights affecting every mesh.
+   */
+  [[nodiscard]] size_t globalLightCount() const
+  {
+    return _globalLights.size();
+  }
+
+  /**
+   * @brief Gets the underlying hierarchy.
+   */
+  [[nodiscard]] const DynamicBVH<Light*>& bvh() const
+  {
+    return _bvh;
+  }
+
+private:
+  struct LightProxy {
+    LightPtr light;
+    int proxyId;
+    Vector3 position;
+    float range;
+    float intensity;
+    bool isEnabled;
+  }; // end of struct LightProxy
+
+  struct MeshProxy {
+    int proxyId;
+    int worldMatrixUpdateFlag;
+  }; // end of struct MeshProxy
+
+  static bool _GetInfluence(Light* light, Vector3& position, float& range);
+  void _refitLight(LightProxy& proxy);
+  void _markMeshes(const LightProxy& proxy);
+  void _markAllMeshes();
+
+private:
+  Scene* _scene;
+  DynamicBVH<Light*> _bvh;
+  DynamicBVH<AbstractMesh*> _meshesBvh;
+  std::unordered_map<Light*, LightProxy> _lights;
+  std::vector<Light*> _globalLights;
+  std::unordered_map<AbstractMesh*, MeshProxy> _meshes;
+  std::unordered_set<AbstractMesh*> _dirtyMeshes;
+  std::vector<AbstractMesh*> _selection;
+  Observer<Light>::Ptr _onNewLightAddedObserver;
+  Observer<Light>::Ptr _onLightRemovedObserver;
+  Observer<AbstractMesh>::Ptr _onNewMeshAddedObserver;
+  Observer<AbstractMesh>::Ptr _onMeshRemovedObserver;
+
+}; // end of class LightSpatialIndex
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_LIGHTS_LIGHT_SPATIAL_INDEX_H
@@ -357,6 +357,13 @@ public:
    */
   bool loadAllMaterials;
 
+  /**
+   * Defines if the indices (and vertices) of the loaded triangle meshes are reordered for the
+   * vertex cache, overdraw and vertex fetch (see Mesh::optimizeIndices).
+   * Defaults to false.
+   */
+  bool optimizeIndices;
+
   /**
    * Function called before loading a url referenced by the asset.
    */
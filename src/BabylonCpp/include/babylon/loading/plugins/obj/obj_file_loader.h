@@ -99,6 +99,16 @@ struct BABYLON_SHARED_EXPORT MeshLoadOptions {
    * triggered.
    */
   bool MaterialLoadingFailsSilently;
+  /**
+   * Reorder the indices and vertices of the loaded meshes for the vertex cache, overdraw and
+   * vertex fetch (see Mesh::optimizeIndices).
+   */
+  bool OptimizeIndices;
+  /**
+   * Weld the coincident vertices of the loaded meshes whose attributes match (see
+   * VertexData::weld).
+   */
+  bool WeldVertices;
 }; // end of struct MeshLoadOptions
 
 class AbstractMesh;
@@ -157,6 +167,18 @@ public:
    */
   static bool MATERIAL_LOADING_FAILS_SILENTLY;
 
+  /**
+   * Reorder the indices and vertices of the loaded meshes for the vertex cache, overdraw and
+   * vertex fetch (see Mesh::optimizeIndices).
+   */
+  static bool OPTIMIZE_INDICES;
+
+  /**
+   * Weld the coincident vertices of the loaded meshes whose attributes match (see
+   * VertexData::weld).
+   */
+  static bool WELD_VERTICES;
+
 public:
   /**
    * @brief Creates loader for .OBJ files.
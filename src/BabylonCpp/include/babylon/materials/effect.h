@@ -1,6 +1,7 @@
 ﻿#ifndef BABYLON_MATERIALS_EFFECT_H
 #define BABYLON_MATERIALS_EFFECT_H
 
+#include <future>
 #include <unordered_map>
 #include <variant>
 
@@ -19,6 +20,7 @@ struct IEffectCreationOptions;
 class EffectFallbacks;
 struct IEffectFallbacks;
 class Matrix;
+struct ProcessingOptions;
 class ThinEngine;
 class Vector2;
 class Vector3;
@@ -63,9 +65,18 @@ public:
   static std::unordered_map<std::string, std::string>& ShadersStore();
 
   /**
-   * Store of each included file for a shader (The can be looked up using effect.key)
+   * Store of each included file for a shader (The can be looked up using effect.key). The store is
+   * an immutable snapshot shared with the shaders processed on the engine thread pool.
    */
-  static std::unordered_map<std::string, std::string>& IncludesShadersStore();
+  static std::shared_ptr<const std::unordered_map<std::string, std::string>>
+  IncludesShadersStore();
+
+  /**
+   * @brief Registers or replaces an included file, the includes store is replaced copy-on-write.
+   * @param name defines the name of the include
+   * @param source defines the source code of the include
+   */
+  static void SetIncludeShader(const std::string& name, const std::string& source);
 
 public:
   template <typename... Ts>
@@ -83,7 +94,9 @@ public:
   [[nodiscard]] std::string key() const;
 
   /**
-   * @brief If the effect has been compiled and prepared.
+   * @brief If the effect has been compiled and prepared. When the shaders are processed on the
+   * engine thread pool, the processed code is compiled by the first call made after the processing
+   * is done.
    * @returns if the effect is compiled and prepared.
    */
   [[nodiscard]] bool isReady() const;
@@ -133,6 +146,14 @@ public:
    */
   int getUniformIndex(const std::string& uniformName);
 
+  /**
+   * @brief Gets the handle of a uniform variable, to set the variable without looking up its name.
+   * Handles are stable for the lifetime of the effect and are only valid with this effect.
+   * @param uniformName of the uniform to look up.
+   * @returns the handle of the uniform, -1 if the effect does not declare it.
+   */
+  int getUniformHandle(const std::string& uniformName) const;
+
   /**
    * @brief Returns the attribute based on the name of the variable.
    * @param uniformName of the uniform to look up.
@@ -272,6 +293,16 @@ public:
    */
   void bindUniformBuffer(const WebGLDataBufferPtr& buffer, const std::string& name);
 
+  /**
+   * @brief Binds a range of a buffer to a uniform.
+   * @param buffer Buffer holding the range to bind.
+   * @param name Name of the uniform variable to bind to.
+   * @param byteOffset Offset in bytes of the range.
+   * @param byteLength Size in bytes of the range.
+   */
+  void bindUniformBufferRange(const WebGLDataBufferPtr& buffer, const std::string& name,
+                              size_t byteOffset, size_t byteLength);
+
   /**
    * @brief Binds block to a uniform.
    * @param blockName Name of the block to bind.
@@ -551,6 +582,93 @@ public:
    */
   Effect& setDirectColor4(const std::string& uniformName, const Color4& color4);
 
+  /**
+   * @brief Sets an integer value on a uniform variable.
+   * @param uniformHandle Handle of the variable, as returned by getUniformHandle.
+   * @param value Value to be set.
+   * @returns this effect.
+   */
+  Effect& setInt(int uniformHandle, int value);
+
+  /**
+   * @brief Sets matrix on a uniform variable.
+   * @param uniformHandle Handle of the variable, as returned by getUniformHandle.
+   * @param matrix matrix to be set.
+   * @returns this effect.
+   */
+  Effect& setMatrix(int uniformHandle, const Matrix& matrix);
+
+  /**
+   * @brief Sets a float on a uniform variable.
+   * @param uniformHandle Handle of the variable, as returned by getUniformHandle.
+   * @param value value to be set.
+   * @returns this effect.
+   */
+  Effect& setFloat(int uniformHandle, float value);
+
+  /**
+   * @brief Sets a float2 on a uniform variable.
+   * @param uniformHandle Handle of the variable, as returned by getUniformHandle.
+   * @param x First float in float2.
+   * @param y Second float in float2.
+   * @returns this effect.
+   */
+  Effect& setFloat2(int uniformHandle, float x, float y);
+
+  /**
+   * @brief Sets a float3 on a uniform variable.
+   * @param uniformHandle Handle of the variable, as returned by getUniformHandle.
+   * @param x First float in float3.
+   * @param y Second float in float3.
+   * @param z Third float in float3.
+   * @returns this effect.
+   */
+  Effect& setFloat3(int uniformHandle, float x, float y, float z);
+
+  /**
+   * @brief Sets a float4 on a uniform variable.
+   * @param uniformHandle Handle of the variable, as returned by getUniformHandle.
+   * @param x First float in float4.
+   * @param y Second float in float4.
+   * @param z Third float in float4.
+   * @param w Fourth float in float4.
+   * @returns this effect.
+   */
+  Effect& setFloat4(int uniformHandle, float x, float y, float z, float w);
+
+  /**
+   * @brief Sets a Vector3 on a uniform variable.
+   * @param uniformHandle Handle of the variable, as returned by getUniformHandle.
+   * @param vector3 Value to be set.
+   * @returns this effect.
+   */
+  Effect& setVector3(int uniformHandle, const Vector3& vector3);
+
+  /**
+   * @brief Sets a Vector4 on a uniform variable.
+   * @param uniformHandle Handle of the variable, as returned by getUniformHandle.
+   * @param vector4 Value to be set.
+   * @returns this effect.
+   */
+  Effect& setVector4(int uniformHandle, const Vector4& vector4);
+
+  /**
+   * @brief Sets a Color3 on a uniform variable.
+   * @param uniformHandle Handle of the variable, as returned by getUniformHandle.
+   * @param color3 Value to be set.
+   * @returns this effect.
+   */
+  Effect& setColor3(int uniformHandle, const Color3& color3);
+
+  /**
+   * @brief Sets a Color4 on a uniform variable.
+   * @param uniformHandle Handle of the variable, as returned by getUniformHandle.
+   * @param color3 Value to be set.
+   * @param alpha Alpha value to be set.
+   * @returns this effect.
+   */
+  Effect& setColor4(int uniformHandle, const Color3& color3, float alpha);
+
   /**
    * @brief Release all associated resources.
    */
@@ -625,6 +743,11 @@ private:
     const std::string& migratedVertexCode, const std::string& migratedFragmentCode,
     const std::variant<std::string, std::unordered_map<std::string, std::string>>& baseName);
   bool _isReadyInternal() const;
+  bool _checkShaderProcessing() const;
+  static std::pair<std::string, std::string> _ProcessShaderCodes(
+    const std::string& vertexCode, const std::string& fragmentCode, ProcessingOptions& options,
+    const std::function<std::string(const std::string& shaderType, const std::string& code)>&
+      processFinalCode);
   void _checkIsReady(const IPipelineContextPtr& previousPipelineContext);
   std::tuple<std::string, std::string> _getShaderCodeAndErrorLine(const std::string& code,
                                                                   const std::string& error,
@@ -698,6 +821,11 @@ public:
    * Hidden
    */
   std::string _key;
+  /**
+   * Key of the effect in the engine cache of compiled effects.
+   * Hidden
+   */
+  uint64_t _cacheKey;
   /**
    * Compiled shader to webGL program.
    * Hidden
@@ -739,6 +867,7 @@ private:
   static std::size_t _uniqueIdSeed;
   ThinEngine* _engine;
   std::vector<std::string> _uniformsNames;
+  std::unordered_map<std::string, int> _uniformHandles;
   std::vector<std::string> _samplerList;
   std::unordered_map<std::string, int> _samplers;
   bool _isReady;
@@ -754,7 +883,12 @@ private:
   std::string _fragmentSourceCodeOverride;
   std::vector<std::string> _transformFeedbackVaryings;
   static std::unordered_map<unsigned int, WebGLDataBufferPtr> _baseCache;
+  // Offsets of the bound buffer ranges, the whole buffers bindings are not listed
+  static std::unordered_map<unsigned int, size_t> _baseOffsetCache;
   ShaderProcessingContextPtr _processingContext;
+  // Processed vertex and fragment code, pending while the shaders are processed in background and
+  // consumed by the readiness checks
+  mutable std::future<std::pair<std::string, std::string>> _shaderProcessing;
 
 }; // end of class Effect
 
@@ -1,6 +1,7 @@
 ﻿#ifndef BABYLON_MATERIALS_EFFECT_INCLUDES_SHADERS_STORE_H
 #define BABYLON_MATERIALS_EFFECT_INCLUDES_SHADERS_STORE_H
 
+#include <memory>
 #include <string>
 #include <unordered_map>
 
@@ -8,17 +9,36 @@
 
 namespace BABYLON {
 
+/**
+ * @brief Store of the included files of the shaders.
+ *
+ * The includes are published as an immutable snapshot, which the effects processed on the engine
+ * thread pool keep for the duration of the processing. Registering an include copies the current
+ * snapshot and publishes the copy (copy-on-write).
+ */
 class BABYLON_SHARED_EXPORT EffectIncludesShadersStore {
 
+public:
+  using IncludesMap = std::unordered_map<std::string, std::string>;
+
 public:
   EffectIncludesShadersStore();
   ~EffectIncludesShadersStore(); // = default
 
-  std::unordered_map<std::string, std::string>& shaders();
-  [[nodiscard]] const std::unordered_map<std::string, std::string>& shaders() const;
+  /**
+   * @brief Returns the current snapshot of the includes, safe to read from any thread.
+   */
+  [[nodiscard]] std::shared_ptr<const IncludesMap> shaders() const;
+
+  /**
+   * @brief Registers or replaces an include, the snapshots already handed out are not modified.
+   * @param name defines the name of the include
+   * @param source defines the source code of the include
+   */
+  void setShader(const std::string& name, const std::string& source);
 
 private:
-  static std::unordered_map<std::string, std::string> _shaders;
+  static std::shared_ptr<const IncludesMap> _shaders;
 
 }; // end of class EffectIncludesShadersStore
 
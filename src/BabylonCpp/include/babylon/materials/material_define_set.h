@@ -0,0 +1,416 @@
+#ifndef BABYLON_MATERIALS_MATERIAL_DEFINE_SET_H
+#define BABYLON_MATERIALS_MATERIAL_DEFINE_SET_H
+
+#include <algorithm>
+#include <cstring>
+#include <initializer_list>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <babylon/babylon_api.h>
+
+namespace BABYLON {
+
+/**
+ * Identifier of an interned define name.
+ */
+using MaterialDefineId = uint32_t;
+
+/**
+ * @brief Process wide registry of the define names, each name is interned once and gets a
+ * small dense identifier used to index the define sets.
+ */
+struct BABYLON_SHARED_EXPORT MaterialDefineRegistry {
+
+  /**
+   * @brief Returns the identifier of a define name, interning the name if needed.
+   * @param name defines the define name
+   * @returns the define identifier
+   */
+  static MaterialDefineId Intern(const std::string& name);
+
+  /**
+   * @brief Returns the identifier of a define name if the name was already interned.
+   * @param name defines the define name
+   * @param id receives the define identifier
+   * @returns true if the name is interned
+   */
+  static bool Find(const std::string& name, MaterialDefineId& id);
+
+  /**
+   * @brief Returns the name of an interned define.
+   * @param id defines the define identifier
+   * @returns the define name
+   */
+  static const std::string& Name(MaterialDefineId id);
+
+}; // end of struct MaterialDefineRegistry
+
+/** @hidden */
+namespace MaterialDefineHash {
+
+static constexpr uint64_t Seed = 14695981039346656037ull;
+
+// FNV-1a
+inline uint64_t Combine(uint64_t hash, const void* data, size_t byteLength)
+{
+  auto bytes = static_cast<const uint8_t*>(data);
+  for (size_t i = 0; i < byteLength; ++i) {
+    hash = (hash ^ bytes[i]) * 1099511628211ull;
+  }
+  return hash;
+}
+
+} // end of namespace MaterialDefineHash
+
+/**
+ * @brief Set of boolean defines stored as two bitsets indexed by the define identifiers: the
+ * defines present in the set and their values.
+ */
+class BABYLON_SHARED_EXPORT MaterialBoolDefines {
+
+public:
+  /**
+   * @brief Reference to a define value, marks the define as present when created.
+   */
+  class Reference {
+
+  public:
+    Reference(MaterialBoolDefines& defines, MaterialDefineId id) : _defines{defines}, _id{id}
+    {
+    }
+
+    operator bool() const
+    {
+      return _defines.get(_id);
+    }
+
+    Reference& operator=(bool value)
+    {
+      _defines.set(_id, value);
+      return *this;
+    }
+
+    Reference& operator=(const Reference& other)
+    {
+      return *this = static_cast<bool>(other);
+    }
+
+  private:
+    MaterialBoolDefines& _defines;
+    MaterialDefineId _id;
+
+  }; // end of class Reference
+
+public:
+  MaterialBoolDefines() = default;
+  MaterialBoolDefines(std::initializer_list<std::pair<std::string, bool>> defines)
+  {
+    *this = defines;
+  }
+
+  MaterialBoolDefines& operator=(std::initializer_list<std::pair<std::string, bool>> defines)
+  {
+    clear();
+    for (const auto& define : defines) {
+      set(MaterialDefineRegistry::Intern(define.first), define.second);
+    }
+    return *this;
+  }
+
+  Reference operator[](const std::string& name)
+  {
+    return operator[](MaterialDefineRegistry::Intern(name));
+  }
+
+  Reference operator[](MaterialDefineId id)
+  {
+    _reserve(id);
+    _present[id >> 6] |= _bit(id);
+    return Reference(*this, id);
+  }
+
+  [[nodiscard]] bool contains(const std::string& name) const
+  {
+    MaterialDefineId id;
+    return MaterialDefineRegistry::Find(name, id) && contains(id);
+  }
+
+  [[nodiscard]] bool contains(MaterialDefineId id) const
+  {
+    return (id >> 6) < _present.size() && (_present[id >> 6] & _bit(id));
+  }
+
+  /**
+   * @brief Returns the value of a define, false if the define is not present.
+   */
+  [[nodiscard]] bool get(MaterialDefineId id) const
+  {
+    return (id >> 6) < _values.size() && (_values[id >> 6] & _bit(id));
+  }
+
+  void set(MaterialDefineId id, bool value)
+  {
+    _reserve(id);
+    _present[id >> 6] |= _bit(id);
+    if (value) {
+      _values[id >> 6] |= _bit(id);
+    }
+    else {
+      _values[id >> 6] &= ~_bit(id);
+    }
+  }
+
+  void erase(const std::string& name)
+  {
+    MaterialDefineId id;
+    if (MaterialDefineRegistry::Find(name, id) && (id >> 6) < _present.size()) {
+      _present[id >> 6] &= ~_bit(id);
+      _values[id >> 6] &= ~_bit(id);
+    }
+  }
+
+  void clear()
+  {
+    _present.clear();
+    _values.clear();
+  }
+
+  [[nodiscard]] size_t size() const
+  {
+    size_t count = 0;
+    for (auto word : _present) {
+      for (; word; word &= word - 1) {
+        ++count;
+      }
+    }
+    return count;
+  }
+
+  bool operator==(const MaterialBoolDefines& other) const
+  {
+    return _equal(_present, other._present) && _equal(_values, other._values);
+  }
+
+  bool operator!=(const MaterialBoolDefines& other) const
+  {
+    return !(*this == other);
+  }
+
+  /**
+   * @brief Combines the present defines and their values into a hash, equal sets give the same
+   * hash.
+   */
+  [[nodiscard]] uint64_t hash(uint64_t hash) const
+  {
+    // The values are only set for present defines, they fit in the same number of words
+    const auto length = _trimmedLength(_present);
+    const auto bytes  = length * sizeof(uint64_t);
+    hash              = MaterialDefineHash::Combine(hash, &length, sizeof(length));
+    hash              = MaterialDefineHash::Combine(hash, _present.data(), bytes);
+    return MaterialDefineHash::Combine(hash, _values.data(), bytes);
+  }
+
+  /**
+   * @brief Calls a function with the identifier and the value of each present define, in
+   * identifier order.
+   */
+  template <typename Function>
+  void forEach(Function&& function) const
+  {
+    for (size_t w = 0; w < _present.size(); ++w) {
+      const auto word = _present[w];
+      for (uint32_t b = 0; b < 64 && (word >> b); ++b) {
+        if (word & (1ull << b)) {
+          const auto id = static_cast<MaterialDefineId>((w << 6) + b);
+          function(id, get(id));
+        }
+      }
+    }
+  }
+
+private:
+  static uint64_t _bit(MaterialDefineId id)
+  {
+    return 1ull << (id & 63);
+  }
+
+  void _reserve(MaterialDefineId id)
+  {
+    if ((id >> 6) >= _present.size()) {
+      _present.resize((id >> 6) + 1, 0);
+      _values.resize((id >> 6) + 1, 0);
+    }
+  }
+
+  static size_t _trimmedLength(const std::vector<uint64_t>& words)
+  {
+    auto length = words.size();
+    while (length && words[length - 1] == 0) {
+      --length;
+    }
+    return length;
+  }
+
+  // Missing words are zero
+  static bool _equal(const std::vector<uint64_t>& lhs, const std::vector<uint64_t>& rhs)
+  {
+    const auto length = _trimmedLength(lhs);
+    return length == _trimmedLength(rhs)
+           && (length == 0
+               || std::memcmp(lhs.data(), rhs.data(), length * sizeof(uint64_t)) == 0);
+  }
+
+private:
+  std::vector<uint64_t> _present;
+  std::vector<uint64_t> _values;
+
+}; // end of class MaterialBoolDefines
+
+/**
+ * @brief Set of valued defines (int, float or string) stored in a small array sorted by define
+ * identifier.
+ */
+template <typename T>
+class MaterialValueDefines {
+
+public:
+  using Entry = std::pair<MaterialDefineId, T>;
+
+public:
+  MaterialValueDefines() = default;
+  MaterialValueDefines(std::initializer_list<std::pair<std::string, T>> defines)
+  {
+    *this = defines;
+  }
+
+  MaterialValueDefines& operator=(std::initializer_list<std::pair<std::string, T>> defines)
+  {
+    clear();
+    for (const auto& define : defines) {
+      operator[](MaterialDefineRegistry::Intern(define.first)) = define.second;
+    }
+    return *this;
+  }
+
+  T& operator[](const std::string& name)
+  {
+    return operator[](MaterialDefineRegistry::Intern(name));
+  }
+
+  T& operator[](MaterialDefineId id)
+  {
+    auto it = _lowerBound(id);
+    if (it == _entries.end() || it->first != id) {
+      it = _entries.insert(it, Entry{id, T{}});
+    }
+    return it->second;
+  }
+
+  [[nodiscard]] bool contains(const std::string& name) const
+  {
+    MaterialDefineId id;
+    return MaterialDefineRegistry::Find(name, id) && contains(id);
+  }
+
+  [[nodiscard]] bool contains(MaterialDefineId id) const
+  {
+    auto it = std::lower_bound(
+      _entries.begin(), _entries.end(), id,
+      [](const Entry& entry, MaterialDefineId value) { return entry.first < value; });
+    return it != _entries.end() && it->first == id;
+  }
+
+  void erase(const std::string& name)
+  {
+    MaterialDefineId id;
+    if (MaterialDefineRegistry::Find(name, id)) {
+      auto it = _lowerBound(id);
+      if (it != _entries.end() && it->first == id) {
+        _entries.erase(it);
+      }
+    }
+  }
+
+  void clear()
+  {
+    _entries.clear();
+  }
+
+  [[nodiscard]] size_t size() const
+  {
+    return _entries.size();
+  }
+
+  typename std::vector<Entry>::const_iterator begin() const
+  {
+    return _entries.begin();
+  }
+
+  typename std::vector<Entry>::const_iterator end() const
+  {
+    return _entries.end();
+  }
+
+  bool operator==(const MaterialValueDefines& other) const
+  {
+    if (_entries.size() != other._entries.size()) {
+      return false;
+    }
+    if (_entries.empty()) {
+      return true;
+    }
+    if constexpr (std::is_trivially_copyable_v<T> && sizeof(Entry) == 2 * sizeof(uint32_t)) {
+      return std::memcmp(_entries.data(), other._entries.data(), _entries.size() * sizeof(Entry))
+             == 0;
+    }
+    else {
+      return _entries == other._entries;
+    }
+  }
+
+  bool operator!=(const MaterialValueDefines& other) const
+  {
+    return !(*this == other);
+  }
+
+  /**
+   * @brief Combines the identifiers and the values of the defines into a hash, equal sets give the
+   * same hash.
+   */
+  [[nodiscard]] uint64_t hash(uint64_t hash) const
+  {
+    const auto count = _entries.size();
+    hash             = MaterialDefineHash::Combine(hash, &count, sizeof(count));
+    for (const auto& entry : _entries) {
+      hash = MaterialDefineHash::Combine(hash, &entry.first, sizeof(entry.first));
+      if constexpr (std::is_same_v<T, std::string>) {
+        const auto length = entry.second.size();
+        hash              = MaterialDefineHash::Combine(hash, &length, sizeof(length));
+        hash              = MaterialDefineHash::Combine(hash, entry.second.data(), length);
+      }
+      else {
+        hash = MaterialDefineHash::Combine(hash, &entry.second, sizeof(entry.second));
+      }
+    }
+    return hash;
+  }
+
+private:
+  typename std::vector<Entry>::iterator _lowerBound(MaterialDefineId id)
+  {
+    return std::lower_bound(
+      _entries.begin(), _entries.end(), id,
+      [](const Entry& entry, MaterialDefineId value) { return entry.first < value; });
+  }
+
+private:
+  std::vector<Entry> _entries;
+
+}; // end of class MaterialValueDefines
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_MATERIALS_MATERIAL_DEFINE_SET_H
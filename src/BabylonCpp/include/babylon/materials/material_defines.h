@@ -1,10 +1,9 @@
 #ifndef BABYLON_MATERIALS_MATERIAL_DEFINES_H
 #define BABYLON_MATERIALS_MATERIAL_DEFINES_H
 
-#include <unordered_map>
-
 #include <babylon/babylon_api.h>
 #include <babylon/materials/imaterial_defines.h>
+#include <babylon/materials/material_define_set.h>
 
 namespace BABYLON {
 
@@ -107,6 +106,13 @@ struct BABYLON_SHARED_EXPORT MaterialDefines : public IMaterialDefines {
    */
   void reset() override;
 
+  /**
+   * @brief Returns a 64-bit key of the define values, equal define sets have the same key. The
+   * key is built from the interned define identifiers and is only valid for the process lifetime.
+   * @returns the key of the define values
+   */
+  [[nodiscard]] uint64_t hashCode() const;
+
   /**
    * @brief Converts the material define values to a string.
    * @returns String of material define information.
@@ -114,10 +120,10 @@ struct BABYLON_SHARED_EXPORT MaterialDefines : public IMaterialDefines {
   std::string toString() const override;
 
   // Properties
-  std::unordered_map<std::string, bool> boolDef;
-  std::unordered_map<std::string, int> intDef;
-  std::unordered_map<std::string, float> floatDef;
-  std::unordered_map<std::string, std::string> stringDef;
+  MaterialBoolDefines boolDef;
+  MaterialValueDefines<int> intDef;
+  MaterialValueDefines<float> floatDef;
+  MaterialValueDefines<std::string> stringDef;
 
   bool _isDirty;
   /** Hidden */
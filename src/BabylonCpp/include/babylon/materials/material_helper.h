@@ -72,6 +72,15 @@ struct BABYLON_SHARED_EXPORT MaterialHelper {
   static void BindTextureMatrix(BaseTexture& texture, UniformBuffer& uniformBuffer,
                                 const std::string& key);
 
+  /**
+   * @brief Binds a texture matrix value to its corresponding uniform.
+   * @param texture The texture to bind the matrix for
+   * @param uniformBuffer The uniform buffer receiving the data
+   * @param uniformHandle The handle of the matrix uniform in the uniform buffer
+   */
+  static void BindTextureMatrix(BaseTexture& texture, UniformBuffer& uniformBuffer,
+                                int uniformHandle);
+
   /**
    * @brief Gets the current status of the fog (should it be enabled?).
    * @param mesh defines the mesh to evaluate for fog support
@@ -432,6 +432,7 @@ private:
   void _initializeBlock(const NodeMaterialBlockPtr& node, const NodeMaterialBuildStatePtr& state,
                         std::vector<NodeMaterialBlockPtr>& nodesToProcessForOtherBuildState);
   void _resetDualBlocks(const NodeMaterialBlockPtr& node, size_t id);
+  void _restoreOptimizedGraph();
   void _prepareDefinesForAttributes(AbstractMesh* mesh, NodeMaterialDefines& defines);
   PostProcessPtr
   _createEffectForPostProcess(PostProcessPtr postProcess, const CameraPtr& camera = nullptr,
@@ -134,7 +134,7 @@ protected:
    * @param ownerBlock defines the block hosting this connection point
    * @param direction defines the direction of the connection point
    */
-  NodeMaterialConnectionPoint(const std::string& name, const NodeMaterialBlockPtr& ownerBlock,
+  NodeMaterialConnectionPoint(const std::string& name, NodeMaterialBlock* ownerBlock,
                               const NodeMaterialConnectionPointDirection& direction);
 
   /**
@@ -199,7 +199,8 @@ protected:
   NodeMaterialConnectionPointPtr& get_connectedPoint();
 
   /**
-   * @brief Get the block that owns this connection point.
+   * @brief Get the block that owns this connection point. The shared pointer is resolved on first
+   * use, it is null while the owner block is still being constructed.
    */
   NodeMaterialBlockPtr& get_ownerBlock();
 
@@ -239,6 +240,8 @@ public:
   /** Hidden */
   NodeMaterialBlockPtr _ownerBlock;
   /** Hidden */
+  NodeMaterialBlock* _rawOwnerBlock;
+  /** Hidden */
   NodeMaterialConnectionPointPtr _connectedPoint;
 
   /** Hidden */
@@ -358,7 +361,7 @@ public:
   ReadOnlyProperty<NodeMaterialConnectionPoint, NodeMaterialConnectionPointPtr> connectedPoint;
 
   /**
-   * Get the block that owns this connection point.
+   * Get the block that owns this connection point (null in the constructor of the owner block).
    */
   ReadOnlyProperty<NodeMaterialConnectionPoint, NodeMaterialBlockPtr> ownerBlock;
 
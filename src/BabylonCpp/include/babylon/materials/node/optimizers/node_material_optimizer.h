@@ -1,7 +1,9 @@
 #ifndef BABYLON_MATERIALS_NODE_OPTIMIZERS_NODE_MATERIAL_OPTIMIZER_H
 #define BABYLON_MATERIALS_NODE_OPTIMIZERS_NODE_MATERIAL_OPTIMIZER_H
 
+#include <functional>
 #include <memory>
+#include <utility>
 #include <vector>
 
 #include <babylon/babylon_api.h>
@@ -9,10 +11,61 @@
 namespace BABYLON {
 
 class NodeMaterialBlock;
-using NodeMaterialBlockPtr = std::shared_ptr<NodeMaterialBlock>;
+class NodeMaterialConnectionPoint;
+using NodeMaterialBlockPtr           = std::shared_ptr<NodeMaterialBlock>;
+using NodeMaterialConnectionPointPtr = std::shared_ptr<NodeMaterialConnectionPoint>;
+
+/**
+ * @brief Statistics of the last optimization of a NodeMaterial graph.
+ *
+ * The instruction counts are the numbers of non input blocks emitting code in each shader.
+ */
+struct BABYLON_SHARED_EXPORT NodeMaterialOptimizerStatistics {
+  /**
+   * Number of instructions of the vertex shader before the optimization
+   */
+  size_t vertexInstructionsBefore = 0;
+  /**
+   * Number of instructions of the fragment shader before the optimization
+   */
+  size_t fragmentInstructionsBefore = 0;
+  /**
+   * Number of instructions of the vertex shader after the optimization
+   */
+  size_t vertexInstructionsAfter = 0;
+  /**
+   * Number of instructions of the fragment shader after the optimization
+   */
+  size_t fragmentInstructionsAfter = 0;
+  /**
+   * Number of blocks disconnected because they do not reach the outputs
+   */
+  size_t removedBlocks = 0;
+  /**
+   * Number of blocks replaced by constants
+   */
+  size_t foldedBlocks = 0;
+  /**
+   * Number of blocks replaced by uniforms computed on the CPU
+   */
+  size_t hoistedBlocks = 0;
+  /**
+   * Number of blocks merged with an identical block
+   */
+  size_t mergedBlocks = 0;
+}; // end of struct NodeMaterialOptimizerStatistics
 
 /**
  * @brief Root class for all node material optimizers.
+ *
+ * The default optimizer rewires the graph before the blocks are initialized:
+ * - the math blocks whose inputs are all constant input blocks are replaced by a constant,
+ * - the math blocks whose inputs are constant or uniform input blocks are replaced by a uniform
+ *   computed on the CPU when the material is bound, instead of once per vertex or fragment,
+ * - the identical blocks (same operation on the same inputs) are merged,
+ * - the blocks which do not reach the outputs are disconnected.
+ * The changed connections are recorded so that the graph authored by the user can be restored
+ * once the shaders are generated.
  */
 struct BABYLON_SHARED_EXPORT NodeMaterialOptimizer {
   virtual ~NodeMaterialOptimizer() = default;
@@ -22,9 +75,92 @@ struct BABYLON_SHARED_EXPORT NodeMaterialOptimizer {
    * shader
    * @param fragmentOutputNodes defines the list of output nodes for the
    * fragment shader
+   * @param attachedBlocks defines the list of blocks attached to the material, including the
+   * ones which do not reach the outputs
    */
   virtual void optimize(const std::vector<NodeMaterialBlockPtr>& vertexOutputNodes,
-                        const std::vector<NodeMaterialBlockPtr>& fragmentOutputNodes);
+                        const std::vector<NodeMaterialBlockPtr>& fragmentOutputNodes,
+                        const std::vector<NodeMaterialBlockPtr>& attachedBlocks);
+
+  /**
+   * @brief Restores the connections changed by the last optimization.
+   * @returns the blocks created by the last optimization, which are no longer part of the graph
+   */
+  std::vector<NodeMaterialBlockPtr> restore();
+
+  /**
+   * Defines if the constant and uniform only blocks are folded
+   */
+  bool foldConstants = true;
+  /**
+   * Defines if the identical blocks are merged
+   */
+  bool mergeIdenticalBlocks = true;
+  /**
+   * Defines if the blocks which do not reach the outputs are disconnected
+   */
+  bool removeDeadBlocks = true;
+  /**
+   * Statistics of the last optimization
+   */
+  NodeMaterialOptimizerStatistics statistics;
+
+protected:
+  /**
+   * @brief Counts the instructions of each shader.
+   */
+  void _countInstructions(const std::vector<NodeMaterialBlockPtr>& vertexOutputNodes,
+                          const std::vector<NodeMaterialBlockPtr>& fragmentOutputNodes,
+                          size_t& vertexInstructions, size_t& fragmentInstructions) const;
+
+  /**
+   * @brief Replaces the constant and uniform only blocks by input blocks.
+   */
+  void _foldConstants(const std::vector<NodeMaterialBlockPtr>& blocks);
+
+  /**
+   * @brief Merges the identical blocks.
+   */
+  void _mergeIdenticalBlocks(const std::vector<NodeMaterialBlockPtr>& blocks);
+
+  /**
+   * @brief Disconnects the blocks which are not in the list of reachable blocks.
+   * @returns the number of disconnected blocks
+   */
+  size_t _removeDeadBlocks(const std::vector<NodeMaterialBlockPtr>& blocks,
+                           const std::vector<NodeMaterialBlockPtr>& attachedBlocks);
+
+  /**
+   * @brief Disconnects an input connection point, the previous connection is recorded.
+   */
+  void _disconnect(const NodeMaterialConnectionPointPtr& endpoint);
+
+  /**
+   * @brief Moves the endpoints of an output connection point to another output.
+   * @returns true if at least one endpoint was moved
+   */
+  bool _reconnect(const NodeMaterialConnectionPointPtr& from,
+                  const NodeMaterialConnectionPointPtr& to,
+                  const std::function<bool(const NodeMaterialConnectionPointPtr& endpoint)>& filter
+                  = nullptr);
+
+  /**
+   * @brief Returns the blocks reachable from the outputs, inputs first.
+   */
+  static std::vector<NodeMaterialBlockPtr>
+  _GetReachableBlocks(const std::vector<NodeMaterialBlockPtr>& vertexOutputNodes,
+                      const std::vector<NodeMaterialBlockPtr>& fragmentOutputNodes);
+
+private:
+  /**
+   * Disconnected input connection points with the output they were connected to, in order
+   */
+  std::vector<std::pair<NodeMaterialConnectionPointPtr, NodeMaterialConnectionPointPtr>>
+    _previousConnections;
+  /**
+   * Blocks created by the last optimization
+   */
+  std::vector<NodeMaterialBlockPtr> _createdBlocks;
 
 }; // end of struct NodeMaterialOptimizer
 
@@ -66,10 +66,20 @@ protected:
   void _afterBind(Mesh* mesh, const EffectPtr& effect = nullptr) override;
   bool _mustRebind(Scene* scene, const EffectPtr& effect, float visibility = 1.f);
 
+private:
+  void _resolveMatrixHandles();
+
 protected:
   EffectPtr _activeEffect;
   Matrix _normalMatrix;
 
+private:
+  // Handles of the matrices bound per instance in the active effect
+  const Effect* _matrixHandlesEffect;
+  size_t _matrixHandlesEffectId;
+  int _worldHandle;
+  int _normalMatrixHandle;
+
 }; // end of class PushMaterial
 
 } // end of namespace BABYLON
@@ -818,6 +818,51 @@ private:
    */
   Observer<ImageProcessingConfiguration>::Ptr _imageProcessingObserver;
 
+  /**
+   * Handles of the uniforms of the material uniform buffer, resolved when the layout is built.
+   */
+  struct UniformHandles {
+    int diffuseLeftColor     = -1;
+    int diffuseRightColor    = -1;
+    int opacityParts         = -1;
+    int reflectionLeftColor  = -1;
+    int reflectionRightColor = -1;
+    int refractionLeftColor  = -1;
+    int refractionRightColor = -1;
+    int emissiveLeftColor    = -1;
+    int emissiveRightColor   = -1;
+    int vDiffuseInfos        = -1;
+    int vAmbientInfos        = -1;
+    int vOpacityInfos        = -1;
+    int vReflectionInfos     = -1;
+    int vReflectionPosition  = -1;
+    int vReflectionSize      = -1;
+    int vEmissiveInfos       = -1;
+    int vLightmapInfos       = -1;
+    int vSpecularInfos       = -1;
+    int vBumpInfos           = -1;
+    int diffuseMatrix        = -1;
+    int ambientMatrix        = -1;
+    int opacityMatrix        = -1;
+    int reflectionMatrix     = -1;
+    int emissiveMatrix       = -1;
+    int lightmapMatrix       = -1;
+    int specularMatrix       = -1;
+    int bumpMatrix           = -1;
+    int vTangentSpaceParams  = -1;
+    int pointSize            = -1;
+    int alphaCutOff          = -1;
+    int refractionMatrix     = -1;
+    int vRefractionInfos     = -1;
+    int vRefractionPosition  = -1;
+    int vRefractionSize      = -1;
+    int vSpecularColor       = -1;
+    int vEmissiveColor       = -1;
+    int vDiffuseColor        = -1;
+    int vAmbientColor        = -1;
+  }; // end of struct UniformHandles
+  UniformHandles _uniformHandles;
+
 }; // end of class StandardMaterial
 
 } // end of namespace BABYLON
@@ -9,6 +9,7 @@
 #include <babylon/babylon_api.h>
 #include <babylon/babylon_common.h>
 #include <babylon/babylon_fwd.h>
+#include <babylon/engines/uniform_buffer_ring.h>
 
 namespace BABYLON {
 
@@ -189,6 +190,84 @@ public:
    */
   void updateUniformArray(const std::string& uniformName, const Float32Array& data, size_t size);
 
+  /**
+   * @brief Gets the handle of an uniform, to update it without looking up its name. Handles are
+   * stable for the lifetime of the buffer.
+   * @param uniformName Define the name of the uniform, as used in the uniform block in the shader.
+   * @returns the handle of the uniform, -1 if the uniform was not added to the layout.
+   */
+  int getUniformHandle(const std::string& uniformName) const;
+
+  /**
+   * @brief Updates a float uniform.
+   * @param uniformHandle Define the handle of the uniform, as returned by getUniformHandle.
+   * @param x Define the value
+   */
+  void updateFloatByHandle(int uniformHandle, float x);
+
+  /**
+   * @brief Updates a vec2 uniform.
+   * @param uniformHandle Define the handle of the uniform, as returned by getUniformHandle.
+   * @param x Define the first component
+   * @param y Define the second component
+   */
+  void updateFloat2ByHandle(int uniformHandle, float x, float y);
+
+  /**
+   * @brief Updates a vec3 uniform.
+   * @param uniformHandle Define the handle of the uniform, as returned by getUniformHandle.
+   * @param x Define the first component
+   * @param y Define the second component
+   * @param z Define the third component
+   */
+  void updateFloat3ByHandle(int uniformHandle, float x, float y, float z);
+
+  /**
+   * @brief Updates a vec4 uniform.
+   * @param uniformHandle Define the handle of the uniform, as returned by getUniformHandle.
+   * @param x Define the first component
+   * @param y Define the second component
+   * @param z Define the third component
+   * @param w Define the fourth component
+   */
+  void updateFloat4ByHandle(int uniformHandle, float x, float y, float z, float w);
+
+  /**
+   * @brief Updates a mat4 uniform, the matrix is written directly without an intermediate copy.
+   * @param uniformHandle Define the handle of the uniform, as returned by getUniformHandle.
+   * @param mat Define the matrix
+   */
+  void updateMatrixByHandle(int uniformHandle, const Matrix& mat);
+
+  /**
+   * @brief Updates a vec3 uniform from a Vector3.
+   * @param uniformHandle Define the handle of the uniform, as returned by getUniformHandle.
+   * @param vector Define the vector
+   */
+  void updateVector3ByHandle(int uniformHandle, const Vector3& vector);
+
+  /**
+   * @brief Updates a vec4 uniform from a Vector4.
+   * @param uniformHandle Define the handle of the uniform, as returned by getUniformHandle.
+   * @param vector Define the vector
+   */
+  void updateVector4ByHandle(int uniformHandle, const Vector4& vector);
+
+  /**
+   * @brief Updates a vec3 uniform from a Color3.
+   * @param uniformHandle Define the handle of the uniform, as returned by getUniformHandle.
+   * @param color Define the color
+   */
+  void updateColor3ByHandle(int uniformHandle, const Color3& color);
+
+  /**
+   * @brief Updates a vec4 uniform from a Color3 and an alpha value.
+   * @param uniformHandle Define the handle of the uniform, as returned by getUniformHandle.
+   * @param color Define the color
+   * @param alpha Define the alpha value
+   */
+  void updateColor4ByHandle(int uniformHandle, const Color3& color, float alpha);
+
   /**
    * @brief Sets a sampler uniform on the effect.
    * @param name Define the name of the sampler.
@@ -246,6 +325,9 @@ protected:
 private:
   void _createNewBuffer();
   void _checkNewFrame();
+  bool _isCreated() const;
+  void _allocateInRing(UniformBufferRing& ring);
+  void _countUpdateInFrame();
 
   /**
    * @brief std140 layout specifies how to align data within an UBO structure.
@@ -253,8 +335,32 @@ private:
    */
   void _fillAlignment(size_t size);
 
+  /**
+   * Uniform of the layout. In the UBO implementation, the slot locates the uniform in the buffer
+   * data. Otherwise, it caches the handle of the uniform in the current effect.
+   */
+  struct UniformSlot {
+    std::string name;
+    size_t location = 0;
+    size_t size     = 0;
+    // Update flag of the last matrix written to the slot
+    bool hasMatrixFlag   = false;
+    int matrixUpdateFlag = 0;
+    // Handle of the uniform in the effect the slot was last used with
+    const Effect* effect = nullptr;
+    size_t effectId      = 0;
+    int effectHandle     = -1;
+  }; // end of struct UniformSlot
+
+  void _addUniformSlot(const std::string& name, size_t location, size_t size);
+  UniformSlot* _getSlot(int uniformHandle);
+  UniformSlot* _getSlotForUpdate(const std::string& name, size_t size);
+  int _getEffectHandle(int uniformHandle);
+  void _updateSlot(UniformSlot& slot, const float* data, size_t size);
+  void _updateUniformByHandle(int uniformHandle, const float* data, size_t size);
+
   // Matrix cache
-  bool _cacheMatrix(const std::string& name, const Matrix& matrix);
+  bool _cacheMatrix(UniformSlot& slot, const Matrix& matrix);
 
   // Update methods
   void _updateMatrix3x3ForUniform(const std::string& name, const Float32Array& matrix);
@@ -487,8 +593,8 @@ private:
   Float32Array _data;
   Float32Array _bufferData;
   bool _dynamic;
-  std::unordered_map<std::string, size_t> _uniformLocations;
-  std::unordered_map<std::string, size_t> _uniformSizes;
+  std::vector<UniformSlot> _uniformSlots;
+  std::unordered_map<std::string, size_t> _uniformSlotIndices;
   std::unordered_map<std::string, ArraySizes> _uniformArraySizes;
   size_t _uniformLocationPointer;
   bool _needSync;
@@ -497,9 +603,8 @@ private:
   std::string _currentEffectName;
   std::string _name;
   size_t _currentFrameId;
-
-  // Matrix cache
-  std::unordered_map<std::string, int> _valueCache;
+  // Range holding the data when the uniform buffers are sub-allocated in the engine ring
+  UniformBufferRing::Range _ringRange;
 
   // Pool for avoiding memory leaks
   static constexpr unsigned int _MAX_UNIFORM_SIZE = 256;
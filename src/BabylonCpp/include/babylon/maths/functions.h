@@ -11,17 +11,18 @@ namespace BABYLON {
 
 /**
  * @brief Extracts minimum and maximum values from a list of indexed
- * positions.
- * @param positions defines the positions to use
+ * positions stored in place (e.g. in a vertex buffer).
+ * @param positions defines the first component of the first position
  * @param indices defines the indices to the positions
  * @param indexStart defines the start index
  * @param indexCount defines the end index
  * @param bias defines bias value to add to the result
+ * @param stride defines the distance between two positions (in floats)
  * @return minimum and maximum values
  */
-inline MinMax extractMinAndMaxIndexed(const Float32Array& positions, const Uint32Array& indices,
+inline MinMax extractMinAndMaxIndexed(const float* positions, const Uint32Array& indices,
                                       size_t indexStart, size_t indexCount,
-                                      const std::optional<Vector2>& bias = std::nullopt)
+                                      const std::optional<Vector2>& bias, size_t stride)
 {
   Vector3 minimum(std::numeric_limits<float>::max(), std::numeric_limits<float>::max(),
                   std::numeric_limits<float>::max());
@@ -29,7 +30,7 @@ inline MinMax extractMinAndMaxIndexed(const Float32Array& positions, const Uint3
                   std::numeric_limits<float>::lowest());
 
   for (size_t index = indexStart; index < indexStart + indexCount; ++index) {
-    const auto offset = indices[index] * 3;
+    const auto offset = indices[index] * stride;
     const auto x      = positions[offset];
     const auto y      = positions[offset + 1];
     const auto z      = positions[offset + 2];
@@ -51,31 +52,42 @@ inline MinMax extractMinAndMaxIndexed(const Float32Array& positions, const Uint3
 }
 
 /**
- * @brief Extracts minimum and maximum values from a list of positions.
+ * @brief Extracts minimum and maximum values from a list of indexed
+ * positions.
  * @param positions defines the positions to use
+ * @param indices defines the indices to the positions
+ * @param indexStart defines the start index
+ * @param indexCount defines the end index
+ * @param bias defines bias value to add to the result
+ * @return minimum and maximum values
+ */
+inline MinMax extractMinAndMaxIndexed(const Float32Array& positions, const Uint32Array& indices,
+                                      size_t indexStart, size_t indexCount,
+                                      const std::optional<Vector2>& bias = std::nullopt)
+{
+  return extractMinAndMaxIndexed(positions.data(), indices, indexStart, indexCount, bias, 3);
+}
+
+/**
+ * @brief Extracts minimum and maximum values from a list of positions
+ * stored in place (e.g. in a vertex buffer).
+ * @param positions defines the first component of the first position
  * @param start defines the start index in the positions array
  * @param count defines the number of positions to handle
  * @param bias defines bias value to add to the result
- * @param stride defines the stride size to use (distance between two
- * positions in the positions array)
+ * @param stride defines the distance between two positions (in floats)
  * @return minimum and maximum values
  */
-inline MinMax extractMinAndMax(const Float32Array& positions, size_t start, size_t count,
-                               const std::optional<Vector2>& bias = std::nullopt,
-                               std::optional<unsigned int> stride = std::nullopt)
+inline MinMax extractMinAndMax(const float* positions, size_t start, size_t count,
+                               const std::optional<Vector2>& bias, size_t stride)
 {
   Vector3 minimum(std::numeric_limits<float>::max(), std::numeric_limits<float>::max(),
                   std::numeric_limits<float>::max());
   Vector3 maximum(std::numeric_limits<float>::lowest(), std::numeric_limits<float>::lowest(),
                   std::numeric_limits<float>::lowest());
 
-  if (!stride) {
-    stride = 3;
-  }
-
-  auto _stride = *stride;
-  for (size_t index = start, offset = start * _stride; index < start + count;
-       index++, offset += _stride) {
+  for (size_t index = start, offset = start * stride; index < start + count;
+       index++, offset += stride) {
     const auto x = positions[offset];
     const auto y = positions[offset + 1];
     const auto z = positions[offset + 2];
@@ -96,6 +108,23 @@ inline MinMax extractMinAndMax(const Float32Array& positions, size_t start, size
   return {minimum, maximum};
 }
 
+/**
+ * @brief Extracts minimum and maximum values from a list of positions.
+ * @param positions defines the positions to use
+ * @param start defines the start index in the positions array
+ * @param count defines the number of positions to handle
+ * @param bias defines bias value to add to the result
+ * @param stride defines the stride size to use (distance between two
+ * positions in the positions array)
+ * @return minimum and maximum values
+ */
+inline MinMax extractMinAndMax(const Float32Array& positions, size_t start, size_t count,
+                               const std::optional<Vector2>& bias = std::nullopt,
+                               std::optional<unsigned int> stride = std::nullopt)
+{
+  return extractMinAndMax(positions.data(), start, count, bias, stride.value_or(3));
+}
+
 inline MinMaxVector2
 ExtractMinAndMaxVector2(const std::function<std::optional<Vector2>(std::size_t index)>& feeder,
                         const std::optional<Vector2>& bias)
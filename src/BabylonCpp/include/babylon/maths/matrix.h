@@ -2,6 +2,7 @@
 #define BABYLON_MATHS_MATRIX_H
 
 #include <array>
+#include <atomic>
 #include <memory>
 #include <optional>
 
@@ -1140,7 +1141,8 @@ public:
   int updateFlag;
 
 private:
-  static int _updateFlagSeed;
+  // Atomic as world matrices can be updated from worker threads
+  static std::atomic<int> _updateFlagSeed;
   static Matrix _identityReadOnly;
   bool _isIdentity;
   bool _isIdentityDirty;
@@ -41,6 +41,7 @@ struct BABYLON_SHARED_EXPORT _InternalMeshDataInfo {
 
   int _preActivateId = -1;
   std::vector<MeshLODLevelPtr> _LODLevels;
+  bool _useLODScreenCoverage = false;
 
   // Morph
   MorphTargetManagerPtr _morphTargetManager = nullptr;
@@ -19,6 +19,7 @@
 #include <babylon/meshes/facet_parameters.h>
 #include <babylon/meshes/iget_set_vertices_data.h>
 #include <babylon/meshes/transform_node.h>
+#include <babylon/meshes/vertex_data_view.h>
 #include <babylon/misc/observable.h>
 #include <babylon/misc/observer.h>
 #include <babylon/physics/physics_impostor.h>
@@ -345,6 +346,22 @@ public:
   Float32Array getVerticesData(const std::string& kind, bool copyWhenShared = false,
                                bool forceCopy = false) override;
 
+  /**
+   * @brief Returns a read-only view on the requested vertex data kind, without copying it.
+   * Implemented by child classes.
+   * @param kind defines the vertex data kind to use
+   * @returns an empty view
+   */
+  [[nodiscard]] virtual VertexDataView getVerticesDataView(const std::string& kind) const;
+
+  /**
+   * @brief Returns a mutable view on the requested vertex data kind, uploaded to the GPU when the
+   * geometry is next bound. Implemented by child classes.
+   * @param kind defines the vertex data kind to use
+   * @returns an empty view
+   */
+  virtual MutableVertexDataView mapVerticesDataForWrite(const std::string& kind);
+
   /**
    * @brief Sets the vertex data of the mesh geometry for the requested `kind`.
    * If the mesh has no geometry, a new Geometry object is set to the mesh and
@@ -558,13 +575,18 @@ public:
   /**
    * @brief Hidden
    */
-  void _refreshBoundingInfo(const Float32Array& data, const std::optional<Vector2>& bias);
+  void _refreshBoundingInfo(const VertexDataView& data, const std::optional<Vector2>& bias);
 
   /**
    * @brief Hidden
    */
   Float32Array _getPositionData(bool applySkeleton);
 
+  /**
+   * @brief Hidden (positions are read in place, skinned positions are stored in skinnedPositions)
+   */
+  VertexDataView _getPositionDataView(bool applySkeleton, Float32Array& skinnedPositions);
+
   /**
    * @brief Hidden
    */
@@ -575,6 +597,26 @@ public:
    */
   AbstractMesh& _updateSubMeshesBoundingInfo(const Matrix& matrix);
 
+  /**
+   * @brief Hidden
+   */
+  void _syncBoundingVolumeStore();
+
+  /**
+   * @brief Hidden
+   */
+  void _notifyBoundingInfoChanged();
+
+  /**
+   * @brief Hidden
+   */
+  bool _canComputeWorldMatrixConcurrently() const override;
+
+  /**
+   * @brief Hidden
+   */
+  void _applyDeferredWorldMatrixSideEffects() override;
+
   /**
    * @brief Returns `true` if the mesh is within the frustum defined by the
    * passed array of planes. A mesh is in the frustum if its bounding box
@@ -1864,6 +1906,18 @@ public:
   /** Hidden */
   BoundingInfoPtr _boundingInfo;
 
+  /** Hidden */
+  size_t _boundingVolumeStoreSlot;
+
+  /** Hidden */
+  bool _hasDeferredMiscDirty;
+
+  /** Hidden */
+  bool _hasDeferredBoundingInfoChange;
+
+  /** Hidden */
+  size_t _octreeSelectionGeneration;
+
   /** Hidden */
   int _renderId;
 
@@ -2002,6 +2056,9 @@ private:
   Matrix _collisionsScalingMatrix;
   // Rendering
   bool _showBoundingBox;
+  // Handles of the mesh uniform buffer uniforms
+  int _worldUniformHandle;
+  int _visibilityUniformHandle;
 
 }; // end of class AbstractMesh
 
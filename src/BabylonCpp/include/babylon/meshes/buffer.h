@@ -138,6 +138,23 @@ public:
    */
   void _increaseReferences();
 
+  /**
+   * @brief Hidden
+   * Flags the CPU data as modified in place, it is uploaded by the next call to _uploadDirtyData()
+   */
+  void _markDataAsDirty();
+
+  /**
+   * @brief Hidden
+   */
+  [[nodiscard]] bool _isDataDirty() const;
+
+  /**
+   * @brief Hidden
+   * Uploads the CPU data to the GPU buffer if it was flagged as modified
+   */
+  void _uploadDirtyData();
+
   /**
    * @brief Release all resources
    */
@@ -161,6 +178,7 @@ private:
   bool _instanced;
   unsigned int _divisor;
   bool _isAlreadyOwned;
+  bool _isDirty;
 
 }; // end of class Buffer
 
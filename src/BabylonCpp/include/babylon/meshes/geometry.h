@@ -9,6 +9,7 @@
 #include <babylon/babylon_fwd.h>
 #include <babylon/core/structs.h>
 #include <babylon/meshes/iget_set_vertices_data.h>
+#include <babylon/meshes/vertex_data_view.h>
 
 using json = nlohmann::json;
 
@@ -180,6 +181,23 @@ public:
   Float32Array getVerticesData(const std::string& kind, bool copyWhenShared = false,
                                bool forceCopy = false) override;
 
+  /**
+   * @brief Gets a read-only view on a specific vertex data attached to this geometry, without
+   * copying it. The view is invalidated when the vertex data is set or updated again.
+   * @param kind defines the data kind (Position, normal, etc...)
+   * @returns the view, empty if the data is not available on the CPU side
+   */
+  [[nodiscard]] VertexDataView getVerticesDataView(const std::string& kind) const;
+
+  /**
+   * @brief Gets a mutable view on a specific vertex data attached to this geometry. The modified
+   * data is uploaded to the GPU the next time the geometry is bound (the vertex buffer must be
+   * updatable) and the bounding info must be refreshed by the caller if the positions are changed.
+   * @param kind defines the data kind (Position, normal, etc...)
+   * @returns the view, empty if the data is not available on the CPU side
+   */
+  MutableVertexDataView mapVerticesDataForWrite(const std::string& kind);
+
   /**
    * @brief Returns a boolean defining if the vertex data for the requested `kind` is updatable.
    * @param kind defines the data kind (Position, normal, etc...)
@@ -187,6 +205,12 @@ public:
    */
   [[nodiscard]] bool isVertexBufferUpdatable(const std::string& kind) const;
 
+  /**
+   * @brief Returns a boolean defining if the index buffer is updatable.
+   * @returns true if the index buffer was created as updatable
+   */
+  [[nodiscard]] bool isIndexBufferUpdatable() const;
+
   /**
    * @brief Gets a specific vertex buffer.
    * @param kind defines the data kind (Position, normal, etc...)
@@ -297,6 +321,11 @@ public:
    */
   bool _generatePointsArray();
 
+  /**
+   * @brief Hidden
+   */
+  void _uploadMappedVerticesData();
+
   /**
    * @brief Gets a value indicating if the geometry is disposed.
    * @returns true if the geometry was disposed
@@ -510,6 +539,7 @@ private:
   WebGLDataBufferPtr _indexBuffer;
   bool _indexBufferIsUpdatable;
   std::vector<Vector3> _positionsCache;
+  std::vector<std::string> _mappedVerticesDataKinds;
 
 }; // end of class Geometry
 
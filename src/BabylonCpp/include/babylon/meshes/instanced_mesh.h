@@ -83,6 +83,20 @@ public:
   Float32Array getVerticesData(const std::string& kind, bool copyWhenShared = false,
                                bool forceCopy = false) override;
 
+  /**
+   * @brief Returns a read-only view on the source mesh vertex data of the requested kind.
+   * @param kind kind of verticies to retrieve (eg. positions, normals, uvs, etc.)
+   * @returns the view, empty if the source mesh has no such data
+   */
+  [[nodiscard]] VertexDataView getVerticesDataView(const std::string& kind) const override;
+
+  /**
+   * @brief Returns a mutable view on the source mesh vertex data of the requested kind.
+   * @param kind kind of verticies to retrieve (eg. positions, normals, uvs, etc.)
+   * @returns the view, empty if the source mesh has no such data
+   */
+  MutableVertexDataView mapVerticesDataForWrite(const std::string& kind) override;
+
   /**
    * @brief Sets the vertex data of the mesh geometry for the requested `kind`.
    * If the mesh has no geometry, a new Geometry object is set to the mesh and then passed this
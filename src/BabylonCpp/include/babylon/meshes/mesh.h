@@ -2,12 +2,17 @@
 #define BABYLON_MESHES_MESH_H
 
 #include <babylon/babylon_api.h>
+#include <babylon/babylon_enums.h>
 #include <babylon/babylon_fwd.h>
 #include <babylon/maths/isize.h>
 #include <babylon/maths/path3d.h>
 #include <babylon/meshes/abstract_mesh.h>
 #include <babylon/meshes/iget_set_vertices_data.h>
+#include <babylon/meshes/optimization/index_optimizer.h>
+#include <babylon/meshes/optimization/meshlet_builder.h>
+#include <babylon/meshes/simplification/isimplification_settings.h>
 #include <babylon/meshes/vertex_data_constants.h>
+#include <babylon/meshes/vertex_weld_options.h>
 
 namespace BABYLON {
 
@@ -309,6 +314,24 @@ public:
   Float32Array getVerticesData(const std::string& kind, bool copyWhenShared = false,
                                bool forceCopy = false) override;
 
+  /**
+   * @brief Returns a read-only view on the vertex data of the mesh geometry for the requested
+   * `kind`, without copying it. The view is shared with the other meshes using the geometry and
+   * is invalidated when the vertex data is set or updated again.
+   * @param kind defines which buffer to read from (positions, normals, etc)
+   * @returns the view, empty if the mesh has no geometry or no vertex buffer for this kind
+   */
+  [[nodiscard]] VertexDataView getVerticesDataView(const std::string& kind) const override;
+
+  /**
+   * @brief Returns a mutable view on the vertex data of the mesh geometry for the requested
+   * `kind`. The changes are uploaded when the geometry is next bound, call refreshBoundingInfo()
+   * after changing the positions.
+   * @param kind defines which buffer to write to (positions, normals, etc)
+   * @returns the view, empty if the mesh has no geometry or no vertex buffer for this kind
+   */
+  MutableVertexDataView mapVerticesDataForWrite(const std::string& kind) override;
+
   /**
    * @brief Returns the mesh VertexBuffer object from the requested `kind`.
    * @param kind defines which buffer to read from (positions, indices, normals,
@@ -924,6 +947,11 @@ public:
    */
   bool isInFrustum(const std::array<Plane, 6>& frustumPlanes, unsigned int strategy = 0) override;
 
+  /**
+   * @brief Hidden
+   */
+  bool _canComputeWorldMatrixConcurrently() const override;
+
   /**
    * @brief Sets the mesh material by the material or multiMaterial `id`
    * property.
@@ -1137,15 +1165,49 @@ public:
   Mesh& synchronizeInstances();
 
   /**
-   * @brief Optimization of the mesh's indices, in case a mesh has duplicated
-   * vertices. The function will only reorder the indices and will not remove
-   * unused vertices to avoid problems with submeshes. This should be used
-   * together with the simplification to avoid disappearing triangles.
+   * @brief Simplify the mesh according to the given array of settings. Function will return
+   * immediately and will simplify async: the vertex data is copied, simplified on the engine thread
+   * pool, and each simplified mesh is added as a LOD level of this mesh, at the distance (or the
+   * screen coverage when useLODScreenCoverage is set) of its settings.
+   * @see https://doc.babylonjs.com/how_to/in-browser_mesh_simplification
+   * @param settings a collection of simplification settings
+   * @param parallelProcessing should all levels calculate parallel or one after the other
+   * @param simplificationType the type of simplification to run
+   * @param successCallback optional success callback to be called after the simplification
+   * finished processing all settings
+   * @returns the current mesh
+   */
+  Mesh& simplify(const std::vector<ISimplificationSettings>& settings,
+                 bool parallelProcessing               = true,
+                 SimplificationType simplificationType = SimplificationType::QUADRATIC,
+                 const std::function<void(Mesh* mesh)>& successCallback = nullptr);
+
+  /**
+   * @brief Optimization of the mesh's indices for the GPU. The triangles of each submesh are
+   * reordered for the post-transform vertex cache, then clusters of triangles are sorted to reduce
+   * the overdraw, and the vertices are reordered in the order they are first used (when the
+   * geometry is not shared, has no morph targets and the submeshes use disjoint vertex ranges).
+   * No vertex is removed to avoid problems with submeshes.
    * @param successCallback an optional success callback to be called after the
    * optimization finished.
-   * @returns the current mesh
+   * @param options defines the cache size and the optimizations to run
+   * @returns the vertex cache statistics (ACMR / ATVR) before and after the optimization
    */
-  void optimizeIndices(const std::function<void(Mesh* mesh)>& successCallback);
+  IndexOptimizationReport
+  optimizeIndices(const std::function<void(Mesh* mesh)>& successCallback = nullptr,
+                  const IndexOptimizationOptions& options             = IndexOptimizationOptions{});
+
+  /**
+   * @brief Splits the triangles of each submesh in meshlets (clusters of at most
+   * options.maxTriangles triangles with a bounding sphere and a normal cone). The triangles are
+   * reordered so that each meshlet is a contiguous index range, the meshlets of the submeshes
+   * visible by the active camera are then culled on the CPU (see meshletCulling) and only the
+   * index ranges of the visible meshlets are drawn. Call it after optimizeIndices(), setting new
+   * indices or new submeshes removes the meshlets.
+   * @param options defines the maximum meshlet size
+   * @returns the number of meshlets created
+   */
+  size_t buildMeshlets(const MeshletBuildOptions& options = MeshletBuildOptions{});
 
   /**
    * @brief This function will remove some indices and vertices from a mesh. It
@@ -1158,9 +1220,14 @@ public:
    *
    * More information on the need for extra facets, which turn out to be lines,
    * can be found in https://babylonjsguide.github.io/advanced/Facets.html
+   *
+   * The vertices are welded with a spatial hash (see VertexData::weld()), in linear time. Without
+   * options, only the positions are kept and welded, and the normals are recomputed. With options,
+   * all the vertex data is kept and the vertices are only welded when their attributes match.
+   * @param options defines the optional welding options
    * @see https://babylonjsguide.github.io/snippets/Minimise_Vertices
    */
-  void minimizeVertices();
+  void minimizeVertices(const std::optional<VertexWeldOptions>& options = std::nullopt);
 
   /**
    * @brief Serialize current mesh.
@@ -1812,11 +1879,14 @@ public:
    * his subMesh array with meshes source.
    * @param multiMultiMaterials when true (false default), subdivide mesh and
    * accept multiple multi materials, ignores subdivideWithSubMeshes.
+   * @param weldOptions when set, the coincident vertices of the merged meshes are welded (see
+   * VertexData::weld()), the submesh index counts are updated accordingly.
    * @returns a new mesh
    */
   static MeshPtr MergeMeshes(const std::vector<MeshPtr>& meshes, bool disposeSource = true,
                              bool allow32BitsIndices = true, MeshPtr meshSubclass = nullptr,
-                             bool subdivideWithSubMeshes = false, bool multiMultiMaterials = false);
+                             bool subdivideWithSubMeshes = false, bool multiMultiMaterials = false,
+                             const std::optional<VertexWeldOptions>& weldOptions = std::nullopt);
 
   /**
    * @brief Hidden
@@ -1964,6 +2034,16 @@ protected:
    */
   bool get_hasLODLevels() const;
 
+  /**
+   * @brief Gets whether the LOD levels are selected by screen coverage instead of distance.
+   */
+  bool get_useLODScreenCoverage() const;
+
+  /**
+   * @brief Sets whether the LOD levels are selected by screen coverage instead of distance.
+   */
+  void set_useLODScreenCoverage(bool value);
+
   /**
    * @brief Gets the mesh internal Geometry object.
    */
@@ -2010,6 +2090,8 @@ protected:
 
 private:
   void _sortLODLevels();
+  float _getScreenCoverage(Camera& camera, const BoundingSphere& boundingSphere,
+                           float distanceToCamera);
   Mesh& _onBeforeDraw(bool isInstance, Matrix& world, Material* effectiveMaterial);
   // Faster 4 weight version
   void normalizeSkinFourWeights();
@@ -2142,6 +2224,11 @@ public:
    */
   bool ignoreCameraMaxZ;
 
+  /**
+   * Gets or sets the tests used to cull the meshlets created by buildMeshlets()
+   */
+  MeshletCullingOptions meshletCulling;
+
   /**
    * Gets the source mesh (the one used to clone this one from)
    */
@@ -2180,6 +2267,13 @@ public:
    */
   ReadOnlyProperty<Mesh, bool> hasLODLevels;
 
+  /**
+   * Gets or sets a boolean indicating that the distanceOrScreenCoverage of the LOD levels is a
+   * screen coverage (ratio of the screen area covered by the bounding sphere, the highest values
+   * are used first) instead of a distance to the camera
+   */
+  Property<Mesh, bool> useLODScreenCoverage;
+
   /**
    * Gets the mesh internal Geometry object
    */
@@ -0,0 +1,162 @@
+#ifndef BABYLON_MESHES_OPTIMIZATION_INDEX_OPTIMIZER_H
+#define BABYLON_MESHES_OPTIMIZATION_INDEX_OPTIMIZER_H
+
+#include <babylon/babylon_api.h>
+#include <babylon/babylon_common.h>
+#include <babylon/meshes/vertex_data_view.h>
+
+namespace BABYLON {
+
+/**
+ * @brief Post-transform vertex cache statistics of a triangle list, measured with a FIFO cache.
+ */
+struct BABYLON_SHARED_EXPORT VertexCacheStatistics {
+  /**
+   * Number of vertex shader invocations (cache misses)
+   */
+  size_t cacheMisses = 0;
+  /**
+   * Number of triangles
+   */
+  size_t triangleCount = 0;
+  /**
+   * Number of distinct vertices referenced by the triangles
+   */
+  size_t vertexCount = 0;
+  /**
+   * Average cache miss ratio: transformed vertices per triangle (0.5 at best, 3 at worst)
+   */
+  float acmr = 0.f;
+  /**
+   * Average transform to vertex ratio: transformed vertices per referenced vertex (1 at best)
+   */
+  float atvr = 0.f;
+}; // end of struct VertexCacheStatistics
+
+/**
+ * @brief Options of Mesh::optimizeIndices().
+ */
+struct BABYLON_SHARED_EXPORT IndexOptimizationOptions {
+  /**
+   * Size of the simulated post-transform FIFO cache
+   */
+  size_t cacheSize = 16;
+  /**
+   * Defines if the triangle clusters are sorted to reduce the overdraw
+   */
+  bool optimizeOverdraw = true;
+  /**
+   * Maximum ACMR degradation allowed when splitting the clusters for the overdraw optimization
+   * (1.05 allows the ACMR to get 5% worse)
+   */
+  float overdrawThreshold = 1.05f;
+  /**
+   * Defines if the vertices are reordered in the order they are first used (vertex fetch)
+   */
+  bool optimizeVertexFetch = true;
+}; // end of struct IndexOptimizationOptions
+
+/**
+ * @brief Result of Mesh::optimizeIndices().
+ */
+struct BABYLON_SHARED_EXPORT IndexOptimizationReport {
+  /**
+   * Vertex cache statistics of the original indices
+   */
+  VertexCacheStatistics before;
+  /**
+   * Vertex cache statistics of the optimized indices
+   */
+  VertexCacheStatistics after;
+  /**
+   * Defines if the vertex buffers were reordered
+   */
+  bool vertexFetchOptimized = false;
+}; // end of struct IndexOptimizationReport
+
+/**
+ * @brief Reorders the triangles and vertices of indexed triangle lists for the GPU.
+ *
+ * The functions work on a range of an index buffer (a submesh), triangles are never moved out of
+ * their range:
+ * - OptimizeVertexCache reorders the triangles for the post-transform vertex cache (Tipsify, Sander
+ * et al. 2007, linear time)
+ * - OptimizeOverdraw splits the result in clusters whose ACMR stays within a threshold and sorts
+ * the clusters so the ones facing outward are drawn first (view independent overdraw reduction)
+ * - GenerateVertexFetchRemap computes the vertex order of first use, applied with RemapIndices and
+ * RemapVertexData, to improve the locality of the vertex fetches
+ */
+class BABYLON_SHARED_EXPORT IndexOptimizer {
+
+public:
+  /**
+   * @brief Simulates a FIFO post-transform cache on a triangle list.
+   * @param indices defines the index buffer
+   * @param indexStart defines the first index of the triangle list
+   * @param indexCount defines the number of indices of the triangle list
+   * @param cacheSize defines the number of vertices in the cache
+   * @returns the cache statistics
+   */
+  static VertexCacheStatistics AnalyzeVertexCache(const IndicesArray& indices, size_t indexStart,
+                                                  size_t indexCount, size_t cacheSize = 16);
+
+  /**
+   * @brief Reorders the triangles of a triangle list to improve the vertex cache hit rate.
+   * @param indices defines the index buffer, updated in place
+   * @param indexStart defines the first index of the triangle list
+   * @param indexCount defines the number of indices of the triangle list
+   * @param cacheSize defines the number of vertices in the cache
+   */
+  static void OptimizeVertexCache(IndicesArray& indices, size_t indexStart, size_t indexCount,
+                                  size_t cacheSize = 16);
+
+  /**
+   * @brief Reorders clusters of triangles of a cache optimized triangle list to reduce overdraw.
+   * @param indices defines the index buffer, updated in place
+   * @param indexStart defines the first index of the triangle list
+   * @param indexCount defines the number of indices of the triangle list
+   * @param positions defines the vertex positions
+   * @param cacheSize defines the number of vertices in the cache
+   * @param threshold defines the maximum ACMR degradation of the clusters (e.g. 1.05)
+   */
+  static void OptimizeOverdraw(IndicesArray& indices, size_t indexStart, size_t indexCount,
+                               const VertexDataView& positions, size_t cacheSize = 16,
+                               float threshold = 1.05f);
+
+  /**
+   * @brief Computes the order of first use of the vertices of a triangle list, the unused vertices
+   * of the range are moved after the used ones.
+   * @param indices defines the index buffer
+   * @param indexStart defines the first index of the triangle list
+   * @param indexCount defines the number of indices of the triangle list
+   * @param verticesStart defines the first vertex of the vertex range used by the triangles
+   * @param verticesCount defines the number of vertices of the vertex range
+   * @param remap defines the old to new vertex index table, filled for the vertex range
+   * @returns false if the triangles use a vertex outside of the vertex range
+   */
+  static bool GenerateVertexFetchRemap(const IndicesArray& indices, size_t indexStart,
+                                       size_t indexCount, size_t verticesStart,
+                                       size_t verticesCount, IndicesArray& remap);
+
+  /**
+   * @brief Applies a vertex remap table to indices.
+   * @param indices defines the index buffer, updated in place
+   * @param remap defines the old to new vertex index table
+   */
+  static void RemapIndices(IndicesArray& indices, const IndicesArray& remap);
+
+  /**
+   * @brief Applies a vertex remap table to vertex data.
+   * @param data defines the tightly packed vertex data
+   * @param size defines the number of components per vertex
+   * @param remap defines the old to new vertex index table
+   * @returns the reordered vertex data
+   */
+  static Float32Array RemapVertexData(const Float32Array& data, size_t size,
+                                      const IndicesArray& remap);
+
+}; // end of class IndexOptimizer
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_MESHES_OPTIMIZATION_INDEX_OPTIMIZER_H
@@ -0,0 +1,144 @@
+#ifndef BABYLON_MESHES_OPTIMIZATION_MESHLET_BUILDER_H
+#define BABYLON_MESHES_OPTIMIZATION_MESHLET_BUILDER_H
+
+#include <array>
+#include <functional>
+#include <vector>
+
+#include <babylon/babylon_api.h>
+#include <babylon/babylon_common.h>
+#include <babylon/maths/plane.h>
+#include <babylon/maths/vector3.h>
+#include <babylon/meshes/vertex_data_view.h>
+
+namespace BABYLON {
+
+class Matrix;
+
+/**
+ * @brief Cluster of triangles of a submesh with its bounds, stored in mesh local space.
+ */
+struct BABYLON_SHARED_EXPORT Meshlet {
+  /**
+   * First index of the triangles of the meshlet in the index buffer
+   */
+  uint32_t indexStart = 0;
+  /**
+   * Number of indices of the triangles of the meshlet
+   */
+  uint32_t indexCount = 0;
+  /**
+   * Center of the bounding sphere
+   */
+  Vector3 center;
+  /**
+   * Radius of the bounding sphere
+   */
+  float radius = 0.f;
+  /**
+   * Axis of the cone containing the triangle normals
+   */
+  Vector3 coneAxis;
+  /**
+   * Sine of the half angle of the normal cone, 1 when the triangles cannot be backface culled
+   * together
+   */
+  float coneCutoff = 1.f;
+}; // end of struct Meshlet
+
+/**
+ * @brief Contiguous range of visible triangles to draw.
+ */
+struct BABYLON_SHARED_EXPORT MeshletDrawRange {
+  /**
+   * First index of the range
+   */
+  uint32_t indexStart = 0;
+  /**
+   * Number of indices of the range
+   */
+  uint32_t indexCount = 0;
+}; // end of struct MeshletDrawRange
+
+/**
+ * @brief Options of Mesh::buildMeshlets().
+ */
+struct BABYLON_SHARED_EXPORT MeshletBuildOptions {
+  /**
+   * Maximum number of triangles per meshlet
+   */
+  size_t maxTriangles = 128;
+  /**
+   * Weight of the normal deviation when choosing the next triangle of a meshlet, higher values
+   * give tighter normal cones (better backface culling) but less compact meshlets
+   */
+  float coneWeight = 0.5f;
+}; // end of struct MeshletBuildOptions
+
+/**
+ * @brief Per meshlet culling options of a mesh.
+ */
+struct BABYLON_SHARED_EXPORT MeshletCullingOptions {
+  /**
+   * Defines if the meshlets outside of the camera frustum are skipped
+   */
+  bool frustumCulling = true;
+  /**
+   * Defines if the meshlets whose triangles all face away from the camera are skipped (only for
+   * back face culled clockwise materials in left handed scenes and uniformly scaled meshes)
+   */
+  bool backfaceCulling = true;
+  /**
+   * Optional occlusion test, called with the world space bounding sphere of the meshlets passing
+   * the other tests, returns false when the meshlet is hidden
+   */
+  std::function<bool(const Vector3& center, float radius)> occlusionTest = nullptr;
+}; // end of struct MeshletCullingOptions
+
+/**
+ * @brief Splits the triangles of indexed triangle lists in meshlets and culls them on the CPU.
+ *
+ * The meshlets are grown from the triangles in index order (so cache optimized indices give
+ * compact meshlets) by adding the adjacent triangle sharing the most vertices with the meshlet and
+ * whose normal is the closest to the meshlet normal. The triangles of a range are reordered so
+ * that each meshlet is a contiguous range of the index buffer, the visible meshlets are then drawn
+ * with merged index ranges.
+ */
+class BABYLON_SHARED_EXPORT MeshletBuilder {
+
+public:
+  /**
+   * @brief Splits a triangle list in meshlets, the triangles are reordered inside the range.
+   * @param indices defines the index buffer, updated in place
+   * @param indexStart defines the first index of the triangle list
+   * @param indexCount defines the number of indices of the triangle list
+   * @param positions defines the vertex positions
+   * @param options defines the meshlet size
+   * @returns the meshlets, sorted by index start
+   */
+  static std::vector<Meshlet> BuildMeshlets(IndicesArray& indices, size_t indexStart,
+                                            size_t indexCount, const VertexDataView& positions,
+                                            const MeshletBuildOptions& options
+                                            = MeshletBuildOptions{});
+
+  /**
+   * @brief Culls meshlets and computes the index ranges of the visible ones.
+   * @param meshlets defines the meshlets, sorted by index start
+   * @param world defines the world matrix of the mesh
+   * @param frustumPlanes defines the frustum planes of the camera
+   * @param cameraPosition defines the world space position of the camera
+   * @param options defines the culling tests to run
+   * @param drawRanges defines the visible index ranges (contiguous meshlets are merged), cleared
+   * first
+   * @returns the number of visible meshlets
+   */
+  static size_t CullMeshlets(const std::vector<Meshlet>& meshlets, const Matrix& world,
+                             const std::array<Plane, 6>& frustumPlanes,
+                             const Vector3& cameraPosition, const MeshletCullingOptions& options,
+                             std::vector<MeshletDrawRange>& drawRanges);
+
+}; // end of class MeshletBuilder
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_MESHES_OPTIMIZATION_MESHLET_BUILDER_H
@@ -1,27 +1,38 @@
 #ifndef BABYLON_MESHES_SIMPLIFICATION_DECIMATION_TRIANGLE_H
 #define BABYLON_MESHES_SIMPLIFICATION_DECIMATION_TRIANGLE_H
 
+#include <array>
+
 #include <babylon/babylon_api.h>
 #include <babylon/maths/vector3.h>
-#include <babylon/meshes/simplification/decimation_vertex.h>
 
 namespace BABYLON {
 
+/**
+ * @brief Triangle of a mesh being decimated.
+ */
 class BABYLON_SHARED_EXPORT DecimationTriangle {
 
 public:
-  DecimationTriangle(const std::vector<DecimationVertex>& vertices);
+  DecimationTriangle(const std::array<int, 3>& vertices, size_t subMeshIndex);
   ~DecimationTriangle(); // = default
 
 public:
   Vector3 normal;
-  std::array<int, 4> error;
+  /**
+   * Collapse errors of the 3 edges, the 4th value is the smallest one
+   */
+  std::array<double, 4> error;
   bool deleted;
   bool isDirty;
-  float borderFactor;
-  bool deletePending;
-  float originalOffset;
-  std::vector<DecimationVertex> vertices;
+  /**
+   * Index of the submesh of the triangle
+   */
+  size_t subMeshIndex;
+  /**
+   * Indices of the vertices in the decimated vertices
+   */
+  std::array<int, 3> vertices;
 
 }; // end of class DecimationTriangle
 
@@ -7,6 +7,9 @@
 
 namespace BABYLON {
 
+/**
+ * @brief Vertex of a mesh being decimated.
+ */
 class BABYLON_SHARED_EXPORT DecimationVertex {
 
 public:
@@ -16,13 +19,27 @@ public:
   void updatePosition(const Vector3& newPosition);
 
 public:
+  /**
+   * Sum of the quadrics of the planes of the adjacent triangles
+   */
   QuadraticMatrix q;
   Vector3 position;
+  /**
+   * Index of the vertex in the original vertex data
+   */
   int id;
+  /**
+   * Defines if the vertex is on a border (open edge, attribute seam or submesh boundary)
+   */
   bool isBorder;
+  /**
+   * First reference to the adjacent triangles
+   */
   int triangleStart;
+  /**
+   * Number of references to the adjacent triangles
+   */
   int triangleCount;
-  Float32Array originalOffsets;
 
 }; // end of class DecimationVertex
 
@@ -1,10 +1,16 @@
 #ifndef BABYLON_MESHES_SIMPLIFICATION_ISIMPLIFIER_H
 #define BABYLON_MESHES_SIMPLIFICATION_ISIMPLIFIER_H
 
+#include <memory>
+
 #include <babylon/babylon_api.h>
+#include <babylon/babylon_common.h>
 
 namespace BABYLON {
 
+struct ISimplificationSettings;
+class VertexData;
+
 /**
  * @brief A simplifier interface for future simplification implementations
  * @see https://doc.babylonjs.com/how_to/in-browser_mesh_simplification
@@ -12,14 +18,22 @@ namespace BABYLON {
 class BABYLON_SHARED_EXPORT ISimplifier {
 
 public:
+  virtual ~ISimplifier() = default;
+
   /**
-   * @brief Simplification of a given mesh according to the given settings.
-   * Since this requires computation, it is assumed that the function runs async.
-   * @param settings The settings of the simplification, including quality and distance
-   * @param successCallback A callback that will be called after the mesh was simplified.
-   * @param errorCallback in case of an error, this callback will be called. optional.
+   * @brief Simplification of the vertex data of a mesh according to the given settings.
+   * The function only works on the given data (no scene or engine access), so it can run on a
+   * background thread.
+   * @param vertexData defines the vertex data to simplify
+   * @param subMeshIndexCounts defines the number of indices of each consecutive submesh, updated
+   * with the number of indices of the simplified submeshes
+   * @param settings defines the settings of the simplification (quality)
+   * @returns the simplified vertex data
    */
-  virtual void simplify() = 0;
+  virtual std::unique_ptr<VertexData> simplify(const VertexData& vertexData,
+                                               IndicesArray& subMeshIndexCounts,
+                                               const ISimplificationSettings& settings)
+    = 0;
 
 }; // end of class ISimplifier
 
@@ -1,8 +1,13 @@
 #ifndef BABYLON_MESHES_SIMPLIFICATION_QUADRATIC_ERROR_SIMPLIFICATION_H
 #define BABYLON_MESHES_SIMPLIFICATION_QUADRATIC_ERROR_SIMPLIFICATION_H
 
+#include <vector>
+
 #include <babylon/babylon_api.h>
+#include <babylon/meshes/simplification/decimation_triangle.h>
+#include <babylon/meshes/simplification/decimation_vertex.h>
 #include <babylon/meshes/simplification/isimplifier.h>
+#include <babylon/meshes/simplification/reference.h>
 
 namespace BABYLON {
 
@@ -13,12 +18,60 @@ namespace BABYLON {
  * http://voxels.blogspot.de/2014/05/quadric-mesh-simplification-with-source.html to babylon JS
  * @author RaananW
  * @see https://doc.babylonjs.com/how_to/in-browser_mesh_simplification
+ *
+ * Edges are collapsed to the position minimizing the quadric error, the attributes of the kept
+ * vertex (normals, tangents, uvs, colors) are interpolated along the collapsed edge. The border
+ * vertices (open edges, attribute seams and submesh boundaries) are never moved.
  */
 class BABYLON_SHARED_EXPORT QuadraticErrorSimplification : public ISimplifier {
 
 public:
   QuadraticErrorSimplification();
-  virtual ~QuadraticErrorSimplification();
+  ~QuadraticErrorSimplification() override; // = default
+
+  /**
+   * @brief Simplification of the vertex data of a mesh, the target number of triangles is the
+   * number of triangles multiplied by settings.quality.
+   * @param vertexData defines the vertex data to simplify (indexed triangles)
+   * @param subMeshIndexCounts defines the number of indices of each consecutive submesh, updated
+   * with the number of indices of the simplified submeshes
+   * @param settings defines the settings of the simplification
+   * @returns the simplified vertex data
+   */
+  std::unique_ptr<VertexData> simplify(const VertexData& vertexData,
+                                       IndicesArray& subMeshIndexCounts,
+                                       const ISimplificationSettings& settings) override;
+
+private:
+  void _initDecimatedMesh(const VertexData& vertexData, const IndicesArray& subMeshIndexCounts);
+  void _runDecimation(size_t targetCount);
+  void _updateMesh(unsigned int iteration);
+  void _identifyBorder();
+  double _calculateError(const DecimationVertex& vertex1, const DecimationVertex& vertex2,
+                         Vector3& pointResult) const;
+  bool _isFlipped(const DecimationVertex& vertex1, int index2, const Vector3& point,
+                  std::vector<bool>& deletedArray) const;
+  void _updateTriangles(int origVertexIndex, const DecimationVertex& vertex,
+                        const std::vector<bool>& deletedArray, size_t& deletedTriangles);
+  void _interpolateAttributes(int index1, int index2, float amount);
+  std::unique_ptr<VertexData> _reconstructMesh(IndicesArray& subMeshIndexCounts);
+
+public:
+  /**
+   * Maximum number of decimation iterations (default 100)
+   */
+  unsigned int decimationIterations;
+
+  /**
+   * Growth exponent of the error threshold between two iterations (default 7)
+   */
+  float aggressiveness;
+
+private:
+  std::vector<DecimationVertex> _vertices;
+  std::vector<DecimationTriangle> _triangles;
+  std::vector<Reference> _references;
+  std::unique_ptr<VertexData> _vertexData;
 
 }; // end of class QuadraticErrorSimplification
 
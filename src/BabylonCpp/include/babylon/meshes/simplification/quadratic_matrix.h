@@ -7,30 +7,43 @@
 
 namespace BABYLON {
 
+/**
+ * @brief Symmetric 4x4 matrix (10 coefficients) used to store the quadric error of a vertex. The
+ * coefficients are stored as doubles, the errors of nearly coplanar faces being tiny.
+ */
 class BABYLON_SHARED_EXPORT QuadraticMatrix {
 
 public:
   QuadraticMatrix();
-  QuadraticMatrix(const std::array<float, 10>& data);
+  QuadraticMatrix(const std::array<double, 10>& data);
   QuadraticMatrix(const QuadraticMatrix& other);
   QuadraticMatrix(QuadraticMatrix&& other);
   QuadraticMatrix& operator=(const QuadraticMatrix& other);
   QuadraticMatrix& operator=(QuadraticMatrix&& other);
   ~QuadraticMatrix(); // = default
 
-  float det(unsigned int a11, unsigned int a12, unsigned int a13, //
-            unsigned int a21, unsigned int a22, int unsigned a23, //
-            int unsigned a31, int unsigned a32, int unsigned a33  //
-  );
+  [[nodiscard]] double det(unsigned int a11, unsigned int a12, unsigned int a13, //
+                           unsigned int a21, unsigned int a22, int unsigned a23, //
+                           int unsigned a31, int unsigned a32, int unsigned a33  //
+  ) const;
   void addInPlace(const QuadraticMatrix& matrix);
-  void addArrayInPlace(const std::array<float, 10>& data);
-  QuadraticMatrix add(const QuadraticMatrix& matrix);
+  void addArrayInPlace(const std::array<double, 10>& data);
+  [[nodiscard]] QuadraticMatrix add(const QuadraticMatrix& matrix) const;
 
-  static QuadraticMatrix FromData(float a, float b, float c, float d);
-  static std::array<float, 10> DataFromNumbers(float a, float b, float c, float d);
+  /**
+   * @brief Evaluates the quadric error of a position.
+   * @param x defines the x coordinate of the position
+   * @param y defines the y coordinate of the position
+   * @param z defines the z coordinate of the position
+   * @returns the error
+   */
+  [[nodiscard]] double vertexError(double x, double y, double z) const;
+
+  static QuadraticMatrix FromData(double a, double b, double c, double d);
+  static std::array<double, 10> DataFromNumbers(double a, double b, double c, double d);
 
 private:
-  std::array<float, 10> data;
+  std::array<double, 10> data;
 
 }; // end of class QuadraticMatrix
 
@@ -1,6 +1,8 @@
 #ifndef BABYLON_MESHES_SIMPLIFICATION_SIMPLIFICATION_QUEUE_H
 #define BABYLON_MESHES_SIMPLIFICATION_SIMPLIFICATION_QUEUE_H
 
+#include <future>
+#include <memory>
 #include <queue>
 
 #include <babylon/babylon_api.h>
@@ -9,9 +11,15 @@
 namespace BABYLON {
 
 class ISimplifier;
+class Mesh;
+struct _SimplificationResult;
 
 /**
  * @brief Queue used to order the simplification tasks.
+ *
+ * The tasks are executed one after the other: the vertex data of the mesh is copied on the main
+ * thread, simplified on the engine thread pool, and the simplified meshes are added as LOD levels
+ * of the mesh on the main thread (checked once per frame by the scene component).
  * @see https://doc.babylonjs.com/how_to/in-browser_mesh_simplification
  */
 class BABYLON_SHARED_EXPORT SimplificationQueue {
@@ -40,8 +48,16 @@ public:
    */
   void runSimplification(const ISimplificationTask& task);
 
+  /**
+   * @brief Adds the LOD levels of the running task when its simplifications are done and executes
+   * the next task.
+   * @param wait defines if the function blocks until the simplifications are done
+   */
+  void checkRunningTask(bool wait = false);
+
 private:
-  ISimplifier* getSimplifier(const ISimplificationTask& task);
+  std::unique_ptr<ISimplifier> getSimplifier(const ISimplificationTask& task);
+  void _addLODLevels();
 
 public:
   /**
@@ -51,6 +67,10 @@ public:
 
 private:
   std::queue<ISimplificationTask> _simplificationQueue;
+  ISimplificationTask _runningTask;
+  std::weak_ptr<Mesh> _runningMesh;
+  std::vector<std::future<void>> _runningJobs;
+  std::vector<std::shared_ptr<_SimplificationResult>> _runningResults;
 
 }; // end of class SimplificationQueue
 
@@ -124,6 +124,13 @@ public:
    */
   SubMesh& refreshBoundingInfo(const Float32Array& data = {});
 
+  /**
+   * @brief Sets a new updated BoundingInfo object to the submesh.
+   * @param data defines the positions to use to determine the bounding info, read in place
+   * @returns the SubMesh
+   */
+  SubMesh& refreshBoundingInfo(const VertexDataView& data);
+
   /**
    * @brief Hidden
    */
@@ -340,6 +347,16 @@ public:
   float _distanceToCamera;
   /** @hidden */
   size_t _id;
+  /** @hidden */
+  size_t _octreeSelectionGeneration;
+  /** @hidden */
+  std::vector<AbstractMesh*>* _autoInstances;
+  /** @hidden */
+  std::vector<Meshlet> _meshlets;
+  /** @hidden */
+  std::vector<MeshletDrawRange> _meshletDrawRanges;
+  /** @hidden */
+  int _meshletDrawRangesFrameId;
 
 private:
   std::unordered_map<std::string, DrawWrapperPtr> _drawWrappers;
@@ -401,6 +401,34 @@ public:
    */
   Matrix& computeWorldMatrix(bool force = false, bool useWasUpdatedFlag = false) override;
 
+  /**
+   * @brief Hidden
+   * Returns true if computeWorldMatrix() only touches state owned by this node, so that it can be
+   * run on a worker thread once the world matrix of the parent is up to date.
+   */
+  virtual bool _canComputeWorldMatrixConcurrently() const;
+
+  /**
+   * @brief Hidden
+   * Applies the side effects of a world matrix update run on a worker thread (the state shared
+   * with other objects is only updated on the calling thread, after the workers are joined).
+   */
+  virtual void _applyDeferredWorldMatrixSideEffects();
+
+  /**
+   * @brief Hidden
+   * Returns true if the world matrix has to be recomputed, the parent being synchronized by the
+   * caller (only its update id is checked, not its ancestors).
+   * @param parentUpdated defines if the world matrix of the parent changed in the current pass
+   */
+  bool _needsWorldMatrixUpdate(bool parentUpdated);
+
+  /**
+   * @brief Hidden
+   * Recomputes the world matrix without any synchronization check.
+   */
+  Matrix& _updateWorldMatrix(bool force, int currentRenderId);
+
   /**
    * @brief Resets this nodeTransform's local matrix to Matrix.Identity().
    * @param independentOfChildren indicates if all child nodeTransform's world-space transform
@@ -710,6 +738,12 @@ public:
   bool _postMultiplyPivotMatrix;
   /** Hidden */
   int _indexInSceneTransformNodesArray;
+  /** Hidden */
+  bool _deferWorldMatrixSideEffects;
+  /** Hidden */
+  int _transformSystemIndex;
+  /** Hidden */
+  size_t _transformSystemGeneration;
 
   /**
    * Gets or set the node position (default is (0.0, 0.0, 0.0))
@@ -0,0 +1,118 @@
+#ifndef BABYLON_MESHES_TRANSFORM_SYSTEM_H
+#define BABYLON_MESHES_TRANSFORM_SYSTEM_H
+
+#include <cstdint>
+#include <vector>
+
+#include <babylon/babylon_api.h>
+#include <babylon/misc/observer.h>
+
+namespace BABYLON {
+
+class AbstractMesh;
+class Node;
+class Scene;
+class ThreadPool;
+class TransformNode;
+
+/**
+ * @brief Flattened view of the transform hierarchy of a scene, used to update the world matrices of
+ * all the transform nodes (and meshes) in a single pass per frame.
+ *
+ * The nodes are stored in a contiguous array sorted by depth (parents always come before their
+ * children) with the index of their parent and a per frame "updated" flag. As the parents are
+ * processed first, a node only checks its own state and the update id of its parent, instead of
+ * walking up the parent chain. Disabled sub trees are skipped.
+ *
+ * The nodes whose ancestors are all tracked are marked as validated by the pass: until a world
+ * matrix with tracked children is recomputed outside of the pass (or the hierarchy changes), their
+ * computeWorldMatrix() calls only compare the local state with the cache.
+ *
+ * The world matrices themselves stay owned by the nodes, too much code holds Matrix references
+ * into them to move them to a contiguous array.
+ *
+ * Nodes of a same depth level are independent, so each level can be processed on a thread pool.
+ * @see Scene::enableTransformSystem
+ */
+class BABYLON_SHARED_EXPORT TransformSystem {
+
+public:
+  /**
+   * @brief Creates a new transform system tracking all the transform nodes of a scene.
+   * @param scene defines the scene whose transform nodes are tracked
+   */
+  TransformSystem(Scene* scene);
+  TransformSystem(const TransformSystem& other) = delete;
+  TransformSystem& operator=(const TransformSystem& other) = delete;
+  ~TransformSystem(); // = default
+
+  /**
+   * @brief Updates the world matrices of the dirty sub trees.
+   * @param threadPool defines an optional thread pool used to process the depth levels
+   */
+  void update(ThreadPool* threadPool = nullptr);
+
+  /**
+   * @brief Forces the sorted hierarchy to be rebuilt on next update (called when nodes are added,
+   * removed or re-parented).
+   */
+  void markHierarchyAsDirty();
+
+  /**
+   * @brief Returns the number of tracked nodes.
+   */
+  [[nodiscard]] size_t size() const;
+
+  /**
+   * @brief Returns the number of depth levels of the tracked hierarchy.
+   */
+  [[nodiscard]] size_t levelCount() const;
+
+  /**
+   * @brief Returns the number of world matrices recomputed by the last update.
+   */
+  [[nodiscard]] size_t updatedCount() const;
+
+  /**
+   * @brief Hidden
+   * Returns true if the ancestors of the node were validated by the last update and none of the
+   * tracked world matrices was recomputed outside of the update since.
+   */
+  [[nodiscard]] bool _isValidated(const TransformNode* node) const;
+
+  /**
+   * @brief Hidden
+   * Called when the world matrix of a node is recomputed outside of the update.
+   */
+  void _onWorldMatrixUpdated(const TransformNode* node);
+
+private:
+  void _rebuild();
+  void _updateExternalNode(size_t index);
+
+private:
+  Scene* _scene;
+  // Sorted by depth, _levelOffsets[l] is the index of the first node of level l
+  std::vector<TransformNode*> _nodes;
+  std::vector<Node*> _parents;
+  std::vector<int> _parentIndices;
+  std::vector<uint8_t> _updated;
+  std::vector<uint8_t> _validated;
+  std::vector<uint8_t> _hasChildren;
+  std::vector<size_t> _levelOffsets;
+  std::vector<size_t> _concurrentIndices;
+  bool _isHierarchyDirty;
+  bool _isUpdating;
+  size_t _updatedCount;
+  // Validation stamp of the nodes, changed by each update and by each invalidation
+  size_t _generation;
+  Observer<AbstractMesh>::Ptr _onNewMeshAddedObserver;
+  Observer<AbstractMesh>::Ptr _onMeshRemovedObserver;
+  Observer<TransformNode>::Ptr _onNewTransformNodeAddedObserver;
+  Observer<TransformNode>::Ptr _onTransformNodeRemovedObserver;
+
+}; // end of class TransformSystem
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_MESHES_TRANSFORM_SYSTEM_H
@@ -8,6 +8,7 @@
 #include <babylon/babylon_api.h>
 #include <babylon/babylon_common.h>
 #include <babylon/babylon_fwd.h>
+#include <babylon/meshes/vertex_data_view.h>
 
 namespace BABYLON {
 
@@ -214,6 +215,33 @@ public:
    */
   Float32Array getFloatData(size_t totalVertices, const std::optional<bool>& forceCopy);
 
+  /**
+   * @brief Gets a read-only view on the current buffer's data, without copying it.
+   * @param totalVertices number of vertices in the buffer to take into account
+   * @returns the view, empty if the buffer has no CPU data or if its type is not
+   * VertexBuffer::FLOAT (getFloatData converts the data of the other types)
+   */
+  [[nodiscard]] VertexDataView getFloatDataView(size_t totalVertices) const;
+
+  /**
+   * @brief Gets a mutable view on the current buffer's data and flags the data as dirty: the
+   * modified data is uploaded by the next call to _uploadDirtyData().
+   * @param totalVertices number of vertices in the buffer to take into account
+   * @returns the view, empty if the buffer has no CPU data or if its type is not
+   * VertexBuffer::FLOAT
+   */
+  MutableVertexDataView mapFloatDataForWrite(size_t totalVertices);
+
+  /**
+   * @brief Hidden
+   */
+  [[nodiscard]] bool _isDataDirty() const;
+
+  /**
+   * @brief Hidden
+   */
+  void _uploadDirtyData();
+
   /**
    * @brief Gets underlying native buffer.
    * @returns underlying native buffer
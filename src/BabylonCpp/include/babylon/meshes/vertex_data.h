@@ -7,6 +7,7 @@
 #include <babylon/maths/vector4.h>
 #include <babylon/meshes/mesh.h>
 #include <babylon/meshes/vertex_data_constants.h>
+#include <babylon/meshes/vertex_weld_options.h>
 
 namespace BABYLON {
 
@@ -112,6 +113,19 @@ public:
    */
   VertexData& merge(VertexData& other, bool use32BitsIndices = false);
 
+  /**
+   * @brief Welds the vertices whose positions are closer than options.epsilon (and whose
+   * normals, uvs and colors match, when compared), in linear time using a spatial hash. The
+   * unused vertices are removed and the vertex order follows the order of first use.
+   * @param options defines the tolerances and the compared attributes
+   * @param subMeshIndexCounts defines the number of indices of each consecutive group of
+   * triangles (submesh), used when options.weldAcrossSubMeshes is false and updated when
+   * degenerate triangles are removed
+   * @returns the modified VertexData
+   */
+  VertexData& weld(const VertexWeldOptions& options = VertexWeldOptions{},
+                   IndicesArray* subMeshIndexCounts = nullptr);
+
   /**
    * @brief Serializes the VertexData.
    * @returns a serialized object
@@ -0,0 +1,132 @@
+#ifndef BABYLON_MESHES_VERTEX_DATA_VIEW_H
+#define BABYLON_MESHES_VERTEX_DATA_VIEW_H
+
+#include <algorithm>
+#include <cstddef>
+
+#include <babylon/babylon_common.h>
+#include <babylon/maths/vector3.h>
+
+namespace BABYLON {
+
+/**
+ * @brief Non owning view on the float data of a vertex buffer (span like: pointer, vertex count,
+ * stride and component count).
+ *
+ * The view points into the CPU copy of the buffer: it is invalidated when the vertex data is set
+ * or updated again, or when the buffer is disposed. An empty view (null data) is returned when the
+ * data is not available.
+ * @tparam T float for a mutable view, const float for a read-only view
+ */
+template <typename T>
+struct BasicVertexDataView {
+
+  /**
+   * @brief Creates a view over a tightly packed array.
+   * @param array defines the array to view
+   * @param size defines the number of components per vertex
+   * @returns the view
+   */
+  template <typename ArrayType>
+  static BasicVertexDataView FromArray(ArrayType& array, size_t size)
+  {
+    if (array.empty() || size == 0) {
+      return BasicVertexDataView{};
+    }
+    return BasicVertexDataView{array.data(), array.size() / size, size, size, 5126};
+  }
+
+  /**
+   * @brief Gets whether the view does not point to any data.
+   */
+  [[nodiscard]] bool empty() const
+  {
+    return data == nullptr || count == 0;
+  }
+
+  /**
+   * @brief Gets whether the vertices are stored one after the other without interleaved data.
+   */
+  [[nodiscard]] bool isTightlyPacked() const
+  {
+    return stride == size;
+  }
+
+  /**
+   * @brief Gets the components of a vertex.
+   * @param index defines the vertex index
+   */
+  T* operator[](size_t index) const
+  {
+    return data + index * stride;
+  }
+
+  /**
+   * @brief Gets the first three components of a vertex as a Vector3.
+   * @param index defines the vertex index
+   */
+  [[nodiscard]] Vector3 getVector3(size_t index) const
+  {
+    const auto values = data + index * stride;
+    return Vector3(values[0], values[1], values[2]);
+  }
+
+  /**
+   * @brief Copies the viewed data in a tightly packed array.
+   * @returns the array
+   */
+  [[nodiscard]] Float32Array toArray() const
+  {
+    if (empty()) {
+      return Float32Array();
+    }
+    if (isTightlyPacked()) {
+      return Float32Array(data, data + count * size);
+    }
+    Float32Array result(count * size);
+    for (size_t index = 0; index < count; ++index) {
+      std::copy(data + index * stride, data + index * stride + size, result.data() + index * size);
+    }
+    return result;
+  }
+
+  /**
+   * Pointer to the first component of the first vertex
+   */
+  T* data = nullptr;
+
+  /**
+   * Number of vertices
+   */
+  size_t count = 0;
+
+  /**
+   * Number of components per vertex
+   */
+  size_t size = 0;
+
+  /**
+   * Number of floats between the start of two consecutive vertices
+   */
+  size_t stride = 0;
+
+  /**
+   * Component type of the buffer (VertexBuffer::FLOAT, ...), the data is always stored as floats
+   */
+  unsigned int type = 5126;
+
+}; // end of struct BasicVertexDataView
+
+/**
+ * Read-only view on vertex data
+ */
+using VertexDataView = BasicVertexDataView<const float>;
+
+/**
+ * Mutable view on vertex data, returned by the mapVerticesDataForWrite() functions
+ */
+using MutableVertexDataView = BasicVertexDataView<float>;
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_MESHES_VERTEX_DATA_VIEW_H
@@ -0,0 +1,45 @@
+#ifndef BABYLON_MESHES_VERTEX_WELD_OPTIONS_H
+#define BABYLON_MESHES_VERTEX_WELD_OPTIONS_H
+
+#include <babylon/babylon_api.h>
+
+namespace BABYLON {
+
+/**
+ * @brief Options of VertexData::weld().
+ */
+struct BABYLON_SHARED_EXPORT VertexWeldOptions {
+  /**
+   * Maximum distance along each axis between two welded positions (0 only welds identical
+   * positions)
+   */
+  float epsilon = 1e-4f;
+  /**
+   * Maximum difference of each component of the compared normals, uvs and colors
+   */
+  float attributeEpsilon = 1e-3f;
+  /**
+   * Defines if vertices with different normals are kept apart (hard edges)
+   */
+  bool compareNormals = true;
+  /**
+   * Defines if vertices with different uvs (any uv set) are kept apart (texture seams)
+   */
+  bool compareUVs = true;
+  /**
+   * Defines if vertices with different colors are kept apart
+   */
+  bool compareColors = true;
+  /**
+   * Defines if vertices used by different submeshes can be welded
+   */
+  bool weldAcrossSubMeshes = true;
+  /**
+   * Defines if the triangles collapsed by the welding are removed
+   */
+  bool removeDegenerateTriangles = true;
+}; // end of struct VertexWeldOptions
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_MESHES_VERTEX_WELD_OPTIONS_H
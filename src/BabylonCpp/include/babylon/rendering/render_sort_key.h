@@ -0,0 +1,74 @@
+#ifndef BABYLON_RENDERING_RENDER_SORT_KEY_H
+#define BABYLON_RENDERING_RENDER_SORT_KEY_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <babylon/babylon_api.h>
+
+namespace BABYLON {
+
+/**
+ * @brief Packed 64 bits sort key of a dispatched sub mesh, ordering a render queue with a single
+ * integer comparison.
+ *
+ * Opaque layout (most significant bits first), grouping the state changes and rendering front to
+ * back within a state:
+ * | layer (8) | alpha mode (4) | effect (14) | material (14) | vertex array (12) | depth (12) |
+ *
+ * Transparent layout, rendering back to front:
+ * | layer (8) | inverted depth (24) | alpha mode (4) | effect (14) | material (14) |
+ *
+ * The identifiers are truncated to their field width, a collision only affects the grouping of
+ * the state changes, never the depth ordering.
+ */
+struct BABYLON_SHARED_EXPORT RenderSortKey {
+  /**
+   * The packed key
+   */
+  uint64_t key = 0;
+
+  /**
+   * The index of the sub mesh in the queue
+   */
+  uint32_t index = 0;
+
+  /**
+   * @brief Builds the key of an opaque (or alpha tested) sub mesh.
+   * @param layer defines the layer of the sub mesh (lower layers are rendered first)
+   * @param alphaMode defines the alpha mode of the material
+   * @param effectId defines the unique id of the effect
+   * @param materialId defines the unique id of the material
+   * @param vertexArrayId defines the unique id of the vertex data source
+   * @param depth defines the normalized distance to the camera in [0, 1]
+   * @returns the packed key
+   */
+  static uint64_t Opaque(uint32_t layer, uint32_t alphaMode, size_t effectId, size_t materialId,
+                         size_t vertexArrayId, float depth);
+
+  /**
+   * @brief Builds the key of a transparent sub mesh.
+   * @param layer defines the layer of the sub mesh (lower layers are rendered first)
+   * @param depth defines the normalized distance to the camera in [0, 1]
+   * @param alphaMode defines the alpha mode of the material
+   * @param effectId defines the unique id of the effect
+   * @param materialId defines the unique id of the material
+   * @returns the packed key
+   */
+  static uint64_t Transparent(uint32_t layer, float depth, uint32_t alphaMode, size_t effectId,
+                              size_t materialId);
+
+  /**
+   * @brief Sorts keys in ascending order with a stable least significant digit radix sort (8 bits
+   * digits). The digits shared by all the keys are skipped, so only the varying bytes cost a pass.
+   * @param keys defines the keys to sort, sorted on return
+   * @param scratch defines a buffer reused between the calls to avoid allocations
+   */
+  static void RadixSort(std::vector<RenderSortKey>& keys, std::vector<RenderSortKey>& scratch);
+
+}; // end of struct RenderSortKey
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_RENDERING_RENDER_SORT_KEY_H
@@ -3,15 +3,18 @@
 
 #include <functional>
 #include <memory>
+#include <unordered_map>
 
 #include <babylon/babylon_api.h>
 #include <babylon/babylon_common.h>
 #include <babylon/babylon_fwd.h>
 #include <babylon/maths/vector3.h>
+#include <babylon/rendering/render_sort_key.h>
 
 namespace BABYLON {
 
 class EdgesRenderer;
+class Geometry;
 class IParticleSystem;
 class ISpriteManager;
 class Scene;
@@ -33,11 +36,12 @@ public:
   /**
    * @brief Creates a new rendering group.
    * @param index The rendering group index
-   * @param opaqueSortCompareFn The opaque sort comparison function. If null no order is applied
-   * @param alphaTestSortCompareFn The alpha test sort comparison function. If null no order is
-   * applied
-   * @param transparentSortCompareFn The transparent sort comparison function. If null back to front
-   * + alpha index sort is applied
+   * @param opaqueSortCompareFn The opaque sort comparison function. If null the sub meshes are
+   * sorted by sort key (state grouping + front to back)
+   * @param alphaTestSortCompareFn The alpha test sort comparison function. If null the sub meshes
+   * are sorted by sort key (state grouping + front to back)
+   * @param transparentSortCompareFn The transparent sort comparison function. If null the sub
+   * meshes are sorted by sort key (alpha index + back to front)
    */
   RenderingGroup(
     unsigned int index, Scene* scene,
@@ -137,43 +141,50 @@ private:
 
   void _renderSprites();
 
+  /**
+   * @brief Groups an opaque sub mesh with a previously dispatched sub mesh sharing the same
+   * geometry, material and draw state (automatic instancing).
+   * @returns true if the sub mesh will be drawn by the instanced draw call of another sub mesh
+   */
+  bool _dispatchAsAutoInstance(SubMesh* subMesh, AbstractMesh* mesh, const MaterialPtr& material);
+
+  /**
+   * @brief Returns a copy of a queue with the sub meshes grouped by automatic instancing, used
+   * when the queues are handed to a custom render function.
+   */
+  [[nodiscard]] std::vector<SubMesh*>
+  _withAutoInstances(const std::vector<SubMesh*>& subMeshes) const;
+
   /**
    * @brief Renders the submeshes in a specified order.
    * @param subMeshes The submeshes to sort before render
-   * @param sortCompareFn The comparison function use to sort
+   * @param sortCompareFn The comparison function use to sort, if null the submeshes are sorted by
+   * sort key
    * @param camera The camera to use to preprocess the submeshes to help sorting
    * @param transparent Specifies to activate blending if true
    */
-  static void
-  renderSorted(const std::vector<SubMesh*>& subMeshes,
-               const std::function<bool(const SubMesh* a, const SubMesh* b)>& sortCompareFn,
-               const CameraPtr& camera, bool transparent);
-
-  /**
-   * @brief Renders the submeshes in the order they were dispatched (no sort
-   * applied).
-   * @param subMeshes The submeshes to render
-   */
-  static void renderUnsorted(const std::vector<SubMesh*>& subMeshes);
+  void renderSorted(const std::vector<SubMesh*>& subMeshes,
+                    const std::function<bool(const SubMesh* a, const SubMesh* b)>& sortCompareFn,
+                    const CameraPtr& camera, bool transparent);
 
 protected:
   /**
    * @brief Set the opaque sort comparison function.
-   * If null the sub meshes will be render in the order they were created
+   * If null the sub meshes will be sorted by sort key (state grouping + front to back)
    */
   void
   set_opaqueSortCompareFn(const std::function<bool(const SubMesh* a, const SubMesh* b)>& value);
 
   /**
    * @brief Set the alpha test sort comparison function.
-   * If null the sub meshes will be render in the order they were created
+   * If null the sub meshes will be sorted by sort key (state grouping + front to back)
    */
   void
   set_alphaTestSortCompareFn(const std::function<bool(const SubMesh* a, const SubMesh* b)>& value);
 
   /**
    * @brief Set the transparent sort comparison function.
-   * If null the sub meshes will be render in the order they were created
+   * If null the sub meshes will be sorted by sort key (alpha index + back to front)
    */
   void set_transparentSortCompareFn(
     const std::function<bool(const SubMesh* a, const SubMesh* b)>& value);
@@ -187,21 +198,21 @@ public:
 
   /**
    * Sets the opaque sort comparison function
-   * If null the sub meshes will be render in the order they were created
+   * If null the sub meshes will be sorted by sort key (state grouping + front to back)
    */
   WriteOnlyProperty<RenderingGroup, std::function<bool(const SubMesh* a, const SubMesh* b)>>
     opaqueSortCompareFn;
 
   /**
    * Sets the alpha test sort comparison function.
-   * If null the sub meshes will be render in the order they were created
+   * If null the sub meshes will be sorted by sort key (state grouping + front to back)
    */
   WriteOnlyProperty<RenderingGroup, std::function<bool(const SubMesh* a, const SubMesh* b)>>
     alphaTestSortCompareFn;
 
   /**
    * Sets the transparent sort comparison function
-   * If null the sub meshes will be render in the order they were created
+   * If null the sub meshes will be sorted by sort key (alpha index + back to front)
    */
   WriteOnlyProperty<RenderingGroup, std::function<bool(const SubMesh* a, const SubMesh* b)>>
     transparentSortCompareFn;
@@ -224,6 +235,19 @@ private:
   std::function<void(const std::vector<SubMesh*>& subMeshes)> _renderAlphaTest;
   std::function<void(const std::vector<SubMesh*>& subMeshes)> _renderTransparent;
 
+  // Automatic instancing
+  struct AutoInstancesBatch {
+    std::vector<AbstractMesh*> meshes;
+    std::vector<SubMesh*> subMeshes;
+  }; // end of struct AutoInstancesBatch
+  std::unordered_map<Geometry*, std::vector<SubMesh*>> _autoInstancesLeaders;
+  std::unordered_map<SubMesh*, AutoInstancesBatch> _autoInstances;
+
+  // Sort buffers, reused between the frames
+  std::vector<RenderSortKey> _sortKeys;
+  std::vector<RenderSortKey> _sortKeysScratch;
+  std::vector<SubMesh*> _sortedSubMeshes;
+
 }; // end of class RenderingGroup
 
 } // end of namespace BABYLON
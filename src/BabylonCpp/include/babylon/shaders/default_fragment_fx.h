@@ -54,6 +54,7 @@ varying vec4 vColor;
 #include<__decl__lightFragment>[0..maxSimultaneousLights]
 
 #include<lightsFragmentFunctions>
+#include<clusteredLightingFunctions>
 #include<shadowsFragmentFunctions>
 
 // Samplers
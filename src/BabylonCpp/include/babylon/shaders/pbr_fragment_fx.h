@@ -56,6 +56,7 @@ const char* pbrPixelShader
 #include<pbrBRDFFunctions>
 #include<hdrFilteringFunctions>
 #include<pbrDirectLightingFunctions>
+#include<clusteredLightingFunctions>
 #include<pbrIBLFunctions>
 #include<bumpFragmentMainFunctions>
 #include<bumpFragmentFunctions>
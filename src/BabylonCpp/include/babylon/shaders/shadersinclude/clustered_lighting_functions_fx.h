@@ -0,0 +1,134 @@
+﻿#ifndef BABYLON_SHADERS_SHADERS_INCLUDE_CLUSTERED_LIGHTING_FUNCTIONS_FX_H
+#define BABYLON_SHADERS_SHADERS_INCLUDE_CLUSTERED_LIGHTING_FUNCTIONS_FX_H
+
+namespace BABYLON {
+
+extern const char* clusteredLightingFunctions;
+
+const char* clusteredLightingFunctions
+  = R"ShaderCode(
+
+#ifdef WEBGL2
+    #define CLUSTEREDLIGHTING
+
+    // Clustered lights: the light list of a cluster starts at its first texel (count followed by
+    // the light indices) and each light uses 5 texels of the light data texture.
+    ivec2 getClusterTexel(highp sampler2D clusterTexture, vec4 depthRow, vec4 sliceData, vec4 clusterInfo)
+    {
+        ivec2 clusterTextureSize = textureSize(clusterTexture, 0);
+        int texelsPerCluster = int(clusterInfo.z);
+        int slicesZ = int(clusterInfo.w);
+        int tilesX = clusterTextureSize.x / texelsPerCluster;
+        int tilesY = clusterTextureSize.y / slicesZ;
+
+        vec2 tile = (gl_FragCoord.xy - clusterInfo.xy) * sliceData.xy;
+        float depth = max(dot(depthRow, vec4(vPositionW, 1.0)), 0.0001);
+
+        int x = clamp(int(tile.x), 0, tilesX - 1);
+        int y = clamp(int(tile.y), 0, tilesY - 1);
+        int z = clamp(int(log(depth) * sliceData.z + sliceData.w), 0, slicesZ - 1);
+
+        return ivec2(x * texelsPerCluster, y + z * tilesY);
+    }
+
+    int getClusterLightIndex(highp sampler2D clusterTexture, ivec2 clusterTexel, int i)
+    {
+        vec4 texel = texelFetch(clusterTexture, ivec2(clusterTexel.x + i / 4, clusterTexel.y), 0);
+        return int(texel[i - (i / 4) * 4]);
+    }
+
+    #ifdef PBR
+        lightingInfo computeClusteredLighting(highp sampler2D lightDataTexture, highp sampler2D clusterTexture, vec4 depthRow, vec4 sliceData, vec4 clusterInfo, vec3 V, vec3 N, float NdotV, float roughness, vec3 reflectance0, vec3 reflectance90, float geometricRoughnessFactor)
+        {
+            lightingInfo result;
+            result.diffuse = vec3(0.);
+            #ifdef SPECULARTERM
+                result.specular = vec3(0.);
+            #endif
+            #ifdef CLEARCOAT
+                result.clearCoat = vec4(0., 0., 0., 1.);
+            #endif
+            #ifdef SHEEN
+                result.sheen = vec3(0.);
+            #endif
+
+            ivec2 clusterTexel = getClusterTexel(clusterTexture, depthRow, sliceData, clusterInfo);
+            int lightCount = int(texelFetch(clusterTexture, clusterTexel, 0).x);
+            for (int i = 1; i <= lightCount; i++)
+            {
+                int lightIndex = getClusterLightIndex(clusterTexture, clusterTexel, i);
+                vec4 positionRange = texelFetch(lightDataTexture, ivec2(0, lightIndex), 0);
+                vec4 diffuseRadius = texelFetch(lightDataTexture, ivec2(1, lightIndex), 0);
+                vec4 specularExponent = texelFetch(lightDataTexture, ivec2(2, lightIndex), 0);
+                vec4 direction = texelFetch(lightDataTexture, ivec2(3, lightIndex), 0);
+                vec4 falloff = texelFetch(lightDataTexture, ivec2(4, lightIndex), 0);
+
+                preLightingInfo preInfo = computePointAndSpotPreLightingInfo(vec4(positionRange.xyz, 0.), V, N);
+                preInfo.NdotV = NdotV;
+                preInfo.attenuation = computeDistanceLightFalloff(preInfo.lightOffset, preInfo.lightDistanceSquared, positionRange.w, falloff.x);
+                if (falloff.w > 0.)
+                {
+                    preInfo.attenuation *= computeDirectionalLightFalloff(direction.xyz, preInfo.L, direction.w, specularExponent.w, falloff.y, falloff.z);
+                }
+                preInfo.roughness = adjustRoughnessFromLightProperties(roughness, diffuseRadius.w, preInfo.lightDistance);
+
+                result.diffuse += computeDiffuseLighting(preInfo, diffuseRadius.rgb);
+                #ifdef SPECULARTERM
+                    result.specular += computeSpecularLighting(preInfo, N, reflectance0, reflectance90, geometricRoughnessFactor, diffuseRadius.rgb);
+                #endif
+            }
+
+            return result;
+        }
+    #else
+        lightingInfo computeClusteredLighting(highp sampler2D lightDataTexture, highp sampler2D clusterTexture, vec4 depthRow, vec4 sliceData, vec4 clusterInfo, vec3 viewDirectionW, vec3 vNormal, float glossiness)
+        {
+            lightingInfo result;
+            result.diffuse = vec3(0.);
+            #ifdef SPECULARTERM
+                result.specular = vec3(0.);
+            #endif
+            #ifdef NDOTL
+                result.ndl = 0.;
+            #endif
+
+            ivec2 clusterTexel = getClusterTexel(clusterTexture, depthRow, sliceData, clusterInfo);
+            int lightCount = int(texelFetch(clusterTexture, clusterTexel, 0).x);
+            for (int i = 1; i <= lightCount; i++)
+            {
+                int lightIndex = getClusterLightIndex(clusterTexture, clusterTexel, i);
+                vec4 positionRange = texelFetch(lightDataTexture, ivec2(0, lightIndex), 0);
+                vec4 diffuseRadius = texelFetch(lightDataTexture, ivec2(1, lightIndex), 0);
+                vec4 specularExponent = texelFetch(lightDataTexture, ivec2(2, lightIndex), 0);
+                vec4 direction = texelFetch(lightDataTexture, ivec2(3, lightIndex), 0);
+                vec4 falloff = texelFetch(lightDataTexture, ivec2(4, lightIndex), 0);
+
+                lightingInfo info;
+                if (falloff.w > 0.)
+                {
+                    info = computeSpotLighting(viewDirectionW, vNormal, vec4(positionRange.xyz, specularExponent.w), direction, diffuseRadius.rgb, specularExponent.rgb, positionRange.w, glossiness);
+                }
+                else
+                {
+                    info = computeLighting(viewDirectionW, vNormal, vec4(positionRange.xyz, 0.), diffuseRadius.rgb, specularExponent.rgb, positionRange.w, glossiness);
+                }
+
+                result.diffuse += info.diffuse;
+                #ifdef SPECULARTERM
+                    result.specular += info.specular;
+                #endif
+                #ifdef NDOTL
+                    result.ndl = max(result.ndl, info.ndl);
+                #endif
+            }
+
+            return result;
+        }
+    #endif
+#endif
+
+)ShaderCode";
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_SHADERS_SHADERS_INCLUDE_CLUSTERED_LIGHTING_FUNCTIONS_FX_H
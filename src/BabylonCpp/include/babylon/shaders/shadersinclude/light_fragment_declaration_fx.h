@@ -88,6 +88,11 @@ const char* lightFragmentDeclaration
         uniform vec4 vLightFalloff{X};
     #elif defined(HEMILIGHT{X})
         uniform vec3 vLightGround{X};
+    #elif defined(CLUSTLIGHT{X})
+        uniform vec4 vSliceData{X};
+        uniform vec4 vClusterInfo{X};
+        uniform highp sampler2D lightDataTexture{X};
+        uniform highp sampler2D clusterTexture{X};
     #endif
     #ifdef PROJECTEDLIGHTTEXTURE{X}
         uniform mat4 textureProjectionMatrix{X};
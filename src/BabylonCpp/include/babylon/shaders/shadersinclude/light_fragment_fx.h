@@ -11,6 +11,24 @@ const char* lightFragment
 #ifdef LIGHT{X}
     #if defined(SHADOWONLY) || defined(LIGHTMAP) && defined(LIGHTMAPEXCLUDED{X}) && defined(LIGHTMAPNOSPECULAR{X})
         //No light calculation
+    #elif defined(CLUSTLIGHT{X}) && defined(CLUSTEREDLIGHTING)
+        #ifdef PBR
+            info = computeClusteredLighting(lightDataTexture{X}, clusterTexture{X}, light{X}.vLightData, light{X}.vSliceData, light{X}.vClusterInfo, viewDirectionW, normalW, NdotV, roughness, clearcoatOut.specularEnvironmentR0, specularEnvironmentR90, AARoughnessFactors.x);
+        #else
+            info = computeClusteredLighting(lightDataTexture{X}, clusterTexture{X}, light{X}.vLightData, light{X}.vSliceData, light{X}.vClusterInfo, viewDirectionW, normalW, glossiness);
+        #endif
+    #elif defined(CLUSTLIGHT{X})
+        // Clustered lights are only rendered by the standard and PBR materials
+        info.diffuse = vec3(0.);
+        #ifdef SPECULARTERM
+            info.specular = vec3(0.);
+        #endif
+        #if defined(PBR) && defined(CLEARCOAT)
+            info.clearCoat = vec4(0., 0., 0., 1.);
+        #endif
+        #if defined(PBR) && defined(SHEEN)
+            info.sheen = vec3(0.);
+        #endif
     #else
         #ifdef PBR
             // Compute Pre Lighting infos
@@ -22,10 +22,17 @@ const char* lightUboDeclaration
             vec4 vLightFalloff;
         #elif defined(HEMILIGHT{X})
             vec3 vLightGround;
+        #elif defined(CLUSTLIGHT{X})
+            vec4 vSliceData;
+            vec4 vClusterInfo;
         #endif
         vec4 shadowsInfo;
         vec2 depthValues;
     } light{X};
+#ifdef CLUSTLIGHT{X}
+    uniform highp sampler2D lightDataTexture{X};
+    uniform highp sampler2D clusterTexture{X};
+#endif
 #ifdef PROJECTEDLIGHTTEXTURE{X}
     uniform mat4 textureProjectionMatrix{X};
     uniform sampler2D projectionLightSampler{X};
@@ -8,9 +8,7 @@
 
 namespace BABYLON {
 
-namespace GL {
-class IGLRenderingContext;
-} // end of namespace GL
+class GLStateCache;
 
 class BABYLON_SHARED_EXPORT AlphaState {
 
@@ -26,7 +24,13 @@ public:
                                        unsigned int value2, unsigned int value3);
   void setAlphaEquationParameters(unsigned int rgb, unsigned int alpha);
   void reset();
-  void apply(GL::IGLRenderingContext& gl);
+  void apply(GLStateCache& glState);
+
+  /**
+   * @brief Copies the values of another state, only the changed values are flagged as dirty.
+   * @param other defines the state to copy
+   */
+  void copyFrom(const AlphaState& other);
 
 protected:
   [[nodiscard]] bool get_isDirty() const;
@@ -6,9 +6,7 @@
 
 namespace BABYLON {
 
-namespace GL {
-class IGLRenderingContext;
-} // end of namespace GL
+class GLStateCache;
 
 class BABYLON_SHARED_EXPORT DepthCullingState {
 
@@ -20,7 +18,13 @@ public:
   ~DepthCullingState(); // = default
 
   void reset();
-  void apply(GL::IGLRenderingContext& _gl);
+  void apply(GLStateCache& glState);
+
+  /**
+   * @brief Copies the values of another state, only the changed values are flagged as dirty.
+   * @param other defines the state to copy
+   */
+  void copyFrom(const DepthCullingState& other);
 
 protected:
   [[nodiscard]] bool get_isDirty() const;
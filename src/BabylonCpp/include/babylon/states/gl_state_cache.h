@@ -0,0 +1,153 @@
+#ifndef BABYLON_STATES_GL_STATE_CACHE_H
+#define BABYLON_STATES_GL_STATE_CACHE_H
+
+#include <array>
+#include <optional>
+#include <unordered_map>
+
+#include <babylon/babylon_api.h>
+#include <babylon/babylon_common.h>
+
+namespace BABYLON {
+
+namespace GL {
+class IGLRenderingContext;
+class IGLUniformLocation;
+} // end of namespace GL
+
+/**
+ * @brief GL calls statistics of a frame.
+ */
+struct BABYLON_SHARED_EXPORT GLStateCounters {
+  /**
+   * Number of GL calls issued
+   */
+  size_t glCalls = 0;
+  /**
+   * Number of redundant GL calls filtered
+   */
+  size_t filteredGLCalls = 0;
+  /**
+   * Number of programs switches
+   */
+  size_t programSwitches = 0;
+  /**
+   * Number of textures binds
+   */
+  size_t textureBinds = 0;
+
+  /**
+   * @brief Resets the counters.
+   */
+  void reset();
+}; // end of struct GLStateCounters
+
+/**
+ * @brief Shadow copy of the GL server state used to filter the redundant GL calls.
+ *
+ * The states (depth culling, alpha, stencil, color mask, capabilities) are unknown until they are
+ * set for the first time, the first call is then always issued. The uniform values are shadowed
+ * in the uniform locations as they are owned by the programs.
+ */
+class BABYLON_SHARED_EXPORT GLStateCache {
+
+public:
+  GLStateCache();
+  ~GLStateCache(); // = default
+
+  /**
+   * @brief Sets the context receiving the GL calls, the shadow state is invalidated.
+   * @param gl defines the GL rendering context
+   */
+  void setContext(GL::IGLRenderingContext* gl);
+
+  /**
+   * @brief Forgets the shadow state, to be called when the GL state is modified outside of the
+   * engine.
+   */
+  void invalidate();
+
+  /**
+   * @brief Gets the counters of the current frame.
+   */
+  [[nodiscard]] const GLStateCounters& counters() const;
+
+  /**
+   * @brief Resets the counters, called at the beginning of each frame.
+   */
+  void resetCounters();
+
+  /**
+   * @brief Counts GL calls issued outside of the cache.
+   * @param count defines the number of calls issued
+   */
+  void countIssued(size_t count = 1);
+
+  /**
+   * @brief Counts GL calls filtered by a cache maintained outside of this class.
+   * @param count defines the number of calls filtered
+   */
+  void countFiltered(size_t count = 1);
+
+  /**
+   * @brief Counts a program switch.
+   */
+  void countProgramSwitch();
+
+  /**
+   * @brief Counts a texture bind.
+   */
+  void countTextureBind();
+
+  /**
+   * @brief Checks a uniform write against the value previously written in the location.
+   * @param location defines the uniform location
+   * @param data defines the new value
+   * @param byteLength defines the size of the new value in bytes
+   * @returns true if the GL call has to be issued, false if it is redundant
+   */
+  bool uniform(GL::IGLUniformLocation& location, const void* data, size_t byteLength);
+
+  /** GL state setters issuing the GL call only if the state changes **/
+
+  void setCapability(unsigned int capability, bool enabled);
+  void depthMask(bool flag);
+  void depthFunc(unsigned int func);
+  void cullFace(unsigned int mode);
+  void frontFace(unsigned int mode);
+  void polygonOffset(float factor, float units);
+  void blendFuncSeparate(unsigned int srcRGB, unsigned int dstRGB, unsigned int srcAlpha,
+                         unsigned int dstAlpha);
+  void blendEquationSeparate(unsigned int modeRGB, unsigned int modeAlpha);
+  void blendColor(float red, float green, float blue, float alpha);
+  void colorMask(bool red, bool green, bool blue, bool alpha);
+  void stencilFunc(unsigned int func, int ref, unsigned int mask);
+  void stencilOp(unsigned int fail, unsigned int zfail, unsigned int zpass);
+  void stencilMask(unsigned int mask);
+
+private:
+  template <typename T>
+  bool _update(std::optional<T>& shadow, const T& value);
+
+private:
+  GL::IGLRenderingContext* _gl;
+  GLStateCounters _counters;
+  std::unordered_map<unsigned int, bool> _capabilities;
+  std::optional<bool> _depthMask;
+  std::optional<unsigned int> _depthFunc;
+  std::optional<unsigned int> _cullFace;
+  std::optional<unsigned int> _frontFace;
+  std::optional<std::array<float, 2>> _polygonOffset;
+  std::optional<std::array<unsigned int, 4>> _blendFunc;
+  std::optional<std::array<unsigned int, 2>> _blendEquation;
+  std::optional<std::array<float, 4>> _blendColor;
+  std::optional<std::array<bool, 4>> _colorMask;
+  std::optional<std::array<unsigned int, 3>> _stencilFunc;
+  std::optional<std::array<unsigned int, 3>> _stencilOp;
+  std::optional<unsigned int> _stencilMask;
+
+}; // end of class GLStateCache
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_STATES_GL_STATE_CACHE_H
@@ -11,6 +11,7 @@
 
 namespace BABYLON {
 
+class GLStateCache;
 FWD_CLASS_SPTR(StencilState)
 
 class BABYLON_SHARED_EXPORT StencilState : public IStencilState {
@@ -52,6 +53,12 @@ public:
 
   void reset() override;
 
+  /**
+   * @brief Applies the state to the GL context.
+   * @param glState defines the GL state cache filtering the redundant calls
+   */
+  void apply(GLStateCache& glState);
+
 protected:
   unsigned int get_func() const override;
   void set_func(unsigned int value) override;
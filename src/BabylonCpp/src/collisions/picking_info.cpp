@@ -51,11 +51,14 @@ std::optional<Vector3> PickingInfo::getNormal(bool useWorldCoordinates, bool use
   Vector3 result;
 
   if (useVerticesNormals) {
-    auto normals = pickedMesh->getVerticesData(VertexBuffer::NormalKind);
+    const auto normals = pickedMesh->getVerticesDataView(VertexBuffer::NormalKind);
+    if (normals.empty()) {
+      return std::nullopt;
+    }
 
-    auto normal0 = Vector3::FromArray(normals, indices[faceId * 3] * 3);
-    auto normal1 = Vector3::FromArray(normals, indices[faceId * 3 + 1] * 3);
-    auto normal2 = Vector3::FromArray(normals, indices[faceId * 3 + 2] * 3);
+    auto normal0 = normals.getVector3(indices[faceId * 3]);
+    auto normal1 = normals.getVector3(indices[faceId * 3 + 1]);
+    auto normal2 = normals.getVector3(indices[faceId * 3 + 2]);
 
     normal0 = normal0.scale(bu);
     normal1 = normal1.scale(bv);
@@ -65,11 +68,14 @@ std::optional<Vector3> PickingInfo::getNormal(bool useWorldCoordinates, bool use
                      normal0.z + normal1.z + normal2.z);
   }
   else {
-    auto positions = pickedMesh->getVerticesData(VertexBuffer::PositionKind);
+    const auto positions = pickedMesh->getVerticesDataView(VertexBuffer::PositionKind);
+    if (positions.empty()) {
+      return std::nullopt;
+    }
 
-    auto vertex1 = Vector3::FromArray(positions, indices[faceId * 3] * 3);
-    auto vertex2 = Vector3::FromArray(positions, indices[faceId * 3 + 1] * 3);
-    auto vertex3 = Vector3::FromArray(positions, indices[faceId * 3 + 2] * 3);
+    auto vertex1 = positions.getVector3(indices[faceId * 3]);
+    auto vertex2 = positions.getVector3(indices[faceId * 3 + 1]);
+    auto vertex3 = positions.getVector3(indices[faceId * 3 + 2]);
 
     auto p1p2 = vertex1.subtract(vertex2);
     auto p3p2 = vertex3.subtract(vertex2);
@@ -109,14 +115,18 @@ std::optional<Vector2> PickingInfo::getTextureCoordinates()
     return std::nullopt;
   }
 
-  const auto uvs = pickedMesh->getVerticesData(VertexBuffer::UVKind);
+  const auto uvs = pickedMesh->getVerticesDataView(VertexBuffer::UVKind);
   if (uvs.empty()) {
     return std::nullopt;
   }
 
-  auto uv0 = Vector2::FromArray(uvs, indices[faceId * 3] * 2);
-  auto uv1 = Vector2::FromArray(uvs, indices[faceId * 3 + 1] * 2);
-  auto uv2 = Vector2::FromArray(uvs, indices[faceId * 3 + 2] * 2);
+  const auto uvAt = [&uvs](uint32_t index) {
+    const auto uv = uvs[index];
+    return Vector2(uv[0], uv[1]);
+  };
+  auto uv0 = uvAt(indices[faceId * 3]);
+  auto uv1 = uvAt(indices[faceId * 3 + 1]);
+  auto uv2 = uvAt(indices[faceId * 3 + 2]);
 
   uv0 = uv0.scale(bu);
   uv1 = uv1.scale(bv);
@@ -0,0 +1,141 @@
+#include <babylon/core/thread_pool.h>
+
+#include <algorithm>
+#include <atomic>
+
+namespace BABYLON {
+
+ThreadPool::ThreadPool(size_t numWorkers) : _stopping{false}
+{
+#ifdef __EMSCRIPTEN__
+  numWorkers = 0;
+#endif
+  _workers.reserve(numWorkers);
+  for (size_t i = 0; i < numWorkers; ++i) {
+    _workers.emplace_back([this]() { _workerLoop(); });
+  }
+}
+
+ThreadPool::~ThreadPool()
+{
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _stopping = true;
+  }
+  _condition.notify_all();
+  for (auto& worker : _workers) {
+    if (worker.joinable()) {
+      worker.join();
+    }
+  }
+}
+
+size_t ThreadPool::DefaultWorkerCount()
+{
+#ifdef __EMSCRIPTEN__
+  return 0;
+#else
+  const auto hardwareThreads = static_cast<size_t>(std::thread::hardware_concurrency());
+  return hardwareThreads > 1 ? hardwareThreads - 1 : 0;
+#endif
+}
+
+size_t ThreadPool::workerCount() const
+{
+  return _workers.size();
+}
+
+void ThreadPool::_push(std::function<void()>&& job)
+{
+  if (_workers.empty()) {
+    job();
+    return;
+  }
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _jobs.emplace_back(std::move(job));
+  }
+  _condition.notify_one();
+}
+
+void ThreadPool::_workerLoop()
+{
+  for (;;) {
+    std::function<void()> job;
+    {
+      std::unique_lock<std::mutex> lock(_mutex);
+      _condition.wait(lock, [this]() { return _stopping || !_jobs.empty(); });
+      if (_stopping && _jobs.empty()) {
+        return;
+      }
+      job = std::move(_jobs.front());
+      _jobs.pop_front();
+    }
+    job();
+  }
+}
+
+size_t ThreadPool::chunkCount(size_t count, size_t grainSize) const
+{
+  if (count == 0) {
+    return 0;
+  }
+  grainSize             = std::max<size_t>(grainSize, 1);
+  const auto maxChunks  = (count + grainSize - 1) / grainSize;
+  const auto numThreads = _workers.size() + 1;
+  return std::min(maxChunks, numThreads);
+}
+
+size_t ThreadPool::parallelFor(
+  size_t count, size_t grainSize,
+  const std::function<void(size_t chunkIndex, size_t begin, size_t end)>& func)
+{
+  const auto numChunks = chunkCount(count, grainSize);
+  if (numChunks == 0) {
+    return 0;
+  }
+  if (numChunks == 1) {
+    func(0, 0, count);
+    return 1;
+  }
+
+  // Shared state is reference counted so that helpers scheduled after all chunks were consumed
+  // never touch the stack of the calling thread
+  struct SharedState {
+    std::atomic<size_t> nextChunk{0};
+    std::atomic<size_t> remaining{0};
+    std::mutex mutex;
+    std::condition_variable condition;
+  };
+  auto state       = std::make_shared<SharedState>();
+  state->remaining = numChunks;
+
+  const auto chunkSize = (count + numChunks - 1) / numChunks;
+  const auto* funcPtr  = &func;
+  const auto runChunks = [state, funcPtr, numChunks, chunkSize, count]() {
+    for (auto chunk = state->nextChunk++; chunk < numChunks; chunk = state->nextChunk++) {
+      const auto begin = chunk * chunkSize;
+      const auto end   = std::min(begin + chunkSize, count);
+      if (begin < end) {
+        (*funcPtr)(chunk, begin, end);
+      }
+      if (--state->remaining == 0) {
+        std::lock_guard<std::mutex> lock(state->mutex);
+        state->condition.notify_all();
+      }
+    }
+  };
+
+  // The calling thread processes chunks as well, so only numChunks - 1 helpers are needed
+  for (size_t i = 1; i < numChunks; ++i) {
+    _push(runChunks);
+  }
+  runChunks();
+
+  std::unique_lock<std::mutex> lock(state->mutex);
+  state->condition.wait(lock, [&state]() { return state->remaining.load() == 0; });
+
+  return numChunks;
+}
+
+} // end of namespace BABYLON
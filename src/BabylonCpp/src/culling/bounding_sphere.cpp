@@ -66,7 +66,8 @@ void BoundingSphere::_update(Matrix worldMatrix)
 {
   if (!worldMatrix.isIdentity()) {
     Vector3::TransformCoordinatesToRef(center, worldMatrix, centerWorld);
-    auto& tempVector = BoundingSphere::TmpVector3[0];
+    // Local temporary: the bounding info update may run on worker threads
+    Vector3 tempVector;
     Vector3::TransformNormalFromFloatsToRef(1.f, 1.f, 1.f, worldMatrix, tempVector);
     radiusWorld
       = std::max(std::max(std::abs(tempVector.x), std::abs(tempVector.y)), std::abs(tempVector.z))
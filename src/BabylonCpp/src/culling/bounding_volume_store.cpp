@@ -0,0 +1,258 @@
+#include <babylon/culling/bounding_volume_store.h>
+
+#include <cmath>
+
+#include <babylon/culling/bounding_info.h>
+#include <babylon/maths/plane.h>
+
+#if defined(__AVX__)
+#include <immintrin.h>
+#define BABYLON_BOUNDING_VOLUME_STORE_AVX
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define BABYLON_BOUNDING_VOLUME_STORE_SSE
+#endif
+
+namespace BABYLON {
+
+// Arrays are padded to a multiple of the widest SIMD batch, padding slots are always culled
+static constexpr size_t BOUNDING_VOLUME_STORE_BATCH_SIZE = 8;
+
+// Radius of the slots without bounding volume: dot(plane, center) <= -radius is always true
+static constexpr float BOUNDING_VOLUME_STORE_INVALID_RADIUS = std::numeric_limits<float>::lowest();
+
+BoundingVolumeStore::BoundingVolumeStore() : _capacity{0}
+{
+}
+
+BoundingVolumeStore::~BoundingVolumeStore() = default;
+
+size_t BoundingVolumeStore::allocate()
+{
+  if (!_freeSlots.empty()) {
+    const auto slot = _freeSlots.back();
+    _freeSlots.pop_back();
+    invalidate(slot);
+    return slot;
+  }
+
+  const auto slot = _capacity++;
+  if (_capacity > _sphereRadius.size()) {
+    const auto paddedSize = _sphereRadius.size() + BOUNDING_VOLUME_STORE_BATCH_SIZE;
+    _sphereCenterX.resize(paddedSize, 0.f);
+    _sphereCenterY.resize(paddedSize, 0.f);
+    _sphereCenterZ.resize(paddedSize, 0.f);
+    _sphereRadius.resize(paddedSize, BOUNDING_VOLUME_STORE_INVALID_RADIUS);
+    _boxCenterX.resize(paddedSize, 0.f);
+    _boxCenterY.resize(paddedSize, 0.f);
+    _boxCenterZ.resize(paddedSize, 0.f);
+    _boxExtendX.resize(paddedSize, 0.f);
+    _boxExtendY.resize(paddedSize, 0.f);
+    _boxExtendZ.resize(paddedSize, 0.f);
+  }
+
+  return slot;
+}
+
+void BoundingVolumeStore::release(size_t slot)
+{
+  if (slot >= _capacity) {
+    return;
+  }
+
+  invalidate(slot);
+  _freeSlots.emplace_back(slot);
+}
+
+void BoundingVolumeStore::update(size_t slot, const BoundingInfo& boundingInfo)
+{
+  const auto& sphere = boundingInfo.boundingSphere;
+  const auto& box    = boundingInfo.boundingBox;
+
+  _sphereCenterX[slot] = sphere.centerWorld.x;
+  _sphereCenterY[slot] = sphere.centerWorld.y;
+  _sphereCenterZ[slot] = sphere.centerWorld.z;
+  _sphereRadius[slot]  = sphere.radiusWorld;
+  _boxCenterX[slot]    = box.centerWorld.x;
+  _boxCenterY[slot]    = box.centerWorld.y;
+  _boxCenterZ[slot]    = box.centerWorld.z;
+  _boxExtendX[slot]    = box.extendSizeWorld.x;
+  _boxExtendY[slot]    = box.extendSizeWorld.y;
+  _boxExtendZ[slot]    = box.extendSizeWorld.z;
+}
+
+void BoundingVolumeStore::invalidate(size_t slot)
+{
+  _sphereCenterX[slot] = 0.f;
+  _sphereCenterY[slot] = 0.f;
+  _sphereCenterZ[slot] = 0.f;
+  _sphereRadius[slot]  = BOUNDING_VOLUME_STORE_INVALID_RADIUS;
+  _boxCenterX[slot]    = 0.f;
+  _boxCenterY[slot]    = 0.f;
+  _boxCenterZ[slot]    = 0.f;
+  _boxExtendX[slot]    = 0.f;
+  _boxExtendY[slot]    = 0.f;
+  _boxExtendZ[slot]    = 0.f;
+}
+
+size_t BoundingVolumeStore::capacity() const
+{
+  return _capacity;
+}
+
+size_t BoundingVolumeStore::size() const
+{
+  return _capacity - _freeSlots.size();
+}
+
+void BoundingVolumeStore::cull(const std::array<Plane, 6>& frustumPlanes,
+                               std::vector<uint64_t>& visibility, bool forceScalar) const
+{
+  visibility.assign((_sphereRadius.size() + 63) / 64, 0ull);
+
+#if defined(BABYLON_BOUNDING_VOLUME_STORE_AVX) || defined(BABYLON_BOUNDING_VOLUME_STORE_SSE)
+  if (!forceScalar) {
+    _cullSIMD(frustumPlanes, visibility);
+    return;
+  }
+#endif
+
+  _cullScalar(frustumPlanes, visibility);
+}
+
+void BoundingVolumeStore::_cullScalar(const std::array<Plane, 6>& frustumPlanes,
+                                      std::vector<uint64_t>& visibility) const
+{
+  const auto count = _sphereRadius.size();
+  for (size_t i = 0; i < count; ++i) {
+    auto culled = false;
+    for (const auto& plane : frustumPlanes) {
+      const auto& n = plane.normal;
+      // Sphere
+      const auto sphereDistance
+        = n.x * _sphereCenterX[i] + n.y * _sphereCenterY[i] + n.z * _sphereCenterZ[i] + plane.d;
+      // Box: distance of the center + projected radius of the extends on the plane normal
+      const auto boxDistance
+        = n.x * _boxCenterX[i] + n.y * _boxCenterY[i] + n.z * _boxCenterZ[i] + plane.d;
+      const auto boxRadius = std::abs(n.x) * _boxExtendX[i] + std::abs(n.y) * _boxExtendY[i]
+                             + std::abs(n.z) * _boxExtendZ[i];
+      if (sphereDistance <= -_sphereRadius[i] || boxDistance + boxRadius < 0.f) {
+        culled = true;
+        break;
+      }
+    }
+    if (!culled) {
+      visibility[i >> 6] |= 1ull << (i & 63);
+    }
+  }
+}
+
+#if defined(BABYLON_BOUNDING_VOLUME_STORE_AVX)
+
+void BoundingVolumeStore::_cullSIMD(const std::array<Plane, 6>& frustumPlanes,
+                                    std::vector<uint64_t>& visibility) const
+{
+  __m256 nx[6], ny[6], nz[6], absNx[6], absNy[6], absNz[6], nd[6];
+  for (size_t p = 0; p < 6; ++p) {
+    const auto& plane = frustumPlanes[p];
+    nx[p]             = _mm256_set1_ps(plane.normal.x);
+    ny[p]             = _mm256_set1_ps(plane.normal.y);
+    nz[p]             = _mm256_set1_ps(plane.normal.z);
+    absNx[p]          = _mm256_set1_ps(std::abs(plane.normal.x));
+    absNy[p]          = _mm256_set1_ps(std::abs(plane.normal.y));
+    absNz[p]          = _mm256_set1_ps(std::abs(plane.normal.z));
+    nd[p]             = _mm256_set1_ps(plane.d);
+  }
+  const auto zero     = _mm256_setzero_ps();
+  const auto signMask = _mm256_set1_ps(-0.f);
+
+  const auto count = _sphereRadius.size();
+  for (size_t i = 0; i < count; i += 8) {
+    const auto scx     = _mm256_loadu_ps(&_sphereCenterX[i]);
+    const auto scy     = _mm256_loadu_ps(&_sphereCenterY[i]);
+    const auto scz     = _mm256_loadu_ps(&_sphereCenterZ[i]);
+    const auto negRad  = _mm256_xor_ps(_mm256_loadu_ps(&_sphereRadius[i]), signMask);
+    const auto bcx     = _mm256_loadu_ps(&_boxCenterX[i]);
+    const auto bcy     = _mm256_loadu_ps(&_boxCenterY[i]);
+    const auto bcz     = _mm256_loadu_ps(&_boxCenterZ[i]);
+    const auto bex     = _mm256_loadu_ps(&_boxExtendX[i]);
+    const auto bey     = _mm256_loadu_ps(&_boxExtendY[i]);
+    const auto bez     = _mm256_loadu_ps(&_boxExtendZ[i]);
+    auto culled        = zero;
+    for (size_t p = 0; p < 6; ++p) {
+      const auto sd = _mm256_add_ps(
+        _mm256_add_ps(_mm256_mul_ps(nx[p], scx), _mm256_mul_ps(ny[p], scy)),
+        _mm256_add_ps(_mm256_mul_ps(nz[p], scz), nd[p]));
+      const auto bd = _mm256_add_ps(
+        _mm256_add_ps(_mm256_mul_ps(nx[p], bcx), _mm256_mul_ps(ny[p], bcy)),
+        _mm256_add_ps(_mm256_mul_ps(nz[p], bcz), nd[p]));
+      const auto br = _mm256_add_ps(
+        _mm256_add_ps(_mm256_mul_ps(absNx[p], bex), _mm256_mul_ps(absNy[p], bey)),
+        _mm256_mul_ps(absNz[p], bez));
+      culled = _mm256_or_ps(culled, _mm256_cmp_ps(sd, negRad, _CMP_LE_OQ));
+      culled = _mm256_or_ps(culled, _mm256_cmp_ps(_mm256_add_ps(bd, br), zero, _CMP_LT_OQ));
+    }
+    const auto visibleMask = static_cast<uint64_t>(~_mm256_movemask_ps(culled) & 0xFF);
+    visibility[i >> 6] |= visibleMask << (i & 63);
+  }
+}
+
+#elif defined(BABYLON_BOUNDING_VOLUME_STORE_SSE)
+
+void BoundingVolumeStore::_cullSIMD(const std::array<Plane, 6>& frustumPlanes,
+                                    std::vector<uint64_t>& visibility) const
+{
+  __m128 nx[6], ny[6], nz[6], absNx[6], absNy[6], absNz[6], nd[6];
+  for (size_t p = 0; p < 6; ++p) {
+    const auto& plane = frustumPlanes[p];
+    nx[p]             = _mm_set1_ps(plane.normal.x);
+    ny[p]             = _mm_set1_ps(plane.normal.y);
+    nz[p]             = _mm_set1_ps(plane.normal.z);
+    absNx[p]          = _mm_set1_ps(std::abs(plane.normal.x));
+    absNy[p]          = _mm_set1_ps(std::abs(plane.normal.y));
+    absNz[p]          = _mm_set1_ps(std::abs(plane.normal.z));
+    nd[p]             = _mm_set1_ps(plane.d);
+  }
+  const auto zero     = _mm_setzero_ps();
+  const auto signMask = _mm_set1_ps(-0.f);
+
+  const auto count = _sphereRadius.size();
+  for (size_t i = 0; i < count; i += 4) {
+    const auto scx    = _mm_loadu_ps(&_sphereCenterX[i]);
+    const auto scy    = _mm_loadu_ps(&_sphereCenterY[i]);
+    const auto scz    = _mm_loadu_ps(&_sphereCenterZ[i]);
+    const auto negRad = _mm_xor_ps(_mm_loadu_ps(&_sphereRadius[i]), signMask);
+    const auto bcx    = _mm_loadu_ps(&_boxCenterX[i]);
+    const auto bcy    = _mm_loadu_ps(&_boxCenterY[i]);
+    const auto bcz    = _mm_loadu_ps(&_boxCenterZ[i]);
+    const auto bex    = _mm_loadu_ps(&_boxExtendX[i]);
+    const auto bey    = _mm_loadu_ps(&_boxExtendY[i]);
+    const auto bez    = _mm_loadu_ps(&_boxExtendZ[i]);
+    auto culled       = zero;
+    for (size_t p = 0; p < 6; ++p) {
+      const auto sd = _mm_add_ps(_mm_add_ps(_mm_mul_ps(nx[p], scx), _mm_mul_ps(ny[p], scy)),
+                                 _mm_add_ps(_mm_mul_ps(nz[p], scz), nd[p]));
+      const auto bd = _mm_add_ps(_mm_add_ps(_mm_mul_ps(nx[p], bcx), _mm_mul_ps(ny[p], bcy)),
+                                 _mm_add_ps(_mm_mul_ps(nz[p], bcz), nd[p]));
+      const auto br
+        = _mm_add_ps(_mm_add_ps(_mm_mul_ps(absNx[p], bex), _mm_mul_ps(absNy[p], bey)),
+                     _mm_mul_ps(absNz[p], bez));
+      culled = _mm_or_ps(culled, _mm_cmple_ps(sd, negRad));
+      culled = _mm_or_ps(culled, _mm_cmplt_ps(_mm_add_ps(bd, br), zero));
+    }
+    const auto visibleMask = static_cast<uint64_t>(~_mm_movemask_ps(culled) & 0xF);
+    visibility[i >> 6] |= visibleMask << (i & 63);
+  }
+}
+
+#else
+
+void BoundingVolumeStore::_cullSIMD(const std::array<Plane, 6>& frustumPlanes,
+                                    std::vector<uint64_t>& visibility) const
+{
+  _cullScalar(frustumPlanes, visibility);
+}
+
+#endif
+
+} // end of namespace BABYLON
@@ -0,0 +1,161 @@
+#include <babylon/culling/bvh/bvh_active_mesh_candidate_provider.h>
+
+#include <algorithm>
+
+#include <babylon/culling/bounding_box.h>
+#include <babylon/culling/bounding_info.h>
+#include <babylon/engines/scene.h>
+#include <babylon/meshes/abstract_mesh.h>
+#include <babylon/meshes/transform_system.h>
+
+namespace BABYLON {
+
+BVHActiveMeshCandidateProvider::BVHActiveMeshCandidateProvider(Scene* scene, float margin)
+    : _scene{scene}, _bvh{margin}
+{
+  for (const auto& mesh : _scene->meshes) {
+    addMesh(mesh.get());
+  }
+
+  _onNewMeshAddedObserver = _scene->onNewMeshAddedObservable.add(
+    [this](AbstractMesh* mesh, EventState& /*es*/) { addMesh(mesh); });
+  _onMeshRemovedObserver = _scene->onMeshRemovedObservable.add(
+    [this](AbstractMesh* mesh, EventState& /*es*/) { removeMesh(mesh); });
+  _onMeshBoundingInfoChangedObserver = _scene->onMeshBoundingInfoChangedObservable.add(
+    [this](AbstractMesh* mesh, EventState& /*es*/) { updateMesh(mesh); });
+  _onSceneDisposeObserver = _scene->onDisposeObservable.add(
+    [this](Scene* /*scene*/, EventState& /*es*/) { _detachFromScene(); });
+}
+
+BVHActiveMeshCandidateProvider::~BVHActiveMeshCandidateProvider()
+{
+  if (_scene) {
+    _scene->onDisposeObservable.remove(_onSceneDisposeObserver);
+    _detachFromScene();
+  }
+}
+
+void BVHActiveMeshCandidateProvider::_detachFromScene()
+{
+  // The dispose observer is cleared by the scene itself
+  _scene->onNewMeshAddedObservable.remove(_onNewMeshAddedObserver);
+  _scene->onMeshRemovedObservable.remove(_onMeshRemovedObserver);
+  _scene->onMeshBoundingInfoChangedObservable.remove(_onMeshBoundingInfoChangedObserver);
+  if (_scene->getActiveMeshCandidateProvider() == this) {
+    _scene->setActiveMeshCandidateProvider(nullptr);
+  }
+  _scene = nullptr;
+}
+
+void BVHActiveMeshCandidateProvider::addMesh(AbstractMesh* mesh)
+{
+  if (!mesh || _proxies.find(mesh) != _proxies.end()) {
+    return;
+  }
+
+  mesh->computeWorldMatrix();
+  const auto& boundingBox   = mesh->getBoundingInfo()->boundingBox;
+  auto& proxy               = _proxies[mesh];
+  proxy.proxyId             = _bvh.createProxy(boundingBox.minimumWorld, boundingBox.maximumWorld,
+                                               mesh);
+  proxy.isDirty             = false;
+  proxy.alwaysSelectedIndex = -1;
+  _setAlwaysSelected(mesh, proxy, mesh->alwaysSelectAsActiveMesh);
+}
+
+void BVHActiveMeshCandidateProvider::removeMesh(AbstractMesh* mesh)
+{
+  auto it = _proxies.find(mesh);
+  if (it == _proxies.end()) {
+    return;
+  }
+
+  _bvh.destroyProxy(it->second.proxyId);
+  _setAlwaysSelected(mesh, it->second, false);
+  _proxies.erase(it);
+}
+
+void BVHActiveMeshCandidateProvider::updateMesh(AbstractMesh* mesh)
+{
+  auto it = _proxies.find(mesh);
+  if (it == _proxies.end() || it->second.isDirty) {
+    return;
+  }
+
+  it->second.isDirty = true;
+  _dirtyMeshes.emplace_back(mesh);
+}
+
+const DynamicBVH<AbstractMesh*>& BVHActiveMeshCandidateProvider::bvh() const
+{
+  return _bvh;
+}
+
+void BVHActiveMeshCandidateProvider::_refit(AbstractMesh* mesh, Proxy& proxy)
+{
+  proxy.isDirty = false;
+  _setAlwaysSelected(mesh, proxy, mesh->alwaysSelectAsActiveMesh);
+
+  const auto& boundingBox = mesh->getBoundingInfo()->boundingBox;
+  _bvh.moveProxy(proxy.proxyId, boundingBox.minimumWorld, boundingBox.maximumWorld);
+}
+
+void BVHActiveMeshCandidateProvider::_setAlwaysSelected(AbstractMesh* mesh, Proxy& proxy,
+                                                        bool alwaysSelected)
+{
+  if (alwaysSelected == (proxy.alwaysSelectedIndex >= 0)) {
+    return;
+  }
+
+  if (alwaysSelected) {
+    proxy.alwaysSelectedIndex = static_cast<int>(_alwaysSelectedMeshes.size());
+    _alwaysSelectedMeshes.emplace_back(mesh);
+    return;
+  }
+
+  // Keep the flagging order, the following meshes are shifted
+  const auto index = static_cast<size_t>(proxy.alwaysSelectedIndex);
+  _alwaysSelectedMeshes.erase(_alwaysSelectedMeshes.begin() + static_cast<std::ptrdiff_t>(index));
+  for (auto i = index; i < _alwaysSelectedMeshes.size(); ++i) {
+    --_proxies[_alwaysSelectedMeshes[i]].alwaysSelectedIndex;
+  }
+  proxy.alwaysSelectedIndex = -1;
+}
+
+std::vector<AbstractMesh*> BVHActiveMeshCandidateProvider::getMeshes(Scene* scene)
+{
+  // Without the transform system, the world matrices are synchronized here, the moved meshes are
+  // reported through updateMesh()
+  if (!scene->getTransformSystem()) {
+    for (const auto& item : _proxies) {
+      if (item.first->isEnabled()) {
+        item.first->computeWorldMatrix();
+      }
+    }
+  }
+
+  for (auto mesh : _dirtyMeshes) {
+    auto it = _proxies.find(mesh);
+    if (it != _proxies.end() && it->second.isDirty) {
+      _refit(mesh, it->second);
+    }
+  }
+  _dirtyMeshes.clear();
+
+  std::vector<AbstractMesh*> selection;
+  selection.reserve(_bvh.size());
+  _bvh.select(scene->frustumPlanes(), selection);
+
+  if (!_alwaysSelectedMeshes.empty()) {
+    selection.erase(std::remove_if(selection.begin(), selection.end(),
+                                   [this](AbstractMesh* mesh) {
+                                     return _proxies[mesh].alwaysSelectedIndex >= 0;
+                                   }),
+                    selection.end());
+    selection.insert(selection.end(), _alwaysSelectedMeshes.begin(), _alwaysSelectedMeshes.end());
+  }
+
+  return selection;
+}
+
+} // end of namespace BABYLON
@@ -0,0 +1,529 @@
+#include <babylon/culling/bvh/dynamic_bvh.h>
+
+#include <algorithm>
+#include <cmath>
+
+#include <babylon/maths/plane.h>
+
+namespace BABYLON {
+
+namespace {
+
+// Half of the surface area of a box, used as the cost metric of the tree
+float HalfSurfaceArea(const Vector3& minimum, const Vector3& maximum)
+{
+  const auto dx = maximum.x - minimum.x;
+  const auto dy = maximum.y - minimum.y;
+  const auto dz = maximum.z - minimum.z;
+  return dx * dy + dy * dz + dz * dx;
+}
+
+float CombinedHalfSurfaceArea(const Vector3& minimumA, const Vector3& maximumA,
+                              const Vector3& minimumB, const Vector3& maximumB)
+{
+  return HalfSurfaceArea(Vector3(std::min(minimumA.x, minimumB.x), std::min(minimumA.y, minimumB.y),
+                                 std::min(minimumA.z, minimumB.z)),
+                         Vector3(std::max(maximumA.x, maximumB.x), std::max(maximumA.y, maximumB.y),
+                                 std::max(maximumA.z, maximumB.z)));
+}
+
+bool Contains(const Vector3& outerMinimum, const Vector3& outerMaximum, const Vector3& minimum,
+              const Vector3& maximum)
+{
+  return outerMinimum.x <= minimum.x && outerMinimum.y <= minimum.y && outerMinimum.z <= minimum.z
+         && maximum.x <= outerMaximum.x && maximum.y <= outerMaximum.y
+         && maximum.z <= outerMaximum.z;
+}
+
+bool Overlaps(const Vector3& minimumA, const Vector3& maximumA, const Vector3& minimumB,
+              const Vector3& maximumB)
+{
+  return minimumA.x <= maximumB.x && minimumB.x <= maximumA.x && minimumA.y <= maximumB.y
+         && minimumB.y <= maximumA.y && minimumA.z <= maximumB.z && minimumB.z <= maximumA.z;
+}
+
+// Frustum test of a box: 0 = outside, 1 = intersecting, 2 = fully inside
+int ClassifyBox(const std::array<Plane, 6>& frustumPlanes, const Vector3& minimum,
+                const Vector3& maximum)
+{
+  const auto cx = (minimum.x + maximum.x) * 0.5f, ex = (maximum.x - minimum.x) * 0.5f;
+  const auto cy = (minimum.y + maximum.y) * 0.5f, ey = (maximum.y - minimum.y) * 0.5f;
+  const auto cz = (minimum.z + maximum.z) * 0.5f, ez = (maximum.z - minimum.z) * 0.5f;
+
+  auto result = 2;
+  for (const auto& plane : frustumPlanes) {
+    const auto& n       = plane.normal;
+    const auto distance = n.x * cx + n.y * cy + n.z * cz + plane.d;
+    const auto radius   = std::abs(n.x) * ex + std::abs(n.y) * ey + std::abs(n.z) * ez;
+    if (distance + radius < 0.f) {
+      return 0;
+    }
+    if (distance - radius < 0.f) {
+      result = 1;
+    }
+  }
+  return result;
+}
+
+} // end of anonymous namespace
+
+template <class T>
+DynamicBVH<T>::DynamicBVH(float margin)
+    : _margin{margin}, _root{NullNode}, _freeList{NullNode}, _proxyCount{0}
+{
+}
+
+template <class T>
+DynamicBVH<T>::~DynamicBVH() = default;
+
+template <class T>
+int DynamicBVH<T>::_allocateNode()
+{
+  int nodeId = _freeList;
+  if (nodeId == NullNode) {
+    nodeId = static_cast<int>(_nodes.size());
+    _nodes.emplace_back();
+  }
+  else {
+    _freeList = _nodes[static_cast<size_t>(nodeId)].parent;
+  }
+
+  auto& node  = _nodes[static_cast<size_t>(nodeId)];
+  node.parent = NullNode;
+  node.child1 = NullNode;
+  node.child2 = NullNode;
+  node.height = 0;
+  return nodeId;
+}
+
+template <class T>
+void DynamicBVH<T>::_freeNode(int nodeId)
+{
+  auto& node    = _nodes[static_cast<size_t>(nodeId)];
+  node.parent   = _freeList;
+  node.height   = -1;
+  node.userData = T{};
+  _freeList     = nodeId;
+}
+
+template <class T>
+int DynamicBVH<T>::createProxy(const Vector3& minimum, const Vector3& maximum, const T& userData)
+{
+  const auto proxyId = _allocateNode();
+  auto& node         = _nodes[static_cast<size_t>(proxyId)];
+  node.minimum.set(minimum.x - _margin, minimum.y - _margin, minimum.z - _margin);
+  node.maximum.set(maximum.x + _margin, maximum.y + _margin, maximum.z + _margin);
+  node.userData = userData;
+
+  _insertLeaf(proxyId);
+  ++_proxyCount;
+
+  return proxyId;
+}
+
+template <class T>
+void DynamicBVH<T>::destroyProxy(int proxyId)
+{
+  if (proxyId < 0 || static_cast<size_t>(proxyId) >= _nodes.size()
+      || !_nodes[static_cast<size_t>(proxyId)].isLeaf()
+      || _nodes[static_cast<size_t>(proxyId)].height != 0) {
+    return;
+  }
+
+  _removeLeaf(proxyId);
+  _freeNode(proxyId);
+  --_proxyCount;
+}
+
+template <class T>
+bool DynamicBVH<T>::moveProxy(int proxyId, const Vector3& minimum, const Vector3& maximum)
+{
+  auto& node = _nodes[static_cast<size_t>(proxyId)];
+
+  // Still inside of the fat box and not too small for it, nothing to do
+  const auto largeMargin = 4.f * _margin;
+  if (Contains(node.minimum, node.maximum, minimum, maximum)
+      && Contains(Vector3(minimum.x - largeMargin, minimum.y - largeMargin, minimum.z - largeMargin),
+                  Vector3(maximum.x + largeMargin, maximum.y + largeMargin, maximum.z + largeMargin),
+                  node.minimum, node.maximum)) {
+    return false;
+  }
+
+  _removeLeaf(proxyId);
+  node.minimum.set(minimum.x - _margin, minimum.y - _margin, minimum.z - _margin);
+  node.maximum.set(maximum.x + _margin, maximum.y + _margin, maximum.z + _margin);
+  _insertLeaf(proxyId);
+
+  return true;
+}
+
+template <class T>
+const T& DynamicBVH<T>::getUserData(int proxyId) const
+{
+  return _nodes[static_cast<size_t>(proxyId)].userData;
+}
+
+template <class T>
+void DynamicBVH<T>::_refitNode(int nodeId)
+{
+  auto& node        = _nodes[static_cast<size_t>(nodeId)];
+  const auto& nodeB = _nodes[static_cast<size_t>(node.child1)];
+  const auto& nodeC = _nodes[static_cast<size_t>(node.child2)];
+  node.minimum.set(std::min(nodeB.minimum.x, nodeC.minimum.x),
+                   std::min(nodeB.minimum.y, nodeC.minimum.y),
+                   std::min(nodeB.minimum.z, nodeC.minimum.z));
+  node.maximum.set(std::max(nodeB.maximum.x, nodeC.maximum.x),
+                   std::max(nodeB.maximum.y, nodeC.maximum.y),
+                   std::max(nodeB.maximum.z, nodeC.maximum.z));
+  node.height = 1 + std::max(nodeB.height, nodeC.height);
+}
+
+template <class T>
+void DynamicBVH<T>::_insertLeaf(int leaf)
+{
+  if (_root == NullNode) {
+    _root                                      = leaf;
+    _nodes[static_cast<size_t>(_root)].parent = NullNode;
+    return;
+  }
+
+  // Find the best sibling for the leaf (surface area heuristic)
+  const auto leafMinimum = _nodes[static_cast<size_t>(leaf)].minimum;
+  const auto leafMaximum = _nodes[static_cast<size_t>(leaf)].maximum;
+  auto index             = _root;
+  while (!_nodes[static_cast<size_t>(index)].isLeaf()) {
+    const auto& node = _nodes[static_cast<size_t>(index)];
+    const auto area  = HalfSurfaceArea(node.minimum, node.maximum);
+    const auto combinedArea
+      = CombinedHalfSurfaceArea(node.minimum, node.maximum, leafMinimum, leafMaximum);
+
+    // Cost of creating a new parent for this node and the new leaf
+    const auto cost = 2.f * combinedArea;
+    // Minimum cost of pushing the leaf further down the tree
+    const auto inheritanceCost = 2.f * (combinedArea - area);
+
+    const auto childCost = [&](int childId) {
+      const auto& child = _nodes[static_cast<size_t>(childId)];
+      const auto childCombinedArea
+        = CombinedHalfSurfaceArea(child.minimum, child.maximum, leafMinimum, leafMaximum);
+      return child.isLeaf() ?
+               childCombinedArea + inheritanceCost :
+               childCombinedArea - HalfSurfaceArea(child.minimum, child.maximum) + inheritanceCost;
+    };
+    const auto cost1 = childCost(node.child1);
+    const auto cost2 = childCost(node.child2);
+
+    if (cost < cost1 && cost < cost2) {
+      break;
+    }
+
+    index = cost1 < cost2 ? node.child1 : node.child2;
+  }
+
+  // Create a new parent for the sibling and the leaf
+  const auto sibling   = index;
+  const auto oldParent = _nodes[static_cast<size_t>(sibling)].parent;
+  const auto newParent = _allocateNode();
+  {
+    auto& node    = _nodes[static_cast<size_t>(newParent)];
+    node.parent   = oldParent;
+    node.userData = T{};
+    node.child1   = sibling;
+    node.child2   = leaf;
+  }
+  _refitNode(newParent);
+  _nodes[static_cast<size_t>(sibling)].parent = newParent;
+  _nodes[static_cast<size_t>(leaf)].parent    = newParent;
+
+  if (oldParent != NullNode) {
+    auto& parent = _nodes[static_cast<size_t>(oldParent)];
+    if (parent.child1 == sibling) {
+      parent.child1 = newParent;
+    }
+    else {
+      parent.child2 = newParent;
+    }
+  }
+  else {
+    _root = newParent;
+  }
+
+  // Walk back up the tree fixing heights and boxes
+  index = _nodes[static_cast<size_t>(leaf)].parent;
+  while (index != NullNode) {
+    index = _balance(index);
+    _refitNode(index);
+    index = _nodes[static_cast<size_t>(index)].parent;
+  }
+}
+
+template <class T>
+void DynamicBVH<T>::_removeLeaf(int leaf)
+{
+  if (leaf == _root) {
+    _root = NullNode;
+    return;
+  }
+
+  const auto parent      = _nodes[static_cast<size_t>(leaf)].parent;
+  const auto grandParent = _nodes[static_cast<size_t>(parent)].parent;
+  const auto sibling     = _nodes[static_cast<size_t>(parent)].child1 == leaf ?
+                             _nodes[static_cast<size_t>(parent)].child2 :
+                             _nodes[static_cast<size_t>(parent)].child1;
+
+  if (grandParent != NullNode) {
+    // Destroy the parent and connect the sibling to the grand parent
+    auto& grandParentNode = _nodes[static_cast<size_t>(grandParent)];
+    if (grandParentNode.child1 == parent) {
+      grandParentNode.child1 = sibling;
+    }
+    else {
+      grandParentNode.child2 = sibling;
+    }
+    _nodes[static_cast<size_t>(sibling)].parent = grandParent;
+    _freeNode(parent);
+
+    // Adjust the ancestors
+    auto index = grandParent;
+    while (index != NullNode) {
+      index = _balance(index);
+      _refitNode(index);
+      index = _nodes[static_cast<size_t>(index)].parent;
+    }
+  }
+  else {
+    _root                                        = sibling;
+    _nodes[static_cast<size_t>(sibling)].parent = NullNode;
+    _freeNode(parent);
+  }
+}
+
+template <class T>
+int DynamicBVH<T>::_balance(int iA)
+{
+  auto& A = _nodes[static_cast<size_t>(iA)];
+  if (A.isLeaf() || A.height < 2) {
+    return iA;
+  }
+
+  const auto iB = A.child1;
+  const auto iC = A.child2;
+  const auto balance
+    = _nodes[static_cast<size_t>(iC)].height - _nodes[static_cast<size_t>(iB)].height;
+
+  // Rotates the child X of A up, Y being the other child of A
+  const auto rotate = [this, iA](int iX, bool xIsChild2) {
+    auto& nodeA = _nodes[static_cast<size_t>(iA)];
+    auto& nodeX = _nodes[static_cast<size_t>(iX)];
+    const auto iF = nodeX.child1;
+    const auto iG = nodeX.child2;
+    auto& nodeF   = _nodes[static_cast<size_t>(iF)];
+    auto& nodeG   = _nodes[static_cast<size_t>(iG)];
+
+    // Swap A and X
+    nodeX.child1 = iA;
+    nodeX.parent = nodeA.parent;
+    nodeA.parent = iX;
+
+    // A's old parent should point to X
+    if (nodeX.parent != NullNode) {
+      auto& parent = _nodes[static_cast<size_t>(nodeX.parent)];
+      if (parent.child1 == iA) {
+        parent.child1 = iX;
+      }
+      else {
+        parent.child2 = iX;
+      }
+    }
+    else {
+      _root = iX;
+    }
+
+    // Keep the highest grand child under X, move the other one under A
+    const auto keepF   = nodeF.height > nodeG.height;
+    const auto iKept   = keepF ? iF : iG;
+    const auto iMoved  = keepF ? iG : iF;
+    nodeX.child2       = iKept;
+    if (xIsChild2) {
+      nodeA.child2 = iMoved;
+    }
+    else {
+      nodeA.child1 = iMoved;
+    }
+    _nodes[static_cast<size_t>(iMoved)].parent = iA;
+
+    _refitNode(iA);
+    _refitNode(iX);
+    return iX;
+  };
+
+  // Rotate C up
+  if (balance > 1) {
+    return rotate(iC, true);
+  }
+
+  // Rotate B up
+  if (balance < -1) {
+    return rotate(iB, false);
+  }
+
+  return iA;
+}
+
+template <class T>
+void DynamicBVH<T>::_collectLeaves(int nodeId, std::vector<T>& selection,
+                                   std::vector<int>& stack) const
+{
+  const auto stackBase = stack.size();
+  stack.emplace_back(nodeId);
+  while (stack.size() > stackBase) {
+    const auto& node = _nodes[static_cast<size_t>(stack.back())];
+    stack.pop_back();
+    if (node.isLeaf()) {
+      selection.emplace_back(node.userData);
+    }
+    else {
+      stack.emplace_back(node.child1);
+      stack.emplace_back(node.child2);
+    }
+  }
+}
+
+template <class T>
+void DynamicBVH<T>::select(const std::array<Plane, 6>& frustumPlanes,
+                           std::vector<T>& selection) const
+{
+  if (_root == NullNode) {
+    return;
+  }
+
+  std::vector<int> stack;
+  stack.reserve(64);
+  stack.emplace_back(_root);
+  while (!stack.empty()) {
+    const auto nodeId = stack.back();
+    stack.pop_back();
+    const auto& node = _nodes[static_cast<size_t>(nodeId)];
+
+    const auto classification = ClassifyBox(frustumPlanes, node.minimum, node.maximum);
+    if (classification == 0) {
+      continue;
+    }
+    if (node.isLeaf()) {
+      selection.emplace_back(node.userData);
+    }
+    else if (classification == 2) {
+      // Fully inside, no need to test the sub tree
+      _collectLeaves(nodeId, selection, stack);
+    }
+    else {
+      stack.emplace_back(node.child1);
+      stack.emplace_back(node.child2);
+    }
+  }
+}
+
+template <class T>
+void DynamicBVH<T>::intersectsMinMax(const Vector3& minimum, const Vector3& maximum,
+                                     std::vector<T>& selection) const
+{
+  if (_root == NullNode) {
+    return;
+  }
+
+  std::vector<int> stack;
+  stack.reserve(64);
+  stack.emplace_back(_root);
+  while (!stack.empty()) {
+    const auto& node = _nodes[static_cast<size_t>(stack.back())];
+    stack.pop_back();
+    if (!Overlaps(node.minimum, node.maximum, minimum, maximum)) {
+      continue;
+    }
+    if (node.isLeaf()) {
+      selection.emplace_back(node.userData);
+    }
+    else {
+      stack.emplace_back(node.child1);
+      stack.emplace_back(node.child2);
+    }
+  }
+}
+
+template <class T>
+void DynamicBVH<T>::intersectsSphere(const Vector3& center, float radius,
+                                     std::vector<T>& selection) const
+{
+  if (_root == NullNode) {
+    return;
+  }
+
+  const auto radiusSquared = radius * radius;
+  std::vector<int> stack;
+  stack.reserve(64);
+  stack.emplace_back(_root);
+  while (!stack.empty()) {
+    const auto& node = _nodes[static_cast<size_t>(stack.back())];
+    stack.pop_back();
+    // Squared distance from the sphere center to the box
+    const auto dx = std::max({node.minimum.x - center.x, 0.f, center.x - node.maximum.x});
+    const auto dy = std::max({node.minimum.y - center.y, 0.f, center.y - node.maximum.y});
+    const auto dz = std::max({node.minimum.z - center.z, 0.f, center.z - node.maximum.z});
+    if (dx * dx + dy * dy + dz * dz > radiusSquared) {
+      continue;
+    }
+    if (node.isLeaf()) {
+      selection.emplace_back(node.userData);
+    }
+    else {
+      stack.emplace_back(node.child1);
+      stack.emplace_back(node.child2);
+    }
+  }
+}
+
+template <class T>
+size_t DynamicBVH<T>::size() const
+{
+  return _proxyCount;
+}
+
+template <class T>
+int DynamicBVH<T>::height() const
+{
+  return _root == NullNode ? -1 : _nodes[static_cast<size_t>(_root)].height;
+}
+
+template <class T>
+bool DynamicBVH<T>::_validateNode(int nodeId) const
+{
+  const auto& node = _nodes[static_cast<size_t>(nodeId)];
+  if (node.isLeaf()) {
+    return node.height == 0 && node.child2 == NullNode;
+  }
+
+  const auto& child1 = _nodes[static_cast<size_t>(node.child1)];
+  const auto& child2 = _nodes[static_cast<size_t>(node.child2)];
+  return child1.parent == nodeId && child2.parent == nodeId
+         && node.height == 1 + std::max(child1.height, child2.height)
+         && Contains(node.minimum, node.maximum, child1.minimum, child1.maximum)
+         && Contains(node.minimum, node.maximum, child2.minimum, child2.maximum)
+         && _validateNode(node.child1) && _validateNode(node.child2);
+}
+
+template <class T>
+bool DynamicBVH<T>::_validate() const
+{
+  if (_root == NullNode) {
+    return _proxyCount == 0;
+  }
+  return _nodes[static_cast<size_t>(_root)].parent == NullNode && _validateNode(_root);
+}
+
+class AbstractMesh;
+class Light;
+
+template class DynamicBVH<AbstractMesh*>;
+template class DynamicBVH<Light*>;
+
+} // end of namespace BABYLON
@@ -1,6 +1,7 @@
 #include <babylon/culling/octrees/octree.h>
 
-#include <babylon/babylon_stl_util.h>
+#include <algorithm>
+
 #include <babylon/culling/bounding_box.h>
 #include <babylon/culling/bounding_info.h>
 #include <babylon/culling/octrees/octree_block.h>
@@ -11,14 +12,19 @@
 namespace BABYLON {
 
 template <class T>
-Octree<T>::Octree() = default;
+Octree<T>::Octree() : maxDepth{2}, looseBounds{false}, _maxBlockCapacity{64}
+{
+}
 
 template <class T>
 Octree<T>::Octree(const std::function<void(T& entry, OctreeBlock<T>& block)>& creationFunc,
                   size_t maxBlockCapacity, size_t iMaxDepth)
-    : maxDepth{iMaxDepth}, _maxBlockCapacity{maxBlockCapacity}, _creationFunc{creationFunc}
+    : maxDepth{iMaxDepth}
+    , looseBounds{false}
+    , _maxBlockCapacity{maxBlockCapacity}
+    , _creationFunc{creationFunc}
 {
-  _selectionContent.resize(1024);
+  _selectionContent.reserve(1024);
 }
 
 template <class T>
@@ -27,23 +33,82 @@ Octree<T>::~Octree() = default;
 template <class T>
 void Octree<T>::update(const Vector3& worldMin, const Vector3& worldMax, std::vector<T>& entries)
 {
-  OctreeBlock<T>::_CreateBlocks(worldMin, worldMax, entries, _maxBlockCapacity, 0, maxDepth, *this,
-                                _creationFunc);
+  _looseEntryBlocks.clear();
+
+  if (!looseBounds) {
+    OctreeBlock<T>::_CreateBlocks(worldMin, worldMax, entries, _maxBlockCapacity, 0, maxDepth,
+                                  *this, _creationFunc);
+    return;
+  }
+
+  std::vector<T> noEntries;
+  OctreeBlock<T>::_CreateBlocks(worldMin, worldMax, noEntries, _maxBlockCapacity, 0, maxDepth,
+                                *this, _creationFunc, true);
+  for (auto& entry : entries) {
+    addMesh(entry);
+  }
 }
 
 template <class T>
 void Octree<T>::addMesh(T& entry)
 {
+  if (!looseBounds) {
+    for (auto& block : IOctreeContainer<T>::blocks) {
+      block->addEntry(entry);
+    }
+    return;
+  }
+
+  if (_looseEntryBlocks.find(entry) != _looseEntryBlocks.end()) {
+    return;
+  }
+
   for (auto& block : IOctreeContainer<T>::blocks) {
-    block.addEntry(entry);
+    if (block->_addLooseEntry(entry, _looseEntryBlocks)) {
+      return;
+    }
   }
+
+  // Outside of the world bounds
+  dynamicContent.emplace_back(entry);
+  _looseEntryBlocks[entry] = nullptr;
 }
 
 template <class T>
 void Octree<T>::removeMesh(T& entry)
 {
-  for (auto& block : IOctreeContainer<T>::blocks) {
-    block.removeEntry(entry);
+  if (!looseBounds) {
+    for (auto& block : IOctreeContainer<T>::blocks) {
+      block->removeEntry(entry);
+    }
+    return;
+  }
+
+  auto it = _looseEntryBlocks.find(entry);
+  if (it == _looseEntryBlocks.end()) {
+    return;
+  }
+
+  auto& blockEntries = it->second ? it->second->entries : dynamicContent;
+  blockEntries.erase(std::remove(blockEntries.begin(), blockEntries.end(), entry),
+                     blockEntries.end());
+  _looseEntryBlocks.erase(it);
+}
+
+template <class T>
+void Octree<T>::updateMesh(T& entry)
+{
+  removeMesh(entry);
+  addMesh(entry);
+}
+
+template <class T>
+void Octree<T>::_addDynamicContent(size_t generation)
+{
+  for (const auto& entry : dynamicContent) {
+    if (OctreeBlock<T>::_MarkAsSelected(entry, generation)) {
+      _selectionContent.emplace_back(entry);
+    }
   }
 }
 
@@ -52,16 +117,12 @@ std::vector<T>& Octree<T>::select(const std::array<Plane, 6>& frustumPlanes, boo
 {
   _selectionContent.clear();
 
+  const auto generation = allowDuplicate ? 0 : OctreeBlock<T>::_NewSelectionGeneration();
   for (auto& block : IOctreeContainer<T>::blocks) {
-    block.select(frustumPlanes, _selectionContent, allowDuplicate);
+    block->_select(frustumPlanes, _selectionContent, generation);
   }
 
-  if (allowDuplicate) {
-    stl_util::concat(_selectionContent, dynamicContent);
-  }
-  else {
-    stl_util::concat_with_no_duplicates(_selectionContent, dynamicContent);
-  }
+  _addDynamicContent(generation);
 
   return _selectionContent;
 }
@@ -72,16 +133,12 @@ std::vector<T>& Octree<T>::intersects(const Vector3& sphereCenter, float sphereR
 {
   _selectionContent.clear();
 
+  const auto generation = allowDuplicate ? 0 : OctreeBlock<T>::_NewSelectionGeneration();
   for (auto& block : IOctreeContainer<T>::blocks) {
-    block.intersects(sphereCenter, sphereRadius, _selectionContent, allowDuplicate);
+    block->_intersects(sphereCenter, sphereRadius, _selectionContent, generation);
   }
 
-  if (allowDuplicate) {
-    stl_util::concat(_selectionContent, dynamicContent);
-  }
-  else {
-    stl_util::concat_with_no_duplicates(_selectionContent, dynamicContent);
-  }
+  _addDynamicContent(generation);
 
   return _selectionContent;
 }
@@ -91,11 +148,12 @@ std::vector<T>& Octree<T>::intersectsRay(const Ray& ray)
 {
   _selectionContent.clear();
 
+  const auto generation = OctreeBlock<T>::_NewSelectionGeneration();
   for (auto& block : IOctreeContainer<T>::blocks) {
-    block.intersectsRay(ray, _selectionContent);
+    block->_intersectsRay(ray, _selectionContent, generation);
   }
 
-  stl_util::concat_with_no_duplicates(_selectionContent, dynamicContent);
+  _addDynamicContent(generation);
 
   return _selectionContent;
 }
@@ -1,6 +1,8 @@
 #include <babylon/culling/octrees/octree_block.h>
 
-#include <babylon/babylon_stl_util.h>
+#include <algorithm>
+#include <atomic>
+
 #include <babylon/culling/bounding_box.h>
 #include <babylon/culling/bounding_info.h>
 #include <babylon/culling/ray.h>
@@ -9,39 +11,66 @@
 
 namespace BABYLON {
 
+namespace {
+
+// Generation 0 is reserved for the selections allowing duplicates
+std::atomic<size_t> octreeSelectionGeneration{0};
+
+bool ContainsMinMax(const Vector3& outerMin, const Vector3& outerMax, const Vector3& minPoint,
+                    const Vector3& maxPoint)
+{
+  return outerMin.x <= minPoint.x && outerMin.y <= minPoint.y && outerMin.z <= minPoint.z
+         && maxPoint.x <= outerMax.x && maxPoint.y <= outerMax.y && maxPoint.z <= outerMax.z;
+}
+
+} // end of anonymous namespace
+
 template <class T>
 OctreeBlock<T>::OctreeBlock(const Vector3& iMinPoint, const Vector3& iMaxPoint, size_t iCapacity,
                             size_t depth, size_t maxDepth,
-                            const std::function<void(T&, OctreeBlock<T>&)>& creationFunc)
+                            const std::function<void(T&, OctreeBlock<T>&)>& creationFunc,
+                            bool loose)
 {
   _capacity     = iCapacity;
   _depth        = depth;
   _maxDepth     = maxDepth;
   _creationFunc = creationFunc;
+  _loose        = loose;
 
   _minPoint = iMinPoint;
   _maxPoint = iMaxPoint;
 
-  _boundingVectors[0] = _minPoint;
-  _boundingVectors[1] = _maxPoint;
+  // Loose blocks are tested with bounds twice the size of the block
+  if (_loose) {
+    const auto halfSize = _maxPoint.subtract(_minPoint).scale(0.5f);
+    _looseMinPoint      = _minPoint.subtract(halfSize);
+    _looseMaxPoint      = _maxPoint.add(halfSize);
+  }
+  else {
+    _looseMinPoint = _minPoint;
+    _looseMaxPoint = _maxPoint;
+  }
+
+  _boundingVectors[0] = _looseMinPoint;
+  _boundingVectors[1] = _looseMaxPoint;
 
-  _boundingVectors[2]   = _minPoint;
-  _boundingVectors[2].x = _maxPoint.x;
+  _boundingVectors[2]   = _looseMinPoint;
+  _boundingVectors[2].x = _looseMaxPoint.x;
 
-  _boundingVectors[3]   = _minPoint;
-  _boundingVectors[3].y = _maxPoint.y;
+  _boundingVectors[3]   = _looseMinPoint;
+  _boundingVectors[3].y = _looseMaxPoint.y;
 
-  _boundingVectors[4]   = _minPoint;
-  _boundingVectors[4].z = _maxPoint.z;
+  _boundingVectors[4]   = _looseMinPoint;
+  _boundingVectors[4].z = _looseMaxPoint.z;
 
-  _boundingVectors[5]   = _maxPoint;
-  _boundingVectors[5].z = _minPoint.z;
+  _boundingVectors[5]   = _looseMaxPoint;
+  _boundingVectors[5].z = _looseMinPoint.z;
 
-  _boundingVectors[6]   = _maxPoint;
-  _boundingVectors[6].x = _minPoint.x;
+  _boundingVectors[6]   = _looseMaxPoint;
+  _boundingVectors[6].x = _looseMinPoint.x;
 
-  _boundingVectors[7]   = _maxPoint;
-  _boundingVectors[7].y = _minPoint.y;
+  _boundingVectors[7]   = _looseMaxPoint;
+  _boundingVectors[7].y = _looseMinPoint.y;
 }
 
 template <class T>
@@ -65,12 +94,24 @@ Vector3& OctreeBlock<T>::maxPoint()
   return _maxPoint;
 }
 
+template <class T>
+const Vector3& OctreeBlock<T>::looseMinPoint() const
+{
+  return _looseMinPoint;
+}
+
+template <class T>
+const Vector3& OctreeBlock<T>::looseMaxPoint() const
+{
+  return _looseMaxPoint;
+}
+
 template <class T>
 void OctreeBlock<T>::addEntry(T& entry)
 {
   if (!IOctreeContainer<T>::blocks.empty()) {
     for (auto& block : IOctreeContainer<T>::blocks) {
-      block.addEntry(entry);
+      block->addEntry(entry);
     }
     return;
   }
@@ -85,13 +126,11 @@ void OctreeBlock<T>::addEntry(T& entry)
 template <class T>
 void OctreeBlock<T>::removeEntry(T& entry)
 {
-  if (!IOctreeContainer<T>::blocks.empty()) {
-    for (auto& block : IOctreeContainer<T>::blocks) {
-      block.removeEntry(entry);
-    }
-    return;
+  for (auto& block : IOctreeContainer<T>::blocks) {
+    block->removeEntry(entry);
   }
 
+  // Loose blocks can hold entries at any level
   const auto entryIndex = std::find(entries.begin(), entries.end(), entry);
 
   if (entryIndex != entries.end()) {
@@ -108,66 +147,181 @@ void OctreeBlock<T>::addEntries(std::vector<T>& _entries)
 }
 
 template <class T>
-void OctreeBlock<T>::select(const std::array<Plane, 6>& frustumPlanes, std::vector<T>& selection,
-                            bool allowDuplicate)
+size_t OctreeBlock<T>::_NewSelectionGeneration()
 {
-  if (BoundingBox::IsInFrustum(_boundingVectors, frustumPlanes)) {
-    if (!IOctreeContainer<T>::blocks.empty()) {
-      for (auto& block : IOctreeContainer<T>::blocks) {
-        block.select(frustumPlanes, selection, allowDuplicate);
-      }
-      return;
-    }
+  auto generation = ++octreeSelectionGeneration;
+  if (generation == 0) {
+    generation = ++octreeSelectionGeneration;
+  }
+  return generation;
+}
 
-    if (allowDuplicate) {
-      stl_util::concat(selection, entries);
-    }
-    else {
-      stl_util::concat_with_no_duplicates(selection, entries);
+template <class T>
+bool OctreeBlock<T>::_MarkAsSelected(const T& entry, size_t generation)
+{
+  if (generation == 0) {
+    return true;
+  }
+  if (entry->_octreeSelectionGeneration == generation) {
+    return false;
+  }
+  entry->_octreeSelectionGeneration = generation;
+  return true;
+}
+
+template <class T>
+template <typename Predicate>
+void OctreeBlock<T>::_collect(const Predicate& intersects, std::vector<T>& selection,
+                              size_t generation)
+{
+  if (!intersects(*this)) {
+    return;
+  }
+
+  for (const auto& entry : entries) {
+    if (_MarkAsSelected(entry, generation)) {
+      selection.emplace_back(entry);
     }
   }
+
+  for (auto& block : IOctreeContainer<T>::blocks) {
+    block->_collect(intersects, selection, generation);
+  }
+}
+
+template <class T>
+void OctreeBlock<T>::select(const std::array<Plane, 6>& frustumPlanes, std::vector<T>& selection,
+                            bool allowDuplicate)
+{
+  _select(frustumPlanes, selection, allowDuplicate ? 0 : _NewSelectionGeneration());
+}
+
+template <class T>
+void OctreeBlock<T>::_select(const std::array<Plane, 6>& frustumPlanes, std::vector<T>& selection,
+                             size_t generation)
+{
+  _collect(
+    [&frustumPlanes](const OctreeBlock<T>& block) {
+      return BoundingBox::IsInFrustum(block._boundingVectors, frustumPlanes);
+    },
+    selection, generation);
 }
 
 template <class T>
 void OctreeBlock<T>::intersects(const Vector3& sphereCenter, float sphereRadius,
                                 std::vector<T>& selection, bool allowDuplicate)
 {
-  if (BoundingBox::IntersectsSphere(_minPoint, _maxPoint, sphereCenter, sphereRadius)) {
-    if (!IOctreeContainer<T>::blocks.empty()) {
-      for (auto& block : IOctreeContainer<T>::blocks) {
-        block.intersects(sphereCenter, sphereRadius, selection, allowDuplicate);
-      }
-      return;
-    }
+  _intersects(sphereCenter, sphereRadius, selection,
+              allowDuplicate ? 0 : _NewSelectionGeneration());
+}
 
-    if (allowDuplicate) {
-      stl_util::concat(selection, entries);
-    }
-    else {
-      stl_util::concat_with_no_duplicates(selection, entries);
-    }
-  }
+template <class T>
+void OctreeBlock<T>::_intersects(const Vector3& sphereCenter, float sphereRadius,
+                                 std::vector<T>& selection, size_t generation)
+{
+  _collect(
+    [&sphereCenter, sphereRadius](const OctreeBlock<T>& block) {
+      return BoundingBox::IntersectsSphere(block._looseMinPoint, block._looseMaxPoint,
+                                           sphereCenter, sphereRadius);
+    },
+    selection, generation);
 }
 
 template <class T>
 void OctreeBlock<T>::intersectsRay(const Ray& ray, std::vector<T>& selection)
 {
-  if (ray.intersectsBoxMinMax(_minPoint, _maxPoint)) {
-    if (!IOctreeContainer<T>::blocks.empty()) {
-      for (auto& block : IOctreeContainer<T>::blocks) {
-        block.intersectsRay(ray, selection);
-      }
-      return;
-    }
-    stl_util::concat_with_no_duplicates(selection, entries);
-  }
+  _intersectsRay(ray, selection, _NewSelectionGeneration());
+}
+
+template <class T>
+void OctreeBlock<T>::_intersectsRay(const Ray& ray, std::vector<T>& selection, size_t generation)
+{
+  _collect(
+    [&ray](const OctreeBlock<T>& block) {
+      return ray.intersectsBoxMinMax(block._looseMinPoint, block._looseMaxPoint);
+    },
+    selection, generation);
 }
 
 template <class T>
 void OctreeBlock<T>::createInnerBlocks()
 {
   OctreeBlock<T>::_CreateBlocks(_minPoint, _maxPoint, entries, _capacity, _depth, _maxDepth, *this,
-                                _creationFunc);
+                                _creationFunc, _loose);
+  entries.clear();
+}
+
+template <class T>
+OctreeBlock<T>* OctreeBlock<T>::_getChildBlock(const Vector3& point)
+{
+  if (IOctreeContainer<T>::blocks.size() != 8) {
+    return nullptr;
+  }
+
+  // Same ordering as _CreateBlocks
+  const auto center = _minPoint.add(_maxPoint).scale(0.5f);
+  const auto index  = (point.x >= center.x ? 4 : 0) + (point.y >= center.y ? 2 : 0)
+                     + (point.z >= center.z ? 1 : 0);
+  return IOctreeContainer<T>::blocks[static_cast<size_t>(index)].get();
+}
+
+template <class T>
+bool OctreeBlock<T>::_addLooseEntry(T& entry, std::unordered_map<T, OctreeBlock<T>*>& entryBlocks)
+{
+  const auto& boundingBox = entry->getBoundingInfo()->boundingBox;
+  if (!ContainsMinMax(_minPoint, _maxPoint, boundingBox.centerWorld, boundingBox.centerWorld)
+      || !ContainsMinMax(_looseMinPoint, _looseMaxPoint, boundingBox.minimumWorld,
+                         boundingBox.maximumWorld)) {
+    return false;
+  }
+
+  // Go as deep as possible
+  if (auto child = _getChildBlock(boundingBox.centerWorld)) {
+    if (child->_addLooseEntry(entry, entryBlocks)) {
+      return true;
+    }
+  }
+
+  const auto entriesCount = entries.size();
+  _creationFunc(entry, *this);
+  if (entries.size() == entriesCount) {
+    // Rejected by the creation function
+    return true;
+  }
+  entryBlocks[entry] = this;
+
+  if (IOctreeContainer<T>::blocks.empty() && entries.size() > _capacity && _depth < _maxDepth) {
+    _createLooseInnerBlocks(entryBlocks);
+  }
+
+  return true;
+}
+
+template <class T>
+void OctreeBlock<T>::_createLooseInnerBlocks(std::unordered_map<T, OctreeBlock<T>*>& entryBlocks)
+{
+  std::vector<T> noEntries;
+  OctreeBlock<T>::_CreateBlocks(_minPoint, _maxPoint, noEntries, _capacity, _depth, _maxDepth,
+                                *this, _creationFunc, true);
+
+  // Push the entries down when they fit in the loose bounds of a child block and the creation
+  // function accepts them there
+  std::vector<T> remainingEntries;
+  for (auto& entry : entries) {
+    const auto& boundingBox = entry->getBoundingInfo()->boundingBox;
+    auto child              = _getChildBlock(boundingBox.centerWorld);
+    if (ContainsMinMax(child->_looseMinPoint, child->_looseMaxPoint, boundingBox.minimumWorld,
+                       boundingBox.maximumWorld)) {
+      const auto childEntriesCount = child->entries.size();
+      child->_creationFunc(entry, *child);
+      if (child->entries.size() != childEntriesCount) {
+        entryBlocks[entry] = child;
+        continue;
+      }
+    }
+    remainingEntries.emplace_back(entry);
+  }
+  entries = std::move(remainingEntries);
 }
 
 template <class T>
@@ -175,7 +329,8 @@ void OctreeBlock<T>::_CreateBlocks(const Vector3& worldMin, const Vector3& world
                                    std::vector<T>& entries, size_t maxBlockCapacity,
                                    size_t currentDepth, size_t maxDepth,
                                    IOctreeContainer<T>& target,
-                                   const std::function<void(T&, OctreeBlock<T>&)>& creationFunc)
+                                   const std::function<void(T&, OctreeBlock<T>&)>& creationFunc,
+                                   bool loose)
 {
   target.blocks.clear();
   Vector3 blockSize((worldMax.x - worldMin.x) / 2.f, (worldMax.y - worldMin.y) / 2.f,
@@ -190,10 +345,11 @@ void OctreeBlock<T>::_CreateBlocks(const Vector3& worldMin, const Vector3& world
         const auto& localMax = worldMin.add(
           blockSize.multiplyByFloats((float)x + 1.f, (float)y + 1.f, (float)z + 1.f));
 
-        OctreeBlock<T> block(localMin, localMax, maxBlockCapacity, currentDepth + 1, maxDepth,
-                             creationFunc);
-        block.addEntries(entries);
-        target.blocks.emplace_back(block);
+        auto block = std::make_unique<OctreeBlock<T>>(localMin, localMax, maxBlockCapacity,
+                                                      currentDepth + 1, maxDepth, creationFunc,
+                                                      loose);
+        block->addEntries(entries);
+        target.blocks.emplace_back(std::move(block));
       }
     }
   }
@@ -0,0 +1,380 @@
+#include <babylon/culling/software_occlusion_culler.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+
+#include <babylon/culling/bounding_info.h>
+#include <babylon/maths/matrix.h>
+#include <babylon/maths/vector3.h>
+#include <babylon/meshes/abstract_mesh.h>
+#include <babylon/meshes/vertex_buffer.h>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define BABYLON_SOFTWARE_OCCLUSION_CULLER_SSE
+#endif
+
+namespace BABYLON {
+
+// Depth of the pixels not covered by any occluder
+static constexpr float SOFTWARE_OCCLUSION_CULLER_FAR_DEPTH = std::numeric_limits<float>::max();
+// Vertices closer to the camera plane are treated as crossing the near plane
+static constexpr float SOFTWARE_OCCLUSION_CULLER_MIN_W = 1e-5f;
+
+SoftwareOcclusionCuller::SoftwareOcclusionCuller(size_t width, size_t height)
+    : forceScalar{false}
+    , _tilesX{std::max<size_t>(1, (width + TileSize - 1) / TileSize)}
+    , _tilesY{std::max<size_t>(1, (height + TileSize - 1) / TileSize)}
+    , _depthSign{1.f}
+    , _rasterizedTriangleCount{0}
+    , _occludedMeshCount{0}
+{
+  _width  = _tilesX * TileSize;
+  _height = _tilesY * TileSize;
+  _depth.assign(_width * _height, SOFTWARE_OCCLUSION_CULLER_FAR_DEPTH);
+  _tileMaxDepth.assign(_tilesX * _tilesY, SOFTWARE_OCCLUSION_CULLER_FAR_DEPTH);
+  Matrix::IdentityReadOnly().copyToArray(_viewProjection);
+}
+
+SoftwareOcclusionCuller::~SoftwareOcclusionCuller() = default;
+
+void SoftwareOcclusionCuller::addOccluder(AbstractMesh* mesh)
+{
+  if (!mesh) {
+    return;
+  }
+
+  Occluder occluder;
+  occluder.positions = mesh->getVerticesData(VertexBuffer::PositionKind);
+  occluder.indices   = mesh->getIndices();
+  if (occluder.indices.empty()) {
+    occluder.indices.resize(occluder.positions.size() / 3);
+    for (size_t i = 0; i < occluder.indices.size(); ++i) {
+      occluder.indices[i] = static_cast<uint32_t>(i);
+    }
+  }
+
+  _occluders[mesh] = std::move(occluder);
+}
+
+void SoftwareOcclusionCuller::removeOccluder(AbstractMesh* mesh)
+{
+  _occluders.erase(mesh);
+}
+
+bool SoftwareOcclusionCuller::isOccluder(AbstractMesh* mesh) const
+{
+  return _occluders.find(mesh) != _occluders.end();
+}
+
+size_t SoftwareOcclusionCuller::occluderCount() const
+{
+  return _occluders.size();
+}
+
+size_t SoftwareOcclusionCuller::width() const
+{
+  return _width;
+}
+
+size_t SoftwareOcclusionCuller::height() const
+{
+  return _height;
+}
+
+float SoftwareOcclusionCuller::depthAt(size_t x, size_t y) const
+{
+  return _depth[_pixelIndex(x, y)];
+}
+
+size_t SoftwareOcclusionCuller::rasterizedTriangleCount() const
+{
+  return _rasterizedTriangleCount;
+}
+
+size_t SoftwareOcclusionCuller::occludedMeshCount() const
+{
+  return _occludedMeshCount;
+}
+
+size_t SoftwareOcclusionCuller::_pixelIndex(size_t x, size_t y) const
+{
+  const auto tileIndex = (y / TileSize) * _tilesX + (x / TileSize);
+  return tileIndex * TileSize * TileSize + (y % TileSize) * TileSize + (x % TileSize);
+}
+
+void SoftwareOcclusionCuller::render(const Matrix& viewProjection, bool reverseDepth)
+{
+  clear(viewProjection, reverseDepth);
+
+  for (auto& [mesh, occluder] : _occluders) {
+    if (!mesh->isEnabled() || !mesh->isVisible) {
+      continue;
+    }
+    rasterizeTriangles(occluder.positions, occluder.indices, mesh->computeWorldMatrix());
+  }
+
+  updateHierarchicalDepth();
+}
+
+void SoftwareOcclusionCuller::clear(const Matrix& viewProjection, bool reverseDepth)
+{
+  viewProjection.copyToArray(_viewProjection);
+  _depthSign               = reverseDepth ? -1.f : 1.f;
+  _rasterizedTriangleCount = 0;
+  _occludedMeshCount       = 0;
+  std::fill(_depth.begin(), _depth.end(), SOFTWARE_OCCLUSION_CULLER_FAR_DEPTH);
+  std::fill(_tileMaxDepth.begin(), _tileMaxDepth.end(), SOFTWARE_OCCLUSION_CULLER_FAR_DEPTH);
+}
+
+void SoftwareOcclusionCuller::rasterizeTriangles(const Float32Array& positions,
+                                                 const IndicesArray& indices, const Matrix& world)
+{
+  // World view projection (row vectors)
+  const auto& w = world.m();
+  std::array<float, 16> m;
+  for (size_t row = 0; row < 4; ++row) {
+    for (size_t col = 0; col < 4; ++col) {
+      m[row * 4 + col] = w[row * 4 + 0] * _viewProjection[0 + col]
+                         + w[row * 4 + 1] * _viewProjection[4 + col]
+                         + w[row * 4 + 2] * _viewProjection[8 + col]
+                         + w[row * 4 + 3] * _viewProjection[12 + col];
+    }
+  }
+
+  // Transform the vertices once to screen space (x, y, depth) and flag the ones that would be
+  // clipped by the near plane with a negative w
+  const auto vertexCount = positions.size() / 3;
+  _clipSpacePositions.resize(vertexCount * 4);
+  const auto halfWidth  = 0.5f * static_cast<float>(_width);
+  const auto halfHeight = 0.5f * static_cast<float>(_height);
+  for (size_t i = 0; i < vertexCount; ++i) {
+    const auto x = positions[i * 3 + 0];
+    const auto y = positions[i * 3 + 1];
+    const auto z = positions[i * 3 + 2];
+    const auto cx = x * m[0] + y * m[4] + z * m[8] + m[12];
+    const auto cy = x * m[1] + y * m[5] + z * m[9] + m[13];
+    const auto cz = x * m[2] + y * m[6] + z * m[10] + m[14];
+    const auto cw = x * m[3] + y * m[7] + z * m[11] + m[15];
+    auto* out     = &_clipSpacePositions[i * 4];
+    if (cw <= SOFTWARE_OCCLUSION_CULLER_MIN_W || _depthSign * cz < -cw) {
+      out[3] = -1.f;
+      continue;
+    }
+    const auto invW = 1.f / cw;
+    out[0]          = (cx * invW + 1.f) * halfWidth;
+    out[1]          = (cy * invW + 1.f) * halfHeight;
+    out[2]          = _depthSign * cz * invW;
+    out[3]          = 1.f;
+  }
+
+  // Triangles crossing the near plane are skipped, which can only make the culling less aggressive
+  for (size_t i = 0; i + 2 < indices.size(); i += 3) {
+    if (indices[i] >= vertexCount || indices[i + 1] >= vertexCount
+        || indices[i + 2] >= vertexCount) {
+      continue;
+    }
+    const auto* v0 = &_clipSpacePositions[indices[i] * 4];
+    const auto* v1 = &_clipSpacePositions[indices[i + 1] * 4];
+    const auto* v2 = &_clipSpacePositions[indices[i + 2] * 4];
+    if (v0[3] < 0.f || v1[3] < 0.f || v2[3] < 0.f) {
+      continue;
+    }
+    _rasterizeTriangle(v0, v1, v2);
+  }
+}
+
+void SoftwareOcclusionCuller::_rasterizeTriangle(const float* v0, const float* v1, const float* v2)
+{
+  // Both windings are rasterized
+  auto area = (v1[0] - v0[0]) * (v2[1] - v0[1]) - (v2[0] - v0[0]) * (v1[1] - v0[1]);
+  if (std::abs(area) < 1e-8f) {
+    return;
+  }
+  if (area < 0.f) {
+    std::swap(v1, v2);
+    area = -area;
+  }
+
+  // Screen bounds
+  const auto fMinX = std::floor(std::min({v0[0], v1[0], v2[0]}));
+  const auto fMaxX = std::floor(std::max({v0[0], v1[0], v2[0]}));
+  const auto fMinY = std::floor(std::min({v0[1], v1[1], v2[1]}));
+  const auto fMaxY = std::floor(std::max({v0[1], v1[1], v2[1]}));
+  if (fMaxX < 0.f || fMaxY < 0.f || fMinX >= static_cast<float>(_width)
+      || fMinY >= static_cast<float>(_height)) {
+    return;
+  }
+  const auto minX = static_cast<size_t>(std::max(fMinX, 0.f));
+  const auto minY = static_cast<size_t>(std::max(fMinY, 0.f));
+  const auto maxX = static_cast<size_t>(std::min(fMaxX, static_cast<float>(_width - 1)));
+  const auto maxY = static_cast<size_t>(std::min(fMaxY, static_cast<float>(_height - 1)));
+
+  ++_rasterizedTriangleCount;
+
+  // Edge functions e(x, y) = a * x + b * y + c, positive inside the triangle, edge i is opposite
+  // to vertex i so that e_i / area is the barycentric weight of vertex i
+  const auto edge = [](const float* from, const float* to, float& a, float& b, float& c) {
+    a = from[1] - to[1];
+    b = to[0] - from[0];
+    c = (to[1] - from[1]) * from[0] - (to[0] - from[0]) * from[1];
+  };
+  float a0, b0, c0, a1, b1, c1, a2, b2, c2;
+  edge(v1, v2, a0, b0, c0);
+  edge(v2, v0, a1, b1, c1);
+  edge(v0, v1, a2, b2, c2);
+
+  // Depth plane
+  const auto invArea = 1.f / area;
+  const auto za      = (a0 * v0[2] + a1 * v1[2] + a2 * v2[2]) * invArea;
+  const auto zb      = (b0 * v0[2] + b1 * v1[2] + b2 * v2[2]) * invArea;
+  const auto zc      = (c0 * v0[2] + c1 * v1[2] + c2 * v2[2]) * invArea;
+
+  // Pixel centers lying on an edge shared by two triangles can be rejected by both because of the
+  // rounding errors, the edges are pushed out by a fraction of pixel to keep the meshes watertight
+  constexpr auto edgeTolerance = 1.f / 1024.f;
+  c0 += edgeTolerance * (std::abs(a0) + std::abs(b0));
+  c1 += edgeTolerance * (std::abs(a1) + std::abs(b1));
+  c2 += edgeTolerance * (std::abs(a2) + std::abs(b2));
+
+  // The buffer is always a multiple of the tile size, so groups of 4 aligned pixels never cross a
+  // tile boundary and are contiguous in memory
+  const auto startX = minX & ~size_t(3);
+
+#if defined(BABYLON_SOFTWARE_OCCLUSION_CULLER_SSE)
+  if (!forceScalar) {
+    const auto offsets = _mm_setr_ps(0.5f, 1.5f, 2.5f, 3.5f);
+    const auto zero    = _mm_setzero_ps();
+    const auto va0 = _mm_set1_ps(a0), va1 = _mm_set1_ps(a1), va2 = _mm_set1_ps(a2);
+    const auto vza = _mm_set1_ps(za);
+    for (auto y = minY; y <= maxY; ++y) {
+      const auto py = static_cast<float>(y) + 0.5f;
+      const auto r0 = _mm_set1_ps(b0 * py + c0);
+      const auto r1 = _mm_set1_ps(b1 * py + c1);
+      const auto r2 = _mm_set1_ps(b2 * py + c2);
+      const auto rz = _mm_set1_ps(zb * py + zc);
+      for (auto x = startX; x <= maxX; x += 4) {
+        const auto px     = _mm_add_ps(_mm_set1_ps(static_cast<float>(x)), offsets);
+        const auto e0     = _mm_add_ps(_mm_mul_ps(va0, px), r0);
+        const auto e1     = _mm_add_ps(_mm_mul_ps(va1, px), r1);
+        const auto e2     = _mm_add_ps(_mm_mul_ps(va2, px), r2);
+        const auto inside = _mm_and_ps(_mm_and_ps(_mm_cmpge_ps(e0, zero), _mm_cmpge_ps(e1, zero)),
+                                       _mm_cmpge_ps(e2, zero));
+        if (_mm_movemask_ps(inside) == 0) {
+          continue;
+        }
+        const auto z      = _mm_add_ps(_mm_mul_ps(vza, px), rz);
+        auto* depth       = &_depth[_pixelIndex(x, y)];
+        const auto stored = _mm_loadu_ps(depth);
+        _mm_storeu_ps(depth, _mm_or_ps(_mm_and_ps(inside, _mm_min_ps(stored, z)),
+                                       _mm_andnot_ps(inside, stored)));
+      }
+    }
+    return;
+  }
+#endif
+
+  for (auto y = minY; y <= maxY; ++y) {
+    const auto py = static_cast<float>(y) + 0.5f;
+    for (auto x = minX; x <= maxX; ++x) {
+      const auto px = static_cast<float>(x) + 0.5f;
+      if (a0 * px + b0 * py + c0 < 0.f || a1 * px + b1 * py + c1 < 0.f
+          || a2 * px + b2 * py + c2 < 0.f) {
+        continue;
+      }
+      const auto z = za * px + zb * py + zc;
+      auto& depth  = _depth[_pixelIndex(x, y)];
+      depth        = std::min(depth, z);
+    }
+  }
+}
+
+void SoftwareOcclusionCuller::updateHierarchicalDepth()
+{
+  constexpr auto tilePixelCount = TileSize * TileSize;
+  for (size_t tile = 0; tile < _tileMaxDepth.size(); ++tile) {
+    const auto begin    = _depth.begin() + static_cast<std::ptrdiff_t>(tile * tilePixelCount);
+    _tileMaxDepth[tile] = *std::max_element(begin, begin + tilePixelCount);
+  }
+}
+
+bool SoftwareOcclusionCuller::isOccluded(const Vector3& minimumWorld,
+                                         const Vector3& maximumWorld) const
+{
+  const auto& m = _viewProjection;
+
+  // Screen space bounds and closest depth of the box
+  auto minX = std::numeric_limits<float>::max(), minY = minX, minDepth = minX;
+  auto maxX = std::numeric_limits<float>::lowest(), maxY = maxX;
+  for (unsigned int corner = 0; corner < 8; ++corner) {
+    const auto x  = (corner & 1) ? maximumWorld.x : minimumWorld.x;
+    const auto y  = (corner & 2) ? maximumWorld.y : minimumWorld.y;
+    const auto z  = (corner & 4) ? maximumWorld.z : minimumWorld.z;
+    const auto cx = x * m[0] + y * m[4] + z * m[8] + m[12];
+    const auto cy = x * m[1] + y * m[5] + z * m[9] + m[13];
+    const auto cz = x * m[2] + y * m[6] + z * m[10] + m[14];
+    const auto cw = x * m[3] + y * m[7] + z * m[11] + m[15];
+    // Crossing the near plane, the box can cover the whole screen
+    if (cw <= SOFTWARE_OCCLUSION_CULLER_MIN_W || _depthSign * cz < -cw) {
+      return false;
+    }
+    const auto invW = 1.f / cw;
+    const auto sx   = (cx * invW + 1.f) * 0.5f * static_cast<float>(_width);
+    const auto sy   = (cy * invW + 1.f) * 0.5f * static_cast<float>(_height);
+    minX            = std::min(minX, sx);
+    maxX            = std::max(maxX, sx);
+    minY            = std::min(minY, sy);
+    maxY            = std::max(maxY, sy);
+    minDepth        = std::min(minDepth, _depthSign * cz * invW);
+  }
+
+  // Outside of the screen, left to the frustum culling
+  if (maxX < 0.f || maxY < 0.f || minX >= static_cast<float>(_width)
+      || minY >= static_cast<float>(_height)) {
+    return false;
+  }
+  const auto x0 = static_cast<size_t>(std::max(std::floor(minX), 0.f));
+  const auto y0 = static_cast<size_t>(std::max(std::floor(minY), 0.f));
+  const auto x1 = static_cast<size_t>(std::min(std::floor(maxX), static_cast<float>(_width - 1)));
+  const auto y1 = static_cast<size_t>(std::min(std::floor(maxY), static_cast<float>(_height - 1)));
+
+  for (auto ty = y0 / TileSize; ty <= y1 / TileSize; ++ty) {
+    for (auto tx = x0 / TileSize; tx <= x1 / TileSize; ++tx) {
+      // Whole tile in front of the box
+      if (_tileMaxDepth[ty * _tilesX + tx] < minDepth) {
+        continue;
+      }
+      // Pixels of the tile covered by the box
+      const auto px0 = std::max(x0, tx * TileSize), px1 = std::min(x1, tx * TileSize + TileSize - 1);
+      const auto py0 = std::max(y0, ty * TileSize), py1 = std::min(y1, ty * TileSize + TileSize - 1);
+      for (auto py = py0; py <= py1; ++py) {
+        for (auto px = px0; px <= px1; ++px) {
+          if (_depth[_pixelIndex(px, py)] >= minDepth) {
+            return false;
+          }
+        }
+      }
+    }
+  }
+
+  return true;
+}
+
+bool SoftwareOcclusionCuller::isOccluded(AbstractMesh* mesh)
+{
+  if (isOccluder(mesh)) {
+    return false;
+  }
+
+  const auto& boundingBox = mesh->getBoundingInfo()->boundingBox;
+  if (!isOccluded(boundingBox.minimumWorld, boundingBox.maximumWorld)) {
+    return false;
+  }
+
+  ++_occludedMeshCount;
+  return true;
+}
+
+} // end of namespace BABYLON
@@ -24,6 +24,7 @@
 #include <babylon/postprocesses/post_process.h>
 #include <babylon/postprocesses/post_process_manager.h>
 #include <babylon/states/depth_culling_state.h>
+#include <babylon/states/gl_state_cache.h>
 #include <babylon/states/stencil_state.h>
 
 namespace BABYLON {
@@ -332,22 +333,12 @@ void Engine::setStencilOperationPass(unsigned int operation)
 
 void Engine::setDitheringState(bool value)
 {
-  if (value) {
-    _gl->enable(GL::DITHER);
-  }
-  else {
-    _gl->disable(GL::DITHER);
-  }
+  _glStateCache->setCapability(GL::DITHER, value);
 }
 
 void Engine::setRasterizerState(bool value)
 {
-  if (value) {
-    _gl->enable(GL::RASTERIZER_DISCARD);
-  }
-  else {
-    _gl->disable(GL::RASTERIZER_DISCARD);
-  }
+  _glStateCache->setCapability(GL::RASTERIZER_DISCARD, value);
 }
 
 int Engine::getDepthFunction() const
@@ -423,13 +414,13 @@ void Engine::scissorClear(int x, int y, int width, int height, const Color4& cle
 void Engine::enableScissor(int x, int y, int width, int height)
 {
   // Change state
-  _gl->enable(GL::SCISSOR_TEST);
+  _glStateCache->setCapability(GL::SCISSOR_TEST, true);
   _gl->scissor(x, y, width, height);
 }
 
 void Engine::disableScissor()
 {
-  _gl->disable(GL::SCISSOR_TEST);
+  _glStateCache->setCapability(GL::SCISSOR_TEST, false);
 }
 
 void Engine::_reportDrawCall()
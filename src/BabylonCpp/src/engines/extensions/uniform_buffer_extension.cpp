@@ -86,6 +86,16 @@ void UniformBufferExtension::bindUniformBufferBase(const WebGLDataBufferPtr& buf
                              buffer ? buffer->underlyingResource().get() : nullptr);
 }
 
+void UniformBufferExtension::bindUniformBufferRange(const WebGLDataBufferPtr& buffer,
+                                                    unsigned int location, size_t byteOffset,
+                                                    size_t byteLength)
+{
+  _this->_gl->bindBufferRange(GL::UNIFORM_BUFFER, location,
+                              buffer ? buffer->underlyingResource().get() : nullptr,
+                              static_cast<GL::GLintptr>(byteOffset),
+                              static_cast<GL::GLsizeiptr>(byteLength));
+}
+
 void UniformBufferExtension::bindUniformBlock(const IPipelineContextPtr& pipelineContext,
                                               const std::string& blockName, unsigned int index)
 {
@@ -10,6 +10,7 @@
 #include <babylon/lights/light.h>
 #include <babylon/maths/matrix.h>
 #include <babylon/meshes/abstract_mesh.h>
+#include <babylon/meshes/transform_system.h>
 
 namespace BABYLON {
 
@@ -135,6 +136,11 @@ void Node::set_parent(Node* const& iParent)
 
   // Enabled state
   _syncParentEnabledState();
+
+  // Flattened hierarchy
+  if (auto transformSystem = _scene ? _scene->getTransformSystem() : nullptr) {
+    transformSystem->markHierarchyAsDirty();
+  }
 }
 
 Node*& Node::get_parent()
@@ -322,6 +328,11 @@ void Node::_markSyncedWithParent()
   }
 }
 
+bool Node::_isSyncedWithParent() const
+{
+  return !_parentNode || _parentUpdateId == _parentNode->_childUpdateId;
+}
+
 bool Node::isSynchronizedWithParent() const
 {
   if (!_parentNode) {
@@ -2,6 +2,7 @@
 
 #include <babylon/babylon_stl_util.h>
 #include <babylon/core/logging.h>
+#include <babylon/engines/snapshot_rendering_stream.h>
 #include <babylon/materials/draw_wrapper.h>
 #include <babylon/materials/effect.h>
 #include <babylon/materials/textures/internal_texture.h>
@@ -88,6 +89,7 @@ NullEngine::NullEngine(const NullEngineOptions& options) : Engine{nullptr}
     _features.uniformBufferHardCheckMatrix              = false;
     _features.allowTexturePrefiltering                  = false;
     _features.trackUbosInFrame                          = false;
+    _features.uniformBufferRing                         = false;
     _features.supportCSM                                = false;
     _features.basisNeedsPOT                             = false;
     _features.support3DTextures                         = false;
@@ -98,6 +100,7 @@ NullEngine::NullEngine(const NullEngineOptions& options) : Engine{nullptr}
     _features.supportSwitchCaseInShader                 = false;
     _features.supportSyncTextureRead                    = false;
     _features.needsInvertingBitmap                      = false;
+    _features.useUBOBindingCache                        = true;
     _features._collectUbosUpdatedInFrame                = false;
   }
 
@@ -284,6 +287,11 @@ bool NullEngine::setMatrices(const WebGLUniformLocationPtr& /*uniform*/,
   return true;
 }
 
+bool NullEngine::setMatrix(const WebGLUniformLocationPtr& /*uniform*/, const Matrix& /*matrix*/)
+{
+  return true;
+}
+
 bool NullEngine::setMatrix3x3(const WebGLUniformLocationPtr& /*uniform*/,
                               const Float32Array& /*matrix*/)
 {
@@ -562,6 +570,34 @@ void NullEngine::updateDynamicVertexBuffer(const WebGLDataBufferPtr& /*vertexBuf
 {
 }
 
+void NullEngine::bindUniformBufferBase(const WebGLDataBufferPtr& buffer, unsigned int location,
+                                       const std::string& name)
+{
+  if (_snapshotRecorder) {
+    _snapshotRecorder->recordBindUniformBufferBase(buffer, location, name);
+  }
+}
+
+WebGLDataBufferPtr NullEngine::createUniformBuffer(const Float32Array& /*elements*/)
+{
+  auto buffer        = std::make_shared<WebGLDataBuffer>(nullptr);
+  buffer->references = 1;
+  return buffer;
+}
+
+WebGLDataBufferPtr NullEngine::createDynamicUniformBuffer(const Float32Array& elements)
+{
+  return createUniformBuffer(elements);
+}
+
+void NullEngine::updateUniformBuffer(const WebGLDataBufferPtr& uniformBuffer,
+                                     const Float32Array& elements, int offset, int count)
+{
+  if (_snapshotRecorder) {
+    _snapshotRecorder->recordUpdateUniformBuffer(uniformBuffer, elements, offset, count);
+  }
+}
+
 bool NullEngine::_bindTextureDirectly(unsigned int /*target*/, const InternalTexturePtr& texture,
                                       bool /*forTextureDataUpdate*/, bool /*force*/)
 {
@@ -583,7 +619,7 @@ void NullEngine::_bindTexture(int channel, const InternalTexturePtr& texture,
   _bindTextureDirectly(0, texture);
 }
 
-void NullEngine::_deleteBuffer(GL::IGLBuffer* /*buffer*/)
+void NullEngine::_deleteBuffer(const WebGLDataBufferPtr& /*buffer*/)
 {
 }
 
@@ -1,11 +1,40 @@
 #include <babylon/engines/processors/shader_code_node.h>
 
+#include <cctype>
+#include <sstream>
+
 #include <babylon/engines/processors/ishader_processor.h>
 #include <babylon/engines/processors/shader_processing_options.h>
 #include <babylon/misc/string_tools.h>
 
 namespace BABYLON {
 
+namespace {
+
+// Returns whether a line is a single uniform declaration ("uniform [highp|lowp] type name;"), as
+// opposed to the opening line of a uniform buffer
+bool isUniformDeclaration(const std::string& line)
+{
+  const auto end = line.find(';');
+  if (end == std::string::npos || end <= 7
+      || !std::isspace(static_cast<unsigned char>(line[7]))) {
+    return false;
+  }
+
+  std::vector<std::string> tokens;
+  std::istringstream iss(line.substr(7, end - 7));
+  for (std::string token; iss >> token;) {
+    tokens.emplace_back(token);
+  }
+  if (!tokens.empty() && (tokens[0] == "highp" || tokens[0] == "lowp")) {
+    tokens.erase(tokens.begin());
+  }
+
+  return tokens.size() == 2;
+}
+
+} // end of anonymous namespace
+
 bool ShaderCodeNode::isValid(
   const std::unordered_map<std::string, std::string>& /*preprocessors*/) const
 {
@@ -36,10 +65,7 @@ std::string ShaderCodeNode::process(std::unordered_map<std::string, std::string>
       else if ((processor->uniformProcessor || processor->uniformBufferProcessor)
                && StringTools::startsWith(line, "uniform")
                && !options.lookForClosingBracketForUniformBuffer) {
-        auto reSearch = R"(uniform\s+(?:(?:highp)?|(?:lowp)?)\s*(\S+)\s+(\S+)\s*;)";
-        std::regex regex(reSearch, std::regex::optimize);
-
-        if (std::regex_search(line, regex)) { // uniform
+        if (isUniformDeclaration(line)) { // uniform
           if (processor->uniformProcessor) {
             value = processor->uniformProcessor(line, options.isFragment, preprocessors,
                                                 options.processingContext);
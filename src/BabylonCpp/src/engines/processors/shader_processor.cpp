@@ -1,6 +1,10 @@
 #include <babylon/engines/processors/shader_processor.h>
 
-#include <babylon/babylon_stl_util.h>
+#include <array>
+#include <cctype>
+#include <cstring>
+#include <mutex>
+
 #include <babylon/engines/processors/expressions/operators/shader_define_and_operator.h>
 #include <babylon/engines/processors/expressions/operators/shader_define_arithmetic_operator.h>
 #include <babylon/engines/processors/expressions/operators/shader_define_is_defined_operator.h>
@@ -12,6 +16,7 @@
 #include <babylon/engines/processors/shader_code_node.h>
 #include <babylon/engines/processors/shader_code_test_node.h>
 #include <babylon/engines/processors/shader_processing_options.h>
+#include <babylon/materials/effect_includes_shaders_store.h>
 #include <babylon/misc/file_tools.h>
 #include <babylon/misc/string_tools.h>
 
@@ -25,13 +30,11 @@ void ShaderProcessor::Initialize(ProcessingOptions& options)
 }
 
 void ShaderProcessor::Process(const std::string& sourceCode, ProcessingOptions& options,
-                              const std::function<void(const std::string& migratedCode)>& callback,
-                              ThinEngine* engine)
+                              const std::function<void(const std::string& migratedCode)>& callback)
 {
   _ProcessIncludes(sourceCode, options,
-                   [&options, callback, &engine](const std::string& codeWithIncludes) -> void {
-                     const auto migratedCode
-                       = _ProcessShaderConversion(codeWithIncludes, options, engine);
+                   [&options, callback](const std::string& codeWithIncludes) -> void {
+                     const auto migratedCode = _ProcessShaderConversion(codeWithIncludes, options);
                      callback(migratedCode);
                    });
 }
@@ -70,13 +73,15 @@ std::string ShaderProcessor::_ProcessPrecision(std::string source, const Process
 
 ShaderDefineExpressionPtr ShaderProcessor::_ExtractOperation(const std::string& expression)
 {
-  auto reStr = R"(defined\((.+)\))";
-  std::regex regex(reStr, std::regex::optimize);
-  std::smatch match;
-
-  if (std::regex_search(expression, match, regex) && !match.empty()) {
-    return std::make_shared<ShaderDefineIsDefinedOperator>(StringTools::trimCopy(match[1]),
-                                                           expression[0] == '!');
+  // defined(X)
+  const auto definedStart = expression.find("defined(");
+  if (definedStart != std::string::npos) {
+    const auto start = definedStart + 8;
+    const auto end   = expression.rfind(')');
+    if (end != std::string::npos && end > start) {
+      return std::make_shared<ShaderDefineIsDefinedOperator>(
+        StringTools::trimCopy(expression.substr(start, end - start)), expression[0] == '!');
+    }
   }
 
   const std::vector<std::string> operators{"==", ">=", "<=", "<", ">"};
@@ -258,19 +263,38 @@ void ShaderProcessor::_MoveCursorWithinIf(ShaderCodeCursor& cursor,
   }
 }
 
+ShaderProcessor::Keyword ShaderProcessor::_FindKeyword(const std::string& line)
+{
+  // Same precedence as the keywords alternation: leftmost "#", then longest keyword first
+  static const std::array<std::pair<const char*, Keyword>, 6> keywords{{
+    {"#ifdef", Keyword::Ifdef},
+    {"#else", Keyword::Else},
+    {"#elif", Keyword::Elif},
+    {"#endif", Keyword::Endif},
+    {"#ifndef", Keyword::Ifndef},
+    {"#if", Keyword::If},
+  }};
+
+  for (auto pos = line.find('#'); pos != std::string::npos; pos = line.find('#', pos + 1)) {
+    for (const auto& keyword : keywords) {
+      if (line.compare(pos, std::strlen(keyword.first), keyword.first) == 0) {
+        return keyword.second;
+      }
+    }
+  }
+
+  return Keyword::None;
+}
+
 bool ShaderProcessor::_MoveCursor(ShaderCodeCursor& cursor, const ShaderCodeNodePtr& rootNode)
 {
   while (cursor.canRead()) {
     ++cursor.lineIndex;
-    const auto& line      = cursor.currentLine();
-    const auto reKeywords = R"((#ifdef)|(#else)|(#elif)|(#endif)|(#ifndef)|(#if))";
-    std::regex regex(reKeywords, std::regex::optimize);
-    std::smatch matches;
-
-    if (std::regex_search(line, matches, regex) && !matches.empty()) {
-      auto keyword = matches[0].str();
+    const auto& line   = cursor.currentLine();
+    const auto keyword = _FindKeyword(line);
 
-      if (keyword == "#ifdef") {
+    if (keyword != Keyword::None) {
+      if (keyword == Keyword::Ifdef) {
         auto newRootNode = std::make_shared<ShaderCodeConditionNode>();
         rootNode->children.emplace_back(newRootNode);
 
@@ -278,13 +302,13 @@ bool ShaderProcessor::_MoveCursor(ShaderCodeCursor& cursor, const ShaderCodeNode
         newRootNode->children.emplace_back(ifNode);
         _MoveCursorWithinIf(cursor, newRootNode, ifNode);
       }
-      else if (keyword == "#else" || keyword == "#elif") {
+      else if (keyword == Keyword::Else || keyword == Keyword::Elif) {
         return true;
       }
-      else if (keyword == "#endif") {
+      else if (keyword == Keyword::Endif) {
         return false;
       }
-      else if (keyword == "#ifndef") {
+      else if (keyword == Keyword::Ifndef) {
         auto newRootNode = std::make_shared<ShaderCodeConditionNode>();
         rootNode->children.emplace_back(newRootNode);
 
@@ -292,7 +316,7 @@ bool ShaderProcessor::_MoveCursor(ShaderCodeCursor& cursor, const ShaderCodeNode
         newRootNode->children.emplace_back(ifNode);
         _MoveCursorWithinIf(cursor, newRootNode, ifNode);
       }
-      else if (keyword == "#if") {
+      else if (keyword == Keyword::If) {
         auto newRootNode = std::make_shared<ShaderCodeConditionNode>();
         auto ifNode      = _BuildExpression(line, 3);
         rootNode->children.emplace_back(newRootNode);
@@ -375,8 +399,7 @@ ShaderProcessor::_PreparePreProcessors(const ProcessingOptions& options)
 }
 
 std::string ShaderProcessor::_ProcessShaderConversion(const std::string& sourceCode,
-                                                      ProcessingOptions& options,
-                                                      ThinEngine* engine)
+                                                      ProcessingOptions& options)
 {
   auto preparedSourceCode = _ProcessPrecision(sourceCode, options);
 
@@ -404,7 +427,8 @@ std::string ShaderProcessor::_ProcessShaderConversion(const std::string& sourceC
   // Post processing
   if (options.processor->postProcessor) {
     preparedSourceCode = options.processor->postProcessor(
-      preparedSourceCode, defines, options.isFragment, options.processingContext, engine);
+      preparedSourceCode, defines, options.isFragment, options.processingContext,
+      options.processorParameters);
   }
 
   return preparedSourceCode;
@@ -413,17 +437,84 @@ std::string ShaderProcessor::_ProcessShaderConversion(const std::string& sourceC
 void ShaderProcessor::_ProcessIncludes(const std::string& sourceCode, ProcessingOptions& options,
                                        const std::function<void(const std::string& data)>& callback)
 {
-  static const auto regexShaderIncludeStr = R"(#include\s?<(.+)>(\((.*)\))*(\[(.*)\])*)";
-  static std::regex regexShaderInclude(regexShaderIncludeStr, std::regex::optimize);
-  auto regexBegin = std::sregex_iterator(sourceCode.begin(), sourceCode.end(), regexShaderInclude);
-  auto regexEnd   = std::sregex_iterator();
+  // The includes are read from the immutable snapshot held by the options, effects processed on
+  // the engine thread pool do not need any lock
+  std::string missingInclude;
+  const auto codeWithIncludes = _ExpandIncludes(sourceCode, options, missingInclude);
+
+  if (missingInclude.empty()) {
+    callback(codeWithIncludes);
+    return;
+  }
 
-  auto returnValue    = sourceCode;
-  auto keepProcessing = false;
+  // Load the missing include in a new snapshot, also published for the next effects, and start over
+  auto includeShaderUrl = options.shadersRepository + "ShadersInclude/" + missingInclude + ".fx";
+
+  ShaderProcessor::_FileToolsLoadFile(
+    includeShaderUrl,
+    [&options, missingInclude, sourceCode,
+     callback](const std::variant<std::string, ArrayBufferView>& fileContent,
+               const std::string& /*responseURL*/) -> void {
+      if (std::holds_alternative<std::string>(fileContent)) {
+        const auto& includeSource = std::get<std::string>(fileContent);
+        auto includesShadersStore
+          = options.includesShadersStore ?
+              std::make_shared<EffectIncludesShadersStore::IncludesMap>(
+                *options.includesShadersStore) :
+              std::make_shared<EffectIncludesShadersStore::IncludesMap>();
+        (*includesShadersStore)[missingInclude] = includeSource;
+        options.includesShadersStore            = std::move(includesShadersStore);
+        EffectIncludesShadersStore().setShader(missingInclude, includeSource);
+        _ProcessIncludes(sourceCode, options, callback);
+      }
+    });
+}
 
-  for (std::sregex_iterator regexIt = regexBegin; regexIt != regexEnd; ++regexIt) {
-    auto match       = *regexIt;
-    auto includeFile = match[1].str();
+std::string ShaderProcessor::_ExpandIncludes(const std::string& sourceCode,
+                                             const ProcessingOptions& options,
+                                             std::string& missingInclude)
+{
+  static const std::string includeKeyword = "#include";
+
+  std::string result;
+  size_t position = 0;
+  for (auto start = sourceCode.find(includeKeyword); start != std::string::npos;
+       start      = sourceCode.find(includeKeyword, position)) {
+    // #include<name>(parameters)[indices], a single optional white space before "<"
+    auto cursor = start + includeKeyword.size();
+    if (cursor < sourceCode.size() && std::isspace(static_cast<unsigned char>(sourceCode[cursor]))
+        && sourceCode[cursor] != '\n') {
+      ++cursor;
+    }
+    const auto nameEnd = cursor < sourceCode.size() && sourceCode[cursor] == '<' ?
+                           _FindOnLine(sourceCode, '>', cursor + 1) :
+                           std::string::npos;
+    if (nameEnd == std::string::npos || nameEnd == cursor + 1) {
+      result.append(sourceCode, position, cursor - position);
+      position = cursor;
+      continue;
+    }
+
+    auto includeFile = sourceCode.substr(cursor + 1, nameEnd - cursor - 1);
+    cursor           = nameEnd + 1;
+
+    std::string parameters, indices;
+    bool hasIndices = false;
+    if (cursor < sourceCode.size() && sourceCode[cursor] == '(') {
+      const auto end = _FindOnLine(sourceCode, ')', cursor + 1);
+      if (end != std::string::npos) {
+        parameters = sourceCode.substr(cursor + 1, end - cursor - 1);
+        cursor     = end + 1;
+      }
+    }
+    if (cursor < sourceCode.size() && sourceCode[cursor] == '[') {
+      const auto end = _FindOnLine(sourceCode, ']', cursor + 1);
+      if (end != std::string::npos) {
+        indices    = sourceCode.substr(cursor + 1, end - cursor - 1);
+        hasIndices = true;
+        cursor     = end + 1;
+      }
+    }
 
     // Uniform declaration
     if (StringTools::indexOf(includeFile, "__decl__") != -1) {
@@ -435,90 +526,121 @@ void ShaderProcessor::_ProcessIncludes(const std::string& sourceCode, Processing
       includeFile = includeFile + "Declaration";
     }
 
-    if (stl_util::contains(options.includesShadersStore, includeFile)
-        && !options.includesShadersStore[includeFile].empty()) {
-      // Substitution
-      auto includeContent = options.includesShadersStore[includeFile];
-      if (match.size() > 2 && !match[2].str().empty()) {
-        auto splits = StringTools::split(match[3].str(), ',');
-
-        for (size_t index = 0; index < splits.size(); index += 2) {
-          auto dest = splits[index + 1];
+    const std::string* includeSource = nullptr;
+    if (options.includesShadersStore) {
+      auto it = options.includesShadersStore->find(includeFile);
+      if (it != options.includesShadersStore->end() && !it->second.empty()) {
+        includeSource = &it->second;
+      }
+    }
+    if (!includeSource) {
+      missingInclude = includeFile;
+      return "";
+    }
 
-          includeContent = StringTools::regexReplace(includeContent, splits[index], dest);
-        }
+    // Resolve the indices range, "min..max" where max can be an index parameter
+    int minIndex = 0, maxIndex = 0;
+    auto isRange = false;
+    if (hasIndices && StringTools::indexOf(indices, "..") != -1) {
+      isRange          = true;
+      const auto split = indices.find("..");
+      const auto first = indices.substr(0, split);
+      const auto last  = indices.substr(split + 2);
+      minIndex         = StringTools::toNumber<int>(first);
+      maxIndex         = StringTools::isDigit(last) ? StringTools::toNumber<int>(last) : -1;
+      if (maxIndex <= 0 && options.indexParameters.find(last) != options.indexParameters.end()) {
+        maxIndex = options.indexParameters[last].get<int>();
       }
+    }
 
-      if (match.size() > 4 && !match[4].str().empty()) {
-        auto indexString = match[5].str();
-
-        if (StringTools::indexOf(indexString, "..") != -1) {
-          StringTools::replaceInPlace(indexString, "..", "@");
-          auto indexSplits          = StringTools::split(indexString, '@');
-          auto minIndex             = StringTools::toNumber<int>(indexSplits[0]);
-          auto maxIndex             = StringTools::isDigit(indexSplits[1]) ?
-                                        StringTools::toNumber<int>(indexSplits[1]) :
-                                        -1;
-          auto sourceIncludeContent = StringTools::slice(includeContent, 0);
-          includeContent            = "";
-
-          if (maxIndex <= 0) {
-            maxIndex = options.indexParameters[indexSplits[1]];
-          }
-
-          for (int i = minIndex; i < maxIndex; ++i) {
-            if (!options.supportsUniformBuffers) {
-              // Ubo replacement
-              /*sourceIncludeContent = sourceIncludeContent.replace(/light\{X\}.(\w*)/g, (str:
-             string, p1: string) => { return p1 + "{X}";
-             });*/
-            }
-            includeContent
-              += StringTools::regexReplace(sourceIncludeContent, R"(\{X\})", std::to_string(i))
-                 + "\n";
-          }
-        }
-        else {
-          if (!options.supportsUniformBuffers) {
-            // Ubo replacement
-            /*includeContent = includeContent.replace(/light\{X\}.(\w*)/g, (str: string, p1: string)
-            => { return p1 + "{X}";
-            });*/
-          }
-          includeContent = StringTools::regexReplace(includeContent, R"(\{X\})", indexString);
-        }
+    auto includeContent
+      = _SubstituteInclude(includeFile, *includeSource, parameters, hasIndices, isRange, indices,
+                           minIndex, maxIndex);
+
+    // Nested includes
+    if (includeContent.find(includeKeyword) != std::string::npos) {
+      includeContent = _ExpandIncludes(includeContent, options, missingInclude);
+      if (!missingInclude.empty()) {
+        return "";
       }
+    }
+
+    result.append(sourceCode, position, start - position);
+    result.append(includeContent);
+    position = cursor;
+  }
 
-      // Replace
-      returnValue = StringTools::replace(returnValue, match[0].str(), includeContent);
+  result.append(sourceCode, position, std::string::npos);
+  return result;
+}
 
-      keepProcessing = keepProcessing                                            //
-                       || StringTools::indexOf(includeContent, "#include<") >= 0 //
-                       || StringTools::indexOf(includeContent, "#include <") >= 0;
+size_t ShaderProcessor::_FindOnLine(const std::string& code, char character, size_t from)
+{
+  for (auto i = from; i < code.size() && code[i] != '\n'; ++i) {
+    if (code[i] == character) {
+      return i;
     }
-    else {
-      auto includeShaderUrl = options.shadersRepository + "ShadersInclude/" + includeFile + ".fx";
-
-      ShaderProcessor::_FileToolsLoadFile(
-        includeShaderUrl,
-        [&options, includeFile, returnValue,
-         callback](const std::variant<std::string, ArrayBufferView>& fileContent,
-                   const std::string& /*responseURL*/) -> void {
-          if (std::holds_alternative<std::string>(fileContent)) {
-            options.includesShadersStore[includeFile] = std::get<std::string>(fileContent);
-            _ProcessIncludes(returnValue, options, callback);
-          }
-        });
-      return;
+  }
+
+  return std::string::npos;
+}
+
+std::string ShaderProcessor::_SubstituteInclude(const std::string& includeFile,
+                                                const std::string& includeSource,
+                                                const std::string& parameters, bool hasIndices,
+                                                bool isRange, const std::string& indices,
+                                                int minIndex, int maxIndex)
+{
+  // The substitution only depends on the include source and on the directive arguments, the
+  // expansions are shared by all the effects
+  struct Expansion {
+    std::string source;
+    std::string content;
+  };
+  static std::mutex expansionsMutex;
+  static std::unordered_map<std::string, Expansion> expansions;
+
+  auto key = includeFile;
+  key.append(1, '\0').append(parameters).append(1, '\0');
+  if (isRange) {
+    key.append(std::to_string(minIndex)).append("..").append(std::to_string(maxIndex));
+  }
+  else if (hasIndices) {
+    key.append(1, '[').append(indices);
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(expansionsMutex);
+    auto it = expansions.find(key);
+    if (it != expansions.end() && it->second.source == includeSource) {
+      return it->second.content;
     }
   }
 
-  if (keepProcessing) {
-    _ProcessIncludes(returnValue, options, callback);
+  // Substitution
+  auto includeContent = includeSource;
+  if (!parameters.empty()) {
+    const auto splits = StringTools::split(parameters, ',');
+    for (size_t index = 0; index + 1 < splits.size(); index += 2) {
+      StringTools::replaceInPlace(includeContent, splits[index], splits[index + 1]);
+    }
   }
-  else {
-    callback(returnValue);
+
+  if (isRange) {
+    const auto sourceIncludeContent = includeContent;
+    includeContent.clear();
+    for (int i = minIndex; i < maxIndex; ++i) {
+      includeContent += StringTools::replace(sourceIncludeContent, "{X}", std::to_string(i));
+      includeContent += "\n";
+    }
+  }
+  else if (hasIndices) {
+    StringTools::replaceInPlace(includeContent, "{X}", indices);
   }
+
+  std::lock_guard<std::mutex> lock(expansionsMutex);
+  expansions[key] = Expansion{includeSource, includeContent};
+  return includeContent;
 }
 
 void ShaderProcessor::_FileToolsLoadFile(
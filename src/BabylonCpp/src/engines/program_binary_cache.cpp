@@ -0,0 +1,252 @@
+#include <babylon/engines/program_binary_cache.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <vector>
+
+#include <babylon/core/filesystem.h>
+#include <babylon/core/logging.h>
+
+namespace BABYLON {
+
+namespace {
+
+// Entry file header: magic, version and binary format
+constexpr char EntryMagic[4]         = {'B', 'P', 'B', 'C'};
+constexpr uint32_t EntryVersion      = 1;
+constexpr size_t EntryHeaderSize     = sizeof(EntryMagic) + 2 * sizeof(uint32_t);
+constexpr const char* IndexFileName  = "index.txt";
+constexpr const char* EntryExtension = ".bin";
+
+uint64_t fnv1a(uint64_t hash, const std::string& data)
+{
+  for (auto c : data) {
+    hash = (hash ^ static_cast<uint8_t>(c)) * 1099511628211ull;
+  }
+  // Separator, "ab" + "c" and "a" + "bc" do not hash the same
+  return (hash ^ 0xFFu) * 1099511628211ull;
+}
+
+} // end of anonymous namespace
+
+ProgramBinaryCache::ProgramBinaryCache(const std::string& directory, size_t maxSize)
+    : _directory{directory}
+    , _maxSize{maxSize}
+    , _size{0}
+    , _useCounter{0}
+    , _hits{0}
+    , _misses{0}
+    , _indexIsDirty{false}
+{
+  if (!Filesystem::isDirectory(_directory) && !Filesystem::createDirectory(_directory)) {
+    BABYLON_LOGF_WARN("ProgramBinaryCache", "Unable to create the program cache directory %s",
+                      _directory.c_str())
+  }
+
+  _readIndex();
+}
+
+ProgramBinaryCache::~ProgramBinaryCache()
+{
+  flush();
+}
+
+std::string
+ProgramBinaryCache::ComputeKey(const std::string& vertexSource, const std::string& fragmentSource,
+                               const std::string& glIdentity,
+                               const std::vector<std::string>& transformFeedbackVaryings)
+{
+  // Two 64 bits hashes with different offset bases, a collision would load the wrong program
+  uint64_t hashes[2] = {14695981039346656037ull, 0x9E3779B97F4A7C15ull};
+  for (auto& hash : hashes) {
+    hash = fnv1a(hash, glIdentity);
+    hash = fnv1a(hash, vertexSource);
+    hash = fnv1a(hash, fragmentSource);
+    // The varyings are linked into the binary
+    hash = fnv1a(hash, std::to_string(transformFeedbackVaryings.size()));
+    for (const auto& varying : transformFeedbackVaryings) {
+      hash = fnv1a(hash, varying);
+    }
+  }
+
+  char key[33];
+  std::snprintf(key, sizeof(key), "%016llx%016llx", static_cast<unsigned long long>(hashes[0]),
+                static_cast<unsigned long long>(hashes[1]));
+  return key;
+}
+
+std::string ProgramBinaryCache::_entryPath(const std::string& key) const
+{
+  return Filesystem::joinPath(_directory, key + EntryExtension);
+}
+
+void ProgramBinaryCache::_readIndex()
+{
+  const auto indexPath = Filesystem::joinPath(_directory, std::string(IndexFileName));
+  if (!Filesystem::exists(indexPath)) {
+    return;
+  }
+
+  for (const auto& line : Filesystem::readFileLines(indexPath.c_str())) {
+    std::istringstream stream(line);
+    std::string key;
+    Entry entry;
+    if (!(stream >> key >> entry.size >> entry.lastUsed)) {
+      continue;
+    }
+    // Drop the entries whose file was removed
+    if (Filesystem::fileSize(_entryPath(key)) != entry.size + EntryHeaderSize) {
+      _indexIsDirty = true;
+      continue;
+    }
+    _entries[key] = entry;
+    _size += entry.size;
+    _useCounter = std::max(_useCounter, entry.lastUsed);
+  }
+}
+
+void ProgramBinaryCache::flush()
+{
+  if (!_indexIsDirty) {
+    return;
+  }
+
+  std::vector<std::string> lines;
+  lines.reserve(_entries.size());
+  for (const auto& [key, entry] : _entries) {
+    lines.emplace_back(key + " " + std::to_string(entry.size) + " "
+                       + std::to_string(entry.lastUsed));
+  }
+
+  const auto indexPath = Filesystem::joinPath(_directory, std::string(IndexFileName));
+  if (Filesystem::writeFileLines(indexPath.c_str(), lines)) {
+    _indexIsDirty = false;
+  }
+}
+
+bool ProgramBinaryCache::load(const std::string& key, unsigned int& binaryFormat,
+                              ArrayBuffer& binary)
+{
+  auto it = _entries.find(key);
+  if (it == _entries.end()) {
+    ++_misses;
+    return false;
+  }
+
+  std::ifstream in(_entryPath(key), std::ios::in | std::ios::binary);
+  char header[EntryHeaderSize];
+  uint32_t version = 0;
+  if (in) {
+    in.read(header, EntryHeaderSize);
+    std::memcpy(&version, header + sizeof(EntryMagic), sizeof(uint32_t));
+    std::memcpy(&binaryFormat, header + sizeof(EntryMagic) + sizeof(uint32_t), sizeof(uint32_t));
+  }
+  if (!in || std::memcmp(header, EntryMagic, sizeof(EntryMagic)) != 0
+      || version != EntryVersion) {
+    remove(key);
+    ++_misses;
+    return false;
+  }
+
+  binary.resize(it->second.size);
+  in.read(reinterpret_cast<char*>(binary.data()), static_cast<std::streamsize>(binary.size()));
+  if (!in) {
+    remove(key);
+    ++_misses;
+    return false;
+  }
+
+  it->second.lastUsed = ++_useCounter;
+  _indexIsDirty       = true;
+  ++_hits;
+  return true;
+}
+
+bool ProgramBinaryCache::store(const std::string& key, unsigned int binaryFormat,
+                               const ArrayBuffer& binary)
+{
+  if (binary.empty() || binary.size() > _maxSize) {
+    return false;
+  }
+
+  remove(key);
+  _evict(binary.size());
+
+  // Write to a temporary file first, a reader never sees a partially written entry
+  const auto entryPath     = _entryPath(key);
+  const auto temporaryPath = entryPath + ".tmp";
+  {
+    std::ofstream out(temporaryPath, std::ios::out | std::ios::binary | std::ios::trunc);
+    out.write(EntryMagic, sizeof(EntryMagic));
+    out.write(reinterpret_cast<const char*>(&EntryVersion), sizeof(uint32_t));
+    out.write(reinterpret_cast<const char*>(&binaryFormat), sizeof(uint32_t));
+    out.write(reinterpret_cast<const char*>(binary.data()),
+              static_cast<std::streamsize>(binary.size()));
+    if (!out) {
+      out.close();
+      Filesystem::removeFile(temporaryPath);
+      return false;
+    }
+  }
+  // A stale entry file not listed in the index would make the rename fail on Windows
+  Filesystem::removeFile(entryPath);
+  if (std::rename(temporaryPath.c_str(), entryPath.c_str()) != 0) {
+    Filesystem::removeFile(temporaryPath);
+    return false;
+  }
+
+  _entries[key] = Entry{binary.size(), ++_useCounter};
+  _size += binary.size();
+  _indexIsDirty = true;
+  return true;
+}
+
+void ProgramBinaryCache::remove(const std::string& key)
+{
+  auto it = _entries.find(key);
+  if (it == _entries.end()) {
+    return;
+  }
+
+  Filesystem::removeFile(_entryPath(key));
+  _size -= it->second.size;
+  _entries.erase(it);
+  _indexIsDirty = true;
+}
+
+void ProgramBinaryCache::clear()
+{
+  for (const auto& item : _entries) {
+    Filesystem::removeFile(_entryPath(item.first));
+  }
+  _entries.clear();
+  _size         = 0;
+  _indexIsDirty = true;
+  flush();
+}
+
+void ProgramBinaryCache::_evict(size_t requiredSize)
+{
+  if (_size + requiredSize <= _maxSize) {
+    return;
+  }
+
+  std::vector<std::pair<uint64_t, std::string>> entries;
+  entries.reserve(_entries.size());
+  for (const auto& [key, entry] : _entries) {
+    entries.emplace_back(entry.lastUsed, key);
+  }
+  std::sort(entries.begin(), entries.end());
+
+  for (const auto& entry : entries) {
+    if (_size + requiredSize <= _maxSize) {
+      break;
+    }
+    remove(entry.second);
+  }
+}
+
+} // end of namespace BABYLON
@@ -19,16 +19,22 @@
 #include <babylon/collisions/collision_coordinator.h>
 #include <babylon/collisions/icollision_coordinator.h>
 #include <babylon/core/logging.h>
+#include <babylon/core/thread_pool.h>
 #include <babylon/culling/bounding_box.h>
 #include <babylon/culling/bounding_info.h>
+#include <babylon/culling/bounding_volume_store.h>
+#include <babylon/culling/iactive_mesh_candidate_provider.h>
 #include <babylon/culling/octrees/octree_scene_component.h>
 #include <babylon/culling/ray.h>
+#include <babylon/culling/software_occlusion_culler.h>
 #include <babylon/debug/debug_layer.h>
 #include <babylon/engines/constants.h>
 #include <babylon/engines/engine.h>
 #include <babylon/engines/engine_store.h>
 #include <babylon/engines/iscene_component.h>
 #include <babylon/engines/iscene_serializable_component.h>
+#include <babylon/engines/shader_warm_up.h>
+#include <babylon/engines/snapshot_rendering_stream.h>
 #include <babylon/events/keyboard_event_types.h>
 #include <babylon/events/keyboard_info_pre.h>
 #include <babylon/events/pointer_event_types.h>
@@ -44,6 +50,7 @@
 #include <babylon/lensflares/lens_flare_system.h>
 #include <babylon/lights/hemispheric_light.h>
 #include <babylon/lights/light.h>
+#include <babylon/lights/light_spatial_index.h>
 #include <babylon/lights/shadows/shadow_generator.h>
 #include <babylon/materials/effect.h>
 #include <babylon/materials/image_processing_configuration.h>
@@ -63,8 +70,10 @@
 #include <babylon/meshes/buffer.h>
 #include <babylon/meshes/geometry.h>
 #include <babylon/meshes/mesh_simplification_scene_component.h>
+#include <babylon/meshes/optimization/meshlet_builder.h>
 #include <babylon/meshes/simplification/simplification_queue.h>
 #include <babylon/meshes/sub_mesh.h>
+#include <babylon/meshes/transform_system.h>
 #include <babylon/meshes/vertex_buffer.h>
 #include <babylon/misc/guid.h>
 #include <babylon/misc/tools.h>
@@ -92,6 +101,12 @@ namespace BABYLON {
 
 size_t Scene::_uniqueIdCounter = 0;
 
+// States of the active mesh candidates computed by the batch evaluation
+static constexpr uint8_t ACTIVEMESH_CANDIDATE_SKIPPED        = 0;
+static constexpr uint8_t ACTIVEMESH_CANDIDATE_EVALUATED      = 1;
+static constexpr uint8_t ACTIVEMESH_CANDIDATE_FRUSTUM_TESTED = 2;
+static constexpr uint8_t ACTIVEMESH_CANDIDATE_IN_FRUSTUM     = 4;
+
 microseconds_t Scene::MinDeltaTime = std::chrono::milliseconds(1);
 microseconds_t Scene::MaxDeltaTime = std::chrono::milliseconds(1000);
 
@@ -120,6 +135,9 @@ Scene::Scene(Engine* engine, const std::optional<SceneOptions>& options)
     , pointerMovePredicate{nullptr}
     , forceWireframe{this, &Scene::get_forceWireframe, &Scene::set_forceWireframe}
     , skipFrustumClipping{this, &Scene::get_skipFrustumClipping, &Scene::set_skipFrustumClipping}
+    , parallelActiveMeshesEvaluation{false}
+    , parallelActiveMeshesEvaluationThreshold{1024}
+    , automaticInstancing{false}
     , forcePointsCloud{this, &Scene::get_forcePointsCloud, &Scene::set_forcePointsCloud}
     , forceShowBoundingBoxes{this, &Scene::get_forceShowBoundingBoxes,
                              &Scene::set_forceShowBoundingBoxes}
@@ -277,6 +295,7 @@ Scene::Scene(Engine* engine, const std::optional<SceneOptions>& options)
     , _alternateProjectionUpdateFlag{-1}
     , _isDisposed{false}
     , _activeMeshCandidateProvider{nullptr}
+    , _lightSpatialIndex{nullptr}
     , _preventFreeActiveMeshesAndRenderingGroups{false}
     , _skipEvaluateActiveMeshesCompletely{false}
     , _renderingManager{nullptr}
@@ -2045,6 +2064,13 @@ void Scene::_checkIsReady()
   }
 }
 
+ShaderWarmUp* Scene::warmUpShaders(const IShaderWarmUpOptions& options)
+{
+  _shaderWarmUp = std::make_unique<ShaderWarmUp>(this, options);
+  _shaderWarmUp->step();
+  return _shaderWarmUp.get();
+}
+
 std::vector<AnimationPtr> Scene::getAnimations()
 {
   return std::vector<AnimationPtr>();
@@ -2514,6 +2540,13 @@ void Scene::addMesh(const AbstractMeshPtr& newMesh, bool recursive)
   }
 
   meshes.emplace_back(newMesh);
+  _engine->snapshotRenderingReset();
+
+  if (_boundingVolumeStore
+      && newMesh->_boundingVolumeStoreSlot == BoundingVolumeStore::InvalidSlot) {
+    newMesh->_boundingVolumeStoreSlot = _boundingVolumeStore->allocate();
+    newMesh->_syncBoundingVolumeStore();
+  }
 
   newMesh->_resyncLightSources();
 
@@ -2544,6 +2577,17 @@ int Scene::removeMesh(AbstractMesh* toRemove, bool recursive)
   if (it != meshes.end()) {
     // Remove from the scene if mesh found
     meshes.erase(it);
+    _engine->snapshotRenderingReset();
+
+    if (_boundingVolumeStore
+        && toRemove->_boundingVolumeStoreSlot != BoundingVolumeStore::InvalidSlot) {
+      _boundingVolumeStore->release(toRemove->_boundingVolumeStoreSlot);
+      toRemove->_boundingVolumeStoreSlot = BoundingVolumeStore::InvalidSlot;
+    }
+
+    if (_softwareOcclusionCuller) {
+      _softwareOcclusionCuller->removeOccluder(toRemove);
+    }
 
     if (!toRemove->parent()) {
       toRemove->_removeFromSceneRootNodes();
@@ -2660,6 +2704,7 @@ int Scene::removeLight(Light* toRemove)
     // Remove from the scene if mesh found
     lights.erase(it);
     sortLightsByPriority();
+    _engine->snapshotRenderingReset();
 
     if (!toRemove->parent()) {
       toRemove->_removeFromSceneRootNodes();
@@ -2683,6 +2728,7 @@ int Scene::removeCamera(Camera* toRemove)
   if (it1 != cameras.end()) {
     // Remove from the scene if camera found
     cameras.erase(it1);
+    _snapshotRenderingStreams.erase(toRemove);
     if (!toRemove->parent()) {
       toRemove->_removeFromSceneRootNodes();
     }
@@ -2773,6 +2819,7 @@ int Scene::removeMaterial(Material* toRemove)
 
     toRemove->_indexInSceneMaterialArray = -1;
     materials.pop_back();
+    _engine->snapshotRenderingReset();
   }
 
   onMaterialRemovedObservable.notifyObservers(toRemove);
@@ -2824,16 +2871,20 @@ void Scene::addLight(const LightPtr& newLight)
   }
   lights.emplace_back(newLight);
   sortLightsByPriority();
+  _engine->snapshotRenderingReset();
 
   if (!newLight->parent()) {
     newLight->_addToSceneRootNodes();
   }
 
-  // Add light to all meshes (To support if the light is removed and then re-added)
-  for (const auto& mesh : meshes) {
-    if (!stl_util::contains(mesh->_lightSources, newLight)) {
-      mesh->_lightSources.emplace_back(newLight);
-      mesh->_resyncLightSources();
+  // Add light to all meshes (To support if the light is removed and then re-added), the light
+  // spatial index only resynchronizes the meshes in the influence of the light
+  if (!_lightSpatialIndex) {
+    for (const auto& mesh : meshes) {
+      if (!stl_util::contains(mesh->_lightSources, newLight)) {
+        mesh->_lightSources.emplace_back(newLight);
+        mesh->_resyncLightSources();
+      }
     }
   }
 
@@ -2913,6 +2964,7 @@ void Scene::addMaterial(const MaterialPtr& newMaterial)
 
   newMaterial->_indexInSceneMaterialArray = static_cast<int>(materials.size());
   materials.emplace_back(newMaterial);
+  _engine->snapshotRenderingReset();
   onNewMaterialAddedObservable.notifyObservers(newMaterial.get());
 }
 
@@ -3648,12 +3700,68 @@ void Scene::_evaluateSubMesh(SubMesh* subMesh, AbstractMesh* mesh, AbstractMesh*
         }
       }
 
+      // Meshlets
+      if (!_cullMeshlets(subMesh, mesh, initialMesh, material)) {
+        return;
+      }
+
       // Dispatch
       _renderingManager->dispatch(subMesh, mesh, material);
     }
   }
 }
 
+bool Scene::_cullMeshlets(SubMesh* subMesh, AbstractMesh* mesh, AbstractMesh* initialMesh,
+                          const MaterialPtr& material)
+{
+  subMesh->_meshletDrawRangesFrameId = -1;
+
+  // The draw ranges are only used by the non instanced draw calls of the camera
+  if (subMesh->_meshlets.empty() || !_activeCamera || initialMesh->hasInstances()
+      || initialMesh->isAnInstance() || mesh->hasThinInstances() || _skipFrustumClipping
+      || mesh->alwaysSelectAsActiveMesh) {
+    return true;
+  }
+
+  const auto& renderingMesh = subMesh->getRenderingMesh();
+  if (!renderingMesh) {
+    return true;
+  }
+
+  const auto& options = renderingMesh->meshletCulling;
+
+  // The normal cones follow the winding of VertexData::ComputeNormals for a left handed system
+  const auto orientation      = renderingMesh->overrideMaterialSideOrientation.value_or(
+    static_cast<unsigned int>(material->sideOrientation));
+  const auto canCullBackFaces = !useRightHandedSystem() && material->backFaceCulling()
+                                && orientation == Material::ClockWiseSideOrientation;
+
+  auto cullingOptions            = options;
+  cullingOptions.backfaceCulling = options.backfaceCulling && canCullBackFaces;
+
+  // The occluders depth buffer is rendered before the meshes are evaluated, the bounding boxes of
+  // the meshlets spheres are tested against it after the user test
+  if (_softwareOcclusionCuller && _softwareOcclusionCuller->occluderCount() > 0
+      && !_softwareOcclusionCuller->isOccluder(mesh)) {
+    const auto& occlusionCuller = *_softwareOcclusionCuller;
+    cullingOptions.occlusionTest
+      = [&occlusionCuller, &options](const Vector3& center, float radius) {
+          if (options.occlusionTest && !options.occlusionTest(center, radius)) {
+            return false;
+          }
+          const Vector3 extend(radius, radius, radius);
+          return !occlusionCuller.isOccluded(center.subtract(extend), center.add(extend));
+        };
+  }
+
+  const auto visibleCount = MeshletBuilder::CullMeshlets(
+    subMesh->_meshlets, mesh->getWorldMatrix(), _frustumPlanes, _activeCamera->globalPosition(),
+    cullingOptions, subMesh->_meshletDrawRanges);
+
+  subMesh->_meshletDrawRangesFrameId = getFrameId();
+  return visibleCount > 0;
+}
+
 void Scene::setActiveMeshCandidateProvider(IActiveMeshCandidateProvider* provider)
 {
   _activeMeshCandidateProvider = provider;
@@ -3664,6 +3772,95 @@ IActiveMeshCandidateProvider* Scene::getActiveMeshCandidateProvider() const
   return _activeMeshCandidateProvider;
 }
 
+void Scene::setLightSpatialIndex(LightSpatialIndex* index)
+{
+  _lightSpatialIndex = index;
+
+  for (const auto& mesh : meshes) {
+    mesh->_resyncLightSources();
+  }
+}
+
+LightSpatialIndex* Scene::getLightSpatialIndex() const
+{
+  return _lightSpatialIndex;
+}
+
+BoundingVolumeStore* Scene::enableBoundingVolumeStore()
+{
+  if (!_boundingVolumeStore) {
+    _boundingVolumeStore = std::make_unique<BoundingVolumeStore>();
+    for (const auto& mesh : meshes) {
+      mesh->_boundingVolumeStoreSlot = _boundingVolumeStore->allocate();
+      mesh->_syncBoundingVolumeStore();
+    }
+  }
+
+  return _boundingVolumeStore.get();
+}
+
+void Scene::disableBoundingVolumeStore()
+{
+  if (!_boundingVolumeStore) {
+    return;
+  }
+
+  for (const auto& mesh : meshes) {
+    mesh->_boundingVolumeStoreSlot = BoundingVolumeStore::InvalidSlot;
+  }
+  _boundingVolumeStore = nullptr;
+  _boundingVolumesVisibility.clear();
+}
+
+BoundingVolumeStore* Scene::getBoundingVolumeStore() const
+{
+  return _boundingVolumeStore.get();
+}
+
+TransformSystem* Scene::enableTransformSystem()
+{
+  if (!_transformSystem) {
+    _transformSystem = std::make_unique<TransformSystem>(this);
+  }
+
+  return _transformSystem.get();
+}
+
+void Scene::disableTransformSystem()
+{
+  _transformSystem = nullptr;
+}
+
+TransformSystem* Scene::getTransformSystem() const
+{
+  return _transformSystem.get();
+}
+
+SoftwareOcclusionCuller* Scene::enableSoftwareOcclusionCulling(size_t width, size_t height)
+{
+  if (!_softwareOcclusionCuller) {
+    _softwareOcclusionCuller = std::make_unique<SoftwareOcclusionCuller>(width, height);
+  }
+
+  return _softwareOcclusionCuller.get();
+}
+
+void Scene::disableSoftwareOcclusionCulling()
+{
+  _softwareOcclusionCuller = nullptr;
+}
+
+SoftwareOcclusionCuller* Scene::getSoftwareOcclusionCuller() const
+{
+  return _softwareOcclusionCuller.get();
+}
+
+SnapshotRenderingStream* Scene::getSnapshotRenderingStream(Camera* camera) const
+{
+  const auto it = _snapshotRenderingStreams.find(camera);
+  return it != _snapshotRenderingStreams.end() ? it->second.get() : nullptr;
+}
+
 Scene& Scene::freezeActiveMeshes(bool skipEvaluateActiveMeshes,
                                  const std::function<void()>& onSuccess,
                                  const std::function<void(const std::string& message)> onError)
@@ -3745,23 +3942,53 @@ void Scene::_evaluateActiveMeshes()
     step.action();
   }
 
+  // Update the world matrices of the dirty sub trees in one pass
+  if (_transformSystem) {
+    _transformSystem->update(parallelActiveMeshesEvaluation ? &_engine->getThreadPool() : nullptr);
+  }
+
   // Determine mesh candidates
-  auto _meshes = getActiveMeshCandidates();
+  auto _meshes = _activeMeshCandidateProvider ? _activeMeshCandidateProvider->getMeshes(this) :
+                                                getActiveMeshCandidates();
+
+  // World matrices and frustum clipping on worker threads and / or in one batch
+  const auto useBatchEvaluation
+    = (parallelActiveMeshesEvaluation
+       && _meshes.size() >= parallelActiveMeshesEvaluationThreshold)
+      || _boundingVolumeStore;
+  if (useBatchEvaluation) {
+    _evaluateActiveMeshCandidates(_meshes);
+  }
+
+  // Occluders depth buffer, tested after the frustum clipping
+  const auto useSoftwareOcclusionCulling = _softwareOcclusionCuller && !_skipFrustumClipping
+                                           && _softwareOcclusionCuller->occluderCount() > 0;
+  if (useSoftwareOcclusionCulling) {
+    _softwareOcclusionCuller->render(getTransformMatrix(), _engine->useReverseDepthBuffer);
+  }
 
   // Check each mesh
-  for (const auto& mesh : _meshes) {
-    mesh->_internalAbstractMeshDataInfo._currentLODIsUpToDate = false;
-    if (mesh->isBlocked()) {
-      continue;
+  for (size_t meshIndex = 0; meshIndex < _meshes.size(); ++meshIndex) {
+    const auto& mesh = _meshes[meshIndex];
+    if (useBatchEvaluation) {
+      if (_activeMeshCandidatesStates[meshIndex] == ACTIVEMESH_CANDIDATE_SKIPPED) {
+        continue;
+      }
     }
+    else {
+      mesh->_internalAbstractMeshDataInfo._currentLODIsUpToDate = false;
+      if (mesh->isBlocked()) {
+        continue;
+      }
 
-    _totalVertices.addCount(mesh->getTotalVertices(), false);
+      _totalVertices.addCount(mesh->getTotalVertices(), false);
 
-    if (!mesh->isReady() || !mesh->isEnabled() || mesh->scaling().lengthSquared() == 0.f) {
-      continue;
-    }
+      if (!mesh->isReady() || !mesh->isEnabled() || mesh->scaling().lengthSquared() == 0.f) {
+        continue;
+      }
 
-    mesh->computeWorldMatrix();
+      mesh->computeWorldMatrix();
+    }
 
     // Intersections
     if (mesh->actionManager
@@ -3794,7 +4021,15 @@ void Scene::_evaluateActiveMeshes()
         && (mesh->alwaysSelectAsActiveMesh
             || ((mesh->layerMask & _activeCamera->layerMask) != 0
                 && (_skipFrustumClipping || mesh->alwaysSelectAsActiveMesh
-                    || mesh->isInFrustum(_frustumPlanes))))) {
+                    || ((useBatchEvaluation
+                         && (_activeMeshCandidatesStates[meshIndex]
+                             & ACTIVEMESH_CANDIDATE_FRUSTUM_TESTED)) ?
+                          (_activeMeshCandidatesStates[meshIndex]
+                           & ACTIVEMESH_CANDIDATE_IN_FRUSTUM)
+                            != 0 :
+                          mesh->isInFrustum(_frustumPlanes)))
+                && !(useSoftwareOcclusionCulling
+                     && _softwareOcclusionCuller->isOccluded(mesh))))) {
       _activeMeshes.emplace_back(mesh);
       _activeCamera->_activeMeshes.emplace_back(mesh);
 
@@ -3844,6 +4079,126 @@ void Scene::_evaluateActiveMeshes()
   }
 }
 
+void Scene::_evaluateActiveMeshCandidates(const std::vector<AbstractMesh*>& candidates)
+{
+  auto& states = _activeMeshCandidatesStates;
+  states.assign(candidates.size(), ACTIVEMESH_CANDIDATE_SKIPPED);
+
+  // Filter the candidates on the calling thread (same rules as the sequential path) and group them
+  // by hierarchy depth so that parents are always up to date before their children
+  std::vector<std::vector<size_t>> levels;
+  for (size_t meshIndex = 0; meshIndex < candidates.size(); ++meshIndex) {
+    const auto& mesh                                          = candidates[meshIndex];
+    mesh->_internalAbstractMeshDataInfo._currentLODIsUpToDate = false;
+    if (mesh->isBlocked()) {
+      continue;
+    }
+
+    _totalVertices.addCount(mesh->getTotalVertices(), false);
+
+    if (!mesh->isReady() || !mesh->isEnabled() || mesh->scaling().lengthSquared() == 0.f) {
+      continue;
+    }
+
+    states[meshIndex] = ACTIVEMESH_CANDIDATE_EVALUATED;
+    size_t depth      = 0;
+    for (auto ancestor = mesh->parent(); ancestor; ancestor = ancestor->parent()) {
+      ++depth;
+    }
+    if (levels.size() <= depth) {
+      levels.resize(depth + 1);
+    }
+    levels[depth].emplace_back(meshIndex);
+  }
+
+  const auto useThreadPool = parallelActiveMeshesEvaluation
+                             && candidates.size() >= parallelActiveMeshesEvaluationThreshold;
+  const auto useBoundingVolumeStore = _boundingVolumeStore && !_skipFrustumClipping;
+
+  const auto testFrustum = [this, &candidates, &states](size_t meshIndex) {
+    const auto& mesh = candidates[meshIndex];
+    if (!_skipFrustumClipping && !mesh->alwaysSelectAsActiveMesh) {
+      states[meshIndex] |= mesh->isInFrustum(_frustumPlanes) ?
+                             ACTIVEMESH_CANDIDATE_FRUSTUM_TESTED | ACTIVEMESH_CANDIDATE_IN_FRUSTUM :
+                             ACTIVEMESH_CANDIDATE_FRUSTUM_TESTED;
+    }
+  };
+  // With the bounding volume store, the frustum test is done in one pass once all the world
+  // matrices are up to date
+  const auto evaluate = [&candidates, &testFrustum, useBoundingVolumeStore](size_t meshIndex) {
+    candidates[meshIndex]->computeWorldMatrix();
+    if (!useBoundingVolumeStore) {
+      testFrustum(meshIndex);
+    }
+  };
+
+  auto* threadPool = useThreadPool ? &_engine->getThreadPool() : nullptr;
+  std::vector<size_t> concurrentIndices;
+  for (const auto& level : levels) {
+    concurrentIndices.clear();
+    for (const auto meshIndex : level) {
+      const auto& mesh = candidates[meshIndex];
+      if (!threadPool || !mesh->_canComputeWorldMatrixConcurrently()) {
+        evaluate(meshIndex);
+        continue;
+      }
+      // Parents that are not candidates themselves are updated here, the workers only read them
+      if (auto iParent = mesh->parent()) {
+        iParent->computeWorldMatrix();
+      }
+      mesh->_deferWorldMatrixSideEffects = true;
+      concurrentIndices.emplace_back(meshIndex);
+    }
+
+    // Each chunk writes the states of its own contiguous range of candidates
+    if (threadPool) {
+      threadPool->parallelFor(concurrentIndices.size(), 64,
+                              [&concurrentIndices, &evaluate](size_t /*chunkIndex*/, size_t begin,
+                                                              size_t end) {
+                                for (auto i = begin; i < end; ++i) {
+                                  evaluate(concurrentIndices[i]);
+                                }
+                              });
+      // The shared state (material defines) is only updated once the workers are joined
+      for (const auto meshIndex : concurrentIndices) {
+        candidates[meshIndex]->_applyDeferredWorldMatrixSideEffects();
+      }
+    }
+  }
+
+  if (!useBoundingVolumeStore) {
+    return;
+  }
+
+  // Batch frustum culling: candidates outside of their conservative bounding volumes are culled,
+  // the exact per mesh test is only run for the potentially visible ones
+  _boundingVolumeStore->cull(_frustumPlanes, _boundingVolumesVisibility);
+  concurrentIndices.clear();
+  for (size_t meshIndex = 0; meshIndex < candidates.size(); ++meshIndex) {
+    const auto& mesh = candidates[meshIndex];
+    if (states[meshIndex] == ACTIVEMESH_CANDIDATE_SKIPPED || mesh->alwaysSelectAsActiveMesh) {
+      continue;
+    }
+    const auto slot = mesh->_boundingVolumeStoreSlot;
+    if (slot != BoundingVolumeStore::InvalidSlot
+        && !BoundingVolumeStore::IsVisible(_boundingVolumesVisibility, slot)) {
+      states[meshIndex] |= ACTIVEMESH_CANDIDATE_FRUSTUM_TESTED;
+    }
+    else if (threadPool && mesh->_canComputeWorldMatrixConcurrently()) {
+      concurrentIndices.emplace_back(meshIndex);
+    }
+  }
+  if (threadPool) {
+    threadPool->parallelFor(concurrentIndices.size(), 64,
+                            [&concurrentIndices, &testFrustum](size_t /*chunkIndex*/, size_t begin,
+                                                               size_t end) {
+                              for (auto i = begin; i < end; ++i) {
+                                testFrustum(concurrentIndices[i]);
+                              }
+                            });
+  }
+}
+
 void Scene::_activeMesh(AbstractMesh* sourceMesh, AbstractMesh* mesh)
 {
   if (_skeletonsEnabled && mesh->skeleton()) {
@@ -3948,12 +4303,29 @@ void Scene::_renderForCamera(const CameraPtr& camera, const CameraPtr& rigParent
   }
   onBeforeCameraRenderObservable.notifyObservers(_activeCamera.get());
 
-  // Meshes
-  _evaluateActiveMeshes();
+  // Snapshot rendering: the draw stream recorded for the camera is replayed as long as the
+  // snapshot is not reset (and no rendered mesh moved in standard mode)
+  SnapshotRenderingStream* snapshotStream = nullptr;
+  auto replaySnapshot                     = false;
+  if (engine->snapshotRendering() && getSceneUniformBuffer()->useUbo()) {
+    auto& stream = _snapshotRenderingStreams[camera.get()];
+    if (!stream) {
+      stream = std::make_unique<SnapshotRenderingStream>(camera.get());
+    }
+    snapshotStream = stream.get();
+    replaySnapshot = snapshotStream->isValidFor(camera.get(), engine->_snapshotRenderingGeneration)
+                     && (engine->snapshotRenderingMode() == Constants::SNAPSHOTRENDERING_FAST
+                         || !snapshotStream->hasMovedMeshes());
+  }
+
+  if (!replaySnapshot) {
+    // Meshes
+    _evaluateActiveMeshes();
 
-  // Software skinning
-  for (const auto& mesh : _softwareSkinnedMeshes) {
-    mesh->applySkeleton(mesh->skeleton());
+    // Software skinning
+    for (const auto& mesh : _softwareSkinnedMeshes) {
+      mesh->applySkeleton(mesh->skeleton());
+    }
   }
 
   // Render targets
@@ -4023,7 +4395,21 @@ void Scene::_renderForCamera(const CameraPtr& camera, const CameraPtr& rigParent
 
   // Render
   onBeforeDrawPhaseObservable.notifyObservers(this);
-  _renderingManager->render(nullptr, {}, true, true);
+  if (replaySnapshot) {
+    // Only the camera data changes between the replays
+    finalizeSceneUbo();
+    snapshotStream->replay(*engine);
+  }
+  else if (snapshotStream && isReady()) {
+    engine->_beginSnapshotRecording(snapshotStream);
+    snapshotStream->addLiveBuffer(getSceneUniformBuffer()->getBuffer());
+    _renderingManager->render(nullptr, {}, true, true);
+    engine->_endSnapshotRecording();
+    snapshotStream->endRecording(_activeMeshes);
+  }
+  else {
+    _renderingManager->render(nullptr, {}, true, true);
+  }
   onAfterDrawPhaseObservable.notifyObservers(this);
 
   // After Camera Draw
@@ -4145,6 +4531,11 @@ void Scene::render(bool updateCameras, bool ignoreAnimations)
     _checkIsReady();
   }
 
+  // Shader warm-up
+  if (_shaderWarmUp) {
+    _shaderWarmUp->step();
+  }
+
   ++_frameId;
 
   // Register components that have been associated lately to the scene.
@@ -4201,6 +4592,11 @@ void Scene::render(bool updateCameras, bool ignoreAnimations)
   // Before render
   onBeforeRenderObservable.notifyObservers(this);
 
+  // Light sources of the moved meshes and lights
+  if (_lightSpatialIndex) {
+    _lightSpatialIndex->update();
+  }
+
   // Customs render targets
   onBeforeRenderTargetsRenderObservable.notifyObservers(this);
   auto engine              = getEngine();
@@ -4510,6 +4906,8 @@ void Scene::dispose()
   _pointerDownStage.clear();
   _pointerUpStage.clear();
 
+  _shaderWarmUp = nullptr;
+
   for (const auto& component : _components) {
     component->dispose();
   }
@@ -4578,6 +4976,7 @@ void Scene::dispose()
   onTransformNodeRemovedObservable.clear();
   onNewMeshAddedObservable.clear();
   onMeshRemovedObservable.clear();
+  onMeshBoundingInfoChangedObservable.clear();
   onNewSkeletonAddedObservable.clear();
   onSkeletonRemovedObservable.clear();
   onNewMaterialAddedObservable.clear();
@@ -4756,11 +5155,9 @@ Scene::getWorldExtends(const std::function<bool(const AbstractMeshPtr& mesh)>& f
                                   filterPredicate :
                                   [](const AbstractMeshPtr& /*mesh*/) -> bool { return true; };
   std::vector<AbstractMeshPtr> filteredMeshes;
-  if (filterPredicate) {
-    for (const auto& mesh : meshes) {
-      if (_filterPredicate(mesh)) {
-        filteredMeshes.emplace_back(mesh);
-      }
+  for (const auto& mesh : meshes) {
+    if (_filterPredicate(mesh)) {
+      filteredMeshes.emplace_back(mesh);
     }
   }
 
@@ -0,0 +1,240 @@
+#include <babylon/engines/shader_warm_up.h>
+
+#include <babylon/babylon_stl_util.h>
+#include <babylon/core/logging.h>
+#include <babylon/core/time.h>
+#include <babylon/engines/engine.h>
+#include <babylon/engines/scene.h>
+#include <babylon/instrumentation/engine_instrumentation.h>
+#include <babylon/lights/light.h>
+#include <babylon/lights/shadows/shadow_generator.h>
+#include <babylon/materials/draw_wrapper.h>
+#include <babylon/materials/effect.h>
+#include <babylon/materials/material.h>
+#include <babylon/materials/shadow_depth_wrapper.h>
+#include <babylon/materials/textures/render_target_texture.h>
+#include <babylon/meshes/mesh.h>
+#include <babylon/meshes/sub_mesh.h>
+
+namespace BABYLON {
+
+ShaderWarmUp::ShaderWarmUp(Scene* scene, const IShaderWarmUpOptions& options)
+    : _scene{scene}
+    , _options{options}
+    , _totalCount{0}
+    , _readyCount{0}
+    , _failedCount{0}
+    , _elapsedTime{0.0}
+    , _compiledProgramCount{0}
+    , _shaderCompilationTime{0}
+{
+  // The compilations of the warm-up are measured by a dedicated instrumentation
+  _instrumentation = std::make_unique<EngineInstrumentation>(scene->getEngine());
+  _instrumentation->captureShaderCompilationTime = true;
+
+  _enumerate();
+}
+
+ShaderWarmUp::~ShaderWarmUp() = default;
+
+void ShaderWarmUp::_enumerate()
+{
+  const auto instancedArrays = _scene->getEngine()->getCaps().instancedArrays;
+
+  for (const auto& abstractMesh : _scene->meshes) {
+    // The instances are rendered with the effects of their source mesh
+    const auto mesh = std::dynamic_pointer_cast<Mesh>(abstractMesh);
+    if (!mesh || mesh->subMeshes.empty()) {
+      continue;
+    }
+
+    mesh->computeWorldMatrix();
+
+    const auto useInstances
+      = instancedArrays && (!mesh->instances.empty() || mesh->hasThinInstances());
+
+    for (const auto& subMesh : mesh->subMeshes) {
+      const auto material = subMesh->getMaterial();
+      if (!material) {
+        continue;
+      }
+
+      Combination combination;
+      combination.mesh         = mesh;
+      combination.subMesh      = subMesh;
+      combination.material     = material;
+      combination.useInstances = useInstances;
+      _pending.emplace_back(combination);
+    }
+
+    if (!_options.shadowGenerators) {
+      continue;
+    }
+
+    for (const auto& light : mesh->lightSources()) {
+      const auto generator = light->getShadowGenerator();
+      if (!generator || !generator->getShadowMap()) {
+        continue;
+      }
+
+      const auto& renderList = generator->getShadowMap()->renderList();
+      if (!renderList.empty() && !stl_util::contains(renderList, mesh.get())) {
+        continue;
+      }
+
+      for (const auto& subMesh : mesh->subMeshes) {
+        const auto material = subMesh->getMaterial();
+
+        Combination combination;
+        combination.mesh            = mesh;
+        combination.subMesh         = subMesh;
+        combination.material        = material;
+        combination.shadowGenerator = generator;
+        combination.useInstances    = useInstances;
+        combination.isTransparent   = material && material->needAlphaBlendingForMesh(*mesh);
+        _pending.emplace_back(combination);
+      }
+    }
+  }
+
+  _totalCount = _pending.size();
+}
+
+ShaderWarmUp::State ShaderWarmUp::_Prepare(const Combination& combination)
+{
+  const auto& mesh     = combination.mesh;
+  const auto& subMesh  = combination.subMesh;
+  const auto& material = combination.material;
+
+  bool isReady = false;
+  if (combination.shadowGenerator) {
+    isReady = combination.shadowGenerator->isReady(subMesh.get(), combination.useInstances,
+                                                   combination.isTransparent);
+  }
+  else if (!material->_storeEffectOnSubMeshes) {
+    isReady = material->isReady(mesh.get(), combination.useInstances);
+  }
+  else {
+    isReady = material->isReadyForSubMesh(mesh.get(), subMesh.get(), combination.useInstances);
+  }
+
+  if (isReady) {
+    return State::Ready;
+  }
+
+  // Do not wait for an effect which cannot be compiled
+  const auto effect = _GetEffect(combination);
+  if (effect && !effect->getCompilationError().empty() && effect->allFallbacksProcessed()) {
+    return State::Failed;
+  }
+
+  return State::Pending;
+}
+
+EffectPtr ShaderWarmUp::_GetEffect(const Combination& combination)
+{
+  const auto& subMesh  = combination.subMesh;
+  const auto& material = combination.material;
+
+  if (combination.shadowGenerator) {
+    // The effects of the shadow maps are stored on the submeshes by the shadow generators
+    const auto generator = std::dynamic_pointer_cast<ShadowGenerator>(combination.shadowGenerator);
+    if (!generator) {
+      return nullptr;
+    }
+    const auto drawWrapper = (material && material->shadowDepthWrapper) ?
+                               material->shadowDepthWrapper->getEffect(subMesh.get(),
+                                                                       generator.get()) :
+                               subMesh->_getDrawWrapper(generator->_nameForDrawWrapper);
+    return drawWrapper ? drawWrapper->effect : nullptr;
+  }
+
+  return material->_storeEffectOnSubMeshes ? subMesh->effect() : material->getEffect();
+}
+
+bool ShaderWarmUp::step()
+{
+  if (!_instrumentation) {
+    return true;
+  }
+
+  const auto start = Time::highresTimepointNow();
+
+  // Each combination is checked once per step, the pending ones are checked again on the next
+  // step while their shaders are processed on the engine thread pool
+  for (auto count = _pending.size(); count > 0 && !_pending.empty(); --count) {
+    const auto combination = _pending.front();
+    _pending.pop_front();
+
+    switch (_Prepare(combination)) {
+      case State::Ready:
+        ++_readyCount;
+        break;
+      case State::Failed:
+        ++_failedCount;
+        break;
+      case State::Pending:
+        if (_options.maxAttempts > 0 && combination.attempts + 1 >= _options.maxAttempts) {
+          BABYLON_LOGF_WARN("ShaderWarmUp",
+                            "Gave up preparing the effect of mesh '%s' after %zu attempts",
+                            combination.mesh->name.c_str(), _options.maxAttempts)
+          ++_failedCount;
+        }
+        else {
+          _pending.emplace_back(combination);
+          ++_pending.back().attempts;
+        }
+        break;
+    }
+
+    if (_options.frameTimeBudget > 0.f
+        && Time::fpTimeSince<float, std::milli>(start) >= _options.frameTimeBudget) {
+      break;
+    }
+  }
+
+  _elapsedTime += Time::fpTimeSince<double, std::milli>(start);
+
+  if (_options.onProgress) {
+    _options.onProgress(*this);
+  }
+
+  if (!isDone()) {
+    return false;
+  }
+
+  // The measures are kept once the instrumentation is released
+  _compiledProgramCount  = _instrumentation->shaderCompilationTimeCounter().count();
+  _shaderCompilationTime = _instrumentation->shaderCompilationTimeCounter().total();
+  _instrumentation->dispose();
+  _instrumentation = nullptr;
+
+  if (_options.onCompleted) {
+    _options.onCompleted(*this);
+  }
+
+  return true;
+}
+
+float ShaderWarmUp::progress() const
+{
+  if (_totalCount == 0) {
+    return 1.f;
+  }
+
+  return static_cast<float>(_readyCount + _failedCount) / static_cast<float>(_totalCount);
+}
+
+size_t ShaderWarmUp::compiledProgramCount() const
+{
+  return _instrumentation ? _instrumentation->shaderCompilationTimeCounter().count() :
+                            _compiledProgramCount;
+}
+
+size_t ShaderWarmUp::shaderCompilationTime() const
+{
+  return _instrumentation ? _instrumentation->shaderCompilationTimeCounter().total() :
+                            _shaderCompilationTime;
+}
+
+} // end of namespace BABYLON
@@ -0,0 +1,405 @@
+#include <babylon/engines/snapshot_rendering_stream.h>
+
+#include <babylon/engines/thin_engine.h>
+#include <babylon/engines/webgl/webgl_pipeline_context.h>
+#include <babylon/materials/effect.h>
+#include <babylon/meshes/abstract_mesh.h>
+#include <babylon/meshes/webgl/webgl_data_buffer.h>
+#include <babylon/states/alpha_state.h>
+#include <babylon/states/depth_culling_state.h>
+
+namespace BABYLON {
+
+SnapshotRenderingStream::SnapshotRenderingStream(Camera* camera)
+    : _camera{camera}, _generation{0}, _recorded{false}, _drawCount{0}
+{
+}
+
+SnapshotRenderingStream::~SnapshotRenderingStream() = default;
+
+bool SnapshotRenderingStream::isValidFor(Camera* camera, size_t generation) const
+{
+  return _recorded && _camera == camera && _generation == generation;
+}
+
+bool SnapshotRenderingStream::isRecorded() const
+{
+  return _recorded;
+}
+
+void SnapshotRenderingStream::addLiveBuffer(const WebGLDataBufferPtr& buffer)
+{
+  if (buffer) {
+    _liveBuffers.emplace_back(buffer);
+  }
+}
+
+void SnapshotRenderingStream::beginRecording(size_t generation)
+{
+  _generation = generation;
+  _recorded   = false;
+  _drawCount  = 0;
+  _liveBuffers.clear();
+  _commands.clear();
+  _effects.clear();
+  _uniforms.clear();
+  _textures.clear();
+  _textureArrays.clear();
+  _vertexArrays.clear();
+  _buffers.clear();
+  _vertexBuffersBindings.clear();
+  _states.clear();
+  _floats.clear();
+  _floatArrays.clear();
+  _intArrays.clear();
+  _names.clear();
+  _effectIndices.clear();
+  _uniformIndices.clear();
+  _textureIndices.clear();
+  _vertexArrayIndices.clear();
+  _bufferIndices.clear();
+  _meshes.clear();
+  _worldMatrixFlags.clear();
+}
+
+void SnapshotRenderingStream::endRecording(const std::vector<AbstractMesh*>& meshes)
+{
+  _recorded = true;
+
+  _meshes = meshes;
+  _worldMatrixFlags.resize(meshes.size());
+  for (size_t i = 0; i < meshes.size(); ++i) {
+    _worldMatrixFlags[i] = meshes[i]->getWorldMatrix().updateFlag;
+  }
+  _commands.shrink_to_fit();
+}
+
+bool SnapshotRenderingStream::hasMovedMeshes() const
+{
+  for (size_t i = 0; i < _meshes.size(); ++i) {
+    if (_meshes[i]->computeWorldMatrix().updateFlag != _worldMatrixFlags[i]) {
+      return true;
+    }
+  }
+  return false;
+}
+
+size_t SnapshotRenderingStream::commandCount() const
+{
+  return _commands.size();
+}
+
+size_t SnapshotRenderingStream::drawCount() const
+{
+  return _drawCount;
+}
+
+template <typename T>
+uint32_t SnapshotRenderingStream::_indexOf(std::vector<T>& pool,
+                                           std::unordered_map<const void*, uint32_t>& indices,
+                                           const T& object)
+{
+  const auto it = indices.find(object.get());
+  if (it != indices.end()) {
+    return it->second;
+  }
+  const auto index      = static_cast<uint32_t>(pool.size());
+  indices[object.get()] = index;
+  pool.emplace_back(object);
+  return index;
+}
+
+SnapshotRenderingStream::Command& SnapshotRenderingStream::_push(Op op, uint32_t object,
+                                                                 uint32_t payload)
+{
+  _commands.emplace_back(Command{op, UniformType::Int, object, payload, {0, 0, 0, 0}});
+  return _commands.back();
+}
+
+uint32_t SnapshotRenderingStream::_uniformIndex(const WebGLUniformLocationPtr& uniform)
+{
+  return _indexOf(_uniforms, _uniformIndices, uniform);
+}
+
+uint32_t SnapshotRenderingStream::_bufferIndex(const WebGLDataBufferPtr& buffer)
+{
+  return _indexOf(_buffers, _bufferIndices, buffer);
+}
+
+bool SnapshotRenderingStream::_isLiveBuffer(const WebGLDataBufferPtr& buffer) const
+{
+  for (const auto& liveBuffer : _liveBuffers) {
+    if (liveBuffer == buffer) {
+      return true;
+    }
+  }
+  return false;
+}
+
+void SnapshotRenderingStream::recordEnableEffect(const EffectPtr& effect)
+{
+  _push(Op::EnableEffect, _indexOf(_effects, _effectIndices, effect));
+}
+
+void SnapshotRenderingStream::recordUniform(UniformType type,
+                                            const WebGLUniformLocationPtr& uniform, int x, int y,
+                                            int z, int w)
+{
+  auto& command       = _push(Op::Uniform, _uniformIndex(uniform));
+  command.uniformType = type;
+  command.args[0]     = x;
+  command.args[1]     = y;
+  command.args[2]     = z;
+  command.args[3]     = w;
+}
+
+void SnapshotRenderingStream::recordUniform(UniformType type,
+                                            const WebGLUniformLocationPtr& uniform, float x,
+                                            float y, float z, float w)
+{
+  auto& command
+    = _push(Op::Uniform, _uniformIndex(uniform), static_cast<uint32_t>(_floats.size()));
+  command.uniformType = type;
+  _floats.insert(_floats.end(), {x, y, z, w});
+}
+
+void SnapshotRenderingStream::recordUniform(UniformType type,
+                                            const WebGLUniformLocationPtr& uniform,
+                                            const Int32Array& array)
+{
+  auto& command
+    = _push(Op::Uniform, _uniformIndex(uniform), static_cast<uint32_t>(_intArrays.size()));
+  command.uniformType = type;
+  _intArrays.emplace_back(array);
+}
+
+void SnapshotRenderingStream::recordUniform(UniformType type,
+                                            const WebGLUniformLocationPtr& uniform,
+                                            const Float32Array& array)
+{
+  auto& command
+    = _push(Op::Uniform, _uniformIndex(uniform), static_cast<uint32_t>(_floatArrays.size()));
+  command.uniformType = type;
+  _floatArrays.emplace_back(array);
+}
+
+void SnapshotRenderingStream::recordTexture(int channel, const WebGLUniformLocationPtr& uniform,
+                                            const ThinTexturePtr& texture)
+{
+  auto& command = _push(Op::Texture, _uniformIndex(uniform),
+                        _indexOf(_textures, _textureIndices, texture));
+  command.args[0] = channel;
+}
+
+void SnapshotRenderingStream::recordTextureArray(int channel,
+                                                 const WebGLUniformLocationPtr& uniform,
+                                                 const std::vector<ThinTexturePtr>& textures)
+{
+  auto& command = _push(Op::TextureArray, _uniformIndex(uniform),
+                        static_cast<uint32_t>(_textureArrays.size()));
+  command.args[0] = channel;
+  _textureArrays.emplace_back(textures);
+}
+
+void SnapshotRenderingStream::recordBindVertexArray(
+  const WebGLVertexArrayObjectPtr& vertexArrayObject, const WebGLDataBufferPtr& indexBuffer)
+{
+  _push(Op::BindVertexArray, _indexOf(_vertexArrays, _vertexArrayIndices, vertexArrayObject),
+        _bufferIndex(indexBuffer));
+}
+
+void SnapshotRenderingStream::recordBindBuffers(
+  const std::unordered_map<std::string, VertexBufferPtr>& vertexBuffers,
+  const WebGLDataBufferPtr& indexBuffer, const EffectPtr& effect,
+  const std::unordered_map<std::string, VertexBufferPtr>& overrides)
+{
+  _push(Op::BindBuffers, static_cast<uint32_t>(_vertexBuffersBindings.size()),
+        _bufferIndex(indexBuffer));
+  _vertexBuffersBindings.emplace_back(VertexBuffersBinding{vertexBuffers, overrides, effect});
+}
+
+void SnapshotRenderingStream::recordUpdateUniformBuffer(const WebGLDataBufferPtr& buffer,
+                                                        const Float32Array& elements, int offset,
+                                                        int count)
+{
+  if (_isLiveBuffer(buffer)) {
+    return;
+  }
+
+  auto& command = _push(Op::UpdateUniformBuffer, _bufferIndex(buffer),
+                        static_cast<uint32_t>(_floatArrays.size()));
+  command.args[0] = offset;
+  command.args[1] = count;
+  _floatArrays.emplace_back(elements);
+}
+
+void SnapshotRenderingStream::recordBindUniformBufferBase(const WebGLDataBufferPtr& buffer,
+                                                          unsigned int location,
+                                                          const std::string& name)
+{
+  auto& command = _push(Op::BindUniformBufferBase, _bufferIndex(buffer),
+                        static_cast<uint32_t>(_names.size()));
+  command.args[0] = static_cast<int32_t>(location);
+  _names.emplace_back(name);
+}
+
+void SnapshotRenderingStream::recordUpdateDynamicVertexBuffer(const WebGLDataBufferPtr& buffer,
+                                                              const Float32Array& data,
+                                                              int byteOffset, int byteLength)
+{
+  auto& command = _push(Op::UpdateDynamicVertexBuffer, _bufferIndex(buffer),
+                        static_cast<uint32_t>(_floatArrays.size()));
+  command.args[0] = byteOffset;
+  command.args[1] = byteLength;
+  _floatArrays.emplace_back(data);
+}
+
+void SnapshotRenderingStream::recordDraw(bool indexed, unsigned int fillMode, int start, int count,
+                                         int instancesCount,
+                                         const DepthCullingState& depthCullingState,
+                                         const AlphaState& alphaState, bool colorWrite,
+                                         bool statesDirty)
+{
+  // The first draw captures the complete states, the replay can not rely on the states left by the
+  // previous frame
+  if (statesDirty || _states.empty()) {
+    States states{std::make_unique<DepthCullingState>(false), std::make_unique<AlphaState>(),
+                  colorWrite};
+    states.depthCulling->reset();
+    states.depthCulling->copyFrom(depthCullingState);
+    states.alpha->copyFrom(alphaState);
+    _push(Op::States, 0, static_cast<uint32_t>(_states.size()));
+    _states.emplace_back(std::move(states));
+  }
+
+  auto& command   = _push(indexed ? Op::DrawElements : Op::DrawArrays);
+  command.args[0] = static_cast<int32_t>(fillMode);
+  command.args[1] = start;
+  command.args[2] = count;
+  command.args[3] = instancesCount;
+  ++_drawCount;
+}
+
+void SnapshotRenderingStream::replay(ThinEngine& engine) const
+{
+  for (const auto& command : _commands) {
+    const auto* args = command.args;
+    switch (command.op) {
+      case Op::EnableEffect:
+        engine.enableEffect(_effects[command.object]);
+        break;
+      case Op::Uniform: {
+        const auto& uniform = _uniforms[command.object];
+        const auto* values  = _floats.data() + command.payload;
+        switch (command.uniformType) {
+          case UniformType::Int:
+            engine.setInt(uniform, args[0]);
+            break;
+          case UniformType::Int2:
+            engine.setInt2(uniform, args[0], args[1]);
+            break;
+          case UniformType::Int3:
+            engine.setInt3(uniform, args[0], args[1], args[2]);
+            break;
+          case UniformType::Int4:
+            engine.setInt4(uniform, args[0], args[1], args[2], args[3]);
+            break;
+          case UniformType::IntArray:
+            engine.setIntArray(uniform, _intArrays[command.payload]);
+            break;
+          case UniformType::IntArray2:
+            engine.setIntArray2(uniform, _intArrays[command.payload]);
+            break;
+          case UniformType::IntArray3:
+            engine.setIntArray3(uniform, _intArrays[command.payload]);
+            break;
+          case UniformType::IntArray4:
+            engine.setIntArray4(uniform, _intArrays[command.payload]);
+            break;
+          case UniformType::Float:
+            engine.setFloat(uniform, values[0]);
+            break;
+          case UniformType::Float2:
+            engine.setFloat2(uniform, values[0], values[1]);
+            break;
+          case UniformType::Float3:
+            engine.setFloat3(uniform, values[0], values[1], values[2]);
+            break;
+          case UniformType::Float4:
+            engine.setFloat4(uniform, values[0], values[1], values[2], values[3]);
+            break;
+          case UniformType::Array:
+            engine.setArray(uniform, _floatArrays[command.payload]);
+            break;
+          case UniformType::Array2:
+            engine.setArray2(uniform, _floatArrays[command.payload]);
+            break;
+          case UniformType::Array3:
+            engine.setArray3(uniform, _floatArrays[command.payload]);
+            break;
+          case UniformType::Array4:
+            engine.setArray4(uniform, _floatArrays[command.payload]);
+            break;
+          case UniformType::Matrices:
+            engine.setMatrices(uniform, _floatArrays[command.payload]);
+            break;
+          case UniformType::Matrix3x3:
+            engine.setMatrix3x3(uniform, _floatArrays[command.payload]);
+            break;
+          case UniformType::Matrix2x2:
+            engine.setMatrix2x2(uniform, _floatArrays[command.payload]);
+            break;
+        }
+      } break;
+      case Op::Texture:
+        engine.setTexture(args[0], _uniforms[command.object], _textures[command.payload], "");
+        break;
+      case Op::TextureArray:
+        engine.setTextureArray(args[0], _uniforms[command.object],
+                               _textureArrays[command.payload], "");
+        break;
+      case Op::BindVertexArray:
+        engine.bindVertexArrayObject(_vertexArrays[command.object], _buffers[command.payload]);
+        break;
+      case Op::BindBuffers: {
+        const auto& binding = _vertexBuffersBindings[command.object];
+        engine.bindBuffers(binding.vertexBuffers, _buffers[command.payload], binding.effect,
+                           binding.overrides);
+      } break;
+      case Op::UpdateUniformBuffer:
+        engine.updateUniformBuffer(_buffers[command.object], _floatArrays[command.payload],
+                                   args[0], args[1]);
+        break;
+      case Op::BindUniformBufferBase:
+        engine.bindUniformBufferBase(_buffers[command.object],
+                                     static_cast<unsigned int>(args[0]), _names[command.payload]);
+        break;
+      case Op::UpdateDynamicVertexBuffer:
+        engine.updateDynamicVertexBuffer(_buffers[command.object], _floatArrays[command.payload],
+                                         args[0], args[1]);
+        break;
+      case Op::States: {
+        const auto& states = _states[command.payload];
+        engine.depthCullingState()->copyFrom(*states.depthCulling);
+        engine.alphaState()->copyFrom(*states.alpha);
+        engine.setColorWrite(states.colorWrite);
+      } break;
+      case Op::DrawElements:
+        engine.drawElementsType(static_cast<unsigned int>(args[0]), args[1], args[2], args[3]);
+        break;
+      case Op::DrawArrays:
+        engine.drawArraysType(static_cast<unsigned int>(args[0]), args[1], args[2], args[3]);
+        break;
+    }
+  }
+
+  // The uniforms were set behind the back of the effects, their value caches are out of date
+  for (const auto& effect : _effects) {
+    if (auto pipelineContext
+        = std::static_pointer_cast<WebGLPipelineContext>(effect->getPipelineContext())) {
+      pipelineContext->_clearValueCache();
+    }
+  }
+}
+
+} // end of namespace BABYLON
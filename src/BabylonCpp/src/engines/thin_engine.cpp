@@ -3,6 +3,7 @@
 #include <babylon/babylon_stl_util.h>
 #include <babylon/babylon_version.h>
 #include <babylon/core/logging.h>
+#include <babylon/core/thread_pool.h>
 #include <babylon/engines/engine_store.h>
 #include <babylon/engines/extensions/alpha_extension.h>
 #include <babylon/engines/extensions/cube_texture_extension.h>
@@ -15,7 +16,10 @@
 #include <babylon/engines/extensions/render_target_extension.h>
 #include <babylon/engines/extensions/uniform_buffer_extension.h>
 #include <babylon/engines/instancing_attribute_info.h>
+#include <babylon/engines/program_binary_cache.h>
 #include <babylon/engines/scene.h>
+#include <babylon/engines/snapshot_rendering_stream.h>
+#include <babylon/engines/uniform_buffer_ring.h>
 #include <babylon/engines/webgl/webgl2_shader_processor.h>
 #include <babylon/engines/webgl/webgl_hardware_texture.h>
 #include <babylon/engines/webgl/webgl_pipeline_context.h>
@@ -26,6 +30,7 @@
 #include <babylon/materials/draw_wrapper.h>
 #include <babylon/materials/effect.h>
 #include <babylon/materials/ieffect_creation_options.h>
+#include <babylon/materials/material_defines.h>
 #include <babylon/materials/textures/base_texture.h>
 #include <babylon/materials/textures/iinternal_texture_loader.h>
 #include <babylon/materials/textures/internal_texture.h>
@@ -35,6 +40,7 @@
 #include <babylon/materials/textures/loaders/tga_texture_loader.h>
 #include <babylon/materials/textures/render_target_texture.h>
 #include <babylon/materials/uniform_buffer.h>
+#include <babylon/maths/matrix.h>
 #include <babylon/maths/scalar.h>
 #include <babylon/maths/viewport.h>
 #include <babylon/meshes/vertex_buffer.h>
@@ -44,6 +50,7 @@
 #include <babylon/misc/string_tools.h>
 #include <babylon/states/alpha_state.h>
 #include <babylon/states/depth_culling_state.h>
+#include <babylon/states/gl_state_cache.h>
 #include <babylon/states/stencil_state.h>
 
 namespace BABYLON {
@@ -123,6 +130,7 @@ ThinEngine::ThinEngine(ICanvas* canvas, const EngineOptions& options)
     , stencilState{this, &ThinEngine::get_stencilState}
     , _depthCullingState{std::make_unique<DepthCullingState>()}
     , _stencilState{std::make_unique<StencilState>()}
+    , _glStateCache{std::make_unique<GLStateCache>()}
     , _supportsHardwareTextureRescaling{this, &ThinEngine::get__supportsHardwareTextureRescaling}
     , _alphaExtension{std::make_unique<AlphaExtension>(this)}
     , _cubeTextureExtension{std::make_unique<CubeTextureExtension>(this)}
@@ -163,6 +171,9 @@ ThinEngine::ThinEngine(ICanvas* canvas, const EngineOptions& options)
     return;
   }
 
+  _glStateCache->setContext(_gl);
+  _stencilState->reset();
+
   // Viewport
   _hardwareScalingLevel = options.adaptToDeviceRatio ? 1.f : 1.f;
   resize();
@@ -171,6 +182,15 @@ ThinEngine::ThinEngine(ICanvas* canvas, const EngineOptions& options)
   _initGLContext();
   _initFeatures();
 
+  // Program binary cache
+  if (!options.programBinaryCachePath.empty()
+      && _gl->getParameteri(GL::NUM_PROGRAM_BINARY_FORMATS) > 0) {
+    _glIdentity = _gl->getString(GL::VENDOR) + "\n" + _gl->getString(GL::RENDERER) + "\n"
+                  + _gl->getString(GL::VERSION);
+    _programBinaryCache = std::make_unique<ProgramBinaryCache>(
+      options.programBinaryCachePath, options.programBinaryCacheMaxSize);
+  }
+
   // Prepare buffer pointers
   for (unsigned int i = 0, ul = static_cast<unsigned>(_caps.maxVertexAttribs); i < ul; ++i) {
     _currentBufferPointers[i] = BufferPointer();
@@ -305,10 +325,14 @@ bool ThinEngine::get_snapshotRendering() const
   return _snapshotRenderingEnabled;
 }
 
-void ThinEngine::set_snapshotRendering(bool /*activate*/)
+void ThinEngine::set_snapshotRendering(bool activate)
 {
-  // WebGL engine does not support snapshot rendering
-  _snapshotRenderingEnabled = false;
+  if (_snapshotRenderingEnabled == activate) {
+    return;
+  }
+
+  _snapshotRenderingEnabled = activate;
+  snapshotRenderingReset();
 }
 
 unsigned int ThinEngine::get_snapshotRenderingMode() const
@@ -318,7 +342,39 @@ unsigned int ThinEngine::get_snapshotRenderingMode() const
 
 void ThinEngine::set_snapshotRenderingMode(unsigned int mode)
 {
+  if (_snapshotRenderingMode == mode) {
+    return;
+  }
+
   _snapshotRenderingMode = mode;
+  snapshotRenderingReset();
+}
+
+void ThinEngine::snapshotRenderingReset()
+{
+  ++_snapshotRenderingGeneration;
+}
+
+void ThinEngine::_beginSnapshotRecording(SnapshotRenderingStream* stream)
+{
+  _snapshotRecorder = stream;
+  _snapshotRecorder->beginRecording(_snapshotRenderingGeneration);
+
+  // The stream must not depend on what was bound before it: force the effect and the uniform
+  // buffers to be rebound and every uniform to be set again while recording
+  _currentEffect = nullptr;
+  Effect::ResetCache();
+  for (const auto& item : _compiledEffects) {
+    if (auto pipelineContext
+        = std::static_pointer_cast<WebGLPipelineContext>(item.second->getPipelineContext())) {
+      pipelineContext->_clearValueCache();
+    }
+  }
+}
+
+void ThinEngine::_endSnapshotRecording()
+{
+  _snapshotRecorder = nullptr;
 }
 
 void ThinEngine::_debugPushGroup(const std::string& /*groupName*/,
@@ -394,6 +450,9 @@ bool ThinEngine::areAllEffectsReady() const
 void ThinEngine::_rebuildBuffers()
 {
   // Uniforms
+  if (_uniformBufferRing) {
+    _uniformBufferRing->_rebuild();
+  }
   for (const auto& uniformBuffer : _uniformBuffers) {
     uniformBuffer->_rebuild();
   }
@@ -631,6 +690,7 @@ void ThinEngine::_initFeatures()
   _features.uniformBufferHardCheckMatrix              = false;
   _features.allowTexturePrefiltering                  = _webGLVersion != 1.f;
   _features.trackUbosInFrame                          = false;
+  _features.uniformBufferRing                         = _webGLVersion != 1.f;
   _features.supportCSM                                = _webGLVersion != 1.f;
   _features.basisNeedsPOT                             = _webGLVersion == 1.f;
   _features.support3DTextures                         = _webGLVersion != 1.f;
@@ -641,6 +701,7 @@ void ThinEngine::_initFeatures()
   _features.supportSwitchCaseInShader                 = _webGLVersion != 1.f;
   _features.supportSyncTextureRead                    = true;
   _features.needsInvertingBitmap                      = true;
+  _features.useUBOBindingCache                        = true;
   _features._collectUbosUpdatedInFrame                = false;
 }
 
@@ -712,6 +773,14 @@ EngineCapabilities& ThinEngine::getCaps()
   return _caps;
 }
 
+ThreadPool& ThinEngine::getThreadPool()
+{
+  if (!_threadPool) {
+    _threadPool = std::make_unique<ThreadPool>();
+  }
+  return *_threadPool;
+}
+
 void ThinEngine::stopRenderLoop()
 {
   _activeRenderLoops.clear();
@@ -852,6 +921,10 @@ void ThinEngine::_viewport(float x, float y, float width, float height)
 
     _gl->viewport(static_cast<int>(x), static_cast<int>(y), static_cast<int>(width),
                   static_cast<int>(height));
+    _glStateCache->countIssued();
+  }
+  else {
+    _glStateCache->countFiltered();
   }
 }
 
@@ -871,6 +944,7 @@ void ThinEngine::setViewport(const Viewport& viewport, const std::optional<int>&
 
 void ThinEngine::beginFrame()
 {
+  _glStateCache->resetCounters();
 }
 
 void ThinEngine::endFrame()
@@ -1197,6 +1271,10 @@ void ThinEngine::bindBuffer(const WebGLDataBufferPtr& buffer, int target)
                                                          buffer->underlyingResource().get() :
                                                          nullptr);
     _currentBoundBuffer[target] = buffer;
+    _glStateCache->countIssued();
+  }
+  else {
+    _glStateCache->countFiltered();
   }
 }
 
@@ -1353,10 +1431,15 @@ WebGLVertexArrayObjectPtr ThinEngine::recordVertexArrayObject(
 void ThinEngine::bindVertexArrayObject(const WebGLVertexArrayObjectPtr& vertexArrayObject,
                                        const WebGLDataBufferPtr& indexBuffer)
 {
+  if (_snapshotRecorder) {
+    _snapshotRecorder->recordBindVertexArray(vertexArrayObject, indexBuffer);
+  }
+
   if (_cachedVertexArrayObject != vertexArrayObject) {
     _cachedVertexArrayObject = vertexArrayObject;
 
     _gl->bindVertexArray(vertexArrayObject.get());
+    _glStateCache->countIssued();
     _cachedVertexBuffersMap.clear();
     _cachedVertexBuffers = nullptr;
     _cachedIndexBuffer   = nullptr;
@@ -1364,6 +1447,9 @@ void ThinEngine::bindVertexArrayObject(const WebGLVertexArrayObjectPtr& vertexAr
     _uintIndicesCurrentlySet  = indexBuffer != nullptr && indexBuffer->is32Bits;
     _mustWipeVertexAttributes = true;
   }
+  else {
+    _glStateCache->countFiltered();
+  }
 }
 
 void ThinEngine::bindBuffersDirectly(const WebGLDataBufferPtr& vertexBuffer,
@@ -1424,6 +1510,10 @@ void ThinEngine::bindBuffers(
   const WebGLDataBufferPtr& indexBuffer, const EffectPtr& effect,
   const std::unordered_map<std::string, VertexBufferPtr>& overrideVertexBuffers)
 {
+  if (_snapshotRecorder) {
+    _snapshotRecorder->recordBindBuffers(vertexBuffers, indexBuffer, effect, overrideVertexBuffers);
+  }
+
   if (_cachedVertexBuffersMap != vertexBuffers || _cachedEffectForVertexBuffers != effect) {
     _cachedVertexBuffersMap       = vertexBuffers;
     _cachedEffectForVertexBuffers = effect;
@@ -1467,6 +1557,22 @@ bool ThinEngine::_releaseBuffer(const WebGLDataBufferPtr& buffer)
   return false;
 }
 
+UniformBufferRing* ThinEngine::_getUniformBufferRing()
+{
+  // The snapshot streams replay the bindings of the buffers owned by the uniform buffers
+  if (!_features.uniformBufferRing || !supportsUniformBuffers() || _snapshotRenderingEnabled) {
+    return nullptr;
+  }
+
+  if (!_uniformBufferRing) {
+    const auto alignment = _gl->getParameteri(GL::UNIFORM_BUFFER_OFFSET_ALIGNMENT);
+    _uniformBufferRing   = std::make_unique<UniformBufferRing>(
+      this, alignment > 0 ? static_cast<size_t>(alignment) : 256);
+  }
+
+  return _uniformBufferRing.get();
+}
+
 void ThinEngine::_deleteBuffer(const WebGLDataBufferPtr& buffer)
 {
   _gl->deleteBuffer(buffer->underlyingResource().get());
@@ -1603,10 +1709,23 @@ void ThinEngine::drawUnIndexed(bool useTriangles, int verticesStart, int vertice
 void ThinEngine::drawElementsType(unsigned int fillMode, int indexStart, int indexCount,
                                   int instancesCount)
 {
+  if (_snapshotRecorder) {
+    _snapshotRecorder->recordDraw(true, fillMode, indexStart, indexCount, instancesCount,
+                                  *_depthCullingState, *_alphaState, _colorWrite,
+                                  _depthCullingState->isDirty() || _alphaState->isDirty()
+                                    || _colorWriteChanged);
+  }
+
   // Apply states
   applyStates();
 
   _reportDrawCall();
+  _glStateCache->countIssued();
+
+  // Upload the uniform buffers data allocated since the previous draw call
+  if (_uniformBufferRing) {
+    _uniformBufferRing->flush();
+  }
 
   // Render
   const auto drawMode = _drawMode(fillMode);
@@ -1624,10 +1743,23 @@ void ThinEngine::drawElementsType(unsigned int fillMode, int indexStart, int ind
 void ThinEngine::drawArraysType(unsigned int fillMode, int verticesStart, int verticesCount,
                                 int instancesCount)
 {
+  if (_snapshotRecorder) {
+    _snapshotRecorder->recordDraw(false, fillMode, verticesStart, verticesCount, instancesCount,
+                                  *_depthCullingState, *_alphaState, _colorWrite,
+                                  _depthCullingState->isDirty() || _alphaState->isDirty()
+                                    || _colorWriteChanged);
+  }
+
   // Apply states
   applyStates();
 
   _reportDrawCall();
+  _glStateCache->countIssued();
+
+  // Upload the uniform buffers data allocated since the previous draw call
+  if (_uniformBufferRing) {
+    _uniformBufferRing->flush();
+  }
 
   // Render
   const auto drawMode = _drawMode(fillMode);
@@ -1674,8 +1806,9 @@ void ThinEngine::_reportDrawCall()
 
 void ThinEngine::_releaseEffect(Effect* effect)
 {
-  if (stl_util::contains(_compiledEffects, effect->_key)) {
-    _compiledEffects.erase(effect->_key);
+  auto it = _compiledEffects.find(effect->_cacheKey);
+  if (it != _compiledEffects.end() && it->second.get() == effect) {
+    _compiledEffects.erase(it);
 
     _deletePipelineContext(
       std::static_pointer_cast<WebGLPipelineContext>(effect->getPipelineContext()));
@@ -1688,7 +1821,10 @@ void ThinEngine::_deletePipelineContext(const IPipelineContextPtr& pipelineConte
   if (webGLPipelineContext && webGLPipelineContext->program) {
     webGLPipelineContext->program->__SPECTOR_rebuildProgram = nullptr;
 
-    _gl->deleteProgram(webGLPipelineContext->program.get());
+    // The null engine has no context
+    if (_gl) {
+      _gl->deleteProgram(webGLPipelineContext->program.get());
+    }
   }
 }
 
@@ -1697,10 +1833,10 @@ EffectPtr ThinEngine::createEffect(
   IEffectCreationOptions& options, ThinEngine* engine,
   const std::function<void(const EffectPtr& effect)>& onCompiled)
 {
-  std::string name;
+  std::string shaderNames;
   if (std::holds_alternative<std::string>(baseName)) {
     auto _baseName = std::get<std::string>(baseName);
-    name           = _baseName + "+" + _baseName + "@" + options.defines;
+    shaderNames    = _baseName + "+" + _baseName;
   }
   else if (std::holds_alternative<std::unordered_map<std::string, std::string>>(baseName)) {
     auto _baseName = std::get<std::unordered_map<std::string, std::string>>(baseName);
@@ -1715,20 +1851,35 @@ EffectPtr ThinEngine::createEffect(
                      stl_util::contains(_baseName, "fragmentToken")  ? _baseName["fragmentToken"] :
                      stl_util::contains(_baseName, "fragmentSource") ? _baseName["fragmentSource"] :
                                                                        "fragment";
-    name           = vertex + "+" + fragment + "@" + options.defines;
+    shaderNames    = vertex + "+" + fragment;
   }
 
-  if (stl_util::contains(_compiledEffects, name)) {
-    auto compiledEffect = _compiledEffects[name];
+  // The defines text of the materials is written from their define values, the hash of the
+  // values identifies it without going through the text
+  auto key = MaterialDefineHash::Combine(MaterialDefineHash::Seed, shaderNames.data(),
+                                         shaderNames.size());
+  if (options.materialDefines) {
+    const auto definesKey = options.materialDefines->hashCode();
+    key                   = MaterialDefineHash::Combine(key, &definesKey, sizeof(definesKey));
+  }
+  else {
+    key = MaterialDefineHash::Combine(key, "@", 1);
+    key = MaterialDefineHash::Combine(key, options.defines.data(), options.defines.size());
+  }
+
+  auto it = _compiledEffects.find(key);
+  if (it != _compiledEffects.end()) {
+    auto compiledEffect = it->second;
     if (onCompiled && compiledEffect->isReady()) {
       onCompiled(compiledEffect);
     }
     return compiledEffect;
   }
-  options.name = name;
+  options.name = shaderNames + "@" + options.defines;
   auto effect  = Effect::New(baseName, options, engine);
 
-  _compiledEffects[name] = effect;
+  effect->_cacheKey     = key;
+  _compiledEffects[key] = effect;
 
   return effect;
 }
@@ -1739,13 +1890,6 @@ std::string ThinEngine::_ConcatenateShader(const std::string& source, const std:
   return shaderVersion + ((!defines.empty()) ? defines + "\n" : "") + source;
 }
 
-WebGLShaderPtr ThinEngine::_compileShader(const std::string& source, const std::string& type,
-                                          const std::string& defines,
-                                          const std::string& shaderVersion)
-{
-  return _compileRawShader(ThinEngine::_ConcatenateShader(source, defines, shaderVersion), type);
-}
-
 WebGLShaderPtr ThinEngine::_compileRawShader(const std::string& source, const std::string& type)
 {
   auto& gl    = *_gl;
@@ -1776,13 +1920,19 @@ ThinEngine::createRawShaderProgram(const IPipelineContextPtr& pipelineContext,
                                    WebGLRenderingContext* context,
                                    const std::vector<std::string>& transformFeedbackVaryings)
 {
-  context = context ? context : _gl;
+  context                   = context ? context : _gl;
+  auto webGLPipelineContext = std::static_pointer_cast<WebGLPipelineContext>(pipelineContext);
+
+  if (auto program = _loadProgramBinary(webGLPipelineContext, vertexCode, fragmentCode, context,
+                                        transformFeedbackVaryings)) {
+    return program;
+  }
 
   auto vertexShader   = _compileRawShader(vertexCode, "vertex");
   auto fragmentShader = _compileRawShader(fragmentCode, "fragment");
 
-  return _createShaderProgram(std::static_pointer_cast<WebGLPipelineContext>(pipelineContext),
-                              vertexShader, fragmentShader, context, transformFeedbackVaryings);
+  return _createShaderProgram(webGLPipelineContext, vertexShader, fragmentShader, context,
+                              transformFeedbackVaryings);
 }
 
 WebGLProgramPtr
@@ -1799,11 +1949,87 @@ ThinEngine::createShaderProgram(const IPipelineContextPtr& pipelineContext,
 #else
   auto shaderVersion = (_webGLVersion > 1.f) ? "#version 330\n#define WEBGL2 \n" : "";
 #endif
-  auto vertexShader   = _compileShader(vertexCode, "vertex", defines, shaderVersion);
-  auto fragmentShader = _compileShader(fragmentCode, "fragment", defines, shaderVersion);
+  auto webGLPipelineContext = std::static_pointer_cast<WebGLPipelineContext>(pipelineContext);
+
+  // Final sources, they identify the program in the program binary cache
+  const auto vertexSource   = ThinEngine::_ConcatenateShader(vertexCode, defines, shaderVersion);
+  const auto fragmentSource = ThinEngine::_ConcatenateShader(fragmentCode, defines, shaderVersion);
 
-  return _createShaderProgram(std::static_pointer_cast<WebGLPipelineContext>(pipelineContext),
-                              vertexShader, fragmentShader, context, transformFeedbackVaryings);
+  if (auto program = _loadProgramBinary(webGLPipelineContext, vertexSource, fragmentSource,
+                                        context, transformFeedbackVaryings)) {
+    return program;
+  }
+
+  auto vertexShader   = _compileRawShader(vertexSource, "vertex");
+  auto fragmentShader = _compileRawShader(fragmentSource, "fragment");
+
+  return _createShaderProgram(webGLPipelineContext, vertexShader, fragmentShader, context,
+                              transformFeedbackVaryings);
+}
+
+ProgramBinaryCache* ThinEngine::programBinaryCache() const
+{
+  return _programBinaryCache.get();
+}
+
+WebGLProgramPtr
+ThinEngine::_loadProgramBinary(const WebGLPipelineContextPtr& pipelineContext,
+                               const std::string& vertexSource, const std::string& fragmentSource,
+                               WebGLRenderingContext* context,
+                               const std::vector<std::string>& transformFeedbackVaryings)
+{
+  if (!_programBinaryCache) {
+    return nullptr;
+  }
+
+  pipelineContext->_programBinaryKey = ProgramBinaryCache::ComputeKey(
+    vertexSource, fragmentSource, _glIdentity, transformFeedbackVaryings);
+
+  unsigned int binaryFormat = 0;
+  ArrayBuffer binary;
+  if (!_programBinaryCache->load(pipelineContext->_programBinaryKey, binaryFormat, binary)) {
+    return nullptr;
+  }
+
+  auto shaderProgram = context->createProgram();
+  if (!shaderProgram) {
+    return nullptr;
+  }
+
+  // Binaries are rejected when the driver was updated, compile the sources instead
+  if (!context->programBinary(shaderProgram.get(), binaryFormat, binary)) {
+    BABYLON_LOGF_INFO("ThinEngine", "Program binary %s rejected, compiling the sources",
+                      pipelineContext->_programBinaryKey.c_str())
+    context->deleteProgram(shaderProgram.get());
+    _programBinaryCache->remove(pipelineContext->_programBinaryKey);
+    return nullptr;
+  }
+
+  // Already linked, nothing to store or to wait for
+  pipelineContext->_programBinaryKey.clear();
+  pipelineContext->program            = shaderProgram;
+  pipelineContext->context            = context;
+  pipelineContext->vertexShader       = nullptr;
+  pipelineContext->fragmentShader     = nullptr;
+  pipelineContext->isParallelCompiled = false;
+  _finalizePipelineContext(pipelineContext.get());
+
+  return shaderProgram;
+}
+
+void ThinEngine::_storeProgramBinary(WebGLPipelineContext* pipelineContext)
+{
+  if (!_programBinaryCache || pipelineContext->_programBinaryKey.empty()) {
+    return;
+  }
+
+  unsigned int binaryFormat = 0;
+  auto binary = pipelineContext->context->getProgramBinary(pipelineContext->program.get(),
+                                                           binaryFormat);
+  if (!binary.empty()) {
+    _programBinaryCache->store(pipelineContext->_programBinaryKey, binaryFormat, binary);
+  }
+  pipelineContext->_programBinaryKey.clear();
 }
 
 IPipelineContextPtr
@@ -1844,6 +2070,10 @@ WebGLProgramPtr ThinEngine::_createShaderProgram(
   context->attachShader(shaderProgram.get(), vertexShader.get());
   context->attachShader(shaderProgram.get(), fragmentShader.get());
 
+  if (!pipelineContext->_programBinaryKey.empty()) {
+    context->programParameteri(shaderProgram.get(), GL::PROGRAM_BINARY_RETRIEVABLE_HINT, 1);
+  }
+
   context->linkProgram(shaderProgram.get());
 
   pipelineContext->context        = context;
@@ -1904,8 +2134,15 @@ void ThinEngine::_finalizePipelineContext(WebGLPipelineContext* pipelineContext)
     }
   }
 
-  context->deleteShader(vertexShader.get());
-  context->deleteShader(fragmentShader.get());
+  _storeProgramBinary(pipelineContext);
+
+  // Programs loaded from the program binary cache have no shaders
+  if (vertexShader) {
+    context->deleteShader(vertexShader.get());
+  }
+  if (fragmentShader) {
+    context->deleteShader(fragmentShader.get());
+  }
 
   pipelineContext->vertexShader   = nullptr;
   pipelineContext->fragmentShader = nullptr;
@@ -2015,6 +2252,10 @@ void ThinEngine::enableEffect(const EffectPtr& effect)
     return;
   }
 
+  if (_snapshotRecorder) {
+    _snapshotRecorder->recordEnableEffect(effect);
+  }
+
   // Use program
   bindSamplers(*effect);
 
@@ -2038,7 +2279,12 @@ bool ThinEngine::setInt(const WebGLUniformLocationPtr& uniform, int value)
     return false;
   }
 
-  _gl->uniform1i(uniform.get(), value);
+  if (_snapshotRecorder) {
+    _snapshotRecorder->recordUniform(SnapshotRenderingStream::UniformType::Int, uniform, value);
+  }
+  if (_glStateCache->uniform(*uniform, &value, sizeof(value))) {
+    _gl->uniform1i(uniform.get(), value);
+  }
 
   return true;
 }
@@ -2049,7 +2295,13 @@ bool ThinEngine::setInt2(const WebGLUniformLocationPtr& uniform, int x, int y)
     return false;
   }
 
-  _gl->uniform2i(uniform.get(), x, y);
+  if (_snapshotRecorder) {
+    _snapshotRecorder->recordUniform(SnapshotRenderingStream::UniformType::Int2, uniform, x, y);
+  }
+  const int value[] = {x, y};
+  if (_glStateCache->uniform(*uniform, value, sizeof(value))) {
+    _gl->uniform2i(uniform.get(), x, y);
+  }
 
   return true;
 }
@@ -2060,7 +2312,13 @@ bool ThinEngine::setInt3(const WebGLUniformLocationPtr& uniform, int x, int y, i
     return false;
   }
 
-  _gl->uniform3i(uniform.get(), x, y, z);
+  if (_snapshotRecorder) {
+    _snapshotRecorder->recordUniform(SnapshotRenderingStream::UniformType::Int3, uniform, x, y, z);
+  }
+  const int value[] = {x, y, z};
+  if (_glStateCache->uniform(*uniform, value, sizeof(value))) {
+    _gl->uniform3i(uniform.get(), x, y, z);
+  }
 
   return true;
 }
@@ -2071,7 +2329,14 @@ bool ThinEngine::setInt4(const WebGLUniformLocationPtr& uniform, int x, int y, i
     return false;
   }
 
-  _gl->uniform4i(uniform.get(), x, y, z, w);
+  if (_snapshotRecorder) {
+    _snapshotRecorder->recordUniform(SnapshotRenderingStream::UniformType::Int4,
+                                     uniform, x, y, z, w);
+  }
+  const int value[] = {x, y, z, w};
+  if (_glStateCache->uniform(*uniform, value, sizeof(value))) {
+    _gl->uniform4i(uniform.get(), x, y, z, w);
+  }
 
   return true;
 }
@@ -2082,7 +2347,13 @@ bool ThinEngine::setIntArray(const WebGLUniformLocationPtr& uniform, const Int32
     return false;
   }
 
-  _gl->uniform1iv(uniform.get(), array);
+  if (_snapshotRecorder) {
+    _snapshotRecorder->recordUniform(SnapshotRenderingStream::UniformType::IntArray,
+                                     uniform, array);
+  }
+  if (_glStateCache->uniform(*uniform, array.data(), array.size() * sizeof(int32_t))) {
+    _gl->uniform1iv(uniform.get(), array);
+  }
 
   return true;
 }
@@ -2093,7 +2364,13 @@ bool ThinEngine::setIntArray2(const WebGLUniformLocationPtr& uniform, const Int3
     return false;
   }
 
-  _gl->uniform2iv(uniform.get(), array);
+  if (_snapshotRecorder) {
+    _snapshotRecorder->recordUniform(SnapshotRenderingStream::UniformType::IntArray2,
+                                     uniform, array);
+  }
+  if (_glStateCache->uniform(*uniform, array.data(), array.size() * sizeof(int32_t))) {
+    _gl->uniform2iv(uniform.get(), array);
+  }
   return true;
 }
 
@@ -2103,7 +2380,13 @@ bool ThinEngine::setIntArray3(const WebGLUniformLocationPtr& uniform, const Int3
     return false;
   }
 
-  _gl->uniform3iv(uniform.get(), array);
+  if (_snapshotRecorder) {
+    _snapshotRecorder->recordUniform(SnapshotRenderingStream::UniformType::IntArray3,
+                                     uniform, array);
+  }
+  if (_glStateCache->uniform(*uniform, array.data(), array.size() * sizeof(int32_t))) {
+    _gl->uniform3iv(uniform.get(), array);
+  }
   return true;
 }
 
@@ -2113,7 +2396,13 @@ bool ThinEngine::setIntArray4(const WebGLUniformLocationPtr& uniform, const Int3
     return false;
   }
 
-  _gl->uniform4iv(uniform.get(), array);
+  if (_snapshotRecorder) {
+    _snapshotRecorder->recordUniform(SnapshotRenderingStream::UniformType::IntArray4,
+                                     uniform, array);
+  }
+  if (_glStateCache->uniform(*uniform, array.data(), array.size() * sizeof(int32_t))) {
+    _gl->uniform4iv(uniform.get(), array);
+  }
   return true;
 }
 
@@ -2126,7 +2415,12 @@ bool ThinEngine::setArray(const WebGLUniformLocationPtr& uniform, const Float32A
   if (array.empty()) {
     return false;
   }
-  _gl->uniform1fv(uniform.get(), array);
+  if (_snapshotRecorder) {
+    _snapshotRecorder->recordUniform(SnapshotRenderingStream::UniformType::Array, uniform, array);
+  }
+  if (_glStateCache->uniform(*uniform, array.data(), array.size() * sizeof(float))) {
+    _gl->uniform1fv(uniform.get(), array);
+  }
   return true;
 }
 
@@ -2136,7 +2430,12 @@ bool ThinEngine::setArray2(const WebGLUniformLocationPtr& uniform, const Float32
     return false;
   }
 
-  _gl->uniform2fv(uniform.get(), array);
+  if (_snapshotRecorder) {
+    _snapshotRecorder->recordUniform(SnapshotRenderingStream::UniformType::Array2, uniform, array);
+  }
+  if (_glStateCache->uniform(*uniform, array.data(), array.size() * sizeof(float))) {
+    _gl->uniform2fv(uniform.get(), array);
+  }
   return true;
 }
 
@@ -2146,7 +2445,12 @@ bool ThinEngine::setArray3(const WebGLUniformLocationPtr& uniform, const Float32
     return false;
   }
 
-  _gl->uniform3fv(uniform.get(), array);
+  if (_snapshotRecorder) {
+    _snapshotRecorder->recordUniform(SnapshotRenderingStream::UniformType::Array3, uniform, array);
+  }
+  if (_glStateCache->uniform(*uniform, array.data(), array.size() * sizeof(float))) {
+    _gl->uniform3fv(uniform.get(), array);
+  }
   return true;
 }
 
@@ -2156,7 +2460,12 @@ bool ThinEngine::setArray4(const WebGLUniformLocationPtr& uniform, const Float32
     return false;
   }
 
-  _gl->uniform4fv(uniform.get(), array);
+  if (_snapshotRecorder) {
+    _snapshotRecorder->recordUniform(SnapshotRenderingStream::UniformType::Array4, uniform, array);
+  }
+  if (_glStateCache->uniform(*uniform, array.data(), array.size() * sizeof(float))) {
+    _gl->uniform4fv(uniform.get(), array);
+  }
   return true;
 }
 
@@ -2166,7 +2475,30 @@ bool ThinEngine::setMatrices(const WebGLUniformLocationPtr& uniform, const Float
     return false;
   }
 
-  _gl->uniformMatrix4fv(uniform.get(), false, matrices);
+  if (_snapshotRecorder) {
+    _snapshotRecorder->recordUniform(SnapshotRenderingStream::UniformType::Matrices,
+                                     uniform, matrices);
+  }
+  if (_glStateCache->uniform(*uniform, matrices.data(), matrices.size() * sizeof(float))) {
+    _gl->uniformMatrix4fv(uniform.get(), false, matrices);
+  }
+  return true;
+}
+
+bool ThinEngine::setMatrix(const WebGLUniformLocationPtr& uniform, const Matrix& matrix)
+{
+  if (!uniform) {
+    return false;
+  }
+
+  const auto& m = matrix.m();
+  if (_snapshotRecorder) {
+    _snapshotRecorder->recordUniform(SnapshotRenderingStream::UniformType::Matrices, uniform,
+                                     Float32Array(m.begin(), m.end()));
+  }
+  if (_glStateCache->uniform(*uniform, m.data(), m.size() * sizeof(float))) {
+    _gl->uniformMatrix4fv(uniform.get(), false, m);
+  }
   return true;
 }
 
@@ -2176,7 +2508,13 @@ bool ThinEngine::setMatrix3x3(const WebGLUniformLocationPtr& uniform, const Floa
     return false;
   }
 
-  _gl->uniformMatrix3fv(uniform.get(), false, matrix);
+  if (_snapshotRecorder) {
+    _snapshotRecorder->recordUniform(SnapshotRenderingStream::UniformType::Matrix3x3,
+                                     uniform, matrix);
+  }
+  if (_glStateCache->uniform(*uniform, matrix.data(), matrix.size() * sizeof(float))) {
+    _gl->uniformMatrix3fv(uniform.get(), false, matrix);
+  }
   return true;
 }
 
@@ -2186,7 +2524,13 @@ bool ThinEngine::setMatrix2x2(const WebGLUniformLocationPtr& uniform, const Floa
     return false;
   }
 
-  _gl->uniformMatrix2fv(uniform.get(), false, matrix);
+  if (_snapshotRecorder) {
+    _snapshotRecorder->recordUniform(SnapshotRenderingStream::UniformType::Matrix2x2,
+                                     uniform, matrix);
+  }
+  if (_glStateCache->uniform(*uniform, matrix.data(), matrix.size() * sizeof(float))) {
+    _gl->uniformMatrix2fv(uniform.get(), false, matrix);
+  }
   return true;
 }
 
@@ -2196,7 +2540,12 @@ bool ThinEngine::setFloat(const WebGLUniformLocationPtr& uniform, float value)
     return false;
   }
 
-  _gl->uniform1f(uniform.get(), value);
+  if (_snapshotRecorder) {
+    _snapshotRecorder->recordUniform(SnapshotRenderingStream::UniformType::Float, uniform, value);
+  }
+  if (_glStateCache->uniform(*uniform, &value, sizeof(value))) {
+    _gl->uniform1f(uniform.get(), value);
+  }
 
   return true;
 }
@@ -2207,7 +2556,13 @@ bool ThinEngine::setFloat2(const WebGLUniformLocationPtr& uniform, float x, floa
     return false;
   }
 
-  _gl->uniform2f(uniform.get(), x, y);
+  if (_snapshotRecorder) {
+    _snapshotRecorder->recordUniform(SnapshotRenderingStream::UniformType::Float2, uniform, x, y);
+  }
+  const float value[] = {x, y};
+  if (_glStateCache->uniform(*uniform, value, sizeof(value))) {
+    _gl->uniform2f(uniform.get(), x, y);
+  }
 
   return true;
 }
@@ -2218,7 +2573,14 @@ bool ThinEngine::setFloat3(const WebGLUniformLocationPtr& uniform, float x, floa
     return false;
   }
 
-  _gl->uniform3f(uniform.get(), x, y, z);
+  if (_snapshotRecorder) {
+    _snapshotRecorder->recordUniform(SnapshotRenderingStream::UniformType::Float3,
+                                     uniform, x, y, z);
+  }
+  const float value[] = {x, y, z};
+  if (_glStateCache->uniform(*uniform, value, sizeof(value))) {
+    _gl->uniform3f(uniform.get(), x, y, z);
+  }
 
   return true;
 }
@@ -2230,21 +2592,28 @@ bool ThinEngine::setFloat4(const WebGLUniformLocationPtr& uniform, float x, floa
     return false;
   }
 
-  _gl->uniform4f(uniform.get(), x, y, z, w);
+  if (_snapshotRecorder) {
+    _snapshotRecorder->recordUniform(SnapshotRenderingStream::UniformType::Float4,
+                                     uniform, x, y, z, w);
+  }
+  const float value[] = {x, y, z, w};
+  if (_glStateCache->uniform(*uniform, value, sizeof(value))) {
+    _gl->uniform4f(uniform.get(), x, y, z, w);
+  }
 
   return true;
 }
 
 void ThinEngine::applyStates()
 {
-  _depthCullingState->apply(*_gl);
-  //_stencilState->apply(*_gl);
-  _alphaState->apply(*_gl);
+  _depthCullingState->apply(*_glStateCache);
+  _stencilState->apply(*_glStateCache);
+  _alphaState->apply(*_glStateCache);
 
   if (_colorWriteChanged) {
     _colorWriteChanged = false;
     const auto enable  = _colorWrite;
-    _gl->colorMask(enable, enable, enable, enable);
+    _glStateCache->colorMask(enable, enable, enable, enable);
   }
 }
 
@@ -2261,6 +2630,11 @@ bool ThinEngine::getColorWrite() const
   return _colorWrite;
 }
 
+const GLStateCounters& ThinEngine::getGLStateCounters() const
+{
+  return _glStateCache->counters();
+}
+
 std::unique_ptr<DepthCullingState>& ThinEngine::get_depthCullingState()
 {
   return _depthCullingState;
@@ -2298,13 +2672,14 @@ void ThinEngine::wipeCaches(bool bruteForce)
   if (bruteForce) {
     _currentProgram = nullptr;
     resetTextureCache();
+    _glStateCache->invalidate();
 
-    _stencilState.reset();
+    _stencilState->reset();
 
-    _depthCullingState.reset();
+    _depthCullingState->reset();
     _depthCullingState->depthFunc = GL::LEQUAL;
 
-    _alphaState.reset();
+    _alphaState->reset();
     _alphaMode     = Constants::ALPHA_ADD;
     _alphaEquation = Constants::ALPHA_DISABLE;
 
@@ -3214,6 +3589,10 @@ void ThinEngine::_setProgram(const WebGLProgramPtr& program)
   if (_currentProgram != program) {
     _gl->useProgram(program.get());
     _currentProgram = program;
+    _glStateCache->countProgramSwitch();
+  }
+  else {
+    _glStateCache->countFiltered();
   }
 }
 
@@ -3240,6 +3619,10 @@ void ThinEngine::_activateCurrentTexture()
   if (_currentTextureChannel != _activeChannel) {
     _gl->activeTexture((*_gl)["TEXTURE0"] + static_cast<unsigned int>(_activeChannel));
     _currentTextureChannel = _activeChannel;
+    _glStateCache->countIssued();
+  }
+  else {
+    _glStateCache->countFiltered();
   }
 }
 
@@ -3271,14 +3654,18 @@ bool ThinEngine::_bindTextureDirectly(unsigned int target, const InternalTexture
     }
 
     _boundTexturesCache[_activeChannel] = texture;
+    _glStateCache->countTextureBind();
 
     if (texture) {
       texture->_associatedChannel = _activeChannel;
     }
   }
-  else if (forTextureDataUpdate) {
-    wasPreviouslyBound = true;
-    _activateCurrentTexture();
+  else {
+    _glStateCache->countFiltered();
+    if (forTextureDataUpdate) {
+      wasPreviouslyBound = true;
+      _activateCurrentTexture();
+    }
   }
 
   if (isTextureForRendering && !forTextureDataUpdate) {
@@ -3324,6 +3711,10 @@ void ThinEngine::setTexture(int channel, const WebGLUniformLocationPtr& uniform,
     return;
   }
 
+  if (_snapshotRecorder) {
+    _snapshotRecorder->recordTexture(channel, uniform, texture);
+  }
+
   if (uniform) {
     _boundUniforms[channel] = uniform;
   }
@@ -3338,11 +3729,10 @@ void ThinEngine::_bindSamplerUniformToChannel(int sourceSlot, int destination)
   }
 
   auto& uniform = _boundUniforms[sourceSlot];
-  if (!uniform || uniform->_currentState == destination) {
+  if (!uniform || !_glStateCache->uniform(*uniform, &destination, sizeof(destination))) {
     return;
   }
   _gl->uniform1i(uniform.get(), destination);
-  uniform->_currentState = destination;
 }
 
 unsigned int ThinEngine::_getTextureWrapMode(unsigned int mode) const
@@ -3474,6 +3864,10 @@ void ThinEngine::setTextureArray(int channel, const WebGLUniformLocationPtr& uni
     return;
   }
 
+  if (_snapshotRecorder) {
+    _snapshotRecorder->recordTextureArray(channel, uniform, textures);
+  }
+
   if (_textureUnits.empty() || _textureUnits.size() != textures.size()) {
     _textureUnits.clear();
     _textureUnits.resize(textures.size());
@@ -3490,7 +3884,10 @@ void ThinEngine::setTextureArray(int channel, const WebGLUniformLocationPtr& uni
       _textureUnits[i] = -1;
     }
   }
-  _gl->uniform1iv(uniform.get(), _textureUnits);
+  if (_glStateCache->uniform(*uniform, _textureUnits.data(),
+                             _textureUnits.size() * sizeof(int32_t))) {
+    _gl->uniform1iv(uniform.get(), _textureUnits);
+  }
 
   size_t index = 0;
   for (const auto& texture : textures) {
@@ -3596,6 +3993,17 @@ void ThinEngine::dispose()
   // Release effects
   releaseEffects();
 
+  // Write the index of the binaries stored since the last flush
+  if (_programBinaryCache) {
+    _programBinaryCache->flush();
+  }
+
+  // Release the uniform buffers ring
+  if (_uniformBufferRing) {
+    _uniformBufferRing->dispose();
+    _uniformBufferRing = nullptr;
+  }
+
   // Unbind
   unbindAllAttributes();
   _boundUniforms = {};
@@ -4143,6 +4551,10 @@ void ThinEngine::updateDynamicIndexBuffer(const WebGLDataBufferPtr& indexBuffer,
 void ThinEngine::updateDynamicVertexBuffer(const WebGLDataBufferPtr& vertexBuffer,
                                            const Float32Array& data, int byteOffset, int byteLength)
 {
+  if (_snapshotRecorder) {
+    _snapshotRecorder->recordUpdateDynamicVertexBuffer(vertexBuffer, data, byteOffset, byteLength);
+  }
+
   _dynamicBufferExtension->updateDynamicVertexBuffer(vertexBuffer, data, byteOffset, byteLength);
 }
 
@@ -4379,6 +4791,10 @@ WebGLDataBufferPtr ThinEngine::createDynamicUniformBuffer(const Float32Array& el
 void ThinEngine::updateUniformBuffer(const WebGLDataBufferPtr& uniformBuffer,
                                      const Float32Array& elements, int offset, int count)
 {
+  if (_snapshotRecorder) {
+    _snapshotRecorder->recordUpdateUniformBuffer(uniformBuffer, elements, offset, count);
+  }
+
   _uniformBufferExtension->updateUniformBuffer(uniformBuffer, elements, offset, count);
 }
 
@@ -4390,9 +4806,19 @@ void ThinEngine::bindUniformBuffer(const WebGLDataBufferPtr& buffer)
 void ThinEngine::bindUniformBufferBase(const WebGLDataBufferPtr& buffer, unsigned int location,
                                        const std::string& name)
 {
+  if (_snapshotRecorder) {
+    _snapshotRecorder->recordBindUniformBufferBase(buffer, location, name);
+  }
+
   _uniformBufferExtension->bindUniformBufferBase(buffer, location, name);
 }
 
+void ThinEngine::bindUniformBufferRange(const WebGLDataBufferPtr& buffer, unsigned int location,
+                                        size_t byteOffset, size_t byteLength)
+{
+  _uniformBufferExtension->bindUniformBufferRange(buffer, location, byteOffset, byteLength);
+}
+
 void ThinEngine::bindUniformBlock(const IPipelineContextPtr& pipelineContext,
                                   const std::string& blockName, unsigned int index)
 {
@@ -0,0 +1,152 @@
+#include <babylon/engines/uniform_buffer_ring.h>
+
+#include <algorithm>
+
+#include <babylon/engines/thin_engine.h>
+#include <babylon/meshes/webgl/webgl_data_buffer.h>
+
+namespace BABYLON {
+
+UniformBufferRing::UniformBufferRing(ThinEngine* engine, size_t offsetAlignment,
+                                     size_t chunkByteLength, size_t framesInFlight)
+    : _engine{engine}
+    , _alignment{std::max<size_t>((offsetAlignment + sizeof(float) - 1) / sizeof(float), 1)}
+    , _chunkLength{chunkByteLength / sizeof(float)}
+    , _frames(std::max<size_t>(framesInFlight, 1))
+    , _frameIndex{0}
+    , _frame{1}
+    , _engineFrameId{engine->frameId()}
+    , _allocatedBytes{0}
+    , _uploads{0}
+{
+}
+
+UniformBufferRing::~UniformBufferRing() = default;
+
+void UniformBufferRing::_checkNewFrame()
+{
+  if (_engineFrameId == _engine->frameId()) {
+    return;
+  }
+
+  // Upload what is left of the previous frame before recycling the chunks of the oldest frame
+  flush();
+
+  _engineFrameId = _engine->frameId();
+  _frameIndex    = (_frameIndex + 1) % _frames.size();
+  ++_frame;
+
+  auto& frame         = _frames[_frameIndex];
+  frame.chunkIndex    = 0;
+  frame.offset        = 0;
+  frame.flushedOffset = 0;
+
+  _allocatedBytes = 0;
+  _uploads        = 0;
+}
+
+UniformBufferRing::Chunk& UniformBufferRing::_getChunk(size_t elementCount)
+{
+  auto& frame = _frames[_frameIndex];
+  auto offset = (frame.offset + _alignment - 1) / _alignment * _alignment;
+
+  while (frame.chunkIndex < frame.chunks.size()
+         && offset + elementCount > frame.chunks[frame.chunkIndex].data.size()) {
+    // The chunk is full, its pending data is uploaded before moving to the next one
+    flush();
+    ++frame.chunkIndex;
+    frame.offset        = 0;
+    frame.flushedOffset = 0;
+    offset              = 0;
+  }
+
+  if (frame.chunkIndex == frame.chunks.size()) {
+    Chunk chunk;
+    chunk.data   = Float32Array(std::max(_chunkLength, elementCount), 0.f);
+    chunk.buffer = _engine->createDynamicUniformBuffer(chunk.data);
+    frame.chunks.emplace_back(std::move(chunk));
+  }
+
+  frame.offset = offset;
+  return frame.chunks[frame.chunkIndex];
+}
+
+UniformBufferRing::Range UniformBufferRing::allocate(const Float32Array& data)
+{
+  _checkNewFrame();
+
+  auto& chunk       = _getChunk(data.size());
+  auto& frame       = _frames[_frameIndex];
+  const auto offset = frame.offset;
+  std::copy(data.begin(), data.end(), chunk.data.begin() + static_cast<std::ptrdiff_t>(offset));
+  frame.offset = offset + data.size();
+
+  _allocatedBytes += data.size() * sizeof(float);
+
+  Range range;
+  range.buffer     = chunk.buffer;
+  range.byteOffset = offset * sizeof(float);
+  range.byteLength = data.size() * sizeof(float);
+  range.frame      = _frame;
+  return range;
+}
+
+bool UniformBufferRing::isValid(const Range& range)
+{
+  _checkNewFrame();
+
+  return range.buffer && range.frame == _frame;
+}
+
+void UniformBufferRing::flush()
+{
+  auto& frame = _frames[_frameIndex];
+  if (frame.offset <= frame.flushedOffset || frame.chunkIndex >= frame.chunks.size()) {
+    return;
+  }
+
+  // A single upload for all the uniform buffers allocated since the last draw call
+  const auto& chunk = frame.chunks[frame.chunkIndex];
+  _uploadData.assign(chunk.data.begin() + static_cast<std::ptrdiff_t>(frame.flushedOffset),
+                     chunk.data.begin() + static_cast<std::ptrdiff_t>(frame.offset));
+  _engine->updateUniformBuffer(chunk.buffer, _uploadData,
+                               static_cast<int>(frame.flushedOffset * sizeof(float)));
+
+  frame.flushedOffset = frame.offset;
+  ++_uploads;
+}
+
+void UniformBufferRing::_rebuild()
+{
+  for (auto& frame : _frames) {
+    frame.chunks.clear();
+    frame.chunkIndex    = 0;
+    frame.offset        = 0;
+    frame.flushedOffset = 0;
+  }
+
+  // The ranges allocated so far refer to the forgotten buffers
+  ++_frame;
+}
+
+void UniformBufferRing::dispose()
+{
+  for (const auto& frame : _frames) {
+    for (const auto& chunk : frame.chunks) {
+      _engine->_releaseBuffer(chunk.buffer);
+    }
+  }
+
+  _rebuild();
+}
+
+size_t UniformBufferRing::chunkCount() const
+{
+  size_t count = 0;
+  for (const auto& frame : _frames) {
+    count += frame.chunks.size();
+  }
+  return count;
+}
+
+} // end of namespace BABYLON
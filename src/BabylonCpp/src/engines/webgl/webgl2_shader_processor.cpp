@@ -23,8 +23,8 @@ WebGL2ShaderProcessor::WebGL2ShaderProcessor()
 
   postProcessor = [this](const std::string& code, const std::vector<std::string>& defines,
                          bool isFragment, const ShaderProcessingContextPtr& processingContext,
-                         ThinEngine* engine) -> std::string {
-    return _postProcessor(code, defines, isFragment, processingContext, engine);
+                         const ShaderProcessorParameters& parameters) -> std::string {
+    return _postProcessor(code, defines, isFragment, processingContext, parameters);
   };
 }
 
@@ -40,7 +40,8 @@ std::string WebGL2ShaderProcessor::_varyingProcessor(const std::string& varying,
 
 std::string WebGL2ShaderProcessor::_postProcessor(
   std::string code, const std::vector<std::string>& defines, bool isFragment,
-  const ShaderProcessingContextPtr& /*processingContext*/, ThinEngine* /*engine*/)
+  const ShaderProcessingContextPtr& /*processingContext*/,
+  const ShaderProcessorParameters& /*parameters*/)
 {
   const auto hasDrawBuffersExtension
     = StringTools::contains(code, "#extension.+GL_EXT_draw_buffers.+require");
@@ -62,10 +62,16 @@ void WebGLPipelineContext::_fillEffectInformation(
   }
 
   const auto effectAvailableUniforms = engine->getUniforms(this, uniformsNames);
+  _uniformSlots.clear();
+  _uniformSlots.resize(effectAvailableUniforms.size());
+  _uniformSlotIndices.clear();
+  _uniformSlotIndices.reserve(effectAvailableUniforms.size());
   for (size_t index = 0; index < effectAvailableUniforms.size(); ++index) {
     uniforms[uniformsNames[index]] = effectAvailableUniforms[index];
+    _uniformSlots[index].location  = effectAvailableUniforms[index];
+    // Duplicated names keep the first slot, as Effect::getUniformHandle does
+    _uniformSlotIndices.emplace(uniformsNames[index], index);
   }
-  _uniforms = uniforms;
 
   stl_util::erase_remove_if(samplerList, [&effect](const std::string& uniformName) {
     return effect->getUniform(uniformName) == nullptr;
@@ -82,199 +88,217 @@ void WebGLPipelineContext::_fillEffectInformation(
 
 void WebGLPipelineContext::dispose()
 {
-  _uniforms = {};
+  _uniformSlots       = {};
+  _uniformSlotIndices = {};
 }
 
 WebGLUniformLocationPtr WebGLPipelineContext::getUniform(const std::string& uniformName)
 {
-  if (stl_util::contains(_uniforms, uniformName)) {
-    return _uniforms[uniformName];
+  auto it = _uniformSlotIndices.find(uniformName);
+  return it != _uniformSlotIndices.end() ? _uniformSlots[it->second].location : nullptr;
+}
+
+void WebGLPipelineContext::_clearValueCache()
+{
+  for (auto& slot : _uniformSlots) {
+    slot.cachedSize    = 0;
+    slot.hasMatrixFlag = false;
+  }
+}
+
+WebGLPipelineContext::UniformSlot* WebGLPipelineContext::_getSlot(const std::string& uniformName)
+{
+  auto it = _uniformSlotIndices.find(uniformName);
+  if (it == _uniformSlotIndices.end()) {
+    return nullptr;
   }
 
-  return nullptr;
+  // Uniforms removed by the shader compiler have no location, there is nothing to set
+  auto& slot = _uniformSlots[it->second];
+  return slot.location ? &slot : nullptr;
 }
 
-bool WebGLPipelineContext::_cacheMatrix(const std::string& uniformName, const Matrix& matrix)
+WebGLPipelineContext::UniformSlot* WebGLPipelineContext::_getSlot(int uniformHandle)
 {
-  auto flag = matrix.updateFlag;
-  if (stl_util::contains(_valueCache, uniformName) && !_valueCache[uniformName].empty()
-      && static_cast<int>(_valueCache[uniformName][0]) == flag) {
-    return false;
+  if (uniformHandle < 0 || static_cast<size_t>(uniformHandle) >= _uniformSlots.size()) {
+    return nullptr;
   }
 
-  if (_valueCache[uniformName].empty()) {
-    _valueCache[uniformName].emplace_back(static_cast<float>(flag));
+  auto& slot = _uniformSlots[static_cast<size_t>(uniformHandle)];
+  return slot.location ? &slot : nullptr;
+}
+
+WebGLUniformLocationPtr WebGLPipelineContext::_invalidateSlot(const std::string& uniformName)
+{
+  auto slot = _getSlot(uniformName);
+  if (!slot) {
+    return nullptr;
   }
-  else {
-    _valueCache[uniformName][0] = static_cast<float>(flag);
+
+  slot->cachedSize    = 0;
+  slot->hasMatrixFlag = false;
+  return slot->location;
+}
+
+bool WebGLPipelineContext::_cacheMatrix(UniformSlot& slot, const Matrix& matrix)
+{
+  if (slot.hasMatrixFlag && slot.matrixUpdateFlag == matrix.updateFlag) {
+    return false;
   }
 
+  slot.cachedSize       = 0;
+  slot.hasMatrixFlag    = true;
+  slot.matrixUpdateFlag = matrix.updateFlag;
   return true;
 }
 
-bool WebGLPipelineContext::_cacheFloat2(const std::string& uniformName, float x, float y)
+bool WebGLPipelineContext::_cacheFloats(UniformSlot& slot, size_t size, float x, float y, float z,
+                                        float w)
 {
-  if (!stl_util::contains(_valueCache, uniformName) || _valueCache[uniformName].size() != 2) {
-    _valueCache[uniformName] = {x, y};
+  const std::array<float, 4> values{x, y, z, w};
+  slot.hasMatrixFlag = false;
+  if (slot.cachedSize != size) {
+    slot.cachedSize = size;
+    slot.cache      = values;
     return true;
   }
 
   auto changed = false;
-  auto& cache  = _valueCache[uniformName];
-  if (!stl_util::almost_equal(cache[0], x)) {
-    cache[0] = x;
-    changed  = true;
-  }
-  if (!stl_util::almost_equal(cache[1], y)) {
-    cache[1] = y;
-    changed  = true;
+  for (size_t i = 0; i < size; ++i) {
+    if (!stl_util::almost_equal(slot.cache[i], values[i])) {
+      slot.cache[i] = values[i];
+      changed       = true;
+    }
   }
 
   return changed;
 }
 
-bool WebGLPipelineContext::_cacheFloat3(const std::string& uniformName, float x, float y, float z)
+void WebGLPipelineContext::_setMatrix(UniformSlot* slot, const Matrix& matrix)
 {
-  if (!stl_util::contains(_valueCache, uniformName) || _valueCache[uniformName].size() != 3) {
-    _valueCache[uniformName] = {x, y, z};
-    return true;
+  if (slot && _cacheMatrix(*slot, matrix)) {
+    engine->setMatrix(slot->location, matrix);
   }
+}
 
-  auto changed = false;
-  auto& cache  = _valueCache[uniformName];
-  if (!stl_util::almost_equal(cache[0], x)) {
-    cache[0] = x;
-    changed  = true;
-  }
-  if (!stl_util::almost_equal(cache[1], y)) {
-    cache[1] = y;
-    changed  = true;
-  }
-  if (!stl_util::almost_equal(cache[2], z)) {
-    cache[2] = z;
-    changed  = true;
+void WebGLPipelineContext::_setInt(UniformSlot* slot, int value)
+{
+  if (slot && _cacheFloats(*slot, 1, static_cast<float>(value))) {
+    engine->setInt(slot->location, value);
   }
-
-  return changed;
 }
 
-bool WebGLPipelineContext::_cacheFloat4(const std::string& uniformName, float x, float y, float z,
-                                        float w)
+void WebGLPipelineContext::_setInt2(UniformSlot* slot, int x, int y)
 {
-  if (!stl_util::contains(_valueCache, uniformName) || _valueCache[uniformName].size() != 4) {
-    _valueCache[uniformName] = {x, y, z, w};
-    return true;
+  if (slot && _cacheFloats(*slot, 2, static_cast<float>(x), static_cast<float>(y))) {
+    engine->setInt2(slot->location, x, y);
   }
+}
 
-  auto changed = false;
-  auto& cache  = _valueCache[uniformName];
-  if (!stl_util::almost_equal(cache[0], x)) {
-    cache[0] = x;
-    changed  = true;
-  }
-  if (!stl_util::almost_equal(cache[1], y)) {
-    cache[1] = y;
-    changed  = true;
+void WebGLPipelineContext::_setInt3(UniformSlot* slot, int x, int y, int z)
+{
+  if (slot
+      && _cacheFloats(*slot, 3, static_cast<float>(x), static_cast<float>(y),
+                      static_cast<float>(z))) {
+    engine->setInt3(slot->location, x, y, z);
   }
-  if (!stl_util::almost_equal(cache[2], z)) {
-    cache[2] = z;
-    changed  = true;
+}
+
+void WebGLPipelineContext::_setInt4(UniformSlot* slot, int x, int y, int z, int w)
+{
+  if (slot
+      && _cacheFloats(*slot, 4, static_cast<float>(x), static_cast<float>(y),
+                      static_cast<float>(z), static_cast<float>(w))) {
+    engine->setInt4(slot->location, x, y, z, w);
   }
-  if (!stl_util::almost_equal(cache[3], w)) {
-    cache[3] = w;
-    changed  = true;
+}
+
+void WebGLPipelineContext::_setFloat(UniformSlot* slot, float value)
+{
+  if (slot && _cacheFloats(*slot, 1, value)) {
+    engine->setFloat(slot->location, value);
   }
+}
 
-  return changed;
+void WebGLPipelineContext::_setFloat2(UniformSlot* slot, float x, float y)
+{
+  if (slot && _cacheFloats(*slot, 2, x, y)) {
+    engine->setFloat2(slot->location, x, y);
+  }
 }
 
-void WebGLPipelineContext::setInt(const std::string& uniformName, int value)
+void WebGLPipelineContext::_setFloat3(UniformSlot* slot, float x, float y, float z)
 {
-  Float32Array _value{static_cast<float>(value)};
-  if (stl_util::contains(_valueCache, uniformName) && (_valueCache[uniformName] == _value)) {
-    return;
+  if (slot && _cacheFloats(*slot, 3, x, y, z)) {
+    engine->setFloat3(slot->location, x, y, z);
   }
+}
 
-  if (engine->setInt(getUniform(uniformName), value)) {
-    _valueCache[uniformName] = _value;
+void WebGLPipelineContext::_setFloat4(UniformSlot* slot, float x, float y, float z, float w)
+{
+  if (slot && _cacheFloats(*slot, 4, x, y, z, w)) {
+    engine->setFloat4(slot->location, x, y, z, w);
   }
 }
 
+void WebGLPipelineContext::setInt(const std::string& uniformName, int value)
+{
+  _setInt(_getSlot(uniformName), value);
+}
+
 void WebGLPipelineContext::setInt2(const std::string& uniformName, int x, int y)
 {
-  if (_cacheFloat2(uniformName, static_cast<float>(x), static_cast<float>(y))) {
-    if (!engine->setInt2(getUniform(uniformName), x, y)) {
-      _valueCache.erase(uniformName);
-    }
-  }
+  _setInt2(_getSlot(uniformName), x, y);
 }
 
 void WebGLPipelineContext::setInt3(const std::string& uniformName, int x, int y, int z)
 {
-  if (_cacheFloat3(uniformName, static_cast<float>(x), static_cast<float>(y),
-                   static_cast<float>(z))) {
-    if (!engine->setInt3(getUniform(uniformName), x, y, z)) {
-      _valueCache.erase(uniformName);
-    }
-  }
+  _setInt3(_getSlot(uniformName), x, y, z);
 }
 
 void WebGLPipelineContext::setInt4(const std::string& uniformName, int x, int y, int z, int w)
 {
-  if (_cacheFloat4(uniformName, static_cast<float>(x), static_cast<float>(y), static_cast<float>(z),
-                   static_cast<float>(w))) {
-    if (!engine->setInt4(getUniform(uniformName), x, y, z, w)) {
-      _valueCache.erase(uniformName);
-    }
-  }
+  _setInt4(_getSlot(uniformName), x, y, z, w);
 }
 
 void WebGLPipelineContext::setIntArray(const std::string& uniformName, const Int32Array& array)
 {
-  _valueCache.erase(uniformName);
-  engine->setIntArray(getUniform(uniformName), array);
+  engine->setIntArray(_invalidateSlot(uniformName), array);
 }
 
 void WebGLPipelineContext::setIntArray2(const std::string& uniformName, const Int32Array& array)
 {
-  _valueCache.erase(uniformName);
-  engine->setIntArray2(getUniform(uniformName), array);
+  engine->setIntArray2(_invalidateSlot(uniformName), array);
 }
 
 void WebGLPipelineContext::setIntArray3(const std::string& uniformName, const Int32Array& array)
 {
-  _valueCache.erase(uniformName);
-  engine->setIntArray3(getUniform(uniformName), array);
+  engine->setIntArray3(_invalidateSlot(uniformName), array);
 }
 
 void WebGLPipelineContext::setIntArray4(const std::string& uniformName, const Int32Array& array)
 {
-  _valueCache.erase(uniformName);
-  engine->setIntArray4(getUniform(uniformName), array);
+  engine->setIntArray4(_invalidateSlot(uniformName), array);
 }
 
 void WebGLPipelineContext::setArray(const std::string& uniformName, const Float32Array& array)
 {
-  _valueCache.erase(uniformName);
-  engine->setArray(getUniform(uniformName), array);
+  engine->setArray(_invalidateSlot(uniformName), array);
 }
 
 void WebGLPipelineContext::setArray2(const std::string& uniformName, const Float32Array& array)
 {
-  _valueCache.erase(uniformName);
-  engine->setArray2(getUniform(uniformName), array);
+  engine->setArray2(_invalidateSlot(uniformName), array);
 }
 
 void WebGLPipelineContext::setArray3(const std::string& uniformName, const Float32Array& array)
 {
-  _valueCache.erase(uniformName);
-  engine->setArray3(getUniform(uniformName), array);
+  engine->setArray3(_invalidateSlot(uniformName), array);
 }
 
 void WebGLPipelineContext::setArray4(const std::string& uniformName, const Float32Array& array)
 {
-  _valueCache.erase(uniformName);
-  engine->setArray4(getUniform(uniformName), array);
+  engine->setArray4(_invalidateSlot(uniformName), array);
 }
 
 void WebGLPipelineContext::setMatrices(const std::string& uniformName, const Float32Array& matrices)
@@ -283,124 +307,104 @@ void WebGLPipelineContext::setMatrices(const std::string& uniformName, const Flo
     return;
   }
 
-  _valueCache.erase(uniformName);
-  engine->setMatrices(getUniform(uniformName), matrices);
+  engine->setMatrices(_invalidateSlot(uniformName), matrices);
 }
 
 void WebGLPipelineContext::setMatrix(const std::string& uniformName, const Matrix& matrix)
 {
-  if (_cacheMatrix(uniformName, matrix)) {
-    if (!engine->setMatrices(getUniform(uniformName), matrix.toArray())) {
-      _valueCache.erase(uniformName);
-    }
-  }
+  _setMatrix(_getSlot(uniformName), matrix);
 }
 
 void WebGLPipelineContext::setMatrix3x3(const std::string& uniformName, const Float32Array& matrix)
 {
-  _valueCache.erase(uniformName);
-  engine->setMatrix3x3(getUniform(uniformName), matrix);
+  engine->setMatrix3x3(_invalidateSlot(uniformName), matrix);
 }
 
 void WebGLPipelineContext::setMatrix2x2(const std::string& uniformName, const Float32Array& matrix)
 {
-  _valueCache.erase(uniformName);
-  engine->setMatrix2x2(getUniform(uniformName), matrix);
+  engine->setMatrix2x2(_invalidateSlot(uniformName), matrix);
 }
 
 void WebGLPipelineContext::setFloat(const std::string& uniformName, float value)
 {
-  if (stl_util::contains(_valueCache, uniformName)
-      && stl_util::almost_equal(_valueCache[uniformName][0], value)) {
-    return;
-  }
-
-  if (engine->setFloat(getUniform(uniformName), value)) {
-    _valueCache[uniformName] = {value};
-  }
+  _setFloat(_getSlot(uniformName), value);
 }
 
 void WebGLPipelineContext::setVector2(const std::string& uniformName, const Vector2& vector2)
 {
-  if (_cacheFloat2(uniformName, vector2.x, vector2.y)) {
-    if (!engine->setFloat2(getUniform(uniformName), vector2.x, vector2.y)) {
-      _valueCache.erase(uniformName);
-    }
-  }
+  _setFloat2(_getSlot(uniformName), vector2.x, vector2.y);
 }
 
 void WebGLPipelineContext::setFloat2(const std::string& uniformName, float x, float y)
 {
-  if (_cacheFloat2(uniformName, x, y)) {
-    if (!engine->setFloat2(getUniform(uniformName), x, y)) {
-      _valueCache.erase(uniformName);
-    }
-  }
+  _setFloat2(_getSlot(uniformName), x, y);
 }
 
 void WebGLPipelineContext::setVector3(const std::string& uniformName, const Vector3& vector3)
 {
-  if (_cacheFloat3(uniformName, vector3.x, vector3.y, vector3.z)) {
-    if (!engine->setFloat3(getUniform(uniformName), vector3.x, vector3.y, vector3.z)) {
-      _valueCache.erase(uniformName);
-    }
-  }
+  _setFloat3(_getSlot(uniformName), vector3.x, vector3.y, vector3.z);
 }
 
 void WebGLPipelineContext::setFloat3(const std::string& uniformName, float x, float y, float z)
 {
-  if (_cacheFloat3(uniformName, x, y, z)) {
-    if (!engine->setFloat3(getUniform(uniformName), x, y, z)) {
-      _valueCache.erase(uniformName);
-    }
-  }
+  _setFloat3(_getSlot(uniformName), x, y, z);
 }
 
 void WebGLPipelineContext::setVector4(const std::string& uniformName, const Vector4& vector4)
 {
-  if (_cacheFloat4(uniformName, vector4.x, vector4.y, vector4.z, vector4.w)) {
-    if (!engine->setFloat4(getUniform(uniformName), vector4.x, vector4.y, vector4.z, vector4.w)) {
-      _valueCache.erase(uniformName);
-    }
-  }
+  _setFloat4(_getSlot(uniformName), vector4.x, vector4.y, vector4.z, vector4.w);
 }
 
 void WebGLPipelineContext::setFloat4(const std::string& uniformName, float x, float y, float z,
                                      float w)
 {
-  if (_cacheFloat4(uniformName, x, y, z, w)) {
-    if (!engine->setFloat4(getUniform(uniformName), x, y, z, w)) {
-      _valueCache.erase(uniformName);
-    }
-  }
+  _setFloat4(_getSlot(uniformName), x, y, z, w);
 }
 
 void WebGLPipelineContext::setColor3(const std::string& uniformName, const Color3& color3)
 {
-  if (_cacheFloat3(uniformName, color3.r, color3.g, color3.b)) {
-    if (!engine->setFloat3(getUniform(uniformName), color3.r, color3.g, color3.b)) {
-      _valueCache.erase(uniformName);
-    }
-  }
+  _setFloat3(_getSlot(uniformName), color3.r, color3.g, color3.b);
 }
 
 void WebGLPipelineContext::setColor4(const std::string& uniformName, const Color3& color3,
                                      float alpha)
 {
-  if (_cacheFloat4(uniformName, color3.r, color3.g, color3.b, alpha)) {
-    if (!engine->setFloat4(getUniform(uniformName), color3.r, color3.g, color3.b, alpha)) {
-      _valueCache.erase(uniformName);
-    }
-  }
+  _setFloat4(_getSlot(uniformName), color3.r, color3.g, color3.b, alpha);
 }
 
 void WebGLPipelineContext::setDirectColor4(const std::string& uniformName, const Color4& color4)
 {
-  if (_cacheFloat4(uniformName, color4.r, color4.g, color4.b, color4.a)) {
-    if (!engine->setFloat4(getUniform(uniformName), color4.r, color4.g, color4.b, color4.a)) {
-      _valueCache.erase(uniformName);
-    }
-  }
+  _setFloat4(_getSlot(uniformName), color4.r, color4.g, color4.b, color4.a);
+}
+
+void WebGLPipelineContext::setInt(int uniformHandle, int value)
+{
+  _setInt(_getSlot(uniformHandle), value);
+}
+
+void WebGLPipelineContext::setMatrix(int uniformHandle, const Matrix& matrix)
+{
+  _setMatrix(_getSlot(uniformHandle), matrix);
+}
+
+void WebGLPipelineContext::setFloat(int uniformHandle, float value)
+{
+  _setFloat(_getSlot(uniformHandle), value);
+}
+
+void WebGLPipelineContext::setFloat2(int uniformHandle, float x, float y)
+{
+  _setFloat2(_getSlot(uniformHandle), x, y);
+}
+
+void WebGLPipelineContext::setFloat3(int uniformHandle, float x, float y, float z)
+{
+  _setFloat3(_getSlot(uniformHandle), x, y, z);
+}
+
+void WebGLPipelineContext::setFloat4(int uniformHandle, float x, float y, float z, float w)
+{
+  _setFloat4(_getSlot(uniformHandle), x, y, z, w);
 }
 
 std::string WebGLPipelineContext::_getVertexShaderCode() const
@@ -1,6 +1,6 @@
 #include <babylon/engines/webgl/webgl_shader_processor.h>
 
-#include <babylon/engines/thin_engine.h>
+#include <babylon/engines/processors/shader_processing_options.h>
 #include <babylon/misc/string_tools.h>
 
 namespace BABYLON {
@@ -9,17 +9,18 @@ WebGLShaderProcessor::WebGLShaderProcessor() : IShaderProcessor{}
 {
   postProcessor = [this](const std::string& code, const std::vector<std::string>& defines,
                          bool isFragment, const ShaderProcessingContextPtr& processingContext,
-                         ThinEngine* engine) -> std::string {
-    return _postProcessor(code, defines, isFragment, processingContext, engine);
+                         const ShaderProcessorParameters& parameters) -> std::string {
+    return _postProcessor(code, defines, isFragment, processingContext, parameters);
   };
 }
 
 std::string WebGLShaderProcessor::_postProcessor(
   std::string code, const std::vector<std::string>& /*defines*/, bool /*isFragment*/,
-  const ShaderProcessingContextPtr& /*processingContext*/, ThinEngine* engine)
+  const ShaderProcessingContextPtr& /*processingContext*/,
+  const ShaderProcessorParameters& parameters)
 {
   // Remove extensions
-  if (!engine->getCaps().drawBuffersExtension) {
+  if (parameters.drawBuffersExtensionDisabled) {
     // even if enclosed in #if/#endif, IE11 does parse the #extension declaration, so we need to
     // remove it altogether
     const std::string regex("#extension.+GL_EXT_draw_buffers.+(enable|require)");
@@ -1,6 +1,7 @@
 #include <babylon/instrumentation/engine_instrumentation.h>
 
 #include <babylon/engines/engine.h>
+#include <babylon/states/gl_state_cache.h>
 
 namespace BABYLON {
 
@@ -11,14 +12,22 @@ EngineInstrumentation::EngineInstrumentation(Engine* engine)
     , shaderCompilationTimeCounter{this, &EngineInstrumentation::get_shaderCompilationTimeCounter}
     , captureShaderCompilationTime{this, &EngineInstrumentation::get_captureShaderCompilationTime,
                                    &EngineInstrumentation::set_captureShaderCompilationTime}
+    , glCallsCounter{this, &EngineInstrumentation::get_glCallsCounter}
+    , filteredGLCallsCounter{this, &EngineInstrumentation::get_filteredGLCallsCounter}
+    , programSwitchesCounter{this, &EngineInstrumentation::get_programSwitchesCounter}
+    , textureBindsCounter{this, &EngineInstrumentation::get_textureBindsCounter}
+    , captureGLStateStatistics{this, &EngineInstrumentation::get_captureGLStateStatistics,
+                               &EngineInstrumentation::set_captureGLStateStatistics}
     , _engine{engine}
     , _captureGPUFrameTime{false}
     , _gpuFrameTimeToken{std::nullopt}
     , _captureShaderCompilationTime{false}
+    , _captureGLStateStatistics{false}
     , _onBeginFrameObserver{nullptr}
     , _onEndFrameObserver{nullptr}
     , _onBeforeShaderCompilationObserver{nullptr}
     , _onAfterShaderCompilationObserver{nullptr}
+    , _onEndFrameGLStateObserver{nullptr}
 {
 }
 
@@ -108,6 +117,59 @@ void EngineInstrumentation::set_captureShaderCompilationTime(bool value)
   }
 }
 
+PerfCounter& EngineInstrumentation::get_glCallsCounter()
+{
+  return _glCalls;
+}
+
+PerfCounter& EngineInstrumentation::get_filteredGLCallsCounter()
+{
+  return _filteredGLCalls;
+}
+
+PerfCounter& EngineInstrumentation::get_programSwitchesCounter()
+{
+  return _programSwitches;
+}
+
+PerfCounter& EngineInstrumentation::get_textureBindsCounter()
+{
+  return _textureBinds;
+}
+
+bool EngineInstrumentation::get_captureGLStateStatistics() const
+{
+  return _captureGLStateStatistics;
+}
+
+void EngineInstrumentation::set_captureGLStateStatistics(bool value)
+{
+  if (value == _captureGLStateStatistics) {
+    return;
+  }
+
+  _captureGLStateStatistics = value;
+
+  if (value) {
+    _onEndFrameGLStateObserver
+      = _engine->onEndFrameObservable.add([this](Engine* /*engine*/, EventState& /*es*/) {
+          const auto& counters = _engine->getGLStateCounters();
+          _glCalls.fetchNewFrame();
+          _glCalls.addCount(counters.glCalls, true);
+          _filteredGLCalls.fetchNewFrame();
+          _filteredGLCalls.addCount(counters.filteredGLCalls, true);
+          _programSwitches.fetchNewFrame();
+          _programSwitches.addCount(counters.programSwitches, true);
+          _textureBinds.fetchNewFrame();
+          _textureBinds.addCount(counters.textureBinds, true);
+        });
+  }
+  else {
+    _engine->onEndFrameObservable.remove(_onEndFrameGLStateObserver);
+    _onEndFrameGLStateObserver = nullptr;
+  }
+}
+
 void EngineInstrumentation::dispose(bool /*doNotRecurse*/, bool /*disposeMaterialAndTextures*/)
 {
   _engine->onBeginFrameObservable.remove(_onBeginFrameObserver);
@@ -122,6 +184,9 @@ void EngineInstrumentation::dispose(bool /*doNotRecurse*/, bool /*disposeMateria
   _engine->onAfterShaderCompilationObservable.remove(_onAfterShaderCompilationObserver);
   _onAfterShaderCompilationObserver = nullptr;
 
+  _engine->onEndFrameObservable.remove(_onEndFrameGLStateObserver);
+  _onEndFrameGLStateObserver = nullptr;
+
   _engine = nullptr;
 }
 
@@ -0,0 +1,361 @@
+#include <babylon/lights/clustered/clustered_light_container.h>
+
+#include <cmath>
+
+#include <babylon/babylon_stl_util.h>
+#include <babylon/cameras/camera.h>
+#include <babylon/core/logging.h>
+#include <babylon/engines/engine.h>
+#include <babylon/engines/scene.h>
+#include <babylon/lights/spot_light.h>
+#include <babylon/materials/effect.h>
+#include <babylon/materials/material_defines.h>
+#include <babylon/materials/textures/raw_texture.h>
+#include <babylon/materials/uniform_buffer.h>
+#include <babylon/maths/vector3.h>
+
+namespace BABYLON {
+
+ClusteredLightContainer::ClusteredLightContainer(const std::string& iName,
+                                                 const std::vector<LightPtr>& iLights,
+                                                 Scene* scene)
+    : Light{iName, scene}
+    , useThreadPool{true}
+    , _lightCapacity{0}
+    , _depthRow{{0.f, 0.f, 1.f, 0.f}}
+    , _sliceData{{0.f, 0.f, 0.f, 0.f}}
+    , _clusterInfo{{0.f, 0.f, 1.f, 1.f}}
+{
+  for (const auto& light : iLights) {
+    addLight(light);
+  }
+
+  _onBeforeCameraRenderObserver = scene->onBeforeCameraRenderObservable.add(
+    [this](Camera* camera, EventState& /*es*/) { update(camera); });
+}
+
+ClusteredLightContainer::~ClusteredLightContainer() = default;
+
+bool ClusteredLightContainer::IsLightSupported(const LightPtr& light)
+{
+  if (!light) {
+    return false;
+  }
+
+  const auto typeId = light->getTypeID();
+  return typeId == Light::LIGHTTYPEID_POINTLIGHT || typeId == Light::LIGHTTYPEID_SPOTLIGHT;
+}
+
+std::string ClusteredLightContainer::getClassName() const
+{
+  return "ClusteredLightContainer";
+}
+
+Type ClusteredLightContainer::type() const
+{
+  return Type::CLUSTEREDLIGHT;
+}
+
+unsigned int ClusteredLightContainer::getTypeID() const
+{
+  return Light::LIGHTTYPEID_CLUSTERED_CONTAINER;
+}
+
+bool ClusteredLightContainer::isSupported() const
+{
+  const auto engine = getScene()->getEngine();
+  return engine->webGLVersion() >= 2.f && engine->getCaps().textureFloat;
+}
+
+void ClusteredLightContainer::addLight(const LightPtr& light)
+{
+  if (!IsLightSupported(light)) {
+    BABYLON_LOGF_WARN("ClusteredLightContainer", "Light \"%s\" is not a point or a spot light",
+                      light ? light->name.c_str() : "")
+    return;
+  }
+
+  if (stl_util::contains(_lights, light)) {
+    return;
+  }
+
+  // The light is only rendered through the container
+  getScene()->removeLight(light);
+  _lights.emplace_back(light);
+}
+
+void ClusteredLightContainer::removeLight(Light* light)
+{
+  auto it = std::find_if(_lights.begin(), _lights.end(),
+                         [light](const LightPtr& item) { return item.get() == light; });
+  if (it == _lights.end()) {
+    return;
+  }
+
+  const auto removedLight = *it;
+  _lights.erase(it);
+  getScene()->addLight(removedLight);
+}
+
+void ClusteredLightContainer::setGridSize(size_t horizontalTiles, size_t verticalTiles,
+                                          size_t depthSlices, size_t maxLightsPerCluster)
+{
+  _grid.resize(horizontalTiles, verticalTiles, depthSlices, maxLightsPerCluster);
+
+  // Recreated with the new size on the next update
+  if (_clusterTexture) {
+    _clusterTexture->dispose();
+    _clusterTexture = nullptr;
+  }
+}
+
+void ClusteredLightContainer::update(Camera* camera)
+{
+  if (!camera || !isSupported()) {
+    return;
+  }
+
+  auto scene       = getScene();
+  auto engine      = scene->getEngine();
+  const auto& view = camera->getViewMatrix();
+  const auto& m    = camera->getProjectionMatrix().m();
+
+  // Frustum of the camera, the view depth is along +z in the grid
+  const auto depthSign = scene->useRightHandedSystem() ? -1.f : 1.f;
+  const auto znear     = camera->minZ;
+  const auto zfar      = camera->maxZ > 0.f ? camera->maxZ : 10000.f;
+  if (m[15] == 0.f) {
+    // Perspective: ndc.x = m[0] * x / depth + m[8] * depthSign
+    _grid.setPerspective((-1.f - m[8] * depthSign) / m[0], (1.f - m[8] * depthSign) / m[0],
+                         (-1.f - m[9] * depthSign) / m[5], (1.f - m[9] * depthSign) / m[5], znear,
+                         zfar);
+  }
+  else {
+    // Orthographic: ndc.x = m[0] * x + m[12]
+    _grid.setOrthographic((-1.f - m[12]) / m[0], (1.f - m[12]) / m[0], (-1.f - m[13]) / m[5],
+                          (1.f - m[13]) / m[5], znear, zfar);
+  }
+
+  // Lights, in view space
+  _grid.clearLights();
+  _binnedLights.clear();
+  for (const auto& light : _lights) {
+    if (!light->isEnabled() || light->intensity == 0.f) {
+      continue;
+    }
+
+    auto shadowLight = std::static_pointer_cast<IShadowLight>(light);
+    const auto position
+      = shadowLight->computeTransformedInformation() ? shadowLight->transformedPosition() :
+                                                       shadowLight->position();
+    auto viewPosition = Vector3::TransformCoordinates(position, view);
+    viewPosition.z *= depthSign;
+    _grid.addLight(viewPosition, light->range());
+    _binnedLights.emplace_back(light.get());
+  }
+
+  _grid.bin(useThreadPool ? &engine->getThreadPool() : nullptr);
+
+  // Cluster lookup in the fragment shader
+  const auto& vm        = view.m();
+  const auto viewportX  = camera->viewport.x * static_cast<float>(engine->getRenderWidth());
+  const auto viewportY  = camera->viewport.y * static_cast<float>(engine->getRenderHeight());
+  const auto viewportW  = camera->viewport.width * static_cast<float>(engine->getRenderWidth());
+  const auto viewportH  = camera->viewport.height * static_cast<float>(engine->getRenderHeight());
+  const auto texelCount = (_grid.maxLightsPerCluster() + 1 + 3) / 4;
+  _depthRow  = {{vm[2] * depthSign, vm[6] * depthSign, vm[10] * depthSign, vm[14] * depthSign}};
+  _sliceData = {{static_cast<float>(_grid.tilesX()) / std::max(viewportW, 1.f),
+                 static_cast<float>(_grid.tilesY()) / std::max(viewportH, 1.f), _grid.sliceScale(),
+                 _grid.sliceBias()}};
+  _clusterInfo
+    = {{viewportX, viewportY, static_cast<float>(texelCount), static_cast<float>(_grid.slicesZ())}};
+
+  _packLights(_binnedLights.size());
+  _packClusters();
+}
+
+void ClusteredLightContainer::_packLights(size_t lightCount)
+{
+  // The texture grows by powers of two
+  if (!_lightDataTexture || lightCount > _lightCapacity) {
+    _lightCapacity = 64;
+    while (_lightCapacity < lightCount) {
+      _lightCapacity *= 2;
+    }
+    _lightData = ArrayBufferView(
+      ArrayBuffer(_lightCapacity * LightDataTexelCount * 4 * sizeof(float), 0));
+    _lightDataTexture = RawTexture::CreateRGBATexture(
+      _lightData, static_cast<int>(LightDataTexelCount), static_cast<int>(_lightCapacity),
+      getScene(), false, false, Constants::TEXTURE_NEAREST_SAMPLINGMODE,
+      Constants::TEXTURETYPE_FLOAT);
+  }
+
+  auto data = reinterpret_cast<float*>(_lightData.uint8Array().data());
+  for (size_t i = 0; i < lightCount; ++i) {
+    auto light       = _binnedLights[i];
+    auto shadowLight = static_cast<IShadowLight*>(light);
+    auto texels      = data + i * LightDataTexelCount * 4;
+
+    const auto& position = shadowLight->computeTransformedInformation() ?
+                             shadowLight->transformedPosition() :
+                             shadowLight->position();
+    const auto lightRange      = light->range();
+    const auto scaledIntensity = light->getScaledIntensity();
+
+    // Position and range
+    texels[0] = position.x;
+    texels[1] = position.y;
+    texels[2] = position.z;
+    texels[3] = lightRange;
+    // Diffuse and radius
+    texels[4] = light->diffuse.r * scaledIntensity;
+    texels[5] = light->diffuse.g * scaledIntensity;
+    texels[6] = light->diffuse.b * scaledIntensity;
+    texels[7] = light->radius();
+    // Specular and spot exponent
+    texels[8]  = light->specular.r * scaledIntensity;
+    texels[9]  = light->specular.g * scaledIntensity;
+    texels[10] = light->specular.b * scaledIntensity;
+    texels[11] = 0.f;
+    // Spot direction and cosine of the half angle
+    texels[12] = 0.f;
+    texels[13] = 0.f;
+    texels[14] = 0.f;
+    texels[15] = -1.f;
+    // Inverse squared range, spot angle scale and offset, spot flag
+    texels[16] = 1.f / (lightRange * lightRange);
+    texels[17] = 0.f;
+    texels[18] = 0.f;
+    texels[19] = 0.f;
+
+    if (light->getTypeID() == Light::LIGHTTYPEID_SPOTLIGHT) {
+      auto spotLight           = static_cast<SpotLight*>(light);
+      const auto direction     = Vector3::Normalize(spotLight->computeTransformedInformation() ?
+                                                      spotLight->transformedDirection() :
+                                                      spotLight->direction());
+      const auto cosHalfAngle  = std::cos(spotLight->angle() * 0.5f);
+      const auto cosInnerAngle = std::cos(spotLight->innerAngle() * 0.5f);
+      const auto angleScale    = 1.f / std::max(0.001f, cosInnerAngle - cosHalfAngle);
+      texels[11]               = spotLight->exponent;
+      texels[12]               = direction.x;
+      texels[13]               = direction.y;
+      texels[14]               = direction.z;
+      texels[15]               = cosHalfAngle;
+      texels[17]               = angleScale;
+      texels[18]               = -cosHalfAngle * angleScale;
+      texels[19]               = 1.f;
+    }
+  }
+
+  _lightDataTexture->update(_lightData);
+}
+
+void ClusteredLightContainer::_packClusters()
+{
+  const auto texelCount = static_cast<size_t>(_clusterInfo[2]);
+  const auto width      = _grid.tilesX() * texelCount;
+  const auto height     = _grid.tilesY() * _grid.slicesZ();
+
+  if (!_clusterTexture) {
+    _clusterData    = ArrayBufferView(ArrayBuffer(width * height * 4 * sizeof(float), 0));
+    _clusterTexture = RawTexture::CreateRGBATexture(
+      _clusterData, static_cast<int>(width), static_cast<int>(height), getScene(), false, false,
+      Constants::TEXTURE_NEAREST_SAMPLINGMODE, Constants::TEXTURETYPE_FLOAT);
+  }
+
+  // Cluster (x, y, z) starts at texel (x * texelCount, y + z * tilesY): light count followed by
+  // the light indices
+  auto data = reinterpret_cast<float*>(_clusterData.uint8Array().data());
+  for (size_t z = 0; z < _grid.slicesZ(); ++z) {
+    for (size_t y = 0; y < _grid.tilesY(); ++y) {
+      auto row = data + (y + z * _grid.tilesY()) * width * 4;
+      for (size_t x = 0; x < _grid.tilesX(); ++x) {
+        const auto cluster    = _grid.getClusterIndex(x, y, z);
+        const auto lightCount = _grid.getClusterLightCount(cluster);
+        const auto lights     = _grid.getClusterLights(cluster);
+        auto values           = row + x * texelCount * 4;
+        values[0]             = static_cast<float>(lightCount);
+        for (uint32_t i = 0; i < lightCount; ++i) {
+          values[i + 1] = static_cast<float>(lights[i]);
+        }
+      }
+    }
+  }
+
+  _clusterTexture->update(_clusterData);
+}
+
+IShadowGeneratorPtr ClusteredLightContainer::getShadowGenerator()
+{
+  return nullptr;
+}
+
+void ClusteredLightContainer::_buildUniformLayout()
+{
+  _uniformBuffer->addUniform("vLightData", 4);
+  _uniformBuffer->addUniform("vLightDiffuse", 4);
+  _uniformBuffer->addUniform("vLightSpecular", 4);
+  _uniformBuffer->addUniform("vSliceData", 4);
+  _uniformBuffer->addUniform("vClusterInfo", 4);
+  _uniformBuffer->addUniform("shadowsInfo", 3);
+  _uniformBuffer->addUniform("depthValues", 2);
+  _uniformBuffer->create();
+}
+
+void ClusteredLightContainer::transferToEffect(Effect* /*effect*/, const std::string& lightIndex)
+{
+  _uniformBuffer->updateFloat4("vLightData", _depthRow[0], _depthRow[1], _depthRow[2],
+                               _depthRow[3], lightIndex);
+  _uniformBuffer->updateFloat4("vSliceData", _sliceData[0], _sliceData[1], _sliceData[2],
+                               _sliceData[3], lightIndex);
+  _uniformBuffer->updateFloat4("vClusterInfo", _clusterInfo[0], _clusterInfo[1], _clusterInfo[2],
+                               _clusterInfo[3], lightIndex);
+}
+
+ClusteredLightContainer& ClusteredLightContainer::transferTexturesToEffect(
+  Effect* effect, const std::string& lightIndex)
+{
+  if (_lightDataTexture && _clusterTexture) {
+    effect->setTexture("lightDataTexture" + lightIndex, _lightDataTexture);
+    effect->setTexture("clusterTexture" + lightIndex, _clusterTexture);
+  }
+
+  return *this;
+}
+
+ClusteredLightContainer&
+ClusteredLightContainer::transferToNodeMaterialEffect(Effect* /*effect*/,
+                                                      const std::string& /*lightDataUniformName*/)
+{
+  return *this;
+}
+
+void ClusteredLightContainer::prepareLightSpecificDefines(MaterialDefines& defines,
+                                                          unsigned int lightIndex)
+{
+  defines.boolDef["CLUSTLIGHT" + std::to_string(lightIndex)] = isSupported();
+}
+
+void ClusteredLightContainer::dispose(bool doNotRecurse, bool disposeMaterialAndTextures)
+{
+  getScene()->onBeforeCameraRenderObservable.remove(_onBeforeCameraRenderObserver);
+
+  for (const auto& light : _lights) {
+    light->dispose(doNotRecurse, disposeMaterialAndTextures);
+  }
+  _lights.clear();
+  _binnedLights.clear();
+
+  if (_lightDataTexture) {
+    _lightDataTexture->dispose();
+    _lightDataTexture = nullptr;
+  }
+  if (_clusterTexture) {
+    _clusterTexture->dispose();
+    _clusterTexture = nullptr;
+  }
+
+  Light::dispose(doNotRecurse, disposeMaterialAndTextures);
+}
+
+} // end of namespace BABYLON
@@ -0,0 +1,420 @@
+#include <babylon/lights/clustered/clustered_light_grid.h>
+
+#include <algorithm>
+#include <cmath>
+
+#include <babylon/core/thread_pool.h>
+#include <babylon/maths/vector3.h>
+
+#if defined(__AVX__)
+#include <immintrin.h>
+#define BABYLON_CLUSTERED_LIGHT_GRID_AVX
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define BABYLON_CLUSTERED_LIGHT_GRID_SSE
+#endif
+
+namespace BABYLON {
+
+// Candidate arrays are padded to a multiple of the widest SIMD batch, padding lights never pass
+static constexpr size_t CLUSTERED_LIGHT_GRID_BATCH_SIZE = 8;
+
+// Minimum number of lights per chunk when computing the light bounds on the thread pool
+static constexpr size_t CLUSTERED_LIGHT_GRID_LIGHTS_GRAIN_SIZE = 256;
+
+ClusteredLightGrid::ClusteredLightGrid(size_t tilesX, size_t tilesY, size_t slicesZ,
+                                       size_t maxLightsPerCluster)
+    : _tilesX{0}
+    , _tilesY{0}
+    , _slicesZ{0}
+    , _maxLightsPerCluster{0}
+    , _orthographic{false}
+    , _left{-1.f}
+    , _right{1.f}
+    , _bottom{-1.f}
+    , _top{1.f}
+    , _near{1.f}
+    , _far{1000.f}
+    , _sliceScale{1.f}
+    , _sliceBias{0.f}
+    , _overflowCount{0}
+{
+  resize(tilesX, tilesY, slicesZ, maxLightsPerCluster);
+}
+
+ClusteredLightGrid::~ClusteredLightGrid() = default;
+
+void ClusteredLightGrid::resize(size_t tilesX, size_t tilesY, size_t slicesZ,
+                                size_t maxLightsPerCluster)
+{
+  _tilesX              = std::max<size_t>(tilesX, 1);
+  _tilesY              = std::max<size_t>(tilesY, 1);
+  _slicesZ             = std::max<size_t>(slicesZ, 1);
+  _maxLightsPerCluster = std::max<size_t>(maxLightsPerCluster, 1);
+
+  _clusterLightCounts.assign(clusterCount(), 0);
+  _clusterLights.assign(clusterCount() * _maxLightsPerCluster, 0);
+  _overflowCount = 0;
+
+  // The slice distribution depends on the number of slices
+  if (_orthographic) {
+    setOrthographic(_left, _right, _bottom, _top, _near, _far);
+  }
+  else {
+    setPerspective(_left, _right, _bottom, _top, _near, _far);
+  }
+}
+
+void ClusteredLightGrid::setPerspective(float left, float right, float bottom, float top,
+                                        float znear, float zfar)
+{
+  _orthographic = false;
+  _left         = left;
+  _right        = right;
+  _bottom       = bottom;
+  _top          = top;
+  _near         = std::max(znear, 1e-4f);
+  _far          = std::max(zfar, _near * 1.001f);
+  _sliceScale   = static_cast<float>(_slicesZ) / std::log(_far / _near);
+  _sliceBias    = -std::log(_near) * _sliceScale;
+}
+
+void ClusteredLightGrid::setOrthographic(float left, float right, float bottom, float top,
+                                         float znear, float zfar)
+{
+  setPerspective(left, right, bottom, top, znear, zfar);
+  _orthographic = true;
+}
+
+void ClusteredLightGrid::clearLights()
+{
+  _lightX.clear();
+  _lightY.clear();
+  _lightZ.clear();
+  _lightRange.clear();
+}
+
+uint32_t ClusteredLightGrid::addLight(const Vector3& viewPosition, float range)
+{
+  _lightX.emplace_back(viewPosition.x);
+  _lightY.emplace_back(viewPosition.y);
+  _lightZ.emplace_back(viewPosition.z);
+  _lightRange.emplace_back(range);
+  return static_cast<uint32_t>(_lightX.size() - 1);
+}
+
+size_t ClusteredLightGrid::computeSlice(float depth) const
+{
+  if (depth <= _near) {
+    return 0;
+  }
+
+  const auto slice = std::floor(std::log(depth) * _sliceScale + _sliceBias);
+  return static_cast<size_t>(std::clamp(slice, 0.f, static_cast<float>(_slicesZ - 1)));
+}
+
+void ClusteredLightGrid::bin(ThreadPool* threadPool, bool forceScalar)
+{
+  const auto lightCount = _lightX.size();
+  _lightFirstRow.resize(lightCount);
+  _lightLastRow.resize(lightCount);
+  _lightFirstSlice.resize(lightCount);
+  _lightLastSlice.resize(lightCount);
+
+  // Tile rows and depth slices overlapped by the lights
+  if (threadPool && lightCount > CLUSTERED_LIGHT_GRID_LIGHTS_GRAIN_SIZE) {
+    threadPool->parallelFor(lightCount, CLUSTERED_LIGHT_GRID_LIGHTS_GRAIN_SIZE,
+                            [this](size_t /*chunkIndex*/, size_t begin, size_t end) {
+                              _computeLightBounds(begin, end);
+                            });
+  }
+  else {
+    _computeLightBounds(0, lightCount);
+  }
+
+  // Clusters, each chunk of depth slices only writes the clusters of its slices
+  const auto chunkCount = threadPool ? threadPool->chunkCount(_slicesZ, 1) : 1;
+  if (_candidates.size() < chunkCount) {
+    _candidates.resize(chunkCount);
+  }
+  std::vector<size_t> overflowCounts(chunkCount, 0);
+
+  const auto binSlices = [this, forceScalar, &overflowCounts](size_t chunkIndex, size_t begin,
+                                                               size_t end) {
+    for (auto slice = begin; slice < end; ++slice) {
+      _binSlice(slice, _candidates[chunkIndex], forceScalar, overflowCounts[chunkIndex]);
+    }
+  };
+
+  if (threadPool) {
+    threadPool->parallelFor(_slicesZ, 1, binSlices);
+  }
+  else {
+    binSlices(0, 0, _slicesZ);
+  }
+
+  _overflowCount = 0;
+  for (const auto overflowCount : overflowCounts) {
+    _overflowCount += overflowCount;
+  }
+}
+
+void ClusteredLightGrid::_computeLightBounds(size_t begin, size_t end)
+{
+  const auto rowScale  = static_cast<float>(_tilesY) / (_top - _bottom);
+  const auto lastRow   = static_cast<float>(_tilesY - 1);
+  const auto lastSlice = static_cast<int32_t>(_slicesZ - 1);
+
+  for (auto i = begin; i < end; ++i) {
+    const auto range = _lightRange[i];
+    const auto zMin  = _lightZ[i] - range;
+    const auto zMax  = _lightZ[i] + range;
+
+    // Culled by the near and far planes
+    if (zMax < _near || zMin > _far || range <= 0.f) {
+      _lightFirstSlice[i] = 1;
+      _lightLastSlice[i]  = 0;
+      continue;
+    }
+
+    // Extent of the bounding box of the sphere, in slopes for perspective frustums (x / z and y / z
+    // are monotonic in x, y and z, their extrema over the box are reached at the corners)
+    auto xMin = _lightX[i] - range;
+    auto xMax = _lightX[i] + range;
+    auto yMin = _lightY[i] - range;
+    auto yMax = _lightY[i] + range;
+    if (!_orthographic) {
+      const auto zA = std::max(zMin, _near);
+      const auto zB = std::max(zMax, _near);
+      const auto x0 = xMin;
+      const auto x1 = xMax;
+      const auto y0 = yMin;
+      const auto y1 = yMax;
+      xMin          = std::min(x0 / zA, x0 / zB);
+      xMax          = std::max(x1 / zA, x1 / zB);
+      yMin          = std::min(y0 / zA, y0 / zB);
+      yMax          = std::max(y1 / zA, y1 / zB);
+    }
+
+    // Culled by the left and right planes
+    if (xMax < _left || xMin > _right) {
+      _lightFirstSlice[i] = 1;
+      _lightLastSlice[i]  = 0;
+      continue;
+    }
+
+    const auto firstRow = std::floor((yMin - _bottom) * rowScale);
+    const auto lastRowF = std::floor((yMax - _bottom) * rowScale);
+    if (lastRowF < 0.f || firstRow > lastRow) {
+      _lightFirstSlice[i] = 1;
+      _lightLastSlice[i]  = 0;
+      continue;
+    }
+
+    _lightFirstRow[i]   = static_cast<int32_t>(std::max(firstRow, 0.f));
+    _lightLastRow[i]    = static_cast<int32_t>(std::min(lastRowF, lastRow));
+    _lightFirstSlice[i] = static_cast<int32_t>(computeSlice(std::max(zMin, _near)));
+    _lightLastSlice[i]  = std::min(static_cast<int32_t>(computeSlice(std::min(zMax, _far))),
+                                  lastSlice);
+  }
+}
+
+void ClusteredLightGrid::_binSlice(size_t slice, Candidates& candidates, bool forceScalar,
+                                   size_t& overflowCount)
+{
+  const auto firstSliceCluster = getClusterIndex(0, 0, slice);
+  std::fill(_clusterLightCounts.begin() + static_cast<std::ptrdiff_t>(firstSliceCluster),
+            _clusterLightCounts.begin()
+              + static_cast<std::ptrdiff_t>(firstSliceCluster + _tilesX * _tilesY),
+            0u);
+
+  // Lights overlapping the slice
+  auto& sliceLights = candidates.sliceLights;
+  sliceLights.clear();
+  const auto sliceIndex = static_cast<int32_t>(slice);
+  for (size_t i = 0, count = _lightX.size(); i < count; ++i) {
+    if (_lightFirstSlice[i] <= sliceIndex && sliceIndex <= _lightLastSlice[i]) {
+      sliceLights.emplace_back(static_cast<uint32_t>(i));
+    }
+  }
+
+  if (sliceLights.empty()) {
+    return;
+  }
+
+  // Depth range of the slice
+  const auto zMin = (slice == 0) ? _near :
+                                   std::exp((static_cast<float>(slice) - _sliceBias) / _sliceScale);
+  const auto zMax = (slice + 1 == _slicesZ) ?
+                      _far :
+                      std::exp((static_cast<float>(slice + 1) - _sliceBias) / _sliceScale);
+
+  // Horizontal extent of the clusters of the slice
+  const auto tileWidth  = (_right - _left) / static_cast<float>(_tilesX);
+  const auto tileHeight = (_top - _bottom) / static_cast<float>(_tilesY);
+  candidates.tileMinX.resize(_tilesX);
+  candidates.tileMaxX.resize(_tilesX);
+  for (size_t x = 0; x < _tilesX; ++x) {
+    const auto x0 = _left + static_cast<float>(x) * tileWidth;
+    const auto x1 = x0 + tileWidth;
+    if (_orthographic) {
+      candidates.tileMinX[x] = x0;
+      candidates.tileMaxX[x] = x1;
+    }
+    else {
+      candidates.tileMinX[x] = std::min(x0 * zMin, x0 * zMax);
+      candidates.tileMaxX[x] = std::max(x1 * zMin, x1 * zMax);
+    }
+  }
+
+  for (size_t y = 0; y < _tilesY; ++y) {
+    auto rowMinY = _bottom + static_cast<float>(y) * tileHeight;
+    auto rowMaxY = rowMinY + tileHeight;
+    if (!_orthographic) {
+      const auto y0 = rowMinY;
+      const auto y1 = rowMaxY;
+      rowMinY       = std::min(y0 * zMin, y0 * zMax);
+      rowMaxY       = std::max(y1 * zMin, y1 * zMax);
+    }
+
+    // Lights of the row, with their squared distance to the row along y and z
+    candidates.x.clear();
+    candidates.distanceSquaredYZ.clear();
+    candidates.rangeSquared.clear();
+    candidates.index.clear();
+    const auto rowIndex = static_cast<int32_t>(y);
+    for (const auto i : sliceLights) {
+      if (rowIndex < _lightFirstRow[i] || rowIndex > _lightLastRow[i]) {
+        continue;
+      }
+
+      const auto dy           = std::max({rowMinY - _lightY[i], 0.f, _lightY[i] - rowMaxY});
+      const auto dz           = std::max({zMin - _lightZ[i], 0.f, _lightZ[i] - zMax});
+      const auto rangeSquared = _lightRange[i] * _lightRange[i];
+      const auto distanceYZ   = dy * dy + dz * dz;
+      if (distanceYZ > rangeSquared) {
+        continue;
+      }
+
+      candidates.x.emplace_back(_lightX[i]);
+      candidates.distanceSquaredYZ.emplace_back(distanceYZ);
+      candidates.rangeSquared.emplace_back(rangeSquared);
+      candidates.index.emplace_back(i);
+    }
+
+    const auto candidateCount = candidates.index.size();
+    if (candidateCount == 0) {
+      continue;
+    }
+
+    const auto paddedCount
+      = (candidateCount + CLUSTERED_LIGHT_GRID_BATCH_SIZE - 1) / CLUSTERED_LIGHT_GRID_BATCH_SIZE
+        * CLUSTERED_LIGHT_GRID_BATCH_SIZE;
+    candidates.x.resize(paddedCount, 0.f);
+    candidates.distanceSquaredYZ.resize(paddedCount, 0.f);
+    candidates.rangeSquared.resize(paddedCount, -1.f);
+    candidates.index.resize(paddedCount, 0);
+
+    const auto firstCluster = getClusterIndex(0, y, slice);
+#if defined(BABYLON_CLUSTERED_LIGHT_GRID_AVX) || defined(BABYLON_CLUSTERED_LIGHT_GRID_SSE)
+    if (!forceScalar) {
+      _testRowSIMD(candidates, candidateCount, firstCluster, overflowCount);
+      continue;
+    }
+#else
+    (void)forceScalar;
+#endif
+    _testRowScalar(candidates, candidateCount, firstCluster, overflowCount);
+  }
+}
+
+void ClusteredLightGrid::_appendLight(size_t cluster, uint32_t lightIndex, size_t& overflowCount)
+{
+  auto& count = _clusterLightCounts[cluster];
+  if (count == _maxLightsPerCluster) {
+    ++overflowCount;
+    return;
+  }
+
+  _clusterLights[cluster * _maxLightsPerCluster + count] = lightIndex;
+  ++count;
+}
+
+void ClusteredLightGrid::_testRowScalar(const Candidates& candidates, size_t candidateCount,
+                                        size_t firstCluster, size_t& overflowCount)
+{
+  for (size_t x = 0; x < _tilesX; ++x) {
+    const auto minX = candidates.tileMinX[x];
+    const auto maxX = candidates.tileMaxX[x];
+    for (size_t c = 0; c < candidateCount; ++c) {
+      const auto cx = candidates.x[c];
+      const auto dx = std::max({minX - cx, 0.f, cx - maxX});
+      if (dx * dx + candidates.distanceSquaredYZ[c] <= candidates.rangeSquared[c]) {
+        _appendLight(firstCluster + x, candidates.index[c], overflowCount);
+      }
+    }
+  }
+}
+
+#if defined(BABYLON_CLUSTERED_LIGHT_GRID_AVX)
+
+void ClusteredLightGrid::_testRowSIMD(const Candidates& candidates, size_t candidateCount,
+                                      size_t firstCluster, size_t& overflowCount)
+{
+  const auto zero = _mm256_setzero_ps();
+  for (size_t x = 0; x < _tilesX; ++x) {
+    const auto minX = _mm256_set1_ps(candidates.tileMinX[x]);
+    const auto maxX = _mm256_set1_ps(candidates.tileMaxX[x]);
+    for (size_t c = 0; c < candidateCount; c += 8) {
+      const auto cx = _mm256_loadu_ps(&candidates.x[c]);
+      const auto dx
+        = _mm256_max_ps(_mm256_max_ps(_mm256_sub_ps(minX, cx), _mm256_sub_ps(cx, maxX)), zero);
+      const auto d2 = _mm256_add_ps(_mm256_mul_ps(dx, dx),
+                                    _mm256_loadu_ps(&candidates.distanceSquaredYZ[c]));
+      auto mask     = static_cast<unsigned int>(_mm256_movemask_ps(
+        _mm256_cmp_ps(d2, _mm256_loadu_ps(&candidates.rangeSquared[c]), _CMP_LE_OQ)));
+      for (size_t bit = 0; mask != 0; ++bit, mask >>= 1) {
+        if (mask & 1u) {
+          _appendLight(firstCluster + x, candidates.index[c + bit], overflowCount);
+        }
+      }
+    }
+  }
+}
+
+#elif defined(BABYLON_CLUSTERED_LIGHT_GRID_SSE)
+
+void ClusteredLightGrid::_testRowSIMD(const Candidates& candidates, size_t candidateCount,
+                                      size_t firstCluster, size_t& overflowCount)
+{
+  const auto zero = _mm_setzero_ps();
+  for (size_t x = 0; x < _tilesX; ++x) {
+    const auto minX = _mm_set1_ps(candidates.tileMinX[x]);
+    const auto maxX = _mm_set1_ps(candidates.tileMaxX[x]);
+    for (size_t c = 0; c < candidateCount; c += 4) {
+      const auto cx = _mm_loadu_ps(&candidates.x[c]);
+      const auto dx = _mm_max_ps(_mm_max_ps(_mm_sub_ps(minX, cx), _mm_sub_ps(cx, maxX)), zero);
+      const auto d2
+        = _mm_add_ps(_mm_mul_ps(dx, dx), _mm_loadu_ps(&candidates.distanceSquaredYZ[c]));
+      auto mask = static_cast<unsigned int>(
+        _mm_movemask_ps(_mm_cmple_ps(d2, _mm_loadu_ps(&candidates.rangeSquared[c]))));
+      for (size_t bit = 0; mask != 0; ++bit, mask >>= 1) {
+        if (mask & 1u) {
+          _appendLight(firstCluster + x, candidates.index[c + bit], overflowCount);
+        }
+      }
+    }
+  }
+}
+
+#else
+
+void ClusteredLightGrid::_testRowSIMD(const Candidates& candidates, size_t candidateCount,
+                                      size_t firstCluster, size_t& overflowCount)
+{
+  _testRowScalar(candidates, candidateCount, firstCluster, overflowCount);
+}
+
+#endif
+
+} // end of namespace BABYLON
@@ -0,0 +1,306 @@
+#include <babylon/lights/light_spatial_index.h>
+
+#include <algorithm>
+#include <limits>
+
+#include <babylon/culling/bounding_box.h>
+#include <babylon/culling/bounding_info.h>
+#include <babylon/engines/scene.h>
+#include <babylon/lights/ishadow_light.h>
+#include <babylon/meshes/abstract_mesh.h>
+
+namespace BABYLON {
+
+namespace {
+
+float DistanceSquaredToBox(const Vector3& point, const Vector3& minimum, const Vector3& maximum)
+{
+  const auto dx = std::max({minimum.x - point.x, 0.f, point.x - maximum.x});
+  const auto dy = std::max({minimum.y - point.y, 0.f, point.y - maximum.y});
+  const auto dz = std::max({minimum.z - point.z, 0.f, point.z - maximum.z});
+  return dx * dx + dy * dy + dz * dz;
+}
+
+} // end of anonymous namespace
+
+LightSpatialIndex::LightSpatialIndex(Scene* scene, float margin)
+    : _scene{scene}, _bvh{margin}, _meshesBvh{margin}
+{
+  for (const auto& mesh : _scene->meshes) {
+    addMesh(mesh.get());
+  }
+
+  for (const auto& light : _scene->lights) {
+    addLight(light);
+  }
+
+  _onNewLightAddedObserver = _scene->onNewLightAddedObservable.add(
+    [this](Light* light, EventState& /*es*/) { addLight(light->_this()); });
+  _onLightRemovedObserver = _scene->onLightRemovedObservable.add(
+    [this](Light* light, EventState& /*es*/) { removeLight(light); });
+  _onNewMeshAddedObserver = _scene->onNewMeshAddedObservable.add(
+    [this](AbstractMesh* mesh, EventState& /*es*/) { addMesh(mesh); });
+  _onMeshRemovedObserver = _scene->onMeshRemovedObservable.add(
+    [this](AbstractMesh* mesh, EventState& /*es*/) { removeMesh(mesh); });
+}
+
+LightSpatialIndex::~LightSpatialIndex()
+{
+  _scene->onNewLightAddedObservable.remove(_onNewLightAddedObserver);
+  _scene->onLightRemovedObservable.remove(_onLightRemovedObserver);
+  _scene->onNewMeshAddedObservable.remove(_onNewMeshAddedObserver);
+  _scene->onMeshRemovedObservable.remove(_onMeshRemovedObserver);
+  if (_scene->getLightSpatialIndex() == this) {
+    _scene->setLightSpatialIndex(nullptr);
+  }
+}
+
+bool LightSpatialIndex::_GetInfluence(Light* light, Vector3& position, float& range)
+{
+  const auto typeId = light->getTypeID();
+  if (typeId != Light::LIGHTTYPEID_POINTLIGHT && typeId != Light::LIGHTTYPEID_SPOTLIGHT) {
+    return false;
+  }
+
+  range = light->range();
+  if (!std::isfinite(range) || range >= std::numeric_limits<float>::max()) {
+    return false;
+  }
+
+  auto shadowLight = static_cast<IShadowLight*>(light);
+  shadowLight->computeTransformedInformation();
+  position = shadowLight->getAbsolutePosition();
+  return true;
+}
+
+void LightSpatialIndex::addLight(const LightPtr& light)
+{
+  if (!light || _lights.find(light.get()) != _lights.end()) {
+    return;
+  }
+
+  auto& proxy     = _lights[light.get()];
+  proxy.light     = light;
+  proxy.proxyId   = DynamicBVH<Light*>::NullNode;
+  proxy.range     = 0.f;
+  proxy.intensity = light->intensity;
+  proxy.isEnabled = light->isEnabled();
+  _refitLight(proxy);
+
+  if (proxy.proxyId == DynamicBVH<Light*>::NullNode) {
+    _markAllMeshes();
+  }
+  else {
+    _markMeshes(proxy);
+  }
+}
+
+void LightSpatialIndex::removeLight(Light* light)
+{
+  auto it = _lights.find(light);
+  if (it == _lights.end()) {
+    return;
+  }
+
+  if (it->second.proxyId == DynamicBVH<Light*>::NullNode) {
+    _globalLights.erase(std::remove(_globalLights.begin(), _globalLights.end(), light),
+                        _globalLights.end());
+  }
+  else {
+    _bvh.destroyProxy(it->second.proxyId);
+  }
+  _lights.erase(it);
+}
+
+void LightSpatialIndex::addMesh(AbstractMesh* mesh)
+{
+  if (!mesh || _meshes.find(mesh) != _meshes.end()) {
+    return;
+  }
+
+  const auto& worldMatrix = mesh->computeWorldMatrix();
+  const auto& boundingBox = mesh->getBoundingInfo()->boundingBox;
+  _meshes[mesh]           = MeshProxy{
+    _meshesBvh.createProxy(boundingBox.minimumWorld, boundingBox.maximumWorld, mesh), // proxyId
+    worldMatrix.updateFlag // worldMatrixUpdateFlag
+  };
+
+  // The light sources of a new mesh may have been computed before its world matrix
+  _dirtyMeshes.insert(mesh);
+}
+
+void LightSpatialIndex::removeMesh(AbstractMesh* mesh)
+{
+  auto it = _meshes.find(mesh);
+  if (it == _meshes.end()) {
+    return;
+  }
+
+  _meshesBvh.destroyProxy(it->second.proxyId);
+  _meshes.erase(it);
+  _dirtyMeshes.erase(mesh);
+}
+
+void LightSpatialIndex::_refitLight(LightProxy& proxy)
+{
+  const auto light = proxy.light.get();
+  Vector3 position;
+  float range = 0.f;
+  if (!_GetInfluence(light, position, range)) {
+    if (proxy.proxyId != DynamicBVH<Light*>::NullNode) {
+      _bvh.destroyProxy(proxy.proxyId);
+      proxy.proxyId = DynamicBVH<Light*>::NullNode;
+    }
+    if (std::find(_globalLights.begin(), _globalLights.end(), light) == _globalLights.end()) {
+      _globalLights.emplace_back(light);
+    }
+    return;
+  }
+
+  proxy.position = position;
+  proxy.range    = range;
+
+  const Vector3 extent(range, range, range);
+  if (proxy.proxyId == DynamicBVH<Light*>::NullNode) {
+    _globalLights.erase(std::remove(_globalLights.begin(), _globalLights.end(), light),
+                        _globalLights.end());
+    proxy.proxyId = _bvh.createProxy(position.subtract(extent), position.add(extent), light);
+  }
+  else {
+    _bvh.moveProxy(proxy.proxyId, position.subtract(extent), position.add(extent));
+  }
+}
+
+void LightSpatialIndex::_markMeshes(const LightProxy& proxy)
+{
+  const Vector3 extent(proxy.range, proxy.range, proxy.range);
+  _selection.clear();
+  _meshesBvh.intersectsMinMax(proxy.position.subtract(extent), proxy.position.add(extent),
+                              _selection);
+  _dirtyMeshes.insert(_selection.begin(), _selection.end());
+}
+
+void LightSpatialIndex::_markAllMeshes()
+{
+  for (const auto& item : _meshes) {
+    _dirtyMeshes.insert(item.first);
+  }
+}
+
+void LightSpatialIndex::update()
+{
+  // Lights, the meshes in the influence of a light before and after its change are resynchronized
+  for (auto& item : _lights) {
+    auto& proxy         = item.second;
+    const auto light    = proxy.light.get();
+    const auto wasLocal = proxy.proxyId != DynamicBVH<Light*>::NullNode;
+
+    Vector3 position;
+    float range = 0.f;
+    const auto isLocal   = _GetInfluence(light, position, range);
+    const auto isEnabled = light->isEnabled();
+    if (isLocal != wasLocal || isEnabled != proxy.isEnabled || light->intensity != proxy.intensity
+        || (isLocal && (range != proxy.range || !position.equals(proxy.position)))) {
+      if (wasLocal) {
+        _markMeshes(proxy);
+      }
+      else {
+        _markAllMeshes();
+      }
+      proxy.intensity = light->intensity;
+      proxy.isEnabled = isEnabled;
+      _refitLight(proxy);
+      if (isLocal) {
+        _markMeshes(proxy);
+      }
+      else {
+        _markAllMeshes();
+      }
+    }
+  }
+
+  // Meshes, computeWorldMatrix only does work for the meshes that are not synchronized anymore
+  for (auto& item : _meshes) {
+    const auto mesh         = item.first;
+    auto& proxy             = item.second;
+    const auto& worldMatrix = mesh->computeWorldMatrix();
+    if (worldMatrix.updateFlag == proxy.worldMatrixUpdateFlag) {
+      continue;
+    }
+
+    const auto& boundingBox     = mesh->getBoundingInfo()->boundingBox;
+    proxy.worldMatrixUpdateFlag = worldMatrix.updateFlag;
+    _meshesBvh.moveProxy(proxy.proxyId, boundingBox.minimumWorld, boundingBox.maximumWorld);
+    _dirtyMeshes.insert(mesh);
+  }
+
+  if (_dirtyMeshes.empty()) {
+    return;
+  }
+
+  // The resynchronization queries the index and only marks the materials as dirty when the light
+  // sources changed
+  const std::vector<AbstractMesh*> dirtyMeshes(_dirtyMeshes.begin(), _dirtyMeshes.end());
+  _dirtyMeshes.clear();
+  for (const auto& mesh : dirtyMeshes) {
+    mesh->_resyncLightSources();
+  }
+}
+
+void LightSpatialIndex::getLightSources(AbstractMesh* mesh,
+                                        std::vector<LightPtr>& lightSources) const
+{
+  struct Candidate {
+    Light* light;
+    bool isGlobal;
+    float contribution;
+  }; // end of struct Candidate
+
+  const auto& boundingBox = mesh->getBoundingInfo()->boundingBox;
+
+  std::vector<Light*> lights(_globalLights.begin(), _globalLights.end());
+  _bvh.intersectsMinMax(boundingBox.minimumWorld, boundingBox.maximumWorld, lights);
+
+  std::vector<Candidate> candidates;
+  candidates.reserve(lights.size());
+  for (const auto& light : lights) {
+    if (!light->isEnabled() || !light->canAffectMesh(mesh)) {
+      continue;
+    }
+
+    const auto& proxy = _lights.at(light);
+    if (proxy.proxyId == DynamicBVH<Light*>::NullNode) {
+      candidates.emplace_back(Candidate{light, true, light->intensity});
+      continue;
+    }
+
+    const auto distanceSquared
+      = DistanceSquaredToBox(proxy.position, boundingBox.minimumWorld, boundingBox.maximumWorld);
+    if (distanceSquared > proxy.range * proxy.range) {
+      continue;
+    }
+    candidates.emplace_back(Candidate{
+      light, false, light->intensity / std::max(distanceSquared, 1.f)});
+  }
+
+  // The priority of the lights first, then the lights affecting the whole scene and the most
+  // contributing local lights
+  std::stable_sort(candidates.begin(), candidates.end(),
+                   [](const Candidate& a, const Candidate& b) {
+                     const auto priority = Light::CompareLightsPriority(a.light, b.light);
+                     if (priority != 0) {
+                       return priority < 0;
+                     }
+                     if (a.isGlobal != b.isGlobal) {
+                       return a.isGlobal;
+                     }
+                     return a.contribution > b.contribution;
+                   });
+
+  lightSources.clear();
+  for (const auto& candidate : candidates) {
+    lightSources.emplace_back(_lights.at(candidate.light).light);
+  }
+}
+
+} // end of namespace BABYLON
@@ -739,6 +739,10 @@ AbstractMeshPtr GLTFLoader::_loadMeshPrimitiveAsync(
       auto babylonGeometry = _loadVertexDataAsync(context, primitive, babylonMesh);
       _loadMorphTargetsAsync(context, primitive, babylonMesh, babylonGeometry);
       babylonGeometry->applyToMesh(babylonMesh.get());
+      if (_parent.optimizeIndices
+          && GLTFLoader::_GetDrawMode(context, primitive.mode) == Material::TriangleFillMode) {
+        babylonMesh->optimizeIndices();
+      }
     });
 
     const auto babylonDrawMode = GLTFLoader::_GetDrawMode(context, primitive.mode);
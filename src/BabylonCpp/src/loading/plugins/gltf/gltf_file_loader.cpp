@@ -43,6 +43,7 @@ GLTFFileLoader::GLTFFileLoader()
     , createInstances{true}
     , alwaysComputeBoundingBox{false}
     , loadAllMaterials{false}
+    , optimizeIndices{false}
     , preprocessUrlAsync{nullptr}
     , onMeshLoaded{this, &GLTFFileLoader::set_onMeshLoaded}
     , onTextureLoaded{this, &GLTFFileLoader::set_onTextureLoaded}
@@ -26,6 +26,10 @@ bool OBJFileLoader::SKIP_MATERIALS = false;
 
 bool OBJFileLoader::MATERIAL_LOADING_FAILS_SILENTLY = true;
 
+bool OBJFileLoader::OPTIMIZE_INDICES = false;
+
+bool OBJFileLoader::WELD_VERTICES = false;
+
 OBJFileLoader::OBJFileLoader(const std::optional<MeshLoadOptions>& meshLoadOptions)
 {
   _meshLoadOptions = meshLoadOptions.value_or(OBJFileLoader::currentMeshLoadOptions());
@@ -42,6 +46,8 @@ MeshLoadOptions OBJFileLoader::currentMeshLoadOptions()
   options.MaterialLoadingFailsSilently = OBJFileLoader::MATERIAL_LOADING_FAILS_SILENTLY;
   options.OptimizeWithUV               = OBJFileLoader::OPTIMIZE_WITH_UV;
   options.SkipMaterials                = OBJFileLoader::SKIP_MATERIALS;
+  options.OptimizeIndices              = OBJFileLoader::OPTIMIZE_INDICES;
+  options.WeldVertices                 = OBJFileLoader::WELD_VERTICES;
   return options;
 }
 
@@ -654,8 +660,14 @@ std::vector<AbstractMeshPtr> OBJFileLoader::_parseSolid(const std::vector<std::s
     if (_meshLoadOptions.ImportVertexColors == true) {
       vertexData->colors = state.handledMesh.colors;
     }
+    if (_meshLoadOptions.WeldVertices) {
+      vertexData->weld();
+    }
     // Set the data from the VertexBuffer to the current Mesh
     vertexData->applyToMesh(*babylonMesh);
+    if (_meshLoadOptions.OptimizeIndices) {
+      babylonMesh->optimizeIndices();
+    }
     if (_meshLoadOptions.InvertY) {
       babylonMesh->scaling().y *= -1.f;
     }
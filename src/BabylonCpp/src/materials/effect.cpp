@@ -4,6 +4,7 @@
 
 #include <babylon/babylon_stl_util.h>
 #include <babylon/core/logging.h>
+#include <babylon/core/thread_pool.h>
 #include <babylon/engines/engine.h>
 #include <babylon/engines/ipipeline_context.h>
 #include <babylon/engines/processors/shader_processing_options.h>
@@ -31,13 +32,19 @@ std::unordered_map<std::string, std::string>& Effect::ShadersStore()
   return EffectShadersStore().shaders();
 }
 
-std::unordered_map<std::string, std::string>& Effect::IncludesShadersStore()
+std::shared_ptr<const std::unordered_map<std::string, std::string>> Effect::IncludesShadersStore()
 {
   return EffectIncludesShadersStore().shaders();
 }
 
+void Effect::SetIncludeShader(const std::string& name, const std::string& source)
+{
+  EffectIncludesShadersStore().setShader(name, source);
+}
+
 std::size_t Effect::_uniqueIdSeed = 0;
 std::unordered_map<unsigned int, WebGLDataBufferPtr> Effect::_baseCache{};
+std::unordered_map<unsigned int, size_t> Effect::_baseOffsetCache{};
 
 Effect::Effect(
   const std::variant<std::string, std::unordered_map<std::string, std::string>>& baseName,
@@ -48,6 +55,7 @@ Effect::Effect(
     , _bonesComputationForcedToCPU{false}
     , _multiTarget{false}
     , onBindObservable{this, &Effect::get_onBindObservable}
+    , _cacheKey{0}
     , _pipelineContext{nullptr}
     , vertexSourceCode{this, &Effect::get_vertexSourceCode}
     , fragmentSourceCode{this, &Effect::get_fragmentSourceCode}
@@ -80,6 +88,9 @@ Effect::Effect(
     _multiTarget               = options.multiTarget.value_or(false);
 
     stl_util::concat(_uniformsNames, options.samplers);
+    for (size_t i = 0; i < _uniformsNames.size(); ++i) {
+      _uniformHandles.emplace(_uniformsNames[i], static_cast<int>(i));
+    }
 
     if (!options.uniformBuffersNames.empty()) {
       _uniformBuffersNamesList = options.uniformBuffersNames;
@@ -138,56 +149,97 @@ Effect::Effect(
   processorOptions.version           = std::to_string(static_cast<int>(_engine->version() * 100));
   processorOptions.platformName      = _engine->shaderPlatformName();
   processorOptions.processingContext = _processingContext;
+  processorOptions.processorParameters.drawBuffersExtensionDisabled
+    = !_engine->getCaps().drawBuffersExtension;
+
+  // The shaders store is only read on the calling thread
+  _loadShader(vertexSource, "Vertex", "", [this](const std::string& vertexCode) -> void {
+    _rawVertexSourceCode = vertexCode;
+  });
+  _loadShader(fragmentSource, "Fragment", "Pixel", [this](const std::string& fragmentCode) -> void {
+    _rawFragmentSourceCode = fragmentCode;
+  });
+
+  if (_rawVertexSourceCode.empty() || _rawFragmentSourceCode.empty()) {
+    return;
+  }
 
-  std::string shaderCodes[2] = {"", ""};
-  auto shadersLoaded
-    = [this, &shaderCodes, &processorOptions, &processFinalCode, &baseName]() -> void {
-    if (!shaderCodes[0].empty() && !shaderCodes[1].empty()) {
-      processorOptions.isFragment    = true;
-      const auto& migratedVertexCode = shaderCodes[0];
-      const auto& fragmentCode       = shaderCodes[1];
-      ShaderProcessor::Process(
-        fragmentCode, processorOptions,
-        [&](const std::string& iMigratedFragmentCode) -> void {
-          auto migratedFragmentCode = iMigratedFragmentCode;
-          if (processFinalCode) {
-            migratedFragmentCode = processFinalCode("fragment", migratedFragmentCode);
-          }
-          auto finalShaders
-            = ShaderProcessor::Finalize(migratedVertexCode, migratedFragmentCode, processorOptions);
-          _useFinalCode(finalShaders["vertexCode"], finalShaders["fragmentCode"], baseName);
-        },
-        _engine);
-    }
-  };
-  _loadShader(vertexSource, "Vertex", "",
-              [this, &processorOptions, &processFinalCode, &shaderCodes,
-               &shadersLoaded](const std::string& vertexCode) -> void {
-                ShaderProcessor::Initialize(processorOptions);
-                ShaderProcessor::Process(
-                  vertexCode, processorOptions,
-                  [this, &vertexCode, &processFinalCode, &shaderCodes,
-                   &shadersLoaded](const std::string& iMigratedVertexCode) -> void {
-                    _rawVertexSourceCode    = vertexCode;
-                    auto migratedVertexCode = iMigratedVertexCode;
-                    if (processFinalCode) {
-                      migratedVertexCode = processFinalCode("vertex", migratedVertexCode);
-                    }
-                    shaderCodes[0] = migratedVertexCode;
-                    shadersLoaded();
-                  },
-                  _engine);
-              });
-  _loadShader(fragmentSource, "Fragment", "Pixel",
-              [this, &shaderCodes, &shadersLoaded](const std::string& fragmentCode) -> void {
-                _rawFragmentSourceCode = fragmentCode;
-                shaderCodes[1]         = fragmentCode;
-                shadersLoaded();
-              });
+  if (_engine->parallelShaderProcessing && !processFinalCode) {
+    _shaderProcessing = _engine->getThreadPool().enqueue(
+      [vertexCode = _rawVertexSourceCode, fragmentCode = _rawFragmentSourceCode,
+       processorOptions]() mutable -> std::pair<std::string, std::string> {
+        // The engine is only available on its own thread, the processors read the options
+        return _ProcessShaderCodes(vertexCode, fragmentCode, processorOptions, nullptr);
+      });
+    // Inline execution when the pool has no worker
+    _checkShaderProcessing();
+    return;
+  }
+
+  const auto [vertexCode, fragmentCode] = _ProcessShaderCodes(
+    _rawVertexSourceCode, _rawFragmentSourceCode, processorOptions, processFinalCode);
+  _useFinalCode(vertexCode, fragmentCode, baseName);
 }
 
 Effect::~Effect() = default;
 
+std::pair<std::string, std::string> Effect::_ProcessShaderCodes(
+  const std::string& vertexCode, const std::string& fragmentCode, ProcessingOptions& options,
+  const std::function<std::string(const std::string& shaderType, const std::string& code)>&
+    processFinalCode)
+{
+  std::string migratedVertexCode;
+  std::string migratedFragmentCode;
+
+  ShaderProcessor::Initialize(options);
+  options.isFragment = false;
+  ShaderProcessor::Process(vertexCode, options,
+                           [&migratedVertexCode](const std::string& code) -> void {
+                             migratedVertexCode = code;
+                           });
+  options.isFragment = true;
+  ShaderProcessor::Process(fragmentCode, options,
+                           [&migratedFragmentCode](const std::string& code) -> void {
+                             migratedFragmentCode = code;
+                           });
+
+  if (processFinalCode) {
+    migratedVertexCode   = processFinalCode("vertex", migratedVertexCode);
+    migratedFragmentCode = processFinalCode("fragment", migratedFragmentCode);
+  }
+
+  auto finalShaders = ShaderProcessor::Finalize(migratedVertexCode, migratedFragmentCode, options);
+  return {finalShaders["vertexCode"], finalShaders["fragmentCode"]};
+}
+
+bool Effect::_checkShaderProcessing() const
+{
+  if (!_shaderProcessing.valid()) {
+    return true;
+  }
+
+  if (_shaderProcessing.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+    return false;
+  }
+
+  // Compiling the processed code ends the construction of the effect, which is never created as a
+  // const object (see Effect::New)
+  auto self = const_cast<Effect*>(this);
+  try {
+    const auto [vertexCode, fragmentCode] = _shaderProcessing.get();
+    self->_useFinalCode(vertexCode, fragmentCode, name);
+  }
+  catch (const std::exception& e) {
+    self->_compilationError = e.what();
+    BABYLON_LOGF_ERROR("Effect", "Unable to process the shaders: %s", _compilationError.c_str())
+    if (onError) {
+      onError(self, _compilationError);
+    }
+  }
+
+  return true;
+}
+
 void Effect::_useFinalCode(
   const std::string& migratedVertexCode, const std::string& migratedFragmentCode,
   const std::variant<std::string, std::unordered_map<std::string, std::string>>& baseName)
@@ -252,6 +304,9 @@ bool Effect::_isReadyInternal() const
   if (_isReady) {
     return true;
   }
+  if (!_checkShaderProcessing()) {
+    return false;
+  }
   if (_pipelineContext) {
     return _pipelineContext->isReady();
   }
@@ -294,7 +349,13 @@ size_t Effect::getAttributesCount()
 
 int Effect::getUniformIndex(const std::string& uniformName)
 {
-  return stl_util::index_of(_uniformsNames, uniformName);
+  return getUniformHandle(uniformName);
+}
+
+int Effect::getUniformHandle(const std::string& uniformName) const
+{
+  auto it = _uniformHandles.find(uniformName);
+  return it != _uniformHandles.end() ? it->second : -1;
 }
 
 WebGLUniformLocationPtr Effect::getUniform(const std::string& uniformName)
@@ -352,6 +413,17 @@ void Effect::executeWhenCompiled(const std::function<void(Effect* effect)>& func
 
 void Effect::_checkIsReady(const IPipelineContextPtr& previousPipelineContext)
 {
+  // The caller waits for the compilation, wait for the background processing as well
+  if (_shaderProcessing.valid()) {
+    _shaderProcessing.wait();
+    _checkShaderProcessing();
+  }
+
+  // Nothing to wait for when the shaders could not be loaded or processed
+  if (!_pipelineContext) {
+    return;
+  }
+
   try {
     if (_isReadyInternal()) {
       return;
@@ -515,9 +587,9 @@ void Effect::_prepareEffect()
                                                  _attributes           // attributes
         );
 
-        // Caches attribute locations.
+        // Caches attribute locations, engines without context (null engine) return none
         if (!attributesNames.empty()) {
-          for (size_t i = 0; i < attributesNames.size(); ++i) {
+          for (size_t i = 0; i < attributesNames.size() && i < _attributes.size(); ++i) {
             _attributeLocationByName[attributesNames[i]] = _attributes[i];
           }
         }
@@ -727,7 +799,8 @@ void Effect::bindUniformBuffer(const WebGLDataBufferPtr& buffer, const std::stri
   if (stl_util::contains(_uniformBuffersNames, iName)) {
     const auto& bufferName = _uniformBuffersNames[iName];
     if (stl_util::contains(Effect::_baseCache, bufferName)
-        && (Effect::_baseCache[bufferName] == buffer && _engine->_features.useUBOBindingCache)) {
+        && (Effect::_baseCache[bufferName] == buffer && _engine->_features.useUBOBindingCache)
+        && !stl_util::contains(Effect::_baseOffsetCache, bufferName)) {
       return;
     }
   }
@@ -737,9 +810,31 @@ void Effect::bindUniformBuffer(const WebGLDataBufferPtr& buffer, const std::stri
 
   const auto& bufferName         = _uniformBuffersNames[iName];
   Effect::_baseCache[bufferName] = buffer;
+  Effect::_baseOffsetCache.erase(bufferName);
   _engine->bindUniformBufferBase(buffer, bufferName, iName);
 }
 
+void Effect::bindUniformBufferRange(const WebGLDataBufferPtr& buffer, const std::string& iName,
+                                    size_t byteOffset, size_t byteLength)
+{
+  if (!stl_util::contains(_uniformBuffersNames, iName)) {
+    _uniformBuffersNames[iName] = 0;
+  }
+
+  const auto bufferName = _uniformBuffersNames[iName];
+  if (_engine->_features.useUBOBindingCache) {
+    auto it = Effect::_baseOffsetCache.find(bufferName);
+    if (it != Effect::_baseOffsetCache.end() && it->second == byteOffset
+        && Effect::_baseCache[bufferName] == buffer) {
+      return;
+    }
+  }
+
+  Effect::_baseCache[bufferName]       = buffer;
+  Effect::_baseOffsetCache[bufferName] = byteOffset;
+  _engine->bindUniformBufferRange(buffer, bufferName, byteOffset, byteLength);
+}
+
 void Effect::bindUniformBlock(const std::string& blockName, unsigned index)
 {
   _engine->bindUniformBlock(_pipelineContext, blockName, index);
@@ -993,6 +1088,74 @@ Effect& Effect::setDirectColor4(const std::string& uniformName, const Color4& co
   return *this;
 }
 
+Effect& Effect::setInt(int uniformHandle, int value)
+{
+  if (_pipelineContext) {
+    _pipelineContext->setInt(uniformHandle, value);
+  }
+  return *this;
+}
+
+Effect& Effect::setMatrix(int uniformHandle, const Matrix& matrix)
+{
+  if (_pipelineContext) {
+    _pipelineContext->setMatrix(uniformHandle, matrix);
+  }
+  return *this;
+}
+
+Effect& Effect::setFloat(int uniformHandle, float value)
+{
+  if (_pipelineContext) {
+    _pipelineContext->setFloat(uniformHandle, value);
+  }
+  return *this;
+}
+
+Effect& Effect::setFloat2(int uniformHandle, float x, float y)
+{
+  if (_pipelineContext) {
+    _pipelineContext->setFloat2(uniformHandle, x, y);
+  }
+  return *this;
+}
+
+Effect& Effect::setFloat3(int uniformHandle, float x, float y, float z)
+{
+  if (_pipelineContext) {
+    _pipelineContext->setFloat3(uniformHandle, x, y, z);
+  }
+  return *this;
+}
+
+Effect& Effect::setFloat4(int uniformHandle, float x, float y, float z, float w)
+{
+  if (_pipelineContext) {
+    _pipelineContext->setFloat4(uniformHandle, x, y, z, w);
+  }
+  return *this;
+}
+
+Effect& Effect::setVector3(int uniformHandle, const Vector3& vector3)
+{
+  return setFloat3(uniformHandle, vector3.x, vector3.y, vector3.z);
+}
+
+Effect& Effect::setVector4(int uniformHandle, const Vector4& vector4)
+{
+  return setFloat4(uniformHandle, vector4.x, vector4.y, vector4.z, vector4.w);
+}
+
+Effect& Effect::setColor3(int uniformHandle, const Color3& color3)
+{
+  return setFloat3(uniformHandle, color3.r, color3.g, color3.b);
+}
+
+Effect& Effect::setColor4(int uniformHandle, const Color3& color3, float alpha)
+{
+  return setFloat4(uniformHandle, color3.r, color3.g, color3.b, alpha);
+}
+
 void Effect::dispose(bool /*doNotRecurse*/, bool /*disposeMaterialAndTextures*/)
 {
   if (_pipelineContext) {
@@ -1016,6 +1179,7 @@ void Effect::RegisterShader(const std::string& name, const std::optional<std::st
 void Effect::ResetCache()
 {
   Effect::_baseCache.clear();
+  Effect::_baseOffsetCache.clear();
 }
 
 } // end of namespace BABYLON
@@ -1,5 +1,7 @@
 ﻿#include <babylon/materials/effect_includes_shaders_store.h>
 
+#include <mutex>
+
 #include <babylon/shaders/shadersinclude/background_fragment_declaration_fx.h>
 #include <babylon/shaders/shadersinclude/background_ubo_declaration_fx.h>
 #include <babylon/shaders/shadersinclude/background_vertex_declaration_fx.h>
@@ -17,6 +19,7 @@
 #include <babylon/shaders/shadersinclude/clip_plane_vertex_fx.h>
 #include <babylon/shaders/shadersinclude/clip_plane_vertex_declaration_fx.h>
 #include <babylon/shaders/shadersinclude/clip_plane_vertex_declaration2_fx.h>
+#include <babylon/shaders/shadersinclude/clustered_lighting_functions_fx.h>
 #include <babylon/shaders/shadersinclude/default_fragment_declaration_fx.h>
 #include <babylon/shaders/shadersinclude/default_ubo_declaration_fx.h>
 #include <babylon/shaders/shadersinclude/default_vertex_declaration_fx.h>
@@ -103,24 +106,38 @@
 
 namespace BABYLON {
 
+namespace {
+
+// Guards the publication of the snapshots, not their content
+std::mutex& ShadersMutex()
+{
+  static std::mutex shadersMutex;
+  return shadersMutex;
+}
+
+} // end of anonymous namespace
+
 EffectIncludesShadersStore::EffectIncludesShadersStore() = default;
 
 EffectIncludesShadersStore::~EffectIncludesShadersStore() = default;
 
-std::unordered_map<std::string, std::string>&
-EffectIncludesShadersStore::shaders()
+std::shared_ptr<const EffectIncludesShadersStore::IncludesMap>
+EffectIncludesShadersStore::shaders() const
 {
+  std::lock_guard<std::mutex> lock(ShadersMutex());
   return _shaders;
 }
 
-const std::unordered_map<std::string, std::string>&
-EffectIncludesShadersStore::shaders() const
+void EffectIncludesShadersStore::setShader(const std::string& name, const std::string& source)
 {
-  return _shaders;
+  std::lock_guard<std::mutex> lock(ShadersMutex());
+  auto shaders     = std::make_shared<IncludesMap>(*_shaders);
+  (*shaders)[name] = source;
+  _shaders         = std::move(shaders);
 }
 
-std::unordered_map<std::string, std::string>
-  EffectIncludesShadersStore::_shaders
+// Moved into the first snapshot
+static EffectIncludesShadersStore::IncludesMap InitialShaders
   = {{"backgroundFragmentDeclaration", backgroundFragmentDeclaration},
      {"backgroundUboDeclaration", backgroundUboDeclaration},
      {"backgroundVertexDeclaration", backgroundVertexDeclaration},
@@ -138,6 +155,7 @@ std::unordered_map<std::string, std::string>
      {"clipPlaneVertex", clipPlaneVertex},
      {"clipPlaneVertexDeclaration", clipPlaneVertexDeclaration},
      {"clipPlaneVertexDeclaration2", clipPlaneVertexDeclaration2},
+     {"clusteredLightingFunctions", clusteredLightingFunctions},
      {"defaultFragmentDeclaration", defaultFragmentDeclaration},
      {"defaultUboDeclaration", defaultUboDeclaration},
      {"defaultVertexDeclaration", defaultVertexDeclaration},
@@ -222,4 +240,7 @@ std::unordered_map<std::string, std::string>
      {"shadowsVertex", shadowsVertex},
      {"subSurfaceScatteringFunctions", subSurfaceScatteringFunctions}};
 
+std::shared_ptr<const EffectIncludesShadersStore::IncludesMap> EffectIncludesShadersStore::_shaders
+  = std::make_shared<const EffectIncludesShadersStore::IncludesMap>(std::move(InitialShaders));
+
 } // end of namespace BABYLON
@@ -0,0 +1,110 @@
+#include <babylon/materials/material_define_set.h>
+
+#include <atomic>
+#include <deque>
+#include <mutex>
+#include <string_view>
+#include <unordered_map>
+
+namespace BABYLON {
+
+namespace {
+
+struct DefineNames {
+  std::mutex mutex;
+  // Deque, the references returned by Name stay valid when new names are interned
+  std::deque<std::string> names;
+  std::unordered_map<std::string, MaterialDefineId> ids;
+  // Number of interned names, read without the lock to check if a mirror is up to date
+  std::atomic<size_t> count{0};
+};
+
+/**
+ * Per thread copy of the interned names. The identifier of a name never changes, so the lookups
+ * only go through the registry lock when a name was interned since the last synchronization.
+ */
+struct DefineNamesMirror {
+  std::vector<const std::string*> names;
+  std::unordered_map<std::string_view, MaterialDefineId> ids;
+};
+
+DefineNames& defineNames()
+{
+  static DefineNames defineNames;
+  return defineNames;
+}
+
+DefineNamesMirror& defineNamesMirror()
+{
+  thread_local DefineNamesMirror defineNamesMirror;
+  return defineNamesMirror;
+}
+
+void synchronize(DefineNames& registry, DefineNamesMirror& mirror)
+{
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  for (auto id = mirror.names.size(); id < registry.names.size(); ++id) {
+    const auto& name = registry.names[id];
+    mirror.names.emplace_back(&name);
+    mirror.ids.emplace(name, static_cast<MaterialDefineId>(id));
+  }
+}
+
+bool findInMirror(const std::string& name, MaterialDefineId& id)
+{
+  auto& mirror = defineNamesMirror();
+  auto it      = mirror.ids.find(name);
+  if (it == mirror.ids.end()) {
+    auto& registry = defineNames();
+    if (registry.count.load(std::memory_order_acquire) == mirror.names.size()) {
+      return false;
+    }
+    synchronize(registry, mirror);
+    it = mirror.ids.find(name);
+    if (it == mirror.ids.end()) {
+      return false;
+    }
+  }
+
+  id = it->second;
+  return true;
+}
+
+} // end of anonymous namespace
+
+MaterialDefineId MaterialDefineRegistry::Intern(const std::string& name)
+{
+  MaterialDefineId id = 0;
+  if (findInMirror(name, id)) {
+    return id;
+  }
+
+  auto& registry = defineNames();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  auto it = registry.ids.find(name);
+  if (it != registry.ids.end()) {
+    return it->second;
+  }
+
+  id = static_cast<MaterialDefineId>(registry.names.size());
+  registry.names.emplace_back(name);
+  registry.ids.emplace(name, id);
+  registry.count.store(registry.names.size(), std::memory_order_release);
+  return id;
+}
+
+bool MaterialDefineRegistry::Find(const std::string& name, MaterialDefineId& id)
+{
+  return findInMirror(name, id);
+}
+
+const std::string& MaterialDefineRegistry::Name(MaterialDefineId id)
+{
+  auto& mirror = defineNamesMirror();
+  if (id >= mirror.names.size()) {
+    synchronize(defineNames(), mirror);
+  }
+  return *mirror.names[id];
+}
+
+} // end of namespace BABYLON
@@ -1,9 +1,30 @@
 #include <babylon/materials/material_defines.h>
 
-#include <babylon/babylon_stl_util.h>
+#include <algorithm>
+#include <sstream>
 
 namespace BABYLON {
 
+namespace {
+
+// Emits the valued defines sorted by name
+template <typename T>
+void writeDefines(std::ostream& os, const MaterialValueDefines<T>& defines)
+{
+  std::vector<std::pair<const std::string*, const T*>> entries;
+  entries.reserve(defines.size());
+  for (const auto& entry : defines) {
+    entries.emplace_back(&MaterialDefineRegistry::Name(entry.first), &entry.second);
+  }
+  std::sort(entries.begin(), entries.end(),
+            [](const auto& lhs, const auto& rhs) { return *lhs.first < *rhs.first; });
+  for (const auto& entry : entries) {
+    os << "#define " << *entry.first << " " << *entry.second << "\n";
+  }
+}
+
+} // end of anonymous namespace
+
 MaterialDefines::MaterialDefines()
     : _isDirty{true}
     , _renderId{-1}
@@ -122,7 +143,8 @@ MaterialDefines::~MaterialDefines() = default;
 
 bool MaterialDefines::operator[](const std::string& define) const
 {
-  return stl_util::contains(boolDef, define) && boolDef.at(define);
+  MaterialDefineId id;
+  return MaterialDefineRegistry::Find(define, id) && boolDef.get(id);
 }
 
 bool MaterialDefines::operator==(const MaterialDefines& rhs) const
@@ -137,23 +159,23 @@ bool MaterialDefines::operator!=(const MaterialDefines& rhs) const
 
 std::ostream& operator<<(std::ostream& os, const MaterialDefines& materialDefines)
 {
-  for (const auto& item : materialDefines.boolDef) {
-    if (item.second) {
-      os << "#define " << item.first << "\n";
+  // The defines are written in a canonical order (sorted by name) so that identical define sets
+  // give the same shader code and hit the same effect in the engine cache
+  std::vector<const std::string*> names;
+  materialDefines.boolDef.forEach([&names](MaterialDefineId id, bool value) {
+    if (value) {
+      names.emplace_back(&MaterialDefineRegistry::Name(id));
     }
+  });
+  std::sort(names.begin(), names.end(),
+            [](const std::string* lhs, const std::string* rhs) { return *lhs < *rhs; });
+  for (const auto& name : names) {
+    os << "#define " << *name << "\n";
   }
 
-  for (const auto& item : materialDefines.intDef) {
-    os << "#define " << item.first << " " << item.second << "\n";
-  }
-
-  for (const auto& item : materialDefines.floatDef) {
-    os << "#define " << item.first << " " << item.second << "\n";
-  }
-
-  for (const auto& item : materialDefines.stringDef) {
-    os << "#define " << item.first << " " << item.second << "\n";
-  }
+  writeDefines(os, materialDefines.intDef);
+  writeDefines(os, materialDefines.floatDef);
+  writeDefines(os, materialDefines.stringDef);
 
   return os;
 }
@@ -241,12 +263,6 @@ void MaterialDefines::rebuild()
 
 bool MaterialDefines::isEqual(const MaterialDefines& other) const
 {
-  if ((boolDef.size() != other.boolDef.size()) || (intDef.size() != other.intDef.size())
-      || (floatDef.size() != other.floatDef.size())
-      || (stringDef.size() != other.stringDef.size())) {
-    return false;
-  }
-
   if ((_isDirty != other._isDirty) || (_renderId != other._renderId)
       || (_areLightsDirty != other._areLightsDirty)
       || (_areLightsDisposed != other._areLightsDisposed)
@@ -308,6 +324,14 @@ void MaterialDefines::reset()
   _needUVs            = false;
 }
 
+uint64_t MaterialDefines::hashCode() const
+{
+  auto hash = boolDef.hash(MaterialDefineHash::Seed);
+  hash      = intDef.hash(hash);
+  hash      = floatDef.hash(hash);
+  return stringDef.hash(hash);
+}
+
 std::string MaterialDefines::toString() const
 {
   std::ostringstream oss;
@@ -63,6 +63,12 @@ void MaterialHelper::BindTextureMatrix(BaseTexture& texture, UniformBuffer& unif
   uniformBuffer.updateMatrix(key + "Matrix", matrix);
 }
 
+void MaterialHelper::BindTextureMatrix(BaseTexture& texture, UniformBuffer& uniformBuffer,
+                                       int uniformHandle)
+{
+  uniformBuffer.updateMatrixByHandle(uniformHandle, *texture.getTextureMatrix());
+}
+
 bool MaterialHelper::GetFogState(AbstractMesh* mesh, Scene* scene)
 {
   return (scene->fogEnabled() && mesh->applyFog() && scene->fogMode() != Scene::FOGMODE_NONE);
@@ -163,7 +169,7 @@ void MaterialHelper::PrepareDefinesForBones(AbstractMesh* mesh, MaterialDefines&
   if (mesh->useBones() && mesh->computeBonesUsingShaders() && mesh->skeleton()) {
     defines.intDef["NUM_BONE_INFLUENCERS"] = mesh->numBoneInfluencers();
 
-    const auto materialSupportsBoneTexture = stl_util::contains(defines.boolDef, "BONETEXTURE");
+    const auto materialSupportsBoneTexture = defines.boolDef.contains("BONETEXTURE");
 
     if (mesh->skeleton()->isUsingTextureForMatrices && materialSupportsBoneTexture) {
       defines.boolDef["BONETEXTURE"] = true;
@@ -364,7 +370,7 @@ void MaterialHelper::PrepareDefinesForLight(Scene* scene, AbstractMesh* mesh, co
 
   auto lightIndexStr = std::to_string(lightIndex);
 
-  if (!stl_util::contains(defines.boolDef, "LIGHT" + lightIndexStr)) {
+  if (!defines.boolDef.contains("LIGHT" + lightIndexStr)) {
     state.needRebuild = true;
   }
 
@@ -374,6 +380,7 @@ void MaterialHelper::PrepareDefinesForLight(Scene* scene, AbstractMesh* mesh, co
   defines.boolDef["HEMILIGHT" + lightIndexStr]  = false;
   defines.boolDef["POINTLIGHT" + lightIndexStr] = false;
   defines.boolDef["DIRLIGHT" + lightIndexStr]   = false;
+  defines.boolDef["CLUSTLIGHT" + lightIndexStr] = false;
 
   light->prepareLightSpecificDefines(defines, lightIndex);
 
@@ -477,12 +484,13 @@ bool MaterialHelper::PrepareDefinesForLights(Scene* scene, AbstractMesh* mesh,
   auto lightIndexStr = std::to_string(lightIndex);
   for (auto index = lightIndex; index < maxSimultaneousLights; ++index) {
     const auto indexStr = std::to_string(index);
-    if (stl_util::contains(defines.boolDef, "LIGHT" + indexStr)) {
+    if (defines.boolDef.contains("LIGHT" + indexStr)) {
       defines.boolDef["LIGHT" + indexStr]                  = false;
       defines.boolDef["HEMILIGHT" + indexStr]              = false;
       defines.boolDef["POINTLIGHT" + indexStr]             = false;
       defines.boolDef["DIRLIGHT" + indexStr]               = false;
       defines.boolDef["SPOTLIGHT" + indexStr]              = false;
+      defines.boolDef["CLUSTLIGHT" + indexStr]             = false;
       defines.boolDef["SHADOW" + indexStr]                 = false;
       defines.boolDef["SHADOWCSM" + indexStr]              = false;
       defines.boolDef["SHADOWCSMDEBUG" + indexStr]         = false;
@@ -503,7 +511,7 @@ bool MaterialHelper::PrepareDefinesForLights(Scene* scene, AbstractMesh* mesh,
 
   auto caps = scene->getEngine()->getCaps();
 
-  if (!stl_util::contains(defines.boolDef, "SHADOWFLOAT")) {
+  if (!defines.boolDef.contains("SHADOWFLOAT")) {
     state.needRebuild = true;
   }
 
@@ -557,10 +565,14 @@ void MaterialHelper::PrepareUniformsAndSamplersForLight(
                                    "lightMatrix" + lightIndexStr,     //
                                    "shadowsInfo" + lightIndexStr,     //
                                    "depthValues" + lightIndexStr,     //
+                                   "vSliceData" + lightIndexStr,      //
+                                   "vClusterInfo" + lightIndexStr,    //
                                  });
 
   samplersList.emplace_back("shadowSampler" + lightIndexStr);
   samplersList.emplace_back("depthSampler" + lightIndexStr);
+  samplersList.emplace_back("lightDataTexture" + lightIndexStr);
+  samplersList.emplace_back("clusterTexture" + lightIndexStr);
 
   stl_util::concat(uniformsList, {
                                    "viewFrustumZ" + lightIndexStr,          //
@@ -595,7 +607,7 @@ void MaterialHelper::PrepareUniformsAndSamplersList(std::vector<std::string>& un
                                        defines["PROJECTEDLIGHTTEXTURE" + lightIndexStr]);
   }
 
-  if (stl_util::contains(defines.intDef, "NUM_MORPH_INFLUENCERS")
+  if (defines.intDef.contains("NUM_MORPH_INFLUENCERS")
       && defines.intDef["NUM_MORPH_INFLUENCERS"]) {
     uniformsList.emplace_back("morphTargetInfluences");
   }
@@ -620,7 +632,7 @@ void MaterialHelper::PrepareUniformsAndSamplersList(IEffectCreationOptions& opti
                                        defines["PROJECTEDLIGHTTEXTURE" + lightIndexStr]);
   }
 
-  if (stl_util::contains(defines.intDef, "NUM_MORPH_INFLUENCERS")
+  if (defines.intDef.contains("NUM_MORPH_INFLUENCERS")
       && defines.intDef["NUM_MORPH_INFLUENCERS"]) {
     uniformsList.emplace_back("morphTargetInfluences");
   }
@@ -635,7 +647,7 @@ unsigned int MaterialHelper::HandleFallbacksForShadows(MaterialDefines& defines,
   for (unsigned int lightIndex = 0; lightIndex < maxSimultaneousLights; ++lightIndex) {
     const std::string lightIndexStr = std::to_string(lightIndex);
 
-    if (!stl_util::contains(defines.boolDef, "LIGHT" + lightIndexStr)) {
+    if (!defines.boolDef.contains("LIGHT" + lightIndexStr)) {
       break;
     }
 
@@ -117,7 +117,7 @@ void PerturbNormalBlock::prepareDefines(AbstractMesh* /*mesh*/,
                                         SubMesh* /*subMesh*/)
 {
   const auto normalSamplerName
-    = std::static_pointer_cast<TextureBlock>(normalMapColor()->connectedPoint()->_ownerBlock)
+    = std::static_pointer_cast<TextureBlock>(normalMapColor()->connectedPoint()->ownerBlock())
         ->samplerName();
   const auto useParallax = viewDirection()->isConnected()
                            && ((useParallaxOcclusion && !normalSamplerName.empty())
@@ -177,7 +177,7 @@ PerturbNormalBlock& PerturbNormalBlock::_buildBlock(NodeMaterialBuildState& stat
   state._emitUniformFromString(_tangentSpaceParameterName, "vec2");
 
   const auto normalSamplerName
-    = std::static_pointer_cast<TextureBlock>(normalMapColor()->connectedPoint()->_ownerBlock)
+    = std::static_pointer_cast<TextureBlock>(normalMapColor()->connectedPoint()->ownerBlock())
         ->samplerName();
   const auto useParallax = viewDirection()->isConnected()
                            && ((useParallaxOcclusion && !normalSamplerName.empty())
@@ -339,28 +339,28 @@ void InputBlock::setDefaultValue()
 {
   switch (type) {
     case NodeMaterialBlockConnectionPointTypes::Float:
-      value()->get<float>() = 0.f;
+      value = std::make_shared<AnimationValue>(0.f);
       break;
     case NodeMaterialBlockConnectionPointTypes::Int:
-      value()->get<int>() = 0;
+      value = std::make_shared<AnimationValue>(0);
       break;
     case NodeMaterialBlockConnectionPointTypes::Vector2:
-      value()->get<Vector2>() = Vector2::Zero();
+      value = std::make_shared<AnimationValue>(Vector2::Zero());
       break;
     case NodeMaterialBlockConnectionPointTypes::Vector3:
-      value()->get<Vector3>() = Vector3::Zero();
+      value = std::make_shared<AnimationValue>(Vector3::Zero());
       break;
     case NodeMaterialBlockConnectionPointTypes::Vector4:
-      value()->get<Vector4>() = Vector4::Zero();
+      value = std::make_shared<AnimationValue>(Vector4::Zero());
       break;
     case NodeMaterialBlockConnectionPointTypes::Color3:
-      value()->get<Color3>() = Color3::White();
+      value = std::make_shared<AnimationValue>(Color3::White());
       break;
     case NodeMaterialBlockConnectionPointTypes::Color4:
-      value()->get<Color4>() = Color4(1.f, 1.f, 1.f, 1.f);
+      value = std::make_shared<AnimationValue>(Color4(1.f, 1.f, 1.f, 1.f));
       break;
     case NodeMaterialBlockConnectionPointTypes::Matrix:
-      value()->get<Matrix>() = Matrix::Identity();
+      value = std::make_shared<AnimationValue>(Matrix::Identity());
       break;
     default:
       break;
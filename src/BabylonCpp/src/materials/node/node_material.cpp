@@ -437,6 +437,22 @@ void NodeMaterial::build(bool verbose, bool updateBuildId)
   _sharedData->scene                    = getScene();
   _sharedData->allowEmptyVertexProgram  = allowEmptyVertexProgram;
 
+  // Optimize, before the initialization so that the blocks created by the optimizers are built
+  optimize();
+
+  if (verbose) {
+    for (const auto& optimizer : _optimizers) {
+      const auto& statistics = optimizer->statistics;
+      BABYLON_LOGF_INFO("NodeMaterial",
+                        "Optimizer: vertex instructions %zu -> %zu, fragment instructions %zu -> "
+                        "%zu (%zu removed, %zu folded, %zu hoisted, %zu merged)",
+                        statistics.vertexInstructionsBefore, statistics.vertexInstructionsAfter,
+                        statistics.fragmentInstructionsBefore, statistics.fragmentInstructionsAfter,
+                        statistics.removedBlocks, statistics.foldedBlocks, statistics.hoistedBlocks,
+                        statistics.mergedBlocks)
+    }
+  }
+
   // Initialize blocks
   std::vector<NodeMaterialBlockPtr> vertexNodes;
   std::vector<NodeMaterialBlockPtr> fragmentNodes;
@@ -451,9 +467,6 @@ void NodeMaterial::build(bool verbose, bool updateBuildId)
     _initializeBlock(fragmentOutputNode, _fragmentCompilationState, vertexNodes);
   }
 
-  // Optimize
-  optimize();
-
   // Vertex
   for (const auto& vertexOutputNode : vertexNodes) {
     vertexOutputNode->build(*_vertexCompilationState, vertexNodes);
@@ -477,6 +490,9 @@ void NodeMaterial::build(bool verbose, bool updateBuildId)
   _vertexCompilationState->finalize(*_vertexCompilationState);
   _fragmentCompilationState->finalize(*_fragmentCompilationState);
 
+  // The generated shaders and the build state keep the optimized blocks
+  _restoreOptimizedGraph();
+
   if (updateBuildId) {
     _buildId = NodeMaterial::_BuildIdGenerator++;
   }
@@ -518,8 +534,20 @@ void NodeMaterial::build(bool verbose, bool updateBuildId)
 
 void NodeMaterial::optimize()
 {
+  // Leftover of a build which did not complete
+  _restoreOptimizedGraph();
+
   for (const auto& optimizer : _optimizers) {
-    optimizer->optimize(_vertexOutputNodes, _fragmentOutputNodes);
+    optimizer->optimize(_vertexOutputNodes, _fragmentOutputNodes, attachedBlocks);
+  }
+}
+
+void NodeMaterial::_restoreOptimizedGraph()
+{
+  for (auto it = _optimizers.rbegin(); it != _optimizers.rend(); ++it) {
+    for (const auto& block : (*it)->restore()) {
+      removeBlock(block);
+    }
   }
 }
 
@@ -176,7 +176,7 @@ NodeMaterialBlock::registerInput(const std::string& iName,
 {
   auto iPoint        = point ? point :
                                NodeMaterialConnectionPoint::New(
-                          iName, shared_from_this(), NodeMaterialConnectionPointDirection::Input);
+                          iName, this, NodeMaterialConnectionPointDirection::Input);
   iPoint->type       = type;
   iPoint->isOptional = isOptional;
   if (iTarget.has_value()) {
@@ -196,7 +196,7 @@ NodeMaterialBlock::registerOutput(const std::string& iName,
 {
   auto iPoint  = point ? point :
                          NodeMaterialConnectionPoint::New(
-                          iName, shared_from_this(), NodeMaterialConnectionPointDirection::Output);
+                          iName, this, NodeMaterialConnectionPointDirection::Output);
   iPoint->type = type;
   if (iTarget.has_value()) {
     iPoint->target = *iTarget;
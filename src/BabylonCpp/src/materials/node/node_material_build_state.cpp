@@ -198,8 +198,10 @@ std::string NodeMaterialBuildState::_emitCodeFromInclude(
                                options->repeatKey.c_str());
   }
 
-  auto code = (stl_util::contains(Effect::IncludesShadersStore(), includeName) ?
-                 Effect::IncludesShadersStore()[includeName] :
+  const auto includesShadersStore = Effect::IncludesShadersStore();
+
+  auto code = (stl_util::contains(*includesShadersStore, includeName) ?
+                 includesShadersStore->at(includeName) :
                  "")
               + "\r\n";
 
@@ -248,8 +250,10 @@ void NodeMaterialBuildState::_emitFunctionFromInclude(
     return;
   }
 
-  functions[key] = stl_util::contains(Effect::IncludesShadersStore(), includeName) ?
-                     Effect::IncludesShadersStore()[includeName] :
+  const auto includesShadersStore = Effect::IncludesShadersStore();
+
+  functions[key] = stl_util::contains(*includesShadersStore, includeName) ?
+                     includesShadersStore->at(includeName) :
                      "";
 
   if (sharedData->emitComments) {
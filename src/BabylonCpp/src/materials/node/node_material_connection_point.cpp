@@ -43,9 +43,10 @@ bool NodeMaterialConnectionPoint::AreEquivalentTypes(NodeMaterialBlockConnection
 }
 
 NodeMaterialConnectionPoint::NodeMaterialConnectionPoint(
-  const std::string& iName, const NodeMaterialBlockPtr& ownerBlock,
+  const std::string& iName, NodeMaterialBlock* ownerBlock,
   const NodeMaterialConnectionPointDirection& direction)
     : _ownerBlock{nullptr}
+    , _rawOwnerBlock{ownerBlock}
     , _connectedPoint{nullptr}
     , _typeConnectionSource{nullptr}
     , _defaultConnectionPointType{std::nullopt}
@@ -81,9 +82,8 @@ NodeMaterialConnectionPoint::NodeMaterialConnectionPoint(
     , _connectInputBlock{nullptr}
     , _sourceBlock{nullptr}
 {
-  _ownerBlock = ownerBlock;
-  name        = iName;
-  _direction  = direction;
+  name       = iName;
+  _direction = direction;
 }
 
 NodeMaterialConnectionPointDirection& NodeMaterialConnectionPoint::get_direction()
@@ -93,8 +93,8 @@ NodeMaterialConnectionPointDirection& NodeMaterialConnectionPoint::get_direction
 
 std::string NodeMaterialConnectionPoint::get_associatedVariableName() const
 {
-  if (_ownerBlock->isInput()) {
-    auto inputBlock = std::static_pointer_cast<InputBlock>(_ownerBlock);
+  if (_rawOwnerBlock->isInput()) {
+    auto inputBlock = static_cast<InputBlock*>(_rawOwnerBlock);
     if (inputBlock) {
       return inputBlock->associatedVariableName();
     }
@@ -123,8 +123,8 @@ NodeMaterialBlockConnectionPointTypes& NodeMaterialConnectionPoint::get_innerTyp
 NodeMaterialBlockConnectionPointTypes& NodeMaterialConnectionPoint::get_type()
 {
   if (_type == NodeMaterialBlockConnectionPointTypes::AutoDetect) {
-    if (_ownerBlock->isInput()) {
-      auto inputBlock = std::static_pointer_cast<InputBlock>(_ownerBlock);
+    if (_rawOwnerBlock->isInput()) {
+      auto inputBlock = static_cast<InputBlock*>(_rawOwnerBlock);
       if (inputBlock) {
         return inputBlock->type();
       }
@@ -161,7 +161,7 @@ void NodeMaterialConnectionPoint::set_type(const NodeMaterialBlockConnectionPoin
 
 NodeMaterialBlockTargets& NodeMaterialConnectionPoint::get_target()
 {
-  if (!_prioritizeVertex || !_ownerBlock) {
+  if (!_prioritizeVertex || !_rawOwnerBlock) {
     return _target;
   }
 
@@ -169,7 +169,7 @@ NodeMaterialBlockTargets& NodeMaterialConnectionPoint::get_target()
     return _target;
   }
 
-  if (_ownerBlock->target() == NodeMaterialBlockTargets::Fragment) {
+  if (_rawOwnerBlock->target() == NodeMaterialBlockTargets::Fragment) {
     _tmpTarget = NodeMaterialBlockTargets::Fragment;
     return _tmpTarget;
   }
@@ -211,6 +211,11 @@ NodeMaterialConnectionPointPtr& NodeMaterialConnectionPoint::get_connectedPoint(
 
 NodeMaterialBlockPtr& NodeMaterialConnectionPoint::get_ownerBlock()
 {
+  // The blocks register their connection points while they are constructed, no shared pointer
+  // owns the block yet
+  if (!_ownerBlock && _rawOwnerBlock) {
+    _ownerBlock = _rawOwnerBlock->weak_from_this().lock();
+  }
   return _ownerBlock;
 }
 
@@ -329,7 +334,7 @@ bool NodeMaterialConnectionPoint::canConnectTo(const NodeMaterialConnectionPoint
 NodeMaterialConnectionPointCompatibilityStates NodeMaterialConnectionPoint::checkCompatibilityState(
   const NodeMaterialConnectionPoint& connectionPoint)
 {
-  const auto& iOwnerBlock = _ownerBlock;
+  const auto& iOwnerBlock = get_ownerBlock();
   const auto& otherBlock  = connectionPoint.ownerBlock();
 
   if (iOwnerBlock->target() == NodeMaterialBlockTargets::Fragment) {
@@ -7,7 +7,7 @@ NodeMaterialConnectionPointCustomObject::NodeMaterialConnectionPointCustomObject
   NodeMaterialConnectionPointDirection direction,
   const std::function<NodeMaterialBlockPtr(const std::string& name)>& nodeMaterialBlockConstructor,
   const std::string& blockName, const std::string& nameForCheking)
-    : NodeMaterialConnectionPoint{iName, ownerBlock, direction}
+    : NodeMaterialConnectionPoint{iName, ownerBlock.get(), direction}
     , _nodeMaterialBlockConstructor{nodeMaterialBlockConstructor}
     , _blockName{blockName}
     , _nameForCheking{nameForCheking}
@@ -1,7 +1,5 @@
 #include <babylon/materials/node/node_material_defines.h>
 
-#include <babylon/babylon_stl_util.h>
-
 namespace BABYLON {
 
 NodeMaterialDefines::NodeMaterialDefines() : MaterialDefines{}
@@ -62,7 +60,7 @@ NodeMaterialDefines::~NodeMaterialDefines() = default;
 void NodeMaterialDefines::setValue(const std::string& name, bool value,
                                    bool markAsUnprocessedIfDirty)
 {
-  if (markAsUnprocessedIfDirty && (!stl_util::contains(boolDef, name) || boolDef[name] != value)) {
+  if (markAsUnprocessedIfDirty && (!boolDef.contains(name) || boolDef[name] != value)) {
     markAsUnprocessed();
   }
 
@@ -73,7 +71,7 @@ void NodeMaterialDefines::setValue(const std::string& name, const std::string& v
                                    bool markAsUnprocessedIfDirty)
 {
   if (markAsUnprocessedIfDirty
-      && (!stl_util::contains(stringDef, name) || stringDef[name] != value)) {
+      && (!stringDef.contains(name) || stringDef[name] != value)) {
     markAsUnprocessed();
   }
 
@@ -1,12 +1,644 @@
 #include <babylon/materials/node/optimizers/node_material_optimizer.h>
 
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <functional>
+#include <unordered_map>
+#include <unordered_set>
+
+#include <babylon/babylon_stl_util.h>
+#include <babylon/materials/node/blocks/clamp_block.h>
+#include <babylon/materials/node/blocks/input/input_block.h>
+#include <babylon/materials/node/node_material_block.h>
+#include <babylon/materials/node/node_material_connection_point.h>
+#include <babylon/maths/color3.h>
+#include <babylon/maths/color4.h>
+#include <babylon/maths/vector2.h>
+#include <babylon/maths/vector3.h>
+#include <babylon/maths/vector4.h>
+#include <babylon/misc/string_tools.h>
+
 namespace BABYLON {
 
-void NodeMaterialOptimizer::optimize(
-  const std::vector<NodeMaterialBlockPtr>& /*vertexOutputNodes*/,
-  const std::vector<NodeMaterialBlockPtr>& /*fragmentOutputNodes*/)
+namespace {
+
+/**
+ * Value of a float, vector or color connection point, the scalars are broadcasted.
+ */
+struct Value {
+  std::array<float, 4> v{{0.f, 0.f, 0.f, 0.f}};
+  size_t n = 1;
+
+  float operator[](size_t i) const
+  {
+    return n == 1 ? v[0] : (i < n ? v[i] : 0.f);
+  }
+}; // end of struct Value
+
+/**
+ * Math expression computed by a block whose inputs are constant or uniform input blocks.
+ */
+struct Expression {
+  std::string className;
+  InputBlockPtr input = nullptr;
+  std::vector<std::shared_ptr<Expression>> arguments;
+  NodeMaterialBlockConnectionPointTypes type = NodeMaterialBlockConnectionPointTypes::Float;
+  float minimum                              = 0.f;
+  float maximum                              = 0.f;
+  bool isConstant                            = true;
+}; // end of struct Expression
+
+using ExpressionPtr = std::shared_ptr<Expression>;
+
+/**
+ * Classes of the blocks which can be evaluated on the CPU.
+ */
+const std::unordered_set<std::string> evaluableClassNames{
+  "AddBlock",        "SubtractBlock", "MultiplyBlock", "DivideBlock",   "MinBlock",
+  "MaxBlock",        "ModBlock",      "PowBlock",      "ScaleBlock",    "DotBlock",
+  "DistanceBlock",   "LengthBlock",   "NegateBlock",   "OneMinusBlock", "ReciprocalBlock",
+  "NormalizeBlock",  "LerpBlock",     "ClampBlock",    "StepBlock",     "SmoothStepBlock"};
+
+/**
+ * Classes of the blocks whose result only depends on their inputs.
+ */
+const std::unordered_set<std::string> mergeableClassNames{"CrossBlock", "ArcTan2Block"};
+
+size_t componentCount(NodeMaterialBlockConnectionPointTypes type)
+{
+  switch (type) {
+    case NodeMaterialBlockConnectionPointTypes::Float:
+      return 1;
+    case NodeMaterialBlockConnectionPointTypes::Vector2:
+      return 2;
+    case NodeMaterialBlockConnectionPointTypes::Vector3:
+    case NodeMaterialBlockConnectionPointTypes::Color3:
+      return 3;
+    case NodeMaterialBlockConnectionPointTypes::Vector4:
+    case NodeMaterialBlockConnectionPointTypes::Color4:
+      return 4;
+    default:
+      return 0;
+  }
+}
+
+Value toValue(NodeMaterialBlockConnectionPointTypes type, const AnimationValuePtr& animationValue)
+{
+  Value value;
+  value.n = componentCount(type);
+  switch (type) {
+    case NodeMaterialBlockConnectionPointTypes::Float:
+      value.v[0] = animationValue->get<float>();
+      break;
+    case NodeMaterialBlockConnectionPointTypes::Vector2: {
+      const auto& vector2 = animationValue->get<Vector2>();
+      value.v             = {{vector2.x, vector2.y, 0.f, 0.f}};
+    } break;
+    case NodeMaterialBlockConnectionPointTypes::Vector3: {
+      const auto& vector3 = animationValue->get<Vector3>();
+      value.v             = {{vector3.x, vector3.y, vector3.z, 0.f}};
+    } break;
+    case NodeMaterialBlockConnectionPointTypes::Vector4: {
+      const auto& vector4 = animationValue->get<Vector4>();
+      value.v             = {{vector4.x, vector4.y, vector4.z, vector4.w}};
+    } break;
+    case NodeMaterialBlockConnectionPointTypes::Color3: {
+      const auto& color3 = animationValue->get<Color3>();
+      value.v            = {{color3.r, color3.g, color3.b, 0.f}};
+    } break;
+    case NodeMaterialBlockConnectionPointTypes::Color4: {
+      const auto& color4 = animationValue->get<Color4>();
+      value.v            = {{color4.r, color4.g, color4.b, color4.a}};
+    } break;
+    default:
+      break;
+  }
+  return value;
+}
+
+AnimationValuePtr toAnimationValue(NodeMaterialBlockConnectionPointTypes type, const Value& value)
+{
+  switch (type) {
+    case NodeMaterialBlockConnectionPointTypes::Float:
+      return std::make_shared<AnimationValue>(value[0]);
+    case NodeMaterialBlockConnectionPointTypes::Vector2:
+      return std::make_shared<AnimationValue>(Vector2(value[0], value[1]));
+    case NodeMaterialBlockConnectionPointTypes::Vector3:
+      return std::make_shared<AnimationValue>(Vector3(value[0], value[1], value[2]));
+    case NodeMaterialBlockConnectionPointTypes::Color3:
+      return std::make_shared<AnimationValue>(Color3(value[0], value[1], value[2]));
+    case NodeMaterialBlockConnectionPointTypes::Color4:
+      return std::make_shared<AnimationValue>(Color4(value[0], value[1], value[2], value[3]));
+    default:
+      return std::make_shared<AnimationValue>(Vector4(value[0], value[1], value[2], value[3]));
+  }
+}
+
+Value componentWise(const Value& a, const Value& b, const std::function<float(float, float)>& op)
+{
+  Value result;
+  result.n = std::max(a.n, b.n);
+  for (size_t i = 0; i < result.n; ++i) {
+    result.v[i] = op(a[i], b[i]);
+  }
+  return result;
+}
+
+Value componentWise(const Value& a, const std::function<float(float)>& op)
+{
+  Value result;
+  result.n = a.n;
+  for (size_t i = 0; i < result.n; ++i) {
+    result.v[i] = op(a[i]);
+  }
+  return result;
+}
+
+float dot(const Value& a, const Value& b)
 {
-  // Do nothing by default
+  float result = 0.f;
+  for (size_t i = 0; i < std::max(a.n, b.n); ++i) {
+    result += a[i] * b[i];
+  }
+  return result;
+}
+
+Value scalar(float x)
+{
+  Value result;
+  result.v[0] = x;
+  return result;
+}
+
+Value evaluate(const Expression& expression)
+{
+  if (expression.input) {
+    auto& input       = *expression.input;
+    const auto& value = input.valueCallback() ? input.valueCallback()() : input.value();
+    return toValue(input.type(), value);
+  }
+
+  std::vector<Value> args;
+  args.reserve(expression.arguments.size());
+  for (const auto& argument : expression.arguments) {
+    args.emplace_back(evaluate(*argument));
+  }
+
+  const auto& name = expression.className;
+  Value result;
+  if (name == "AddBlock") {
+    result = componentWise(args[0], args[1], [](float a, float b) { return a + b; });
+  }
+  else if (name == "SubtractBlock") {
+    result = componentWise(args[0], args[1], [](float a, float b) { return a - b; });
+  }
+  else if (name == "MultiplyBlock") {
+    result = componentWise(args[0], args[1], [](float a, float b) { return a * b; });
+  }
+  else if (name == "DivideBlock") {
+    result = componentWise(args[0], args[1], [](float a, float b) { return a / b; });
+  }
+  else if (name == "MinBlock") {
+    result = componentWise(args[0], args[1], [](float a, float b) { return std::min(a, b); });
+  }
+  else if (name == "MaxBlock") {
+    result = componentWise(args[0], args[1], [](float a, float b) { return std::max(a, b); });
+  }
+  else if (name == "ModBlock") {
+    result = componentWise(args[0], args[1],
+                           [](float a, float b) { return a - b * std::floor(a / b); });
+  }
+  else if (name == "PowBlock") {
+    result = componentWise(args[0], args[1], [](float a, float b) { return std::pow(a, b); });
+  }
+  else if (name == "ScaleBlock") {
+    const auto factor = args[1][0];
+    result            = componentWise(args[0], [factor](float a) { return a * factor; });
+  }
+  else if (name == "DotBlock") {
+    result = scalar(dot(args[0], args[1]));
+  }
+  else if (name == "DistanceBlock") {
+    const auto difference
+      = componentWise(args[0], args[1], [](float a, float b) { return a - b; });
+    result = scalar(std::sqrt(dot(difference, difference)));
+  }
+  else if (name == "LengthBlock") {
+    result = scalar(std::sqrt(dot(args[0], args[0])));
+  }
+  else if (name == "NegateBlock") {
+    result = componentWise(args[0], [](float a) { return -a; });
+  }
+  else if (name == "OneMinusBlock") {
+    result = componentWise(args[0], [](float a) { return 1.f - a; });
+  }
+  else if (name == "ReciprocalBlock") {
+    result = componentWise(args[0], [](float a) { return 1.f / a; });
+  }
+  else if (name == "NormalizeBlock") {
+    const auto length = std::sqrt(dot(args[0], args[0]));
+    result            = componentWise(args[0], [length](float a) { return a / length; });
+  }
+  else if (name == "LerpBlock") {
+    const auto difference
+      = componentWise(args[1], args[0], [](float a, float b) { return a - b; });
+    result = componentWise(args[0], componentWise(difference, args[2], std::multiplies<float>()),
+                           std::plus<float>());
+  }
+  else if (name == "ClampBlock") {
+    const auto minimum = expression.minimum;
+    const auto maximum = expression.maximum;
+    result             = componentWise(
+      args[0], [minimum, maximum](float a) { return std::min(std::max(a, minimum), maximum); });
+  }
+  else if (name == "StepBlock") {
+    // step(edge, value)
+    result = componentWise(args[0], args[1], [](float a, float b) { return a < b ? 0.f : 1.f; });
+  }
+  else if (name == "SmoothStepBlock") {
+    // smoothstep(edge0, edge1, value)
+    const auto edge0 = args[1][0];
+    const auto edge1 = args[2][0];
+    result           = componentWise(args[0], [edge0, edge1](float a) {
+      const auto t = std::min(std::max((a - edge0) / (edge1 - edge0), 0.f), 1.f);
+      return t * t * (3.f - 2.f * t);
+    });
+  }
+
+  // Conversion to the type of the output
+  Value output;
+  output.n = componentCount(expression.type);
+  for (size_t i = 0; i < output.n; ++i) {
+    output.v[i] = result[i];
+  }
+  return output;
+}
+
+} // end of anonymous namespace
+
+void NodeMaterialOptimizer::optimize(const std::vector<NodeMaterialBlockPtr>& vertexOutputNodes,
+                                     const std::vector<NodeMaterialBlockPtr>& fragmentOutputNodes,
+                                     const std::vector<NodeMaterialBlockPtr>& attachedBlocks)
+{
+  // Always start from the graph authored by the user
+  restore();
+
+  statistics = NodeMaterialOptimizerStatistics{};
+  _countInstructions(vertexOutputNodes, fragmentOutputNodes, statistics.vertexInstructionsBefore,
+                     statistics.fragmentInstructionsBefore);
+
+  auto blocks = _GetReachableBlocks(vertexOutputNodes, fragmentOutputNodes);
+  if (removeDeadBlocks) {
+    statistics.removedBlocks = _removeDeadBlocks(blocks, attachedBlocks);
+  }
+
+  if (foldConstants) {
+    _foldConstants(blocks);
+    blocks = _GetReachableBlocks(vertexOutputNodes, fragmentOutputNodes);
+  }
+
+  if (mergeIdenticalBlocks) {
+    _mergeIdenticalBlocks(blocks);
+    blocks = _GetReachableBlocks(vertexOutputNodes, fragmentOutputNodes);
+  }
+
+  // Detach the replaced blocks from the graph
+  _removeDeadBlocks(blocks, attachedBlocks);
+
+  _countInstructions(vertexOutputNodes, fragmentOutputNodes, statistics.vertexInstructionsAfter,
+                     statistics.fragmentInstructionsAfter);
+}
+
+std::vector<NodeMaterialBlockPtr> NodeMaterialOptimizer::restore()
+{
+  // Latest changes first, so that each input ends up connected to its original output
+  for (auto it = _previousConnections.rbegin(); it != _previousConnections.rend(); ++it) {
+    const auto& endpoint       = it->first;
+    const auto connectedPoint = endpoint->connectedPoint();
+    if (connectedPoint) {
+      connectedPoint->disconnectFrom(endpoint);
+    }
+    // The connection existed before the optimization, it was already validated
+    it->second->connectTo(endpoint, true);
+  }
+  _previousConnections.clear();
+
+  std::vector<NodeMaterialBlockPtr> createdBlocks;
+  createdBlocks.swap(_createdBlocks);
+  return createdBlocks;
+}
+
+void NodeMaterialOptimizer::_disconnect(const NodeMaterialConnectionPointPtr& endpoint)
+{
+  const auto connectedPoint = endpoint->connectedPoint();
+  if (!connectedPoint) {
+    return;
+  }
+
+  connectedPoint->disconnectFrom(endpoint);
+  _previousConnections.emplace_back(endpoint, connectedPoint);
+}
+
+bool NodeMaterialOptimizer::_reconnect(
+  const NodeMaterialConnectionPointPtr& from, const NodeMaterialConnectionPointPtr& to,
+  const std::function<bool(const NodeMaterialConnectionPointPtr& endpoint)>& filter)
+{
+  auto reconnected     = false;
+  const auto endpoints = from->endpoints();
+  for (const auto& endpoint : endpoints) {
+    // The endpoints which cannot be connected keep using the previous point
+    if ((filter && !filter(endpoint)) || !to->canConnectTo(*endpoint)) {
+      continue;
+    }
+    _disconnect(endpoint);
+    to->connectTo(endpoint);
+    reconnected = true;
+  }
+  return reconnected;
+}
+
+std::vector<NodeMaterialBlockPtr> NodeMaterialOptimizer::_GetReachableBlocks(
+  const std::vector<NodeMaterialBlockPtr>& vertexOutputNodes,
+  const std::vector<NodeMaterialBlockPtr>& fragmentOutputNodes)
+{
+  std::vector<NodeMaterialBlockPtr> blocks;
+  std::unordered_set<NodeMaterialBlock*> visited;
+
+  std::function<void(const NodeMaterialBlockPtr&)> visit = [&](const NodeMaterialBlockPtr& block) {
+    if (!visited.insert(block.get()).second) {
+      return;
+    }
+    for (const auto& input : block->inputs()) {
+      if (input->connectedPoint()) {
+        visit(input->connectedPoint()->ownerBlock());
+      }
+    }
+    blocks.emplace_back(block);
+  };
+
+  for (const auto& outputNode : vertexOutputNodes) {
+    visit(outputNode);
+  }
+  for (const auto& outputNode : fragmentOutputNodes) {
+    visit(outputNode);
+  }
+
+  return blocks;
+}
+
+void NodeMaterialOptimizer::_countInstructions(
+  const std::vector<NodeMaterialBlockPtr>& vertexOutputNodes,
+  const std::vector<NodeMaterialBlockPtr>& fragmentOutputNodes, size_t& vertexInstructions,
+  size_t& fragmentInstructions) const
+{
+  std::unordered_set<NodeMaterialBlock*> vertexBlocks;
+  std::unordered_set<NodeMaterialBlock*> fragmentBlocks;
+
+  // The vertex blocks used by the fragment shader are computed in the vertex shader
+  std::function<void(const NodeMaterialBlockPtr&, bool)> visit
+    = [&](const NodeMaterialBlockPtr& block, bool inVertexShader) {
+        inVertexShader = inVertexShader || block->target() == NodeMaterialBlockTargets::Vertex;
+        auto& visited  = inVertexShader ? vertexBlocks : fragmentBlocks;
+        if (!visited.insert(block.get()).second) {
+          return;
+        }
+        for (const auto& input : block->inputs()) {
+          if (input->connectedPoint()) {
+            visit(input->connectedPoint()->ownerBlock(), inVertexShader);
+          }
+        }
+      };
+
+  for (const auto& outputNode : vertexOutputNodes) {
+    visit(outputNode, true);
+  }
+  for (const auto& outputNode : fragmentOutputNodes) {
+    visit(outputNode, false);
+  }
+
+  const auto countInstructions = [](const std::unordered_set<NodeMaterialBlock*>& blocks) {
+    return static_cast<size_t>(std::count_if(
+      blocks.begin(), blocks.end(), [](NodeMaterialBlock* block) { return !block->isInput(); }));
+  };
+  vertexInstructions   = countInstructions(vertexBlocks);
+  fragmentInstructions = countInstructions(fragmentBlocks);
+}
+
+void NodeMaterialOptimizer::_foldConstants(const std::vector<NodeMaterialBlockPtr>& blocks)
+{
+  std::unordered_map<NodeMaterialBlock*, ExpressionPtr> expressions;
+
+  // Expressions of the blocks, the inputs are listed before the blocks using them
+  for (const auto& block : blocks) {
+    auto expression = std::make_shared<Expression>();
+
+    if (block->isInput()) {
+      auto input = std::static_pointer_cast<InputBlock>(block);
+      if (!input->isUniform() || input->isSystemValue() || input->convertToGammaSpace
+          || input->convertToLinearSpace || componentCount(input->type()) == 0
+          || (!input->valueCallback() && !input->value())) {
+        continue;
+      }
+      expression->input        = input;
+      expression->type         = input->type();
+      expression->isConstant   = input->isConstant && !input->valueCallback();
+      expressions[block.get()] = expression;
+      continue;
+    }
+
+    const auto className = block->getClassName();
+    if (!stl_util::contains(evaluableClassNames, className) || block->outputs().size() != 1
+        || componentCount(block->outputs()[0]->type()) == 0) {
+      continue;
+    }
+
+    bool evaluable = true;
+    for (const auto& input : block->inputs()) {
+      const auto& connectedPoint = input->connectedPoint();
+      if (!connectedPoint || !stl_util::contains(expressions, connectedPoint->ownerBlock().get())) {
+        evaluable = false;
+        break;
+      }
+      const auto& argument = expressions[connectedPoint->ownerBlock().get()];
+      expression->arguments.emplace_back(argument);
+      expression->isConstant = expression->isConstant && argument->isConstant;
+    }
+    if (!evaluable) {
+      continue;
+    }
+
+    expression->className = className;
+    expression->type      = block->outputs()[0]->type();
+    if (className == "ClampBlock") {
+      const auto clampBlock = std::static_pointer_cast<ClampBlock>(block);
+      expression->minimum   = clampBlock->minimum;
+      expression->maximum   = clampBlock->maximum;
+    }
+    expressions[block.get()] = expression;
+  }
+
+  // The blocks which can be evaluated are replaced along with the blocks using them
+  const auto isNotEvaluable = [&expressions](const NodeMaterialConnectionPointPtr& endpoint) {
+    return !stl_util::contains(expressions, endpoint->ownerBlock().get());
+  };
+
+  // Replace the outputs used by blocks which cannot be evaluated
+  for (const auto& block : blocks) {
+    if (block->isInput() || !stl_util::contains(expressions, block.get())) {
+      continue;
+    }
+
+    const auto& output    = block->outputs()[0];
+    const auto& endpoints = output->endpoints();
+    if (std::none_of(endpoints.begin(), endpoints.end(), isNotEvaluable)) {
+      continue;
+    }
+
+    const auto& expression = expressions[block.get()];
+    const auto type        = expression->type;
+    auto replacement = InputBlock::New(block->name(), NodeMaterialBlockTargets::Vertex, type);
+    replacement->value = toAnimationValue(type, evaluate(*expression));
+    if (expression->isConstant) {
+      replacement->isConstant = true;
+    }
+    else {
+      // Computed once per bind instead of once per vertex or fragment
+      replacement->valueCallback = [expression, type]() -> AnimationValuePtr {
+        return toAnimationValue(type, evaluate(*expression));
+      };
+    }
+
+    if (!_reconnect(output, replacement->output(), isNotEvaluable)) {
+      continue;
+    }
+
+    _createdBlocks.emplace_back(replacement);
+    if (expression->isConstant) {
+      ++statistics.foldedBlocks;
+    }
+    else {
+      ++statistics.hoistedBlocks;
+    }
+  }
+}
+
+void NodeMaterialOptimizer::_mergeIdenticalBlocks(const std::vector<NodeMaterialBlockPtr>& blocks)
+{
+  std::unordered_map<std::string, NodeMaterialBlockPtr> identicalBlocks;
+
+  // The inputs of a block are merged before the block itself
+  for (const auto& block : blocks) {
+    std::string key;
+
+    if (block->isInput()) {
+      const auto input = std::static_pointer_cast<InputBlock>(block);
+      if (input->isSystemValue()) {
+        key = StringTools::printf("system|%d", static_cast<int>(*input->systemValue()));
+      }
+      else if (input->isAttribute()) {
+        key = "attribute|" + input->name();
+      }
+      else if (input->isConstant && !input->valueCallback() && input->value()
+               && componentCount(input->type()) > 0 && !input->convertToGammaSpace
+               && !input->convertToLinearSpace) {
+        const auto value = toValue(input->type(), input->value());
+        key              = StringTools::printf("constant|%d|%.9g|%.9g|%.9g|%.9g",
+                                  static_cast<int>(input->type()), value[0], value[1],
+                                  value[2], value[3]);
+      }
+      else {
+        continue;
+      }
+    }
+    else {
+      const auto className = block->getClassName();
+      if (!stl_util::contains(evaluableClassNames, className)
+          && !stl_util::contains(mergeableClassNames, className)) {
+        continue;
+      }
+
+      key = StringTools::printf("%s|%d", className.c_str(), static_cast<int>(block->target()));
+      for (const auto& input : block->inputs()) {
+        key += StringTools::printf("|%p", static_cast<void*>(input->connectedPoint().get()));
+      }
+      if (className == "ClampBlock") {
+        const auto clampBlock = std::static_pointer_cast<ClampBlock>(block);
+        key += StringTools::printf("|%.9g|%.9g", clampBlock->minimum, clampBlock->maximum);
+      }
+    }
+
+    if (!stl_util::contains(identicalBlocks, key)) {
+      identicalBlocks[key] = block;
+      continue;
+    }
+
+    const auto& identicalBlock = identicalBlocks[key];
+    auto merged                = false;
+    for (size_t i = 0; i < block->outputs().size(); ++i) {
+      merged = _reconnect(block->outputs()[i], identicalBlock->outputs()[i]) || merged;
+    }
+    if (merged) {
+      ++statistics.mergedBlocks;
+    }
+  }
+}
+
+size_t
+NodeMaterialOptimizer::_removeDeadBlocks(const std::vector<NodeMaterialBlockPtr>& blocks,
+                                         const std::vector<NodeMaterialBlockPtr>& attachedBlocks)
+{
+  std::unordered_set<NodeMaterialBlock*> reachableBlocks;
+  for (const auto& block : blocks) {
+    reachableBlocks.insert(block.get());
+  }
+
+  // The attached blocks, which can be connected to dead blocks only, and the blocks using the
+  // outputs of the reachable blocks, which are not always attached yet
+  std::vector<NodeMaterialBlockPtr> deadBlocks;
+  std::unordered_set<NodeMaterialBlock*> visited;
+  const auto addDeadBlock = [&](const NodeMaterialBlockPtr& block) {
+    if (!stl_util::contains(reachableBlocks, block.get()) && visited.insert(block.get()).second) {
+      deadBlocks.emplace_back(block);
+    }
+  };
+  for (const auto& block : attachedBlocks) {
+    addDeadBlock(block);
+  }
+  for (const auto& block : blocks) {
+    for (const auto& output : block->outputs()) {
+      for (const auto& endpoint : output->endpoints()) {
+        addDeadBlock(endpoint->ownerBlock());
+      }
+    }
+  }
+
+  const auto isConnected = [](const NodeMaterialBlockPtr& block) {
+    return std::any_of(block->inputs().begin(), block->inputs().end(),
+                       [](const NodeMaterialConnectionPointPtr& input) {
+                         return input->isConnected();
+                       })
+           || std::any_of(block->outputs().begin(), block->outputs().end(),
+                          [](const NodeMaterialConnectionPointPtr& output) {
+                            return output->hasEndpoints();
+                          });
+  };
+  const auto removedBlocks
+    = static_cast<size_t>(std::count_if(deadBlocks.begin(), deadBlocks.end(), isConnected));
+
+  for (const auto& block : deadBlocks) {
+    for (const auto& input : block->inputs()) {
+      _disconnect(input);
+    }
+    for (const auto& output : block->outputs()) {
+      const auto endpoints = output->endpoints();
+      for (const auto& endpoint : endpoints) {
+        _disconnect(endpoint);
+      }
+    }
+  }
+
+  return removedBlocks;
 }
 
 } // end of namespace BABYLON
@@ -1218,6 +1218,64 @@ void PBRBaseMaterial::buildUniformLayout()
   ubo.addUniform("vSphericalZX", 3);
 
   ubo.create();
+
+  // Resolve the uniforms once, the bindings update them by handle
+  _uniformHandles.vAlbedoInfos                 = ubo.getUniformHandle("vAlbedoInfos");
+  _uniformHandles.vAmbientInfos                = ubo.getUniformHandle("vAmbientInfos");
+  _uniformHandles.vOpacityInfos                = ubo.getUniformHandle("vOpacityInfos");
+  _uniformHandles.vEmissiveInfos               = ubo.getUniformHandle("vEmissiveInfos");
+  _uniformHandles.vLightmapInfos               = ubo.getUniformHandle("vLightmapInfos");
+  _uniformHandles.vReflectivityInfos           = ubo.getUniformHandle("vReflectivityInfos");
+  _uniformHandles.vMicroSurfaceSamplerInfos    = ubo.getUniformHandle("vMicroSurfaceSamplerInfos");
+  _uniformHandles.vReflectionInfos             = ubo.getUniformHandle("vReflectionInfos");
+  _uniformHandles.vReflectionFilteringInfo     = ubo.getUniformHandle("vReflectionFilteringInfo");
+  _uniformHandles.vReflectionPosition          = ubo.getUniformHandle("vReflectionPosition");
+  _uniformHandles.vReflectionSize              = ubo.getUniformHandle("vReflectionSize");
+  _uniformHandles.vBumpInfos                   = ubo.getUniformHandle("vBumpInfos");
+  _uniformHandles.albedoMatrix                 = ubo.getUniformHandle("albedoMatrix");
+  _uniformHandles.ambientMatrix                = ubo.getUniformHandle("ambientMatrix");
+  _uniformHandles.opacityMatrix                = ubo.getUniformHandle("opacityMatrix");
+  _uniformHandles.emissiveMatrix               = ubo.getUniformHandle("emissiveMatrix");
+  _uniformHandles.lightmapMatrix               = ubo.getUniformHandle("lightmapMatrix");
+  _uniformHandles.reflectivityMatrix           = ubo.getUniformHandle("reflectivityMatrix");
+  _uniformHandles.microSurfaceSamplerMatrix    = ubo.getUniformHandle("microSurfaceSamplerMatrix");
+  _uniformHandles.bumpMatrix                   = ubo.getUniformHandle("bumpMatrix");
+  _uniformHandles.vTangentSpaceParams          = ubo.getUniformHandle("vTangentSpaceParams");
+  _uniformHandles.reflectionMatrix             = ubo.getUniformHandle("reflectionMatrix");
+  _uniformHandles.vReflectionColor             = ubo.getUniformHandle("vReflectionColor");
+  _uniformHandles.vAlbedoColor                 = ubo.getUniformHandle("vAlbedoColor");
+  _uniformHandles.vLightingIntensity           = ubo.getUniformHandle("vLightingIntensity");
+  _uniformHandles.vReflectionMicrosurfaceInfos
+    = ubo.getUniformHandle("vReflectionMicrosurfaceInfos");
+  _uniformHandles.pointSize                    = ubo.getUniformHandle("pointSize");
+  _uniformHandles.vReflectivityColor           = ubo.getUniformHandle("vReflectivityColor");
+  _uniformHandles.vEmissiveColor               = ubo.getUniformHandle("vEmissiveColor");
+  _uniformHandles.vAmbientColor                = ubo.getUniformHandle("vAmbientColor");
+  _uniformHandles.vDebugMode                   = ubo.getUniformHandle("vDebugMode");
+  _uniformHandles.vMetallicReflectanceFactors
+    = ubo.getUniformHandle("vMetallicReflectanceFactors");
+  _uniformHandles.vMetallicReflectanceInfos    = ubo.getUniformHandle("vMetallicReflectanceInfos");
+  _uniformHandles.metallicReflectanceMatrix    = ubo.getUniformHandle("metallicReflectanceMatrix");
+  _uniformHandles.vReflectanceInfos            = ubo.getUniformHandle("vReflectanceInfos");
+  _uniformHandles.reflectanceMatrix            = ubo.getUniformHandle("reflectanceMatrix");
+  _uniformHandles.vSphericalL00                = ubo.getUniformHandle("vSphericalL00");
+  _uniformHandles.vSphericalL1_1               = ubo.getUniformHandle("vSphericalL1_1");
+  _uniformHandles.vSphericalL10                = ubo.getUniformHandle("vSphericalL10");
+  _uniformHandles.vSphericalL11                = ubo.getUniformHandle("vSphericalL11");
+  _uniformHandles.vSphericalL2_2               = ubo.getUniformHandle("vSphericalL2_2");
+  _uniformHandles.vSphericalL2_1               = ubo.getUniformHandle("vSphericalL2_1");
+  _uniformHandles.vSphericalL20                = ubo.getUniformHandle("vSphericalL20");
+  _uniformHandles.vSphericalL21                = ubo.getUniformHandle("vSphericalL21");
+  _uniformHandles.vSphericalL22                = ubo.getUniformHandle("vSphericalL22");
+  _uniformHandles.vSphericalX                  = ubo.getUniformHandle("vSphericalX");
+  _uniformHandles.vSphericalY                  = ubo.getUniformHandle("vSphericalY");
+  _uniformHandles.vSphericalZ                  = ubo.getUniformHandle("vSphericalZ");
+  _uniformHandles.vSphericalXX_ZZ              = ubo.getUniformHandle("vSphericalXX_ZZ");
+  _uniformHandles.vSphericalYY_ZZ              = ubo.getUniformHandle("vSphericalYY_ZZ");
+  _uniformHandles.vSphericalZZ                 = ubo.getUniformHandle("vSphericalZZ");
+  _uniformHandles.vSphericalXY                 = ubo.getUniformHandle("vSphericalXY");
+  _uniformHandles.vSphericalYZ                 = ubo.getUniformHandle("vSphericalYZ");
+  _uniformHandles.vSphericalZX                 = ubo.getUniformHandle("vSphericalZX");
 }
 
 void PBRBaseMaterial::unbind()
@@ -1291,39 +1349,46 @@ void PBRBaseMaterial::bindForSubMesh(Matrix& world, Mesh* mesh, SubMesh* subMesh
       // Texture uniforms
       if (scene->texturesEnabled()) {
         if (_albedoTexture && MaterialFlags::DiffuseTextureEnabled()) {
-          ubo.updateFloat2("vAlbedoInfos", static_cast<float>(_albedoTexture->coordinatesIndex),
-                           _albedoTexture->level, "");
-          MaterialHelper::BindTextureMatrix(*_albedoTexture, ubo, "albedo");
+          ubo.updateFloat2ByHandle(_uniformHandles.vAlbedoInfos,
+                                   static_cast<float>(_albedoTexture->coordinatesIndex),
+                                   _albedoTexture->level);
+          MaterialHelper::BindTextureMatrix(*_albedoTexture, ubo, _uniformHandles.albedoMatrix);
         }
 
         if (_ambientTexture && MaterialFlags::AmbientTextureEnabled()) {
-          ubo.updateFloat4("vAmbientInfos", static_cast<float>(_ambientTexture->coordinatesIndex),
-                           _ambientTexture->level, _ambientTextureStrength,
-                           static_cast<float>(_ambientTextureImpactOnAnalyticalLights), "");
-          MaterialHelper::BindTextureMatrix(*_ambientTexture, ubo, "ambient");
+          ubo.updateFloat4ByHandle(_uniformHandles.vAmbientInfos,
+                                   static_cast<float>(_ambientTexture->coordinatesIndex),
+                                   _ambientTexture->level, _ambientTextureStrength,
+                                   static_cast<float>(_ambientTextureImpactOnAnalyticalLights));
+          MaterialHelper::BindTextureMatrix(*_ambientTexture, ubo, _uniformHandles.ambientMatrix);
         }
 
         if (_opacityTexture && MaterialFlags::OpacityTextureEnabled()) {
-          ubo.updateFloat2("vOpacityInfos", static_cast<float>(_opacityTexture->coordinatesIndex),
-                           _opacityTexture->level, "");
-          MaterialHelper::BindTextureMatrix(*_opacityTexture, ubo, "opacity");
+          ubo.updateFloat2ByHandle(_uniformHandles.vOpacityInfos,
+                                   static_cast<float>(_opacityTexture->coordinatesIndex),
+                                   _opacityTexture->level);
+          MaterialHelper::BindTextureMatrix(*_opacityTexture, ubo, _uniformHandles.opacityMatrix);
         }
 
         if (reflectionTexture && MaterialFlags::ReflectionTextureEnabled()) {
-          ubo.updateMatrix("reflectionMatrix", *reflectionTexture->getReflectionTextureMatrix());
-          ubo.updateFloat2("vReflectionInfos", reflectionTexture->level, 0, "");
+          ubo.updateMatrixByHandle(_uniformHandles.reflectionMatrix,
+                                   *reflectionTexture->getReflectionTextureMatrix());
+          ubo.updateFloat2ByHandle(_uniformHandles.vReflectionInfos, reflectionTexture->level, 0);
 
           if (reflectionTexture->boundingBoxSize()) {
             auto cubeTexture = std::static_pointer_cast<CubeTexture>(reflectionTexture);
             if (cubeTexture) {
-              ubo.updateVector3("vReflectionPosition", cubeTexture->boundingBoxPosition);
-              ubo.updateVector3("vReflectionSize", *cubeTexture->boundingBoxSize());
+              ubo.updateVector3ByHandle(_uniformHandles.vReflectionPosition,
+                                        cubeTexture->boundingBoxPosition);
+              ubo.updateVector3ByHandle(_uniformHandles.vReflectionSize,
+                                        *cubeTexture->boundingBoxSize());
             }
           }
 
           if (realTimeFiltering) {
             const auto width = static_cast<float>(reflectionTexture->getSize().width);
-            ubo.updateFloat2("vReflectionFilteringInfo", width, Scalar::Log2(width), "");
+            ubo.updateFloat2ByHandle(_uniformHandles.vReflectionFilteringInfo, width,
+                                     Scalar::Log2(width));
           }
 
           if (!defines["USEIRRADIANCEMAP"]) {
@@ -1332,122 +1397,135 @@ void PBRBaseMaterial::bindForSubMesh(Matrix& world, Mesh* mesh, SubMesh* subMesh
               auto polynomials = *_polynomials;
               if (defines["SPHERICAL_HARMONICS"]) {
                 auto& preScaledHarmonics = polynomials.preScaledHarmonics();
-                ubo.updateVector3("vSphericalL00", preScaledHarmonics.l00);
-                ubo.updateVector3("vSphericalL1_1", preScaledHarmonics.l1_1);
-                ubo.updateVector3("vSphericalL10", preScaledHarmonics.l10);
-                ubo.updateVector3("vSphericalL11", preScaledHarmonics.l11);
-                ubo.updateVector3("vSphericalL2_2", preScaledHarmonics.l2_2);
-                ubo.updateVector3("vSphericalL2_1", preScaledHarmonics.l2_1);
-                ubo.updateVector3("vSphericalL20", preScaledHarmonics.l20);
-                ubo.updateVector3("vSphericalL21", preScaledHarmonics.l21);
-                ubo.updateVector3("vSphericalL22", preScaledHarmonics.l22);
+                ubo.updateVector3ByHandle(_uniformHandles.vSphericalL00, preScaledHarmonics.l00);
+                ubo.updateVector3ByHandle(_uniformHandles.vSphericalL1_1, preScaledHarmonics.l1_1);
+                ubo.updateVector3ByHandle(_uniformHandles.vSphericalL10, preScaledHarmonics.l10);
+                ubo.updateVector3ByHandle(_uniformHandles.vSphericalL11, preScaledHarmonics.l11);
+                ubo.updateVector3ByHandle(_uniformHandles.vSphericalL2_2, preScaledHarmonics.l2_2);
+                ubo.updateVector3ByHandle(_uniformHandles.vSphericalL2_1, preScaledHarmonics.l2_1);
+                ubo.updateVector3ByHandle(_uniformHandles.vSphericalL20, preScaledHarmonics.l20);
+                ubo.updateVector3ByHandle(_uniformHandles.vSphericalL21, preScaledHarmonics.l21);
+                ubo.updateVector3ByHandle(_uniformHandles.vSphericalL22, preScaledHarmonics.l22);
               }
               else {
-                ubo.updateFloat3("vSphericalX", polynomials.x.x, polynomials.x.y, polynomials.x.z,
-                                 "");
-                ubo.updateFloat3("vSphericalY", polynomials.y.x, polynomials.y.y, polynomials.y.z,
-                                 "");
-                ubo.updateFloat3("vSphericalZ", polynomials.z.x, polynomials.z.y, polynomials.z.z,
-                                 "");
-                ubo.updateFloat3("vSphericalXX_ZZ", polynomials.xx.x - polynomials.zz.x,
-                                 polynomials.xx.y - polynomials.zz.y,
-                                 polynomials.xx.z - polynomials.zz.z, "");
-                ubo.updateFloat3("vSphericalYY_ZZ", polynomials.yy.x - polynomials.zz.x,
-                                 polynomials.yy.y - polynomials.zz.y,
-                                 polynomials.yy.z - polynomials.zz.z, "");
-                ubo.updateFloat3("vSphericalZZ", polynomials.zz.x, polynomials.zz.y,
-                                 polynomials.zz.z, "");
-                ubo.updateFloat3("vSphericalXY", polynomials.xy.x, polynomials.xy.y,
-                                 polynomials.xy.z, "");
-                ubo.updateFloat3("vSphericalYZ", polynomials.yz.x, polynomials.yz.y,
-                                 polynomials.yz.z, "");
-                ubo.updateFloat3("vSphericalZX", polynomials.zx.x, polynomials.zx.y,
-                                 polynomials.zx.z, "");
+                ubo.updateFloat3ByHandle(_uniformHandles.vSphericalX, polynomials.x.x,
+                                         polynomials.x.y, polynomials.x.z);
+                ubo.updateFloat3ByHandle(_uniformHandles.vSphericalY, polynomials.y.x,
+                                         polynomials.y.y, polynomials.y.z);
+                ubo.updateFloat3ByHandle(_uniformHandles.vSphericalZ, polynomials.z.x,
+                                         polynomials.z.y, polynomials.z.z);
+                ubo.updateFloat3ByHandle(_uniformHandles.vSphericalXX_ZZ,
+                                         polynomials.xx.x - polynomials.zz.x,
+                                         polynomials.xx.y - polynomials.zz.y,
+                                         polynomials.xx.z - polynomials.zz.z);
+                ubo.updateFloat3ByHandle(_uniformHandles.vSphericalYY_ZZ,
+                                         polynomials.yy.x - polynomials.zz.x,
+                                         polynomials.yy.y - polynomials.zz.y,
+                                         polynomials.yy.z - polynomials.zz.z);
+                ubo.updateFloat3ByHandle(_uniformHandles.vSphericalZZ, polynomials.zz.x,
+                                         polynomials.zz.y, polynomials.zz.z);
+                ubo.updateFloat3ByHandle(_uniformHandles.vSphericalXY, polynomials.xy.x,
+                                         polynomials.xy.y, polynomials.xy.z);
+                ubo.updateFloat3ByHandle(_uniformHandles.vSphericalYZ, polynomials.yz.x,
+                                         polynomials.yz.y, polynomials.yz.z);
+                ubo.updateFloat3ByHandle(_uniformHandles.vSphericalZX, polynomials.zx.x,
+                                         polynomials.zx.y, polynomials.zx.z);
               }
             }
           }
 
-          ubo.updateFloat3(
-            "vReflectionMicrosurfaceInfos", static_cast<float>(reflectionTexture->getSize().width),
-            reflectionTexture->lodGenerationScale(), reflectionTexture->lodGenerationOffset(), "");
+          ubo.updateFloat3ByHandle(_uniformHandles.vReflectionMicrosurfaceInfos,
+                                   static_cast<float>(reflectionTexture->getSize().width),
+                                   reflectionTexture->lodGenerationScale(),
+                                   reflectionTexture->lodGenerationOffset());
         }
 
         if (_emissiveTexture && MaterialFlags::EmissiveTextureEnabled()) {
-          ubo.updateFloat2("vEmissiveInfos", static_cast<float>(_emissiveTexture->coordinatesIndex),
-                           _emissiveTexture->level, "");
-          MaterialHelper::BindTextureMatrix(*_emissiveTexture, ubo, "emissive");
+          ubo.updateFloat2ByHandle(_uniformHandles.vEmissiveInfos,
+                                   static_cast<float>(_emissiveTexture->coordinatesIndex),
+                                   _emissiveTexture->level);
+          MaterialHelper::BindTextureMatrix(*_emissiveTexture, ubo, _uniformHandles.emissiveMatrix);
         }
 
         if (_lightmapTexture && MaterialFlags::LightmapTextureEnabled()) {
-          ubo.updateFloat2("vLightmapInfos", static_cast<float>(_lightmapTexture->coordinatesIndex),
-                           _lightmapTexture->level, "");
-          MaterialHelper::BindTextureMatrix(*_lightmapTexture, ubo, "lightmap");
+          ubo.updateFloat2ByHandle(_uniformHandles.vLightmapInfos,
+                                   static_cast<float>(_lightmapTexture->coordinatesIndex),
+                                   _lightmapTexture->level);
+          MaterialHelper::BindTextureMatrix(*_lightmapTexture, ubo, _uniformHandles.lightmapMatrix);
         }
 
         if (MaterialFlags::SpecularTextureEnabled()) {
           if (_metallicTexture) {
-            ubo.updateFloat3("vReflectivityInfos",
-                             static_cast<float>(_metallicTexture->coordinatesIndex),
-                             _metallicTexture->level, _ambientTextureStrength, "");
-            MaterialHelper::BindTextureMatrix(*_metallicTexture, ubo, "reflectivity");
+            ubo.updateFloat3ByHandle(_uniformHandles.vReflectivityInfos,
+                                     static_cast<float>(_metallicTexture->coordinatesIndex),
+                                     _metallicTexture->level, _ambientTextureStrength);
+            MaterialHelper::BindTextureMatrix(*_metallicTexture, ubo,
+                                              _uniformHandles.reflectivityMatrix);
           }
           else if (_reflectivityTexture) {
-            ubo.updateFloat3("vReflectivityInfos",
-                             static_cast<float>(_reflectivityTexture->coordinatesIndex),
-                             _reflectivityTexture->level, 1.f, "");
-            MaterialHelper::BindTextureMatrix(*_reflectivityTexture, ubo, "reflectivity");
+            ubo.updateFloat3ByHandle(_uniformHandles.vReflectivityInfos,
+                                     static_cast<float>(_reflectivityTexture->coordinatesIndex),
+                                     _reflectivityTexture->level, 1.f);
+            MaterialHelper::BindTextureMatrix(*_reflectivityTexture, ubo,
+                                              _uniformHandles.reflectivityMatrix);
           }
 
           if (_metallicReflectanceTexture) {
-            ubo.updateFloat2("vMetallicReflectanceInfos",
-                             static_cast<float>(_metallicReflectanceTexture->coordinatesIndex),
-                             _metallicReflectanceTexture->level, "");
+            ubo.updateFloat2ByHandle(
+              _uniformHandles.vMetallicReflectanceInfos,
+              static_cast<float>(_metallicReflectanceTexture->coordinatesIndex),
+              _metallicReflectanceTexture->level);
             MaterialHelper::BindTextureMatrix(*_metallicReflectanceTexture, ubo,
-                                              "metallicReflectance");
+                                              _uniformHandles.metallicReflectanceMatrix);
           }
 
           if (_reflectanceTexture && defines["REFLECTANCE"]) {
-            ubo.updateFloat2("vReflectanceInfos",
-                             static_cast<float>(_reflectanceTexture->coordinatesIndex),
-                             _reflectanceTexture->level, "");
-            MaterialHelper::BindTextureMatrix(*_reflectanceTexture, ubo, "reflectance");
+            ubo.updateFloat2ByHandle(_uniformHandles.vReflectanceInfos,
+                                     static_cast<float>(_reflectanceTexture->coordinatesIndex),
+                                     _reflectanceTexture->level);
+            MaterialHelper::BindTextureMatrix(*_reflectanceTexture, ubo,
+                                              _uniformHandles.reflectanceMatrix);
           }
 
           if (_microSurfaceTexture) {
-            ubo.updateFloat2("vMicroSurfaceSamplerInfos",
-                             static_cast<float>(_microSurfaceTexture->coordinatesIndex),
-                             _microSurfaceTexture->level, "");
-            MaterialHelper::BindTextureMatrix(*_microSurfaceTexture, ubo, "microSurfaceSampler");
+            ubo.updateFloat2ByHandle(_uniformHandles.vMicroSurfaceSamplerInfos,
+                                     static_cast<float>(_microSurfaceTexture->coordinatesIndex),
+                                     _microSurfaceTexture->level);
+            MaterialHelper::BindTextureMatrix(*_microSurfaceTexture, ubo,
+                                              _uniformHandles.microSurfaceSamplerMatrix);
           }
         }
 
         if (_bumpTexture && engine->getCaps().standardDerivatives
             && MaterialFlags::BumpTextureEnabled() && !_disableBumpMap) {
-          ubo.updateFloat3("vBumpInfos", static_cast<float>(_bumpTexture->coordinatesIndex),
-                           _bumpTexture->level, _parallaxScaleBias, "");
-          MaterialHelper::BindTextureMatrix(*_bumpTexture, ubo, "bump");
+          ubo.updateFloat3ByHandle(_uniformHandles.vBumpInfos,
+                                   static_cast<float>(_bumpTexture->coordinatesIndex),
+                                   _bumpTexture->level, _parallaxScaleBias);
+          MaterialHelper::BindTextureMatrix(*_bumpTexture, ubo, _uniformHandles.bumpMatrix);
 
           if (scene->_mirroredCameraPosition) {
-            ubo.updateFloat2("vTangentSpaceParams", _invertNormalMapX ? 1.f : -1.f,
-                             _invertNormalMapY ? 1.f : -1.f, "");
+            ubo.updateFloat2ByHandle(_uniformHandles.vTangentSpaceParams,
+                                     _invertNormalMapX ? 1.f : -1.f,
+                                     _invertNormalMapY ? 1.f : -1.f);
           }
           else {
-            ubo.updateFloat2("vTangentSpaceParams", _invertNormalMapX ? -1.f : 1.f,
-                             _invertNormalMapY ? -1.f : 1.f, "");
+            ubo.updateFloat2ByHandle(_uniformHandles.vTangentSpaceParams,
+                                     _invertNormalMapX ? -1.f : 1.f,
+                                     _invertNormalMapY ? -1.f : 1.f);
           }
         }
       }
 
       // Point size
       if (pointsCloud) {
-        ubo.updateFloat("pointSize", pointSize);
+        ubo.updateFloatByHandle(_uniformHandles.pointSize, pointSize);
       }
 
       // Colors
       if (defines["METALLICWORKFLOW"]) {
         TmpVectors::Color3Array[0].r = !_metallic.has_value() ? 1.f : *_metallic;
         TmpVectors::Color3Array[0].g = !_roughness.has_value() ? 1.f : *_roughness;
-        ubo.updateColor4("vReflectivityColor", TmpVectors::Color3Array[0], 1, "");
+        ubo.updateColor4ByHandle(_uniformHandles.vReflectivityColor, TmpVectors::Color3Array[0], 1);
 
         const auto ior = subSurface->indexOfRefraction();
         const auto outside_ior
@@ -1461,22 +1539,23 @@ void PBRBaseMaterial::bindForSubMesh(Matrix& world, Mesh* mesh, SubMesh* subMesh
         _metallicReflectanceColor.scaleToRef(f0 * _metallicF0Factor, TmpVectors::Color3Array[0]);
         const auto metallicF90 = _metallicF0Factor;
 
-        ubo.updateColor4("vMetallicReflectanceFactors", TmpVectors::Color3Array[0], metallicF90,
-                         "");
+        ubo.updateColor4ByHandle(_uniformHandles.vMetallicReflectanceFactors,
+                                 TmpVectors::Color3Array[0], metallicF90);
       }
       else {
-        ubo.updateColor4("vReflectivityColor", _reflectivityColor, _microSurface, "");
+        ubo.updateColor4ByHandle(_uniformHandles.vReflectivityColor, _reflectivityColor,
+                                 _microSurface);
       }
 
-      ubo.updateColor3(
-        "vEmissiveColor",
-        MaterialFlags::EmissiveTextureEnabled() ? _emissiveColor : Color3::BlackReadOnly(), "");
-      ubo.updateColor3("vReflectionColor", _reflectionColor, "");
+      ubo.updateColor3ByHandle(
+        _uniformHandles.vEmissiveColor,
+        MaterialFlags::EmissiveTextureEnabled() ? _emissiveColor : Color3::BlackReadOnly());
+      ubo.updateColor3ByHandle(_uniformHandles.vReflectionColor, _reflectionColor);
       if (!defines["SS_REFRACTION"] && subSurface->linkRefractionWithTransparency()) {
-        ubo.updateColor4("vAlbedoColor", _albedoColor, 1.f, "");
+        ubo.updateColor4ByHandle(_uniformHandles.vAlbedoColor, _albedoColor, 1.f);
       }
       else {
-        ubo.updateColor4("vAlbedoColor", _albedoColor, alpha, "");
+        ubo.updateColor4ByHandle(_uniformHandles.vAlbedoColor, _albedoColor, alpha);
       }
 
       // Misc
@@ -1485,14 +1564,14 @@ void PBRBaseMaterial::bindForSubMesh(Matrix& world, Mesh* mesh, SubMesh* subMesh
       _lightingInfos.z = _environmentIntensity * scene->environmentIntensity();
       _lightingInfos.w = _specularIntensity;
 
-      ubo.updateVector4("vLightingIntensity", _lightingInfos);
+      ubo.updateVector4ByHandle(_uniformHandles.vLightingIntensity, _lightingInfos);
 
       // Colors
       scene->ambientColor.multiplyToRef(_ambientColor, _globalAmbientColor);
 
-      ubo.updateColor3("vAmbientColor", _globalAmbientColor, "");
+      ubo.updateColor3ByHandle(_uniformHandles.vAmbientColor, _globalAmbientColor);
 
-      ubo.updateFloat2("vDebugMode", debugLimit, debugFactor, "");
+      ubo.updateFloat2ByHandle(_uniformHandles.vDebugMode, debugLimit, debugFactor);
     }
 
     // Textures
@@ -9,7 +9,12 @@
 namespace BABYLON {
 
 PushMaterial::PushMaterial(const std::string& iName, Scene* scene)
-    : Material{iName, scene}, _activeEffect{nullptr}
+    : Material{iName, scene}
+    , _activeEffect{nullptr}
+    , _matrixHandlesEffect{nullptr}
+    , _matrixHandlesEffectId{0}
+    , _worldHandle{-1}
+    , _normalMatrixHandle{-1}
 {
   _storeEffectOnSubMeshes = true;
 }
@@ -56,14 +61,28 @@ bool PushMaterial::_isReadyForSubMesh(SubMesh* subMesh)
   return false;
 }
 
+void PushMaterial::_resolveMatrixHandles()
+{
+  // Bound once per instance, the names are only looked up when the active effect changes
+  if (_matrixHandlesEffect != _activeEffect.get()
+      || _matrixHandlesEffectId != _activeEffect->uniqueId) {
+    _matrixHandlesEffect   = _activeEffect.get();
+    _matrixHandlesEffectId = _activeEffect->uniqueId;
+    _worldHandle           = _activeEffect->getUniformHandle("world");
+    _normalMatrixHandle    = _activeEffect->getUniformHandle("normalMatrix");
+  }
+}
+
 void PushMaterial::bindOnlyWorldMatrix(Matrix& world, const EffectPtr& /*effectOverride*/)
 {
-  _activeEffect->setMatrix("world", world);
+  _resolveMatrixHandles();
+  _activeEffect->setMatrix(_worldHandle, world);
 }
 
 void PushMaterial::bindOnlyNormalMatrix(Matrix& normalMatrix)
 {
-  _activeEffect->setMatrix("normalMatrix", normalMatrix);
+  _resolveMatrixHandles();
+  _activeEffect->setMatrix(_normalMatrixHandle, normalMatrix);
 }
 
 void PushMaterial::bind(Matrix& world, Mesh* mesh, const EffectPtr& /*effectOverride*/)
@@ -1027,6 +1027,46 @@ void StandardMaterial::buildUniformLayout()
   DetailMapConfiguration::PrepareUniformBuffer(ubo);
 
   ubo.create();
+
+  // Resolve the uniforms once, the bindings update them by handle
+  _uniformHandles.diffuseLeftColor     = ubo.getUniformHandle("diffuseLeftColor");
+  _uniformHandles.diffuseRightColor    = ubo.getUniformHandle("diffuseRightColor");
+  _uniformHandles.opacityParts         = ubo.getUniformHandle("opacityParts");
+  _uniformHandles.reflectionLeftColor  = ubo.getUniformHandle("reflectionLeftColor");
+  _uniformHandles.reflectionRightColor = ubo.getUniformHandle("reflectionRightColor");
+  _uniformHandles.refractionLeftColor  = ubo.getUniformHandle("refractionLeftColor");
+  _uniformHandles.refractionRightColor = ubo.getUniformHandle("refractionRightColor");
+  _uniformHandles.emissiveLeftColor    = ubo.getUniformHandle("emissiveLeftColor");
+  _uniformHandles.emissiveRightColor   = ubo.getUniformHandle("emissiveRightColor");
+  _uniformHandles.vDiffuseInfos        = ubo.getUniformHandle("vDiffuseInfos");
+  _uniformHandles.vAmbientInfos        = ubo.getUniformHandle("vAmbientInfos");
+  _uniformHandles.vOpacityInfos        = ubo.getUniformHandle("vOpacityInfos");
+  _uniformHandles.vReflectionInfos     = ubo.getUniformHandle("vReflectionInfos");
+  _uniformHandles.vReflectionPosition  = ubo.getUniformHandle("vReflectionPosition");
+  _uniformHandles.vReflectionSize      = ubo.getUniformHandle("vReflectionSize");
+  _uniformHandles.vEmissiveInfos       = ubo.getUniformHandle("vEmissiveInfos");
+  _uniformHandles.vLightmapInfos       = ubo.getUniformHandle("vLightmapInfos");
+  _uniformHandles.vSpecularInfos       = ubo.getUniformHandle("vSpecularInfos");
+  _uniformHandles.vBumpInfos           = ubo.getUniformHandle("vBumpInfos");
+  _uniformHandles.diffuseMatrix        = ubo.getUniformHandle("diffuseMatrix");
+  _uniformHandles.ambientMatrix        = ubo.getUniformHandle("ambientMatrix");
+  _uniformHandles.opacityMatrix        = ubo.getUniformHandle("opacityMatrix");
+  _uniformHandles.reflectionMatrix     = ubo.getUniformHandle("reflectionMatrix");
+  _uniformHandles.emissiveMatrix       = ubo.getUniformHandle("emissiveMatrix");
+  _uniformHandles.lightmapMatrix       = ubo.getUniformHandle("lightmapMatrix");
+  _uniformHandles.specularMatrix       = ubo.getUniformHandle("specularMatrix");
+  _uniformHandles.bumpMatrix           = ubo.getUniformHandle("bumpMatrix");
+  _uniformHandles.vTangentSpaceParams  = ubo.getUniformHandle("vTangentSpaceParams");
+  _uniformHandles.pointSize            = ubo.getUniformHandle("pointSize");
+  _uniformHandles.alphaCutOff          = ubo.getUniformHandle("alphaCutOff");
+  _uniformHandles.refractionMatrix     = ubo.getUniformHandle("refractionMatrix");
+  _uniformHandles.vRefractionInfos     = ubo.getUniformHandle("vRefractionInfos");
+  _uniformHandles.vRefractionPosition  = ubo.getUniformHandle("vRefractionPosition");
+  _uniformHandles.vRefractionSize      = ubo.getUniformHandle("vRefractionSize");
+  _uniformHandles.vSpecularColor       = ubo.getUniformHandle("vSpecularColor");
+  _uniformHandles.vEmissiveColor       = ubo.getUniformHandle("vEmissiveColor");
+  _uniformHandles.vDiffuseColor        = ubo.getUniformHandle("vDiffuseColor");
+  _uniformHandles.vAmbientColor        = ubo.getUniformHandle("vAmbientColor");
 }
 
 void StandardMaterial::unbind()
@@ -1094,149 +1134,173 @@ void StandardMaterial::bindForSubMesh(Matrix& world, Mesh* mesh, SubMesh* subMes
       if (StandardMaterial::FresnelEnabled() && defines["FRESNEL"]) {
         // Fresnel
         if (_diffuseFresnelParameters && _diffuseFresnelParameters->isEnabled()) {
-          ubo.updateColor4("diffuseLeftColor", _diffuseFresnelParameters->leftColor,
-                           _diffuseFresnelParameters->power, "");
-          ubo.updateColor4("diffuseRightColor", _diffuseFresnelParameters->rightColor,
-                           _diffuseFresnelParameters->bias, "");
+          ubo.updateColor4ByHandle(_uniformHandles.diffuseLeftColor,
+                                   _diffuseFresnelParameters->leftColor,
+                                   _diffuseFresnelParameters->power);
+          ubo.updateColor4ByHandle(_uniformHandles.diffuseRightColor,
+                                   _diffuseFresnelParameters->rightColor,
+                                   _diffuseFresnelParameters->bias);
         }
 
         if (_opacityFresnelParameters && _opacityFresnelParameters->isEnabled()) {
-          ubo.updateColor4("opacityParts",
-                           Color3(_opacityFresnelParameters->leftColor.toLuminance(),
-                                  _opacityFresnelParameters->rightColor.toLuminance(),
-                                  _opacityFresnelParameters->bias),
-                           _opacityFresnelParameters->power, "");
+          ubo.updateColor4ByHandle(_uniformHandles.opacityParts,
+                                   Color3(_opacityFresnelParameters->leftColor.toLuminance(),
+                                          _opacityFresnelParameters->rightColor.toLuminance(),
+                                          _opacityFresnelParameters->bias),
+                                   _opacityFresnelParameters->power);
         }
 
         if (_reflectionFresnelParameters && _reflectionFresnelParameters->isEnabled()) {
-          ubo.updateColor4("reflectionLeftColor", _reflectionFresnelParameters->leftColor,
-                           _reflectionFresnelParameters->power, "");
-          ubo.updateColor4("reflectionRightColor", _reflectionFresnelParameters->rightColor,
-                           _reflectionFresnelParameters->bias, "");
+          ubo.updateColor4ByHandle(_uniformHandles.reflectionLeftColor,
+                                   _reflectionFresnelParameters->leftColor,
+                                   _reflectionFresnelParameters->power);
+          ubo.updateColor4ByHandle(_uniformHandles.reflectionRightColor,
+                                   _reflectionFresnelParameters->rightColor,
+                                   _reflectionFresnelParameters->bias);
         }
 
         if (_refractionFresnelParameters && _refractionFresnelParameters->isEnabled()) {
-          ubo.updateColor4("refractionLeftColor", _refractionFresnelParameters->leftColor,
-                           _refractionFresnelParameters->power, "");
-          ubo.updateColor4("refractionRightColor", _refractionFresnelParameters->rightColor,
-                           _refractionFresnelParameters->bias, "");
+          ubo.updateColor4ByHandle(_uniformHandles.refractionLeftColor,
+                                   _refractionFresnelParameters->leftColor,
+                                   _refractionFresnelParameters->power);
+          ubo.updateColor4ByHandle(_uniformHandles.refractionRightColor,
+                                   _refractionFresnelParameters->rightColor,
+                                   _refractionFresnelParameters->bias);
         }
 
         if (_emissiveFresnelParameters && _emissiveFresnelParameters->isEnabled()) {
-          ubo.updateColor4("emissiveLeftColor", _emissiveFresnelParameters->leftColor,
-                           _emissiveFresnelParameters->power, "");
-          ubo.updateColor4("emissiveRightColor", _emissiveFresnelParameters->rightColor,
-                           _emissiveFresnelParameters->bias, "");
+          ubo.updateColor4ByHandle(_uniformHandles.emissiveLeftColor,
+                                   _emissiveFresnelParameters->leftColor,
+                                   _emissiveFresnelParameters->power);
+          ubo.updateColor4ByHandle(_uniformHandles.emissiveRightColor,
+                                   _emissiveFresnelParameters->rightColor,
+                                   _emissiveFresnelParameters->bias);
         }
       }
 
       // Textures
       if (scene->texturesEnabled()) {
         if (_diffuseTexture && StandardMaterial::DiffuseTextureEnabled()) {
-          ubo.updateFloat2("vDiffuseInfos", static_cast<float>(_diffuseTexture->coordinatesIndex),
-                           static_cast<float>(_diffuseTexture->level), "");
-          MaterialHelper::BindTextureMatrix(*_diffuseTexture, ubo, "diffuse");
+          ubo.updateFloat2ByHandle(_uniformHandles.vDiffuseInfos,
+                                   static_cast<float>(_diffuseTexture->coordinatesIndex),
+                                   static_cast<float>(_diffuseTexture->level));
+          MaterialHelper::BindTextureMatrix(*_diffuseTexture, ubo, _uniformHandles.diffuseMatrix);
         }
 
         if (_ambientTexture && StandardMaterial::AmbientTextureEnabled()) {
-          ubo.updateFloat2("vAmbientInfos", static_cast<float>(_ambientTexture->coordinatesIndex),
-                           static_cast<float>(_ambientTexture->level), "");
-          MaterialHelper::BindTextureMatrix(*_ambientTexture, ubo, "ambient");
+          ubo.updateFloat2ByHandle(_uniformHandles.vAmbientInfos,
+                                   static_cast<float>(_ambientTexture->coordinatesIndex),
+                                   static_cast<float>(_ambientTexture->level));
+          MaterialHelper::BindTextureMatrix(*_ambientTexture, ubo, _uniformHandles.ambientMatrix);
         }
 
         if (_opacityTexture && StandardMaterial::OpacityTextureEnabled()) {
-          ubo.updateFloat2("vOpacityInfos", static_cast<float>(_opacityTexture->coordinatesIndex),
-                           static_cast<float>(_opacityTexture->level), "");
-          MaterialHelper::BindTextureMatrix(*_opacityTexture, ubo, "opacity");
+          ubo.updateFloat2ByHandle(_uniformHandles.vOpacityInfos,
+                                   static_cast<float>(_opacityTexture->coordinatesIndex),
+                                   static_cast<float>(_opacityTexture->level));
+          MaterialHelper::BindTextureMatrix(*_opacityTexture, ubo, _uniformHandles.opacityMatrix);
         }
 
         if (_hasAlphaChannel()) {
-          ubo.updateFloat("alphaCutOff", alphaCutOff);
+          ubo.updateFloatByHandle(_uniformHandles.alphaCutOff, alphaCutOff);
         }
 
         if (_reflectionTexture && StandardMaterial::ReflectionTextureEnabled()) {
-          ubo.updateFloat2("vReflectionInfos", _reflectionTexture->level, _roughness, "");
-          ubo.updateMatrix("reflectionMatrix", *_reflectionTexture->getReflectionTextureMatrix());
+          ubo.updateFloat2ByHandle(_uniformHandles.vReflectionInfos, _reflectionTexture->level,
+                                   _roughness);
+          ubo.updateMatrixByHandle(_uniformHandles.reflectionMatrix,
+                                   *_reflectionTexture->getReflectionTextureMatrix());
 
           if (_reflectionTexture->boundingBoxSize()) {
             if (auto cubeTexture = std::static_pointer_cast<CubeTexture>(_reflectionTexture)) {
-              ubo.updateVector3("vReflectionPosition", cubeTexture->boundingBoxPosition);
-              ubo.updateVector3("vReflectionSize", *cubeTexture->boundingBoxSize());
+              ubo.updateVector3ByHandle(_uniformHandles.vReflectionPosition,
+                                        cubeTexture->boundingBoxPosition);
+              ubo.updateVector3ByHandle(_uniformHandles.vReflectionSize,
+                                        *cubeTexture->boundingBoxSize());
             }
           }
         }
 
         if (_emissiveTexture && StandardMaterial::EmissiveTextureEnabled()) {
-          ubo.updateFloat2("vEmissiveInfos", static_cast<float>(_emissiveTexture->coordinatesIndex),
-                           static_cast<float>(_emissiveTexture->level), "");
-          MaterialHelper::BindTextureMatrix(*_emissiveTexture, ubo, "emissive");
+          ubo.updateFloat2ByHandle(_uniformHandles.vEmissiveInfos,
+                                   static_cast<float>(_emissiveTexture->coordinatesIndex),
+                                   static_cast<float>(_emissiveTexture->level));
+          MaterialHelper::BindTextureMatrix(*_emissiveTexture, ubo, _uniformHandles.emissiveMatrix);
         }
 
         if (_lightmapTexture && StandardMaterial::LightmapTextureEnabled()) {
-          ubo.updateFloat2("vLightmapInfos", static_cast<float>(_lightmapTexture->coordinatesIndex),
-                           static_cast<float>(_lightmapTexture->level), "");
-          MaterialHelper::BindTextureMatrix(*_lightmapTexture, ubo, "lightmap");
+          ubo.updateFloat2ByHandle(_uniformHandles.vLightmapInfos,
+                                   static_cast<float>(_lightmapTexture->coordinatesIndex),
+                                   static_cast<float>(_lightmapTexture->level));
+          MaterialHelper::BindTextureMatrix(*_lightmapTexture, ubo, _uniformHandles.lightmapMatrix);
         }
 
         if (_specularTexture && StandardMaterial::SpecularTextureEnabled()) {
-          ubo.updateFloat2("vSpecularInfos", static_cast<float>(_specularTexture->coordinatesIndex),
-                           static_cast<float>(_specularTexture->level), "");
-          MaterialHelper::BindTextureMatrix(*_specularTexture, ubo, "specular");
+          ubo.updateFloat2ByHandle(_uniformHandles.vSpecularInfos,
+                                   static_cast<float>(_specularTexture->coordinatesIndex),
+                                   static_cast<float>(_specularTexture->level));
+          MaterialHelper::BindTextureMatrix(*_specularTexture, ubo, _uniformHandles.specularMatrix);
         }
 
         if (_bumpTexture && scene->getEngine()->getCaps().standardDerivatives
             && StandardMaterial::BumpTextureEnabled()) {
-          ubo.updateFloat3("vBumpInfos", static_cast<float>(_bumpTexture->coordinatesIndex),
-                           1.f / _bumpTexture->level, parallaxScaleBias, "");
-          MaterialHelper::BindTextureMatrix(*_bumpTexture, ubo, "bump");
+          ubo.updateFloat3ByHandle(_uniformHandles.vBumpInfos,
+                                   static_cast<float>(_bumpTexture->coordinatesIndex),
+                                   1.f / _bumpTexture->level, parallaxScaleBias);
+          MaterialHelper::BindTextureMatrix(*_bumpTexture, ubo, _uniformHandles.bumpMatrix);
           if (scene->_mirroredCameraPosition) {
-            ubo.updateFloat2("vTangentSpaceParams", _invertNormalMapX ? 1.f : -1.f,
-                             _invertNormalMapY ? 1.f : -1.f, "");
+            ubo.updateFloat2ByHandle(_uniformHandles.vTangentSpaceParams,
+                                     _invertNormalMapX ? 1.f : -1.f,
+                                     _invertNormalMapY ? 1.f : -1.f);
           }
           else {
-            ubo.updateFloat2("vTangentSpaceParams", _invertNormalMapX ? -1.f : 1.f,
-                             _invertNormalMapY ? -1.f : 1.f, "");
+            ubo.updateFloat2ByHandle(_uniformHandles.vTangentSpaceParams,
+                                     _invertNormalMapX ? -1.f : 1.f,
+                                     _invertNormalMapY ? -1.f : 1.f);
           }
         }
 
         if (_refractionTexture && StandardMaterial::RefractionTextureEnabled()) {
           float depth = 1.f;
           if (!_refractionTexture->isCube) {
-            ubo.updateMatrix("refractionMatrix", *_refractionTexture->getReflectionTextureMatrix());
+            ubo.updateMatrixByHandle(_uniformHandles.refractionMatrix,
+                                     *_refractionTexture->getReflectionTextureMatrix());
             auto refractionTextureTmp
               = std::static_pointer_cast<RefractionTexture>(_refractionTexture);
             if (refractionTextureTmp) {
               depth = refractionTextureTmp->depth;
             }
           }
-          ubo.updateFloat4("vRefractionInfos", _refractionTexture->level, indexOfRefraction, depth,
-                           invertRefractionY ? -1.f : 1.f, "");
+          ubo.updateFloat4ByHandle(_uniformHandles.vRefractionInfos, _refractionTexture->level,
+                                   indexOfRefraction, depth, invertRefractionY ? -1.f : 1.f);
 
           if (_refractionTexture->boundingBoxSize()) {
             const auto cubeTexture = std::static_pointer_cast<CubeTexture>(_refractionTexture);
 
-            ubo.updateVector3("vRefractionPosition", cubeTexture->boundingBoxPosition);
-            ubo.updateVector3("vRefractionSize", *cubeTexture->boundingBoxSize());
+            ubo.updateVector3ByHandle(_uniformHandles.vRefractionPosition,
+                                      cubeTexture->boundingBoxPosition);
+            ubo.updateVector3ByHandle(_uniformHandles.vRefractionSize,
+                                      *cubeTexture->boundingBoxSize());
           }
         }
       }
 
       // Point size
       if (pointsCloud()) {
-        ubo.updateFloat("pointSize", pointSize);
+        ubo.updateFloatByHandle(_uniformHandles.pointSize, pointSize);
       }
 
       if (defines["SPECULARTERM"]) {
-        ubo.updateColor4("vSpecularColor", specularColor, specularPower, "");
+        ubo.updateColor4ByHandle(_uniformHandles.vSpecularColor, specularColor, specularPower);
       }
-      ubo.updateColor3(
-        "vEmissiveColor",
-        StandardMaterial::EmissiveTextureEnabled() ? emissiveColor : Color3::BlackReadOnly(), "");
+      ubo.updateColor3ByHandle(
+        _uniformHandles.vEmissiveColor,
+        StandardMaterial::EmissiveTextureEnabled() ? emissiveColor : Color3::BlackReadOnly());
 
-      ubo.updateColor4("vDiffuseColor", diffuseColor, alpha(), "");
+      ubo.updateColor4ByHandle(_uniformHandles.vDiffuseColor, diffuseColor, alpha());
 
       scene->ambientColor.multiplyToRef(ambientColor, _globalAmbientColor);
-      ubo.updateColor3("vAmbientColor", _globalAmbientColor, "");
+      ubo.updateColor3ByHandle(_uniformHandles.vAmbientColor, _globalAmbientColor);
     }
 
     // Textures
@@ -21,8 +21,10 @@ UniformBuffer::UniformBuffer(ThinEngine* engine, const Float32Array& data,
     , _numBuffers{this, &UniformBuffer::get__numBuffers}
     , _indexBuffer{this, &UniformBuffer::get__indexBuffer}
     , name{this, &UniformBuffer::get_name}
+    , _createBufferOnWrite{false}
     , _uniformLocationPointer{0}
     , _needSync{false}
+    , _currentEffect{nullptr}
 {
   _engine  = engine;
   _noUBO   = !engine->supportsUniformBuffers();
@@ -31,8 +33,8 @@ UniformBuffer::UniformBuffer(ThinEngine* engine, const Float32Array& data,
 
   _data = data;
 
-  _uniformLocations       = {};
-  _uniformSizes           = {};
+  _uniformSlots           = {};
+  _uniformSlotIndices     = {};
   _uniformArraySizes      = {};
   _uniformLocationPointer = 0;
   _needSync               = false;
@@ -232,12 +234,14 @@ void UniformBuffer::_fillAlignment(size_t size)
 void UniformBuffer::addUniform(const std::string& iName,
                                const std::variant<int, Float32Array>& size, size_t arraySize)
 {
-  if (_noUBO) {
+  if (stl_util::contains(_uniformSlotIndices, iName)) {
+    // Already existing uniform
     return;
   }
 
-  if (stl_util::contains(_uniformLocations, iName)) {
-    // Already existing uniform
+  if (_noUBO) {
+    // The values are set on the effect, only the handle of the uniform is needed
+    _addUniformSlot(iName, 0, 0);
     return;
   }
 
@@ -289,8 +293,7 @@ void UniformBuffer::addUniform(const std::string& iName,
     _fillAlignment(_size);
   }
 
-  _uniformSizes[iName]     = _size;
-  _uniformLocations[iName] = _uniformLocationPointer;
+  _addUniformSlot(iName, _uniformLocationPointer, _size);
   _uniformLocationPointer += _size;
 
   for (size_t i = 0; i < _size; ++i) {
@@ -350,7 +353,7 @@ void UniformBuffer::create()
   if (_noUBO) {
     return;
   }
-  if (_buffer) {
+  if (_isCreated()) {
     return; // nothing to do
   }
 
@@ -369,6 +372,12 @@ void UniformBuffer::_rebuild()
     return;
   }
 
+  if (_engine->_getUniformBufferRing()) {
+    // The data is copied in the ring of the engine on update
+    _ringRange = {};
+    return;
+  }
+
   if (_dynamic) {
     _buffer = _engine->createDynamicUniformBuffer(_bufferData);
   }
@@ -398,10 +407,34 @@ std::string UniformBuffer::get_name() const
   return _name;
 }
 
+bool UniformBuffer::_isCreated() const
+{
+  return _buffer || !_bufferData.empty();
+}
+
 void UniformBuffer::update()
 {
-  if (!_buffer) {
+  auto ring = _noUBO ? nullptr : _engine->_getUniformBufferRing();
+
+  if (!_isCreated()) {
     create();
+    if (!ring) {
+      return;
+    }
+  }
+
+  if (ring) {
+    // The range of a static buffer is only valid during the frame it was allocated in
+    if (_dynamic || _needSync || !ring->isValid(_ringRange)) {
+      _allocateInRing(*ring);
+      _countUpdateInFrame();
+    }
+    return;
+  }
+
+  if (!_buffer) {
+    // The data was sub-allocated in the ring of the engine until now
+    _rebuild();
     return;
   }
 
@@ -411,16 +444,31 @@ void UniformBuffer::update()
   }
 
   _engine->updateUniformBuffer(_buffer, _bufferData);
+  _countUpdateInFrame();
 
+  _needSync            = false;
+  _createBufferOnWrite = _engine->_features.trackUbosInFrame;
+}
+
+void UniformBuffer::_allocateInRing(UniformBufferRing& ring)
+{
+  _ringRange = ring.allocate(_bufferData);
+  _needSync  = false;
+
+  if (_currentEffect) {
+    _currentEffect->bindUniformBufferRange(_ringRange.buffer, _currentEffectName,
+                                           _ringRange.byteOffset, _ringRange.byteLength);
+  }
+}
+
+void UniformBuffer::_countUpdateInFrame()
+{
   if (_engine->_features._collectUbosUpdatedInFrame) {
     if (!stl_util::contains(UniformBuffer::_updatedUbosInFrame, _name)) {
       UniformBuffer::_updatedUbosInFrame[_name] = 0;
     }
     UniformBuffer::_updatedUbosInFrame[_name]++;
   }
-
-  _needSync            = false;
-  _createBufferOnWrite = _engine->_features.trackUbosInFrame;
 }
 
 void UniformBuffer::_createNewBuffer()
@@ -458,29 +506,82 @@ void UniformBuffer::_checkNewFrame()
   }
 }
 
+void UniformBuffer::_addUniformSlot(const std::string& iName, size_t location, size_t size)
+{
+  UniformSlot slot;
+  slot.name     = iName;
+  slot.location = location;
+  slot.size     = size;
+  _uniformSlotIndices[iName] = _uniformSlots.size();
+  _uniformSlots.emplace_back(std::move(slot));
+}
+
+UniformBuffer::UniformSlot* UniformBuffer::_getSlot(int uniformHandle)
+{
+  if (uniformHandle < 0 || static_cast<size_t>(uniformHandle) >= _uniformSlots.size()) {
+    return nullptr;
+  }
+
+  return &_uniformSlots[static_cast<size_t>(uniformHandle)];
+}
+
+UniformBuffer::UniformSlot* UniformBuffer::_getSlotForUpdate(const std::string& iName, size_t size)
+{
+  auto it = _uniformSlotIndices.find(iName);
+  if (it != _uniformSlotIndices.end()) {
+    return &_uniformSlots[it->second];
+  }
+
+  if (_isCreated()) {
+    // Cannot add an uniform if the buffer is already created
+    BABYLON_LOG_ERROR("UniformBuffer", "Cannot add an uniform after UBO has been created.")
+    return nullptr;
+  }
+  addUniform(iName, static_cast<int>(size));
+  return &_uniformSlots.back();
+}
+
+int UniformBuffer::getUniformHandle(const std::string& uniformName) const
+{
+  auto it = _uniformSlotIndices.find(uniformName);
+  return it != _uniformSlotIndices.end() ? static_cast<int>(it->second) : -1;
+}
+
+int UniformBuffer::_getEffectHandle(int uniformHandle)
+{
+  auto slot = _getSlot(uniformHandle);
+  if (!slot) {
+    return -1;
+  }
+
+  // The buffer is shared by the effects of the material, resolve again when the effect changes
+  if (slot->effect != _currentEffect || slot->effectId != _currentEffect->uniqueId) {
+    slot->effect       = _currentEffect;
+    slot->effectId     = _currentEffect->uniqueId;
+    slot->effectHandle = _currentEffect->getUniformHandle(slot->name);
+  }
+
+  return slot->effectHandle;
+}
+
 void UniformBuffer::updateUniform(const std::string& uniformName, const Float32Array& data,
                                   size_t size)
 {
   _checkNewFrame();
 
-  size_t location = 0;
-  if (!stl_util::contains(_uniformLocations, uniformName)) {
-    if (_buffer) {
-      // Cannot add an uniform if the buffer is already created
-      BABYLON_LOG_ERROR("UniformBuffer", "Cannot add an uniform after UBO has been created.")
-      return;
-    }
-    addUniform(uniformName, static_cast<int>(size));
-    location = _uniformLocations[uniformName];
-  }
-  else {
-    location = _uniformLocations[uniformName];
+  if (auto slot = _getSlotForUpdate(uniformName, size)) {
+    slot->hasMatrixFlag = false;
+    _updateSlot(*slot, data.data(), size);
   }
+}
 
-  if (!_buffer) {
+void UniformBuffer::_updateSlot(UniformSlot& slot, const float* data, size_t size)
+{
+  if (!_isCreated()) {
     create();
   }
 
+  const auto location = slot.location;
   if (!_dynamic) {
     // Cache for static uniform buffers
     auto changed = false;
@@ -508,19 +609,30 @@ void UniformBuffer::updateUniform(const std::string& uniformName, const Float32A
   }
 }
 
+void UniformBuffer::_updateUniformByHandle(int uniformHandle, const float* data, size_t size)
+{
+  _checkNewFrame();
+
+  if (auto slot = _getSlot(uniformHandle)) {
+    slot->hasMatrixFlag = false;
+    _updateSlot(*slot, data, std::min(size, slot->size));
+  }
+}
+
 void UniformBuffer::updateUniformArray(const std::string& uniformName, const Float32Array& data,
                                        size_t size)
 {
   _checkNewFrame();
 
-  if (!stl_util::contains(_uniformLocations, uniformName)) {
+  auto it = _uniformSlotIndices.find(uniformName);
+  if (it == _uniformSlotIndices.end()) {
     BABYLON_LOG_ERROR("UniformBuffer",
                       "Cannot add an uniform Array dynamically. Please, add it using addUniform.");
     return;
   }
-  const auto& location = _uniformLocations[uniformName];
+  const auto location = _uniformSlots[it->second].location;
 
-  if (!_buffer) {
+  if (!_isCreated()) {
     create();
   }
 
@@ -559,15 +671,15 @@ void UniformBuffer::updateUniformArray(const std::string& uniformName, const Flo
   }
 }
 
-bool UniformBuffer::_cacheMatrix(const std::string& iName, const Matrix& matrix)
+bool UniformBuffer::_cacheMatrix(UniformSlot& slot, const Matrix& matrix)
 {
-  _checkNewFrame();
-
   const auto flag = matrix.updateFlag;
-  if (stl_util::contains(_valueCache, iName) && _valueCache[iName] == flag) {
+  if (slot.hasMatrixFlag && slot.matrixUpdateFlag == flag) {
     return false;
   }
 
+  slot.hasMatrixFlag    = true;
+  slot.matrixUpdateFlag = flag;
   return true;
 }
 
@@ -701,8 +813,11 @@ void UniformBuffer::_updateMatrixForEffect(const std::string& iName, const Matri
 
 void UniformBuffer::_updateMatrixForUniform(const std::string& iName, const Matrix& mat)
 {
-  if (_cacheMatrix(iName, mat)) {
-    updateUniform(iName, mat.toArray(), 16);
+  _checkNewFrame();
+
+  auto slot = _getSlotForUpdate(iName, 16);
+  if (slot && _cacheMatrix(*slot, mat)) {
+    _updateSlot(*slot, mat.m().data(), 16);
   }
 }
 
@@ -827,6 +942,84 @@ void UniformBuffer::_updateInt4ForUniform(const std::string& iName, int x, int y
   updateUniform(iName, UniformBuffer::_tempBuffer, 4);
 }
 
+void UniformBuffer::updateFloatByHandle(int uniformHandle, float x)
+{
+  if (_noUBO) {
+    _currentEffect->setFloat(_getEffectHandle(uniformHandle), x);
+    return;
+  }
+
+  _updateUniformByHandle(uniformHandle, &x, 1);
+}
+
+void UniformBuffer::updateFloat2ByHandle(int uniformHandle, float x, float y)
+{
+  if (_noUBO) {
+    _currentEffect->setFloat2(_getEffectHandle(uniformHandle), x, y);
+    return;
+  }
+
+  const float data[] = {x, y};
+  _updateUniformByHandle(uniformHandle, data, 2);
+}
+
+void UniformBuffer::updateFloat3ByHandle(int uniformHandle, float x, float y, float z)
+{
+  if (_noUBO) {
+    _currentEffect->setFloat3(_getEffectHandle(uniformHandle), x, y, z);
+    return;
+  }
+
+  const float data[] = {x, y, z};
+  _updateUniformByHandle(uniformHandle, data, 3);
+}
+
+void UniformBuffer::updateFloat4ByHandle(int uniformHandle, float x, float y, float z, float w)
+{
+  if (_noUBO) {
+    _currentEffect->setFloat4(_getEffectHandle(uniformHandle), x, y, z, w);
+    return;
+  }
+
+  const float data[] = {x, y, z, w};
+  _updateUniformByHandle(uniformHandle, data, 4);
+}
+
+void UniformBuffer::updateMatrixByHandle(int uniformHandle, const Matrix& mat)
+{
+  if (_noUBO) {
+    _currentEffect->setMatrix(_getEffectHandle(uniformHandle), mat);
+    return;
+  }
+
+  _checkNewFrame();
+
+  auto slot = _getSlot(uniformHandle);
+  if (slot && slot->size >= 16 && _cacheMatrix(*slot, mat)) {
+    _updateSlot(*slot, mat.m().data(), 16);
+  }
+}
+
+void UniformBuffer::updateVector3ByHandle(int uniformHandle, const Vector3& vector)
+{
+  updateFloat3ByHandle(uniformHandle, vector.x, vector.y, vector.z);
+}
+
+void UniformBuffer::updateVector4ByHandle(int uniformHandle, const Vector4& vector)
+{
+  updateFloat4ByHandle(uniformHandle, vector.x, vector.y, vector.z, vector.w);
+}
+
+void UniformBuffer::updateColor3ByHandle(int uniformHandle, const Color3& color)
+{
+  updateFloat3ByHandle(uniformHandle, color.r, color.g, color.b);
+}
+
+void UniformBuffer::updateColor4ByHandle(int uniformHandle, const Color3& color, float alpha)
+{
+  updateFloat4ByHandle(uniformHandle, color.r, color.g, color.b, alpha);
+}
+
 void UniformBuffer::setTexture(const std::string& iName, const ThinTexturePtr& texture)
 {
   _currentEffect->setTexture(iName, texture);
@@ -844,11 +1037,28 @@ void UniformBuffer::bindToEffect(Effect* effect, const std::string& iName)
   _currentEffect     = effect;
   _currentEffectName = iName;
 
-  if (_noUBO || !_buffer) {
+  if (_noUBO || !_isCreated()) {
     return;
   }
 
   _alreadyBound = true;
+
+  if (auto ring = _engine->_getUniformBufferRing()) {
+    if (ring->isValid(_ringRange)) {
+      effect->bindUniformBufferRange(_ringRange.buffer, iName, _ringRange.byteOffset,
+                                     _ringRange.byteLength);
+    }
+    else {
+      // The frozen materials bind without updating, the range of a previous frame is recycled
+      _allocateInRing(*ring);
+    }
+    return;
+  }
+
+  if (!_buffer) {
+    // The data was sub-allocated in the ring of the engine until now
+    _rebuild();
+  }
   effect->bindUniformBuffer(_buffer, iName);
 }
 
@@ -14,7 +14,7 @@
 
 namespace BABYLON {
 
-int Matrix::_updateFlagSeed      = 0;
+std::atomic<int> Matrix::_updateFlagSeed{0};
 Matrix Matrix::_identityReadOnly = Matrix::Identity();
 
 static const auto mtxConvertNDCToHalfZRange = Matrix::FromValues(1.f, 0.f, 0.f, 0.f,  //
@@ -75,8 +75,12 @@ const std::array<float, 16>& Matrix::m() const
 
 void Matrix::_markAsUpdated()
 {
-  updateFlag
-    = (Matrix::_updateFlagSeed < std::numeric_limits<int>::max()) ? Matrix::_updateFlagSeed++ : 0;
+  auto seed = Matrix::_updateFlagSeed.fetch_add(1, std::memory_order_relaxed);
+  if (seed == std::numeric_limits<int>::max()) {
+    Matrix::_updateFlagSeed = 0;
+    seed                    = 0;
+  }
+  updateFlag = seed;
   _isIdentity         = false;
   _isIdentity3x2      = false;
   _isIdentityDirty    = true;
@@ -86,7 +90,7 @@ void Matrix::_markAsUpdated()
 void Matrix::_updateIdentityStatus(bool isIdentity, bool isIdentityDirty, bool isIdentity3x2,
                                    bool isIdentity3x2Dirty)
 {
-  updateFlag          = Matrix::_updateFlagSeed++;
+  updateFlag          = Matrix::_updateFlagSeed.fetch_add(1, std::memory_order_relaxed);
   _isIdentity         = isIdentity;
   _isIdentity3x2      = isIdentity || isIdentity3x2;
   _isIdentityDirty    = _isIdentity ? false : isIdentityDirty;
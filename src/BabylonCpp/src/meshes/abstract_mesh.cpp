@@ -10,12 +10,14 @@
 #include <babylon/collisions/picking_info.h>
 #include <babylon/culling/bounding_box.h>
 #include <babylon/culling/bounding_info.h>
+#include <babylon/culling/bounding_volume_store.h>
 #include <babylon/culling/octrees/octree_scene_component.h>
 #include <babylon/culling/ray.h>
 #include <babylon/engines/engine.h>
 #include <babylon/engines/extensions/occlusion_query_extension.h>
 #include <babylon/engines/scene.h>
 #include <babylon/lights/light.h>
+#include <babylon/lights/light_spatial_index.h>
 #include <babylon/lights/shadows/shadow_generator.h>
 #include <babylon/materials/material.h>
 #include <babylon/materials/material_defines.h>
@@ -119,6 +121,10 @@ AbstractMesh::AbstractMesh(const std::string& iName, Scene* scene)
     , _masterMesh{nullptr}
     , _materialDefines{nullptr}
     , _boundingInfo{nullptr}
+    , _boundingVolumeStoreSlot{BoundingVolumeStore::InvalidSlot}
+    , _hasDeferredMiscDirty{false}
+    , _hasDeferredBoundingInfoChange{false}
+    , _octreeSelectionGeneration{0}
     , _renderId{0}
     , _submeshesOctree{nullptr}
     , _unIndexed{false}
@@ -149,6 +155,8 @@ AbstractMesh::AbstractMesh(const std::string& iName, Scene* scene)
     , _collisionsTransformMatrix{Matrix::Zero()}
     , _collisionsScalingMatrix{Matrix::Zero()}
     , _showBoundingBox{false}
+    , _worldUniformHandle{-1}
+    , _visibilityUniformHandle{-1}
 {
   _resyncLightSources();
 
@@ -243,7 +251,13 @@ bool AbstractMesh::_updateNonUniformScalingState(bool value)
   if (!TransformNode::_updateNonUniformScalingState(value)) {
     return false;
   }
-  _markSubMeshesAsMiscDirty();
+  // The material defines are shared with other meshes, they are not touched from a worker thread
+  if (_deferWorldMatrixSideEffects) {
+    _hasDeferredMiscDirty = true;
+  }
+  else {
+    _markSubMeshesAsMiscDirty();
+  }
   return true;
 }
 
@@ -553,14 +567,17 @@ void AbstractMesh::_buildUniformLayout()
   _uniformBuffer->addUniform("world", 16);
   _uniformBuffer->addUniform("visibility", 1);
   _uniformBuffer->create();
+
+  _worldUniformHandle      = _uniformBuffer->getUniformHandle("world");
+  _visibilityUniformHandle = _uniformBuffer->getUniformHandle("visibility");
 }
 
 void AbstractMesh::transferToEffect(const Matrix& world)
 {
   const auto& ubo = _uniformBuffer;
 
-  ubo->updateMatrix("world", world);
-  ubo->updateFloat("visibility", _internalAbstractMeshDataInfo._visibility);
+  ubo->updateMatrixByHandle(_worldUniformHandle, world);
+  ubo->updateFloatByHandle(_visibilityUniformHandle, _internalAbstractMeshDataInfo._visibility);
 
   ubo->update();
 }
@@ -654,6 +671,21 @@ void AbstractMesh::_rebuild(bool /*dispose*/)
 
 void AbstractMesh::_resyncLightSources()
 {
+  const auto lightSpatialIndex = getScene()->getLightSpatialIndex();
+  if (lightSpatialIndex) {
+    std::vector<LightPtr> affectingLights;
+    lightSpatialIndex->getLightSources(this, affectingLights);
+    if (affectingLights != _lightSources) {
+      const auto removed
+        = std::any_of(_lightSources.begin(), _lightSources.end(), [&](const LightPtr& light) {
+            return !stl_util::contains(affectingLights, light);
+          });
+      _lightSources = std::move(affectingLights);
+      _markSubMeshesAsLightDirty(removed);
+    }
+    return;
+  }
+
   _lightSources.clear();
 
   for (const auto& light : getScene()->lights) {
@@ -671,6 +703,11 @@ void AbstractMesh::_resyncLightSources()
 
 void AbstractMesh::_resyncLightSource(const LightPtr& light)
 {
+  if (getScene()->getLightSpatialIndex()) {
+    _resyncLightSources();
+    return;
+  }
+
   const auto isIn = light && light->isEnabled() && light->canAffectMesh(this);
 
   auto index = std::find(_lightSources.begin(), _lightSources.end(), light);
@@ -866,6 +903,16 @@ Float32Array AbstractMesh::getVerticesData(const std::string& /*kind*/, bool /*c
   return Float32Array();
 }
 
+VertexDataView AbstractMesh::getVerticesDataView(const std::string& /*kind*/) const
+{
+  return VertexDataView{};
+}
+
+MutableVertexDataView AbstractMesh::mapVerticesDataForWrite(const std::string& /*kind*/)
+{
+  return MutableVertexDataView{};
+}
+
 AbstractMesh* AbstractMesh::setVerticesData(const std::string& /*kind*/,
                                             const Float32Array& /*data*/, bool /*updatable*/,
                                             const std::optional<size_t>& /*stride*/)
@@ -916,6 +963,7 @@ AbstractMesh::normalizeToUnitCube(bool includeDescendants, bool ignoreRotation,
 AbstractMesh& AbstractMesh::setBoundingInfo(const BoundingInfo& boundingInfo)
 {
   _boundingInfo = std::make_unique<BoundingInfo>(boundingInfo);
+  _notifyBoundingInfoChanged();
   return *this;
 }
 
@@ -1029,15 +1077,17 @@ AbstractMesh& AbstractMesh::refreshBoundingInfo(bool applySkeleton)
     return *this;
   }
 
-  _refreshBoundingInfo(_getPositionData(applySkeleton), std::nullopt);
+  Float32Array skinnedPositions;
+  _refreshBoundingInfo(_getPositionDataView(applySkeleton, skinnedPositions), std::nullopt);
   return *this;
 }
 
-void AbstractMesh::_refreshBoundingInfo(const Float32Array& data,
+void AbstractMesh::_refreshBoundingInfo(const VertexDataView& data,
                                         const std::optional<Vector2>& bias)
 {
   if (!data.empty()) {
-    auto extend = extractMinAndMax(data, 0, getTotalVertices(), bias);
+    auto extend = extractMinAndMax(data.data, 0, std::min(data.count, getTotalVertices()), bias,
+                                   data.stride);
     if (_boundingInfo) {
       _boundingInfo->reConstruct(extend.min, extend.max);
     }
@@ -1121,6 +1171,17 @@ Float32Array AbstractMesh::_getPositionData(bool applySkeleton)
   return data;
 }
 
+VertexDataView AbstractMesh::_getPositionDataView(bool applySkeleton,
+                                                  Float32Array& skinnedPositions)
+{
+  if (applySkeleton && skeleton()) {
+    skinnedPositions = _getPositionData(applySkeleton);
+    return VertexDataView::FromArray(skinnedPositions, 3);
+  }
+
+  return getVerticesDataView(VertexBuffer::PositionKind);
+}
+
 AbstractMesh& AbstractMesh::_updateBoundingInfo()
 {
   auto effectiveMesh = _effectiveMesh();
@@ -1131,10 +1192,35 @@ AbstractMesh& AbstractMesh::_updateBoundingInfo()
     _boundingInfo = std::make_unique<BoundingInfo>(absolutePosition(), absolutePosition(),
                                                    effectiveMesh->worldMatrixFromCache());
   }
+  _notifyBoundingInfoChanged();
   _updateSubMeshesBoundingInfo(effectiveMesh->worldMatrixFromCache());
   return *this;
 }
 
+void AbstractMesh::_syncBoundingVolumeStore()
+{
+  if (_boundingVolumeStoreSlot == BoundingVolumeStore::InvalidSlot || !_boundingInfo) {
+    return;
+  }
+  if (auto boundingVolumeStore = getScene()->getBoundingVolumeStore()) {
+    boundingVolumeStore->update(_boundingVolumeStoreSlot, *_boundingInfo);
+  }
+}
+
+void AbstractMesh::_notifyBoundingInfoChanged()
+{
+  _syncBoundingVolumeStore();
+  // Observers are not thread safe, they are notified once the concurrent updates are done
+  if (_deferWorldMatrixSideEffects) {
+    _hasDeferredBoundingInfoChange = true;
+    return;
+  }
+  auto scene = getScene();
+  if (scene->onMeshBoundingInfoChangedObservable.hasObservers()) {
+    scene->onMeshBoundingInfoChangedObservable.notifyObservers(this);
+  }
+}
+
 AbstractMesh& AbstractMesh::_updateSubMeshesBoundingInfo(const Matrix& matrix)
 {
   if (subMeshes.empty()) {
@@ -1152,6 +1238,27 @@ AbstractMesh& AbstractMesh::_updateSubMeshesBoundingInfo(const Matrix& matrix)
   return *this;
 }
 
+bool AbstractMesh::_canComputeWorldMatrixConcurrently() const
+{
+  // The bounding info of a mesh skinned with an override mesh depends on another world matrix
+  const auto& iSkeleton = _internalAbstractMeshDataInfo._skeleton;
+  return TransformNode::_canComputeWorldMatrixConcurrently()
+         && !(iSkeleton && iSkeleton->overrideMesh);
+}
+
+void AbstractMesh::_applyDeferredWorldMatrixSideEffects()
+{
+  TransformNode::_applyDeferredWorldMatrixSideEffects();
+  if (_hasDeferredMiscDirty) {
+    _hasDeferredMiscDirty = false;
+    _markSubMeshesAsMiscDirty();
+  }
+  if (_hasDeferredBoundingInfoChange) {
+    _hasDeferredBoundingInfoChange = false;
+    _notifyBoundingInfoChanged();
+  }
+}
+
 void AbstractMesh::_afterComputeWorldMatrix()
 {
   if (doNotSyncBoundingInfo) {
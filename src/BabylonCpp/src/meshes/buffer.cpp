@@ -12,7 +12,7 @@ namespace BABYLON {
 Buffer::Buffer(ThinEngine* engine, const Float32Array& data, bool updatable,
                std::optional<size_t> stride, bool postponeInternalCreation, bool instanced,
                bool useBytes, const std::optional<unsigned int>& divisor)
-    : _buffer{nullptr}, _isAlreadyOwned{false}
+    : _buffer{nullptr}, _isAlreadyOwned{false}, _isDirty{false}
 {
   _engine    = engine ? engine : Engine::LastCreatedEngine();
   _updatable = updatable;
@@ -35,7 +35,7 @@ Buffer::Buffer(ThinEngine* engine, const Float32Array& data, bool updatable,
 Buffer::Buffer(Mesh* mesh, const Float32Array& data, bool updatable, std::optional<size_t> stride,
                bool postponeInternalCreation, bool instanced, bool useBytes,
                const std::optional<unsigned int>& divisor)
-    : _buffer{nullptr}
+    : _buffer{nullptr}, _isAlreadyOwned{false}, _isDirty{false}
 {
   _engine    = mesh->getScene()->getEngine();
   _updatable = updatable;
@@ -172,6 +172,31 @@ void Buffer::_increaseReferences()
   _buffer->references++;
 }
 
+void Buffer::_markDataAsDirty()
+{
+  _isDirty = true;
+}
+
+bool Buffer::_isDataDirty() const
+{
+  return _isDirty;
+}
+
+void Buffer::_uploadDirtyData()
+{
+  if (!_isDirty) {
+    return;
+  }
+
+  _isDirty = false;
+  if (!_buffer || _data.empty()) {
+    return;
+  }
+
+  // The static buffers are updated in place too, the usage is only a hint for the driver
+  _engine->updateDynamicVertexBuffer(_buffer, _data);
+}
+
 void Buffer::dispose()
 {
   if (!_buffer) {
@@ -283,6 +283,8 @@ void Geometry::_updateBoundingInfo(bool updateExtends, const Float32Array& data)
       for (const auto& subMesh : mesh->subMeshes) {
         subMesh->refreshBoundingInfo();
       }
+
+      mesh->_notifyBoundingInfoChanged();
     }
   }
 }
@@ -303,6 +305,10 @@ void Geometry::_bind(
     return;
   }
 
+  if (!_mappedVerticesDataKinds.empty()) {
+    _uploadMappedVerticesData();
+  }
+
   if (indexToBind == nullptr) {
     indexToBind = _indexBuffer;
   }
@@ -351,6 +357,49 @@ Float32Array Geometry::getVerticesData(const std::string& kind, bool copyWhenSha
                                     forceCopy || (copyWhenShared && _meshes.size() != 1));
 }
 
+VertexDataView Geometry::getVerticesDataView(const std::string& kind) const
+{
+  auto it = _vertexBuffers.find(kind);
+  if (it == _vertexBuffers.end() || !it->second) {
+    return VertexDataView{};
+  }
+
+  return it->second->getFloatDataView(_totalVertices);
+}
+
+MutableVertexDataView Geometry::mapVerticesDataForWrite(const std::string& kind)
+{
+  auto vertexBuffer = getVertexBuffer(kind);
+  if (!vertexBuffer) {
+    return MutableVertexDataView{};
+  }
+
+  auto view = vertexBuffer->mapFloatDataForWrite(_totalVertices);
+  if (!view.empty() && !stl_util::contains(_mappedVerticesDataKinds, kind)) {
+    _mappedVerticesDataKinds.emplace_back(kind);
+  }
+
+  if (kind == VertexBuffer::PositionKind) {
+    _resetPointsArrayCache();
+  }
+
+  return view;
+}
+
+void Geometry::_uploadMappedVerticesData()
+{
+  // Swap first, notifyUpdate can map data again
+  std::vector<std::string> kinds;
+  kinds.swap(_mappedVerticesDataKinds);
+  for (const auto& kind : kinds) {
+    auto vertexBuffer = getVertexBuffer(kind);
+    if (vertexBuffer && vertexBuffer->_isDataDirty()) {
+      vertexBuffer->_uploadDirtyData();
+      notifyUpdate(kind);
+    }
+  }
+}
+
 bool Geometry::isVertexBufferUpdatable(const std::string& kind) const
 {
   auto it = _vertexBuffers.find(kind);
@@ -362,6 +411,11 @@ bool Geometry::isVertexBufferUpdatable(const std::string& kind) const
   return it->second->isUpdatable();
 }
 
+bool Geometry::isIndexBufferUpdatable() const
+{
+  return _indexBufferIsUpdatable;
+}
+
 VertexBufferPtr Geometry::getVertexBuffer(const std::string& kind)
 {
   if (!isReady() || _vertexBuffers.empty() || !stl_util::contains(_vertexBuffers, kind)) {
@@ -692,30 +746,27 @@ bool Geometry::_generatePointsArray()
     return true;
   }
 
-  auto data = getVerticesData(VertexBuffer::PositionKind);
+  // Read the positions in place instead of copying the vertex buffer data first, the positions
+  // which are not stored as floats are converted
+  Float32Array convertedData;
+  auto data = getVerticesDataView(VertexBuffer::PositionKind);
+  if (data.empty()) {
+    convertedData = getVerticesData(VertexBuffer::PositionKind);
+    data          = VertexDataView::FromArray(convertedData, 3);
+  }
 
   if (data.empty()) {
     return false;
   }
 
-  for (auto index = _positionsCache.size() * 3, arrayIdx = _positionsCache.size();
-       index < data.size(); index += 3, ++arrayIdx) {
-    if (arrayIdx >= _positionsCache.size()) {
-      _positionsCache.resize((_positionsCache.size() + 1) * 3);
-    }
-    _positionsCache[arrayIdx] = Vector3::FromArray(data, static_cast<unsigned int>(index));
-  }
+  // just in case the number of positions was reduced, splice the array
+  _positionsCache.resize(data.count);
 
-  for (auto index = 0ull, arrayIdx = 0ull; index < data.size(); index += 3, ++arrayIdx) {
-    if (index >= _positionsCache.size()) {
-      _positionsCache.resize((_positionsCache.size() + 1) * 3);
-    }
-    _positionsCache[arrayIdx].set(data[0 + index], data[1 + index], data[2 + index]);
+  for (size_t index = 0; index < data.count; ++index) {
+    const auto position = data[index];
+    _positionsCache[index].set(position[0], position[1], position[2]);
   }
 
-  // just in case the number of positions was reduced, splice the array
-  _positionsCache.resize(data.size() / 3);
-
   _positions = _positionsCache;
 
   return true;
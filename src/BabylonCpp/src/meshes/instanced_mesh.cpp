@@ -154,6 +154,16 @@ Float32Array InstancedMesh::getVerticesData(const std::string& kind, bool copyWh
   return _sourceMesh->getVerticesData(kind, copyWhenShared, forceCopy);
 }
 
+VertexDataView InstancedMesh::getVerticesDataView(const std::string& kind) const
+{
+  return _sourceMesh->getVerticesDataView(kind);
+}
+
+MutableVertexDataView InstancedMesh::mapVerticesDataForWrite(const std::string& kind)
+{
+  return _sourceMesh->mapVerticesDataForWrite(kind);
+}
+
 AbstractMesh* InstancedMesh::setVerticesData(const std::string& kind, const Float32Array& data,
                                              bool updatable, const std::optional<size_t>& stride)
 {
@@ -204,7 +214,8 @@ InstancedMesh& InstancedMesh::refreshBoundingInfo(bool applySkeleton)
 
   const auto bias
     = _sourceMesh->geometry() ? _sourceMesh->geometry()->boundingBias() : std::nullopt;
-  _refreshBoundingInfo(_sourceMesh->_getPositionData(applySkeleton), bias);
+  Float32Array skinnedPositions;
+  _refreshBoundingInfo(_sourceMesh->_getPositionDataView(applySkeleton, skinnedPositions), bias);
   return *this;
 }
 
@@ -339,6 +350,7 @@ AbstractMesh& InstancedMesh::_updateBoundingInfo()
     _boundingInfo = std::make_shared<BoundingInfo>(absolutePosition(), absolutePosition(),
                                                    effectiveMesh->worldMatrixFromCache());
   }
+  _notifyBoundingInfoChanged();
   _updateSubMeshesBoundingInfo(effectiveMesh->worldMatrixFromCache());
   return *this;
 }
@@ -56,6 +56,7 @@
 #include <babylon/meshes/ground_mesh.h>
 #include <babylon/meshes/instanced_mesh.h>
 #include <babylon/meshes/mesh_lod_level.h>
+#include <babylon/meshes/simplification/simplification_queue.h>
 #include <babylon/meshes/vertex_buffer.h>
 #include <babylon/meshes/vertex_data.h>
 #include <babylon/misc/file_tools.h>
@@ -103,6 +104,7 @@ Mesh::Mesh(const std::string& iName, Scene* scene, Node* iParent, Mesh* source,
                                                &Mesh::set_manualUpdateOfWorldMatrixInstancedBuffer}
     , _isMesh{this, &Mesh::get__isMesh}
     , hasLODLevels{this, &Mesh::get_hasLODLevels}
+    , useLODScreenCoverage{this, &Mesh::get_useLODScreenCoverage, &Mesh::set_useLODScreenCoverage}
     , geometry{this, &Mesh::get_geometry}
     , areNormalsFrozen{this, &Mesh::get_areNormalsFrozen}
     , overridenInstanceCount{this, &Mesh::set_overridenInstanceCount}
@@ -440,6 +442,17 @@ bool Mesh::get_hasLODLevels() const
   return !_internalMeshDataInfo->_LODLevels.empty();
 }
 
+bool Mesh::get_useLODScreenCoverage() const
+{
+  return _internalMeshDataInfo->_useLODScreenCoverage;
+}
+
+void Mesh::set_useLODScreenCoverage(bool value)
+{
+  _internalMeshDataInfo->_useLODScreenCoverage = value;
+  _sortLODLevels();
+}
+
 std::vector<MeshLODLevelPtr>& Mesh::getLODLevels()
 {
   return _internalMeshDataInfo->_LODLevels;
@@ -447,14 +460,15 @@ std::vector<MeshLODLevelPtr>& Mesh::getLODLevels()
 
 void Mesh::_sortLODLevels()
 {
-  auto& _LODLevels = _internalMeshDataInfo->_LODLevels;
+  auto& _LODLevels              = _internalMeshDataInfo->_LODLevels;
+  const auto sortingOrderFactor = _internalMeshDataInfo->_useLODScreenCoverage ? -1 : 1;
   BABYLON::stl_util::sort_js_style(
-    _LODLevels, [](const MeshLODLevelPtr& a, const MeshLODLevelPtr& b) {
+    _LODLevels, [sortingOrderFactor](const MeshLODLevelPtr& a, const MeshLODLevelPtr& b) {
       if (a->distanceOrScreenCoverage < b->distanceOrScreenCoverage) {
-        return 1;
+        return sortingOrderFactor;
       }
       if (a->distanceOrScreenCoverage > b->distanceOrScreenCoverage) {
-        return -1;
+        return -sortingOrderFactor;
       }
       return 0;
     });
@@ -527,7 +541,16 @@ AbstractMesh* Mesh::getLOD(const CameraPtr& camera, BoundingSphere* boundingSphe
 
   auto distanceToCamera = bSphere->centerWorld.subtract(camera->globalPosition()).length();
 
-  if (_LODLevels.back()->distanceOrScreenCoverage > distanceToCamera) {
+  // With screen coverage, the levels are sorted by decreasing coverage and the comparisons are
+  // reversed
+  auto compareValue = distanceToCamera;
+  auto compareSign  = 1.f;
+  if (_internalMeshDataInfo->_useLODScreenCoverage) {
+    compareValue = _getScreenCoverage(*camera, *bSphere, distanceToCamera);
+    compareSign  = -1.f;
+  }
+
+  if (compareSign * _LODLevels.back()->distanceOrScreenCoverage > compareSign * compareValue) {
     if (onLODLevelSelection) {
       onLODLevelSelection(distanceToCamera, this, this);
     }
@@ -535,7 +558,7 @@ AbstractMesh* Mesh::getLOD(const CameraPtr& camera, BoundingSphere* boundingSphe
   }
 
   for (const auto& level : _LODLevels) {
-    if (level->distanceOrScreenCoverage < distanceToCamera) {
+    if (compareSign * level->distanceOrScreenCoverage < compareSign * compareValue) {
       if (level->mesh) {
         if (level->mesh->delayLoadState == Constants::DELAYLOADSTATE_NOTLOADED) {
           level->mesh->_checkDelayState();
@@ -563,6 +586,32 @@ AbstractMesh* Mesh::getLOD(const CameraPtr& camera, BoundingSphere* boundingSphe
   return this;
 }
 
+float Mesh::_getScreenCoverage(Camera& camera, const BoundingSphere& boundingSphere,
+                               float distanceToCamera)
+{
+  // Area of the bounding sphere projected on the near plane relatively to the near plane area
+  auto screenArea = 0.f;
+  auto radius     = boundingSphere.radiusWorld;
+  if (camera.mode == Camera::PERSPECTIVE_CAMERA) {
+    if (distanceToCamera <= boundingSphere.radiusWorld) {
+      return 1.f;
+    }
+    const auto aspectRatio = getScene()->getEngine()->getAspectRatio(camera);
+    const auto size        = camera.minZ * 2.f * std::tan(camera.fov / 2.f);
+    screenArea             = camera.fovMode == Camera::FOVMODE_VERTICAL_FIXED ?
+                               size * size * aspectRatio :
+                               size * size / aspectRatio;
+    radius *= camera.minZ / distanceToCamera;
+  }
+  else {
+    screenArea = (camera.orthoRight - camera.orthoLeft) * (camera.orthoTop - camera.orthoBottom);
+  }
+  if (screenArea <= 0.f) {
+    return 0.f;
+  }
+  return std::min(Math::PI * radius * radius / screenArea, 1.f);
+}
+
 GeometryPtr& Mesh::get_geometry()
 {
   return _geometry;
@@ -589,6 +638,22 @@ Float32Array Mesh::getVerticesData(const std::string& kind, bool copyWhenShared,
   return _geometry->getVerticesData(kind, copyWhenShared, forceCopy);
 }
 
+VertexDataView Mesh::getVerticesDataView(const std::string& kind) const
+{
+  if (!_geometry) {
+    return VertexDataView{};
+  }
+  return _geometry->getVerticesDataView(kind);
+}
+
+MutableVertexDataView Mesh::mapVerticesDataForWrite(const std::string& kind)
+{
+  if (!_geometry) {
+    return MutableVertexDataView{};
+  }
+  return _geometry->mapVerticesDataForWrite(kind);
+}
+
 VertexBufferPtr Mesh::getVertexBuffer(const std::string& kind) const
 {
   if (!_geometry) {
@@ -851,7 +916,8 @@ Mesh& Mesh::refreshBoundingInfo(bool applySkeleton)
   }
 
   std::optional<Vector2> bias = geometry() ? geometry()->boundingBias() : std::nullopt;
-  _refreshBoundingInfo(_getPositionData(applySkeleton), bias);
+  Float32Array skinnedPositions;
+  _refreshBoundingInfo(_getPositionDataView(applySkeleton, skinnedPositions), bias);
   return *this;
 }
 
@@ -1145,6 +1211,15 @@ void Mesh::_draw(SubMesh* subMesh, int fillMode, size_t instancesCount, bool /*a
     engine->drawElementsType(_fillMode, 0, static_cast<int>(subMesh->_linesIndexCount),
                              static_cast<int>(instancesCount));
   }
+  else if (subMesh->_meshletDrawRangesFrameId == scene->getFrameId() && instancesCount <= 1
+           && !scene->_isInIntermediateRendering()) {
+    // Visible meshlets of the active camera
+    for (const auto& range : subMesh->_meshletDrawRanges) {
+      engine->drawElementsType(_fillMode, static_cast<int>(range.indexStart),
+                               static_cast<int>(range.indexCount),
+                               static_cast<int>(instancesCount));
+    }
+  }
   else {
     engine->drawElementsType(_fillMode, static_cast<int>(subMesh->indexStart),
                              static_cast<int>(subMesh->indexCount),
@@ -1223,19 +1298,24 @@ Mesh& Mesh::_renderWithInstances(SubMesh* subMesh, unsigned int fillMode,
                                  const _InstancesBatchPtr& batch, const EffectPtr& effect,
                                  Engine* engine)
 {
-  if (batch->visibleInstances.find(subMesh->_id) == batch->visibleInstances.end()) {
+  // Meshes grouped with this one by the rendering group (automatic instancing)
+  const auto autoInstances     = subMesh->_autoInstances;
+  const auto autoInstanceCount = autoInstances ? autoInstances->size() : 0;
+
+  if (batch->visibleInstances.find(subMesh->_id) == batch->visibleInstances.end()
+      && autoInstanceCount == 0) {
     return *this;
   }
 
   auto& visibleInstances = batch->visibleInstances[subMesh->_id];
-  if (visibleInstances.empty()) {
+  if (visibleInstances.empty() && autoInstanceCount == 0) {
     return *this;
   }
 
   auto& instanceStorage           = _instanceDataStorage;
   auto currentInstancesBufferSize = instanceStorage->instancesBufferSize;
   auto& instancesBuffer           = instanceStorage->instancesBuffer;
-  size_t matricesCount            = visibleInstances.size() + 1;
+  size_t matricesCount            = visibleInstances.size() + autoInstanceCount + 1;
   size_t bufferSize               = matricesCount * 16 * 4;
 
   while (instanceStorage->instancesBufferSize < bufferSize) {
@@ -1270,9 +1350,18 @@ Mesh& Mesh::_renderWithInstances(SubMesh* subMesh, unsigned int fillMode,
         ++instancesCount;
       }
     }
+
+    if (autoInstances) {
+      for (auto autoInstance : *autoInstances) {
+        autoInstance->getWorldMatrix().copyToArray(instanceStorage->instancesData, offset);
+        offset += 16;
+        ++instancesCount;
+      }
+    }
   }
   else {
-    instancesCount = (renderSelf ? 1 : 0) + static_cast<unsigned int>(visibleInstances.size());
+    instancesCount = (renderSelf ? 1 : 0)
+                     + static_cast<unsigned int>(visibleInstances.size() + autoInstanceCount);
   }
 
   if (needUpdateBuffer) {
@@ -1842,9 +1931,24 @@ Mesh& Mesh::render(SubMesh* subMesh, bool enableAlphaMode,
     _internalMeshDataInfo->_onBeforeRenderObservable.notifyObservers(this);
   }
 
+  // Meshes grouped with this one are drawn by this call
+  const auto hasAutoInstances
+    = subMesh->_autoInstances && !subMesh->_autoInstances->empty() && !effectiveMeshReplacement;
+  if (hasAutoInstances) {
+    for (auto autoInstance : *subMesh->_autoInstances) {
+      if (autoInstance->_internalAbstractMeshDataInfo._isActiveIntermediate) {
+        autoInstance->_internalAbstractMeshDataInfo._isActiveIntermediate = false;
+      }
+      else {
+        autoInstance->_internalAbstractMeshDataInfo._isActive = false;
+      }
+    }
+  }
+
   auto engine                     = scene.getEngine();
   auto hardwareInstancedRendering = batch->hardwareInstancedRendering[subMesh->_id]
-                                    || subMesh->getRenderingMesh()->hasThinInstances();
+                                    || subMesh->getRenderingMesh()->hasThinInstances()
+                                    || hasAutoInstances;
   auto& instanceDataStorage = *_instanceDataStorage;
 
   // Material
@@ -2265,6 +2369,16 @@ bool Mesh::isInFrustum(const std::array<Plane, 6>& frustumPlanes, unsigned int /
   return true;
 }
 
+bool Mesh::_canComputeWorldMatrixConcurrently() const
+{
+  // Delay loaded meshes trigger the loading from isInFrustum and thin instances refresh their
+  // bounding info from the shared buffers
+  return AbstractMesh::_canComputeWorldMatrixConcurrently()
+         && delayLoadState == Constants::DELAYLOADSTATE_NONE
+         && (!_geometry || _geometry->delayLoadState == Constants::DELAYLOADSTATE_NONE)
+         && !get_hasThinInstances();
+}
+
 Mesh& Mesh::setMaterialByID(const std::string& iId)
 {
   const auto& materials = getScene()->materials;
@@ -3019,73 +3133,228 @@ Mesh& Mesh::synchronizeInstances()
   return *this;
 }
 
-void Mesh::optimizeIndices(const std::function<void(Mesh* mesh)>& successCallback)
+Mesh& Mesh::simplify(const std::vector<ISimplificationSettings>& settings, bool parallelProcessing,
+                     SimplificationType simplificationType,
+                     const std::function<void(Mesh* mesh)>& successCallback)
 {
-  successCallback(nullptr);
+  ISimplificationTask task;
+  task.settings           = settings;
+  task.parallelProcessing = parallelProcessing;
+  task.mesh               = this;
+  task.simplificationType = simplificationType;
+  if (successCallback) {
+    task.successCallback = [this, successCallback]() { successCallback(this); };
+  }
+  getScene()->simplificationQueue()->addTask(task);
+  return *this;
 }
 
-void Mesh::minimizeVertices()
+IndexOptimizationReport
+Mesh::optimizeIndices(const std::function<void(Mesh* mesh)>& successCallback,
+                      const IndexOptimizationOptions& options)
 {
-  auto _pdata = getVerticesData(VertexBuffer::PositionKind);
-  auto _ndata = getVerticesData(VertexBuffer::NormalKind);
-  auto _idata = getIndices();
+  IndexOptimizationReport report;
 
-  Float32Array _newPdata; // new positions array
-  IndicesArray _newIdata; // new indices array
+  auto indices             = getIndices();
+  const auto totalVertices = getTotalVertices();
+  const auto positions     = getVerticesDataView(VertexBuffer::PositionKind);
+  if (!_geometry || indices.size() < 3 || positions.empty()) {
+    if (successCallback) {
+      successCallback(this);
+    }
+    return report;
+  }
 
-  auto _mapPtr = 0;                          // new index;
-  std::vector<std::string> _uniquePositions; // unique vertex positions
-  for (size_t _i = 0; _i < _idata.size(); _i += 3) {
-    // facet vertex indices
-    IndicesArray _facet{_idata[_i], _idata[_i + 1], _idata[_i + 2]};
-    // lists facet vertex positions (x,y,z) as string "xyz""
-    std::vector<std::string> _pstring(3);
-    for (unsigned int _j = 0; _j < 3; ++_j) { //
-      _pstring[_j] = "";
-      for (size_t _k = 0; _k < 3; ++_k) {
-        // small values make 0
-        if (std::abs(_pdata[3 * _facet[_j] + _k]) < 0.0001f) {
-          _pdata[3 * _facet[_j] + _k] = 0;
-        }
-        _pstring[_j] += std::to_string(_pdata[3 * _facet[_j] + _k]) + "|";
+  report.before = IndexOptimizer::AnalyzeVertexCache(indices, 0, indices.size(), options.cacheSize);
+
+  // Triangles are reordered inside their submesh
+  auto previousSubMeshes = subMeshes;
+  for (const auto& subMesh : previousSubMeshes) {
+    if (subMesh->indexStart + subMesh->indexCount > indices.size()) {
+      continue;
+    }
+    IndexOptimizer::OptimizeVertexCache(indices, subMesh->indexStart, subMesh->indexCount,
+                                        options.cacheSize);
+    if (options.optimizeOverdraw) {
+      IndexOptimizer::OptimizeOverdraw(indices, subMesh->indexStart, subMesh->indexCount,
+                                       positions, options.cacheSize, options.overdrawThreshold);
+    }
+  }
+
+  // The vertices are reordered inside the vertex range of their submesh
+  auto canRemapVertices = options.optimizeVertexFetch && _geometry->meshes().size() == 1
+                          && !morphTargetManager() && !previousSubMeshes.empty();
+  IndicesArray remap(totalVertices);
+  for (size_t vertex = 0; vertex < totalVertices; ++vertex) {
+    remap[vertex] = static_cast<uint32_t>(vertex);
+  }
+  if (canRemapVertices) {
+    std::vector<bool> usedVertices(totalVertices, false);
+    for (const auto& subMesh : previousSubMeshes) {
+      const auto verticesEnd = subMesh->verticesStart + subMesh->verticesCount;
+      if (verticesEnd > totalVertices
+          || std::any_of(usedVertices.begin() + subMesh->verticesStart,
+                         usedVertices.begin() + static_cast<std::ptrdiff_t>(verticesEnd),
+                         [](bool used) { return used; })
+          || !IndexOptimizer::GenerateVertexFetchRemap(indices, subMesh->indexStart,
+                                                       subMesh->indexCount, subMesh->verticesStart,
+                                                       subMesh->verticesCount, remap)) {
+        canRemapVertices = false;
+        break;
       }
-      _pstring[_j] = _pstring[_j].substr(0, _pstring[_j].size() - 1);
-    }
-    // check facet vertices to see that none are repeated
-    // do not process any facet that has a repeated vertex, ie is a line
-    if (!(_pstring[0] == _pstring[1] || _pstring[0] == _pstring[2] || _pstring[1] == _pstring[2])) {
-      // for each facet position check if already listed in uniquePositions
-      // if not listed add to uniquePositions and set index pointer
-      // if listed use its index in uniquePositions and new index pointer
-      for (unsigned int _j = 0; _j < 3; ++_j) {
-        int _ptr = stl_util::index_of(_uniquePositions, _pstring[_j]);
-        if (_ptr < 0) {
-          _uniquePositions.emplace_back(_pstring[_j]);
-          _ptr = _mapPtr++;
-          // not listed so add individual x, y, z coordinates to new positions
-          // array newPdata and add matching normal data to new normals array
-          // newNdata
-          for (unsigned int _k = 0; _k < 3; ++_k) {
-            _newPdata.emplace_back(_pdata[3 * _facet[_j] + _k]);
-          }
-        }
-        // add new index pointer to new indices array newIdata
-        _newIdata.emplace_back(_ptr);
+      std::fill(usedVertices.begin() + subMesh->verticesStart,
+                usedVertices.begin() + static_cast<std::ptrdiff_t>(verticesEnd), true);
+    }
+  }
+  if (canRemapVertices) {
+    for (const auto& kind : getVerticesDataKinds()) {
+      const auto vertexBuffer = getVertexBuffer(kind);
+      if (!vertexBuffer || vertexBuffer->getIsInstanced()) {
+        canRemapVertices = false;
+        break;
+      }
+    }
+  }
+
+  if (canRemapVertices) {
+    for (const auto& kind : getVerticesDataKinds()) {
+      const auto data = getVerticesData(kind);
+      if (data.empty() || data.size() % totalVertices != 0) {
+        continue;
       }
+      const auto size = data.size() / totalVertices;
+      setVerticesData(kind, IndexOptimizer::RemapVertexData(data, size, remap),
+                      isVertexBufferUpdatable(kind), size);
+    }
+    IndexOptimizer::RemapIndices(indices, remap);
+    report.vertexFetchOptimized = true;
+  }
+
+  setIndices(indices, totalVertices, _geometry->isIndexBufferUpdatable());
+
+  // Restore the submeshes recreated by setIndices
+  releaseSubMeshes();
+  for (const auto& previousOne : previousSubMeshes) {
+    SubMesh::AddToMesh(previousOne->materialIndex, previousOne->verticesStart,
+                       previousOne->verticesCount, previousOne->indexStart,
+                       previousOne->indexCount, shared_from_base<Mesh>());
+  }
+  synchronizeInstances();
+  refreshBoundingInfo();
+
+  report.after = IndexOptimizer::AnalyzeVertexCache(indices, 0, indices.size(), options.cacheSize);
+  BABYLON_LOGF_INFO("Mesh", "%s: optimized indices, ACMR %.3f -> %.3f, ATVR %.3f -> %.3f",
+                    name.c_str(), report.before.acmr, report.after.acmr, report.before.atvr,
+                    report.after.atvr)
+
+  if (successCallback) {
+    successCallback(this);
+  }
+
+  return report;
+}
+
+size_t Mesh::buildMeshlets(const MeshletBuildOptions& options)
+{
+  auto indices         = getIndices();
+  const auto positions = getVerticesDataView(VertexBuffer::PositionKind);
+  if (!_geometry || indices.size() < 3 || positions.empty()) {
+    return 0;
+  }
+
+  // Triangles are reordered inside their submesh, meshlets never cross submeshes
+  auto previousSubMeshes = subMeshes;
+  std::vector<std::vector<Meshlet>> subMeshMeshlets(previousSubMeshes.size());
+  for (size_t index = 0; index < previousSubMeshes.size(); ++index) {
+    const auto& subMesh = previousSubMeshes[index];
+    if (subMesh->indexStart + subMesh->indexCount > indices.size()) {
+      continue;
     }
+    subMeshMeshlets[index] = MeshletBuilder::BuildMeshlets(indices, subMesh->indexStart,
+                                                           subMesh->indexCount, positions, options);
   }
 
-  Float32Array _newNdata; // new normal data
+  setIndices(indices, getTotalVertices(), _geometry->isIndexBufferUpdatable());
 
-  VertexData::ComputeNormals(_newPdata, _newIdata, _newNdata);
+  // Restore the submeshes recreated by setIndices
+  releaseSubMeshes();
+  size_t meshletCount = 0;
+  for (size_t index = 0; index < previousSubMeshes.size(); ++index) {
+    const auto& previousOne = previousSubMeshes[index];
+    const auto subMesh      = SubMesh::AddToMesh(
+      previousOne->materialIndex, previousOne->verticesStart, previousOne->verticesCount,
+      previousOne->indexStart, previousOne->indexCount, shared_from_base<Mesh>());
+    meshletCount += subMeshMeshlets[index].size();
+    subMesh->_meshlets = std::move(subMeshMeshlets[index]);
+  }
+  synchronizeInstances();
 
-  // create new vertex data object and update
-  auto _vertexData       = std::make_unique<VertexData>();
-  _vertexData->positions = std::move(_newPdata);
-  _vertexData->indices   = std::move(_newIdata);
-  _vertexData->normals   = std::move(_newNdata);
+  BABYLON_LOGF_INFO("Mesh", "%s: built %zu meshlets for %zu triangles", name.c_str(),
+                    meshletCount, indices.size() / 3)
 
-  _vertexData->applyToMesh(*this);
+  return meshletCount;
+}
+
+void Mesh::minimizeVertices(const std::optional<VertexWeldOptions>& options)
+{
+  // Without options, only the positions are welded and the normals are smoothed
+  const auto smoothNormals = !options.has_value();
+  auto weldOptions         = options.value_or(VertexWeldOptions{});
+  std::unique_ptr<VertexData> vertexData;
+  if (smoothNormals) {
+    weldOptions.compareNormals = false;
+    weldOptions.compareUVs     = false;
+    weldOptions.compareColors  = false;
+    vertexData                 = std::make_unique<VertexData>();
+    vertexData->positions      = getVerticesData(VertexBuffer::PositionKind);
+    vertexData->indices        = getIndices();
+  }
+  else {
+    vertexData = VertexData::ExtractFromMesh(this, true, true);
+  }
+  if (!vertexData || vertexData->positions.empty() || vertexData->indices.size() < 3) {
+    return;
+  }
+
+  // The submeshes are kept when they split the index buffer in consecutive ranges
+  auto previousSubMeshes = subMeshes;
+  std::sort(previousSubMeshes.begin(), previousSubMeshes.end(),
+            [](const SubMeshPtr& a, const SubMeshPtr& b) { return a->indexStart < b->indexStart; });
+  IndicesArray subMeshIndexCounts;
+  size_t indexEnd = 0;
+  for (const auto& subMesh : previousSubMeshes) {
+    if (subMesh->indexStart != indexEnd) {
+      break;
+    }
+    subMeshIndexCounts.emplace_back(static_cast<uint32_t>(subMesh->indexCount));
+    indexEnd += subMesh->indexCount;
+  }
+  const auto keepSubMeshes
+    = previousSubMeshes.size() > 1 && indexEnd == vertexData->indices.size()
+      && subMeshIndexCounts.size() == previousSubMeshes.size();
+
+  const auto previousVertexCount = vertexData->positions.size() / 3;
+  vertexData->weld(weldOptions, keepSubMeshes ? &subMeshIndexCounts : nullptr);
+
+  if (smoothNormals) {
+    VertexData::ComputeNormals(vertexData->positions, vertexData->indices, vertexData->normals);
+  }
+
+  vertexData->applyToMesh(*this);
+
+  if (keepSubMeshes) {
+    releaseSubMeshes();
+    uint32_t indexStart = 0;
+    for (size_t index = 0; index < previousSubMeshes.size(); ++index) {
+      SubMesh::CreateFromIndices(previousSubMeshes[index]->materialIndex, indexStart,
+                                 subMeshIndexCounts[index], shared_from_base<Mesh>());
+      indexStart += subMeshIndexCounts[index];
+    }
+    synchronizeInstances();
+  }
+
+  BABYLON_LOGF_INFO("Mesh", "%s: welded %zu vertices into %zu", name.c_str(),
+                    previousVertexCount, vertexData->positions.size() / 3)
 }
 
 void Mesh::serialize(json& /*serializationObject*/) const
@@ -4203,7 +4472,8 @@ Vector3 Mesh::Center(const std::vector<AbstractMeshPtr>& meshes)
 
 MeshPtr Mesh::MergeMeshes(const std::vector<MeshPtr>& meshes, bool disposeSource,
                           bool allow32BitsIndices, MeshPtr meshSubclass,
-                          bool subdivideWithSubMeshes, bool multiMultiMaterials)
+                          bool subdivideWithSubMeshes, bool multiMultiMaterials,
+                          const std::optional<VertexWeldOptions>& weldOptions)
 {
   unsigned int index = 0;
   if (!allow32BitsIndices) {
@@ -4307,6 +4577,12 @@ MeshPtr Mesh::MergeMeshes(const std::vector<MeshPtr>& meshes, bool disposeSource
   if ((!vertexData) || (!source))
     return meshSubclass;
 
+  // Weld the vertices shared by the merged meshes
+  if (weldOptions) {
+    vertexData->weld(*weldOptions,
+                     (subdivideWithSubMeshes || multiMultiMaterials) ? &indiceArray : nullptr);
+  }
+
   vertexData->applyToMesh(*meshSubclass);
 
   // Setting properties
@@ -32,7 +32,15 @@ void SimplicationQueueSceneComponent::dispose()
 
 void SimplicationQueueSceneComponent::_beforeCameraUpdate()
 {
-  if (scene->simplificationQueue() && !scene->simplificationQueue()->running) {
+  if (!scene->simplificationQueue()) {
+    return;
+  }
+
+  // Running tasks are simplified on the engine thread pool, their LOD levels are added here
+  if (scene->simplificationQueue()->running) {
+    scene->simplificationQueue()->checkRunningTask();
+  }
+  else {
     scene->simplificationQueue()->executeNext();
   }
 }
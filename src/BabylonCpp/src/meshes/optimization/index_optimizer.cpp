@@ -0,0 +1,414 @@
+#include <babylon/meshes/optimization/index_optimizer.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+
+#include <babylon/maths/vector3.h>
+
+namespace BABYLON {
+
+namespace {
+
+constexpr uint32_t InvalidVertex = std::numeric_limits<uint32_t>::max();
+
+/**
+ * Vertices referenced by a range of indices, the algorithms index their per vertex data with the
+ * local vertex index (index - start) to stay proportional to the size of the submesh
+ */
+struct VertexRange {
+  uint32_t start = 0;
+  size_t count   = 0;
+};
+
+VertexRange ComputeVertexRange(const IndicesArray& indices, size_t indexStart, size_t indexCount)
+{
+  if (indexCount == 0) {
+    return VertexRange{};
+  }
+
+  const auto begin  = indices.begin() + static_cast<std::ptrdiff_t>(indexStart);
+  const auto minMax = std::minmax_element(begin, begin + static_cast<std::ptrdiff_t>(indexCount));
+  return VertexRange{*minMax.first, static_cast<size_t>(*minMax.second - *minMax.first) + 1};
+}
+
+/**
+ * FIFO cache emulation: a vertex is in the cache when less than cacheSize vertices entered the
+ * cache after it. Increasing the timestamp by cacheSize + 1 flushes the cache.
+ */
+unsigned int UpdateCache(uint32_t a, uint32_t b, uint32_t c, size_t cacheSize,
+                         std::vector<uint32_t>& cacheTimestamps, uint32_t& timestamp)
+{
+  unsigned int cacheMisses = 0;
+  for (const auto vertex : {a, b, c}) {
+    if (timestamp - cacheTimestamps[vertex] > cacheSize) {
+      cacheTimestamps[vertex] = timestamp++;
+      ++cacheMisses;
+    }
+  }
+  return cacheMisses;
+}
+
+// A new cluster starts when the three vertices of a triangle miss the cache (disjoint patch)
+std::vector<size_t> GenerateHardBoundaries(const uint32_t* indices, size_t triangleCount,
+                                           size_t vertexCount, size_t cacheSize)
+{
+  std::vector<size_t> boundaries;
+  std::vector<uint32_t> cacheTimestamps(vertexCount, 0);
+  uint32_t timestamp = static_cast<uint32_t>(cacheSize) + 1;
+
+  for (size_t triangle = 0; triangle < triangleCount; ++triangle) {
+    const auto misses = UpdateCache(indices[triangle * 3], indices[triangle * 3 + 1],
+                                    indices[triangle * 3 + 2], cacheSize, cacheTimestamps,
+                                    timestamp);
+    if (triangle == 0 || misses == 3) {
+      boundaries.emplace_back(triangle);
+    }
+  }
+
+  return boundaries;
+}
+
+// Splits the hard clusters as soon as their running ACMR reaches threshold x their own ACMR
+std::vector<size_t> GenerateSoftBoundaries(const uint32_t* indices, size_t triangleCount,
+                                           size_t vertexCount,
+                                           const std::vector<size_t>& hardBoundaries,
+                                           size_t cacheSize, float threshold)
+{
+  std::vector<size_t> boundaries;
+  std::vector<uint32_t> cacheTimestamps(vertexCount, 0);
+  const auto flush   = static_cast<uint32_t>(cacheSize) + 1;
+  uint32_t timestamp = flush;
+
+  for (size_t cluster = 0; cluster < hardBoundaries.size(); ++cluster) {
+    const auto start = hardBoundaries[cluster];
+    const auto end
+      = cluster + 1 < hardBoundaries.size() ? hardBoundaries[cluster + 1] : triangleCount;
+
+    timestamp += flush;
+    unsigned int clusterMisses = 0;
+    for (size_t triangle = start; triangle < end; ++triangle) {
+      clusterMisses += UpdateCache(indices[triangle * 3], indices[triangle * 3 + 1],
+                                   indices[triangle * 3 + 2], cacheSize, cacheTimestamps,
+                                   timestamp);
+    }
+    const auto clusterThreshold
+      = threshold * static_cast<float>(clusterMisses) / static_cast<float>(end - start);
+
+    boundaries.emplace_back(start);
+    timestamp += flush;
+    unsigned int runningMisses = 0;
+    unsigned int runningCount  = 0;
+    for (size_t triangle = start; triangle < end; ++triangle) {
+      runningMisses += UpdateCache(indices[triangle * 3], indices[triangle * 3 + 1],
+                                   indices[triangle * 3 + 2], cacheSize, cacheTimestamps,
+                                   timestamp);
+      ++runningCount;
+      if (static_cast<float>(runningMisses) / static_cast<float>(runningCount)
+          <= clusterThreshold) {
+        // Target ACMR reached, the next triangle starts a new cluster with an empty cache
+        boundaries.emplace_back(triangle + 1);
+        timestamp += flush;
+        runningMisses = 0;
+        runningCount  = 0;
+      }
+    }
+
+    // The last split may have started an empty cluster
+    if (boundaries.back() == end) {
+      boundaries.pop_back();
+    }
+  }
+
+  return boundaries;
+}
+
+} // end of anonymous namespace
+
+VertexCacheStatistics IndexOptimizer::AnalyzeVertexCache(const IndicesArray& indices,
+                                                         size_t indexStart, size_t indexCount,
+                                                         size_t cacheSize)
+{
+  VertexCacheStatistics statistics;
+  if (indexCount < 3 || indexStart + indexCount > indices.size() || cacheSize == 0) {
+    return statistics;
+  }
+
+  const auto range = ComputeVertexRange(indices, indexStart, indexCount);
+  std::vector<uint32_t> cacheTimestamps(range.count, 0);
+  std::vector<bool> referenced(range.count, false);
+  uint32_t timestamp = static_cast<uint32_t>(cacheSize) + 1;
+
+  for (size_t index = indexStart; index < indexStart + indexCount; ++index) {
+    const auto vertex = indices[index] - range.start;
+    if (timestamp - cacheTimestamps[vertex] > cacheSize) {
+      cacheTimestamps[vertex] = timestamp++;
+      ++statistics.cacheMisses;
+    }
+    if (!referenced[vertex]) {
+      referenced[vertex] = true;
+      ++statistics.vertexCount;
+    }
+  }
+
+  statistics.triangleCount = indexCount / 3;
+  statistics.acmr
+    = static_cast<float>(statistics.cacheMisses) / static_cast<float>(statistics.triangleCount);
+  statistics.atvr
+    = static_cast<float>(statistics.cacheMisses) / static_cast<float>(statistics.vertexCount);
+
+  return statistics;
+}
+
+void IndexOptimizer::OptimizeVertexCache(IndicesArray& indices, size_t indexStart,
+                                         size_t indexCount, size_t cacheSize)
+{
+  indexCount -= indexCount % 3;
+  if (indexCount < 6 || indexStart + indexCount > indices.size() || cacheSize == 0) {
+    return;
+  }
+
+  const auto triangleCount = indexCount / 3;
+  const auto range         = ComputeVertexRange(indices, indexStart, indexCount);
+  const auto input         = indices.data() + indexStart;
+
+  // Vertex to triangles adjacency, liveTriangles counts the triangles not emitted yet
+  std::vector<uint32_t> liveTriangles(range.count, 0);
+  for (size_t index = 0; index < indexCount; ++index) {
+    ++liveTriangles[input[index] - range.start];
+  }
+  std::vector<uint32_t> adjacencyOffsets(range.count + 1, 0);
+  std::partial_sum(liveTriangles.begin(), liveTriangles.end(), adjacencyOffsets.begin() + 1);
+  std::vector<uint32_t> adjacency(indexCount);
+  {
+    auto fillOffsets = adjacencyOffsets;
+    for (size_t index = 0; index < indexCount; ++index) {
+      adjacency[fillOffsets[input[index] - range.start]++] = static_cast<uint32_t>(index / 3);
+    }
+  }
+
+  std::vector<uint32_t> cacheTimestamps(range.count, 0);
+  std::vector<bool> emitted(triangleCount, false);
+  std::vector<uint32_t> deadEnd;
+  deadEnd.reserve(indexCount);
+  IndicesArray output;
+  output.reserve(indexCount);
+
+  uint32_t timestamp   = static_cast<uint32_t>(cacheSize) + 1;
+  uint32_t inputCursor = 0;
+  uint32_t current     = input[0] - range.start;
+
+  while (current != InvalidVertex) {
+    // Emit all the remaining triangles of the fanning vertex
+    const auto candidatesStart = deadEnd.size();
+    for (auto it = adjacencyOffsets[current]; it < adjacencyOffsets[current + 1]; ++it) {
+      const auto triangle = adjacency[it];
+      if (emitted[triangle]) {
+        continue;
+      }
+      emitted[triangle] = true;
+      for (size_t corner = 0; corner < 3; ++corner) {
+        const auto index  = input[triangle * 3 + corner];
+        const auto vertex = index - range.start;
+        output.emplace_back(index);
+        deadEnd.emplace_back(vertex);
+        --liveTriangles[vertex];
+        if (timestamp - cacheTimestamps[vertex] > cacheSize) {
+          cacheTimestamps[vertex] = timestamp++;
+        }
+      }
+    }
+
+    // Next fanning vertex: the oldest candidate that stays in the cache while its remaining
+    // triangles are emitted, otherwise any candidate with remaining triangles
+    current              = InvalidVertex;
+    int64_t bestPriority = -1;
+    for (auto it = candidatesStart; it < deadEnd.size(); ++it) {
+      const auto vertex = deadEnd[it];
+      if (liveTriangles[vertex] == 0) {
+        continue;
+      }
+      int64_t priority = 0;
+      const auto age   = timestamp - cacheTimestamps[vertex];
+      if (age + 2 * liveTriangles[vertex] <= cacheSize) {
+        priority = age;
+      }
+      if (priority > bestPriority) {
+        bestPriority = priority;
+        current      = vertex;
+      }
+    }
+
+    if (current == InvalidVertex) {
+      // Dead end: go back to a recently used vertex, then to the next vertex in input order
+      while (!deadEnd.empty() && current == InvalidVertex) {
+        const auto vertex = deadEnd.back();
+        deadEnd.pop_back();
+        if (liveTriangles[vertex] > 0) {
+          current = vertex;
+        }
+      }
+      while (current == InvalidVertex && inputCursor < range.count) {
+        if (liveTriangles[inputCursor] > 0) {
+          current = inputCursor;
+        }
+        ++inputCursor;
+      }
+    }
+  }
+
+  std::copy(output.begin(), output.end(),
+            indices.begin() + static_cast<std::ptrdiff_t>(indexStart));
+}
+
+void IndexOptimizer::OptimizeOverdraw(IndicesArray& indices, size_t indexStart, size_t indexCount,
+                                      const VertexDataView& positions, size_t cacheSize,
+                                      float threshold)
+{
+  indexCount -= indexCount % 3;
+  if (indexCount < 6 || indexStart + indexCount > indices.size() || cacheSize == 0
+      || positions.empty() || positions.size < 3) {
+    return;
+  }
+
+  const auto triangleCount = indexCount / 3;
+  const auto range         = ComputeVertexRange(indices, indexStart, indexCount);
+  if (range.start + range.count > positions.count) {
+    return;
+  }
+
+  // Cache emulation on local vertex indices
+  IndicesArray local(indexCount);
+  for (size_t index = 0; index < indexCount; ++index) {
+    local[index] = indices[indexStart + index] - range.start;
+  }
+
+  const auto hardBoundaries
+    = GenerateHardBoundaries(local.data(), triangleCount, range.count, cacheSize);
+  const auto clusters = GenerateSoftBoundaries(local.data(), triangleCount, range.count,
+                                               hardBoundaries, cacheSize, threshold);
+  if (clusters.size() < 2) {
+    return;
+  }
+
+  const auto input = indices.data() + indexStart;
+
+  Vector3 meshCentroid;
+  for (size_t index = 0; index < indexCount; ++index) {
+    meshCentroid.addInPlace(positions.getVector3(input[index]));
+  }
+  meshCentroid.scaleInPlace(1.f / static_cast<float>(indexCount));
+
+  // Clusters facing away from the mesh centroid are drawn first, they are the most likely to
+  // occlude the others
+  std::vector<float> sortKeys(clusters.size());
+  for (size_t cluster = 0; cluster < clusters.size(); ++cluster) {
+    const auto start = clusters[cluster];
+    const auto end   = cluster + 1 < clusters.size() ? clusters[cluster + 1] : triangleCount;
+
+    Vector3 centroid;
+    Vector3 normal;
+    float area = 0.f;
+    for (size_t triangle = start; triangle < end; ++triangle) {
+      const auto p0 = positions.getVector3(input[triangle * 3]);
+      const auto p1 = positions.getVector3(input[triangle * 3 + 1]);
+      const auto p2 = positions.getVector3(input[triangle * 3 + 2]);
+
+      const auto triangleNormal = Vector3::Cross(p1.subtract(p0), p2.subtract(p0));
+      const auto triangleArea   = triangleNormal.length();
+
+      centroid.addInPlace(p0.add(p1).addInPlace(p2).scaleInPlace(triangleArea / 3.f));
+      normal.addInPlace(triangleNormal);
+      area += triangleArea;
+    }
+
+    if (area > 0.f) {
+      centroid.scaleInPlace(1.f / area);
+    }
+    const auto normalLength = normal.length();
+    if (normalLength > 0.f) {
+      normal.scaleInPlace(1.f / normalLength);
+    }
+
+    sortKeys[cluster] = Vector3::Dot(centroid.subtract(meshCentroid), normal);
+  }
+
+  std::vector<size_t> order(clusters.size());
+  std::iota(order.begin(), order.end(), 0);
+  std::stable_sort(order.begin(), order.end(),
+                   [&sortKeys](size_t a, size_t b) { return sortKeys[a] > sortKeys[b]; });
+
+  IndicesArray output;
+  output.reserve(indexCount);
+  for (const auto cluster : order) {
+    const auto start = clusters[cluster];
+    const auto end   = cluster + 1 < clusters.size() ? clusters[cluster + 1] : triangleCount;
+    output.insert(output.end(), input + start * 3, input + end * 3);
+  }
+
+  std::copy(output.begin(), output.end(),
+            indices.begin() + static_cast<std::ptrdiff_t>(indexStart));
+}
+
+bool IndexOptimizer::GenerateVertexFetchRemap(const IndicesArray& indices, size_t indexStart,
+                                              size_t indexCount, size_t verticesStart,
+                                              size_t verticesCount, IndicesArray& remap)
+{
+  if (indexStart + indexCount > indices.size()) {
+    return false;
+  }
+
+  if (remap.size() < verticesStart + verticesCount) {
+    remap.resize(verticesStart + verticesCount);
+  }
+
+  std::vector<bool> assigned(verticesCount, false);
+  auto next = static_cast<uint32_t>(verticesStart);
+
+  for (size_t index = indexStart; index < indexStart + indexCount; ++index) {
+    const auto vertex = indices[index];
+    if (vertex < verticesStart || vertex >= verticesStart + verticesCount) {
+      return false;
+    }
+    if (!assigned[vertex - verticesStart]) {
+      assigned[vertex - verticesStart] = true;
+      remap[vertex]                    = next++;
+    }
+  }
+
+  for (size_t vertex = 0; vertex < verticesCount; ++vertex) {
+    if (!assigned[vertex]) {
+      remap[verticesStart + vertex] = next++;
+    }
+  }
+
+  return true;
+}
+
+void IndexOptimizer::RemapIndices(IndicesArray& indices, const IndicesArray& remap)
+{
+  for (auto& index : indices) {
+    index = remap[index];
+  }
+}
+
+Float32Array IndexOptimizer::RemapVertexData(const Float32Array& data, size_t size,
+                                             const IndicesArray& remap)
+{
+  if (size == 0) {
+    return data;
+  }
+
+  Float32Array result(data.size());
+  const auto vertexCount = data.size() / size;
+  for (size_t vertex = 0; vertex < vertexCount; ++vertex) {
+    const auto target = vertex < remap.size() ? remap[vertex] : vertex;
+    std::copy(data.begin() + static_cast<std::ptrdiff_t>(vertex * size),
+              data.begin() + static_cast<std::ptrdiff_t>((vertex + 1) * size),
+              result.begin() + static_cast<std::ptrdiff_t>(target * size));
+  }
+  return result;
+}
+
+} // end of namespace BABYLON
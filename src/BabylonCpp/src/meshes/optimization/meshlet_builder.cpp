@@ -0,0 +1,321 @@
+#include <babylon/meshes/optimization/meshlet_builder.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+
+#include <babylon/maths/matrix.h>
+
+namespace BABYLON {
+
+namespace {
+
+constexpr uint32_t InvalidMeshlet = std::numeric_limits<uint32_t>::max();
+
+/**
+ * State of the meshlet being grown: the vertex stamps tell which vertices are already used by the
+ * meshlet, the normal sum is the (unnormalized) cone axis and the centroid sum gives the center
+ */
+struct MeshletState {
+  uint32_t id = 0;
+  Vector3 normalSum;
+  Vector3 centroidSum;
+  std::vector<uint32_t> triangles;
+  std::vector<uint32_t> candidates;
+};
+
+// Same winding as VertexData::ComputeNormals, the length of the result is twice the triangle area
+Vector3 ComputeTriangleNormal(const Vector3& p0, const Vector3& p1, const Vector3& p2)
+{
+  return Vector3::Cross(p0.subtract(p1), p2.subtract(p1));
+}
+
+void ComputeMeshletBounds(const uint32_t* triangles, size_t indexCount,
+                          const VertexDataView& positions, const std::vector<Vector3>& normals,
+                          const std::vector<uint32_t>& triangleIds, Meshlet& meshlet)
+{
+  // Bounding sphere centered on the bounding box
+  Vector3 minimum(std::numeric_limits<float>::max(), std::numeric_limits<float>::max(),
+                  std::numeric_limits<float>::max());
+  Vector3 maximum(std::numeric_limits<float>::lowest(), std::numeric_limits<float>::lowest(),
+                  std::numeric_limits<float>::lowest());
+  for (size_t index = 0; index < indexCount; ++index) {
+    const auto position = positions.getVector3(triangles[index]);
+    minimum.minimizeInPlace(position);
+    maximum.maximizeInPlace(position);
+  }
+  meshlet.center      = minimum.add(maximum).scale(0.5f);
+  float radiusSquared = 0.f;
+  for (size_t index = 0; index < indexCount; ++index) {
+    const auto position = positions.getVector3(triangles[index]);
+    radiusSquared = std::max(radiusSquared, Vector3::DistanceSquared(meshlet.center, position));
+  }
+  meshlet.radius = std::sqrt(radiusSquared);
+
+  // Normal cone, the cone test is only conservative for cones narrower than a half sphere
+  Vector3 axis;
+  for (const auto triangle : triangleIds) {
+    axis.addInPlace(normals[triangle]);
+  }
+  const auto axisLength = axis.length();
+  meshlet.coneAxis      = axisLength > 0.f ? axis.scale(1.f / axisLength) : Vector3::Zero();
+  meshlet.coneCutoff    = 1.f;
+  if (axisLength > 0.f) {
+    float minimumDot = 1.f;
+    for (const auto triangle : triangleIds) {
+      minimumDot = std::min(minimumDot, Vector3::Dot(normals[triangle], meshlet.coneAxis));
+    }
+    if (minimumDot > 0.1f) {
+      meshlet.coneCutoff = std::sqrt(1.f - minimumDot * minimumDot);
+    }
+  }
+}
+
+} // end of anonymous namespace
+
+std::vector<Meshlet> MeshletBuilder::BuildMeshlets(IndicesArray& indices, size_t indexStart,
+                                                   size_t indexCount,
+                                                   const VertexDataView& positions,
+                                                   const MeshletBuildOptions& options)
+{
+  std::vector<Meshlet> meshlets;
+  indexCount -= indexCount % 3;
+  if (indexCount == 0 || indexStart + indexCount > indices.size() || positions.empty()
+      || options.maxTriangles == 0) {
+    return meshlets;
+  }
+
+  const auto input         = indices.data() + indexStart;
+  const auto triangleCount = indexCount / 3;
+  const auto minMax        = std::minmax_element(input, input + indexCount);
+  const auto vertexStart   = *minMax.first;
+  const auto vertexCount   = static_cast<size_t>(*minMax.second - vertexStart) + 1;
+  if (*minMax.second >= positions.count) {
+    return meshlets;
+  }
+
+  // Vertex to triangles adjacency
+  std::vector<uint32_t> adjacencyOffsets(vertexCount + 1, 0);
+  for (size_t index = 0; index < indexCount; ++index) {
+    ++adjacencyOffsets[input[index] - vertexStart + 1];
+  }
+  std::partial_sum(adjacencyOffsets.begin(), adjacencyOffsets.end(), adjacencyOffsets.begin());
+  std::vector<uint32_t> adjacency(indexCount);
+  {
+    auto fillOffsets = adjacencyOffsets;
+    for (size_t index = 0; index < indexCount; ++index) {
+      adjacency[fillOffsets[input[index] - vertexStart]++] = static_cast<uint32_t>(index / 3);
+    }
+  }
+
+  // The expected radius of a meshlet scales the distance term of the scores
+  std::vector<Vector3> normals(triangleCount);
+  std::vector<Vector3> centroids(triangleCount);
+  float totalArea = 0.f;
+  for (size_t triangle = 0; triangle < triangleCount; ++triangle) {
+    const auto p0         = positions.getVector3(input[triangle * 3]);
+    const auto p1         = positions.getVector3(input[triangle * 3 + 1]);
+    const auto p2         = positions.getVector3(input[triangle * 3 + 2]);
+    auto normal           = ComputeTriangleNormal(p0, p1, p2);
+    const auto doubleArea = normal.length();
+    if (doubleArea > 0.f) {
+      normal.scaleInPlace(1.f / doubleArea);
+    }
+    normals[triangle]   = normal;
+    centroids[triangle] = p0.add(p1).addInPlace(p2).scaleInPlace(1.f / 3.f);
+    totalArea += doubleArea * 0.5f;
+  }
+  const auto meanArea       = totalArea / static_cast<float>(triangleCount);
+  const auto expectedRadius = std::max(
+    std::sqrt(meanArea * static_cast<float>(options.maxTriangles) * 0.5f), 1e-6f);
+
+  std::vector<uint32_t> vertexMeshlet(vertexCount, InvalidMeshlet);
+  std::vector<bool> emitted(triangleCount, false);
+  IndicesArray output;
+  output.reserve(indexCount);
+
+  MeshletState state;
+  state.triangles.reserve(options.maxTriangles);
+  std::vector<uint32_t> around;
+
+  const auto newVertexCount = [&](uint32_t triangle) {
+    unsigned int count = 0;
+    for (size_t corner = 0; corner < 3; ++corner) {
+      count += vertexMeshlet[input[triangle * 3 + corner] - vertexStart] != state.id ? 1u : 0u;
+    }
+    return count;
+  };
+
+  const auto addTriangle = [&](uint32_t triangle) {
+    emitted[triangle] = true;
+    state.triangles.emplace_back(triangle);
+    state.normalSum.addInPlace(normals[triangle]);
+    state.centroidSum.addInPlace(centroids[triangle]);
+    for (size_t corner = 0; corner < 3; ++corner) {
+      const auto vertex = input[triangle * 3 + corner];
+      output.emplace_back(vertex);
+      vertexMeshlet[vertex - vertexStart] = state.id;
+    }
+  };
+
+  const auto closeMeshlet = [&]() {
+    Meshlet meshlet;
+    meshlet.indexStart = static_cast<uint32_t>(indexStart + output.size()
+                                               - state.triangles.size() * 3);
+    meshlet.indexCount = static_cast<uint32_t>(state.triangles.size() * 3);
+    ComputeMeshletBounds(output.data() + (output.size() - meshlet.indexCount), meshlet.indexCount,
+                         positions, normals, state.triangles, meshlet);
+    meshlets.emplace_back(meshlet);
+    state.triangles.clear();
+    state.candidates.clear();
+    state.normalSum   = Vector3::Zero();
+    state.centroidSum = Vector3::Zero();
+    ++state.id;
+  };
+
+  // Picks the best not emitted triangle of a list: fewest new vertices first, then the closest to
+  // the meshlet center (round meshlets, small spheres) with a normal close to the meshlet axis
+  // (narrow cones)
+  const auto pickBest = [&](const uint32_t* first, const uint32_t* last) {
+    auto axis             = state.normalSum;
+    const auto axisLength = axis.length();
+    if (axisLength > 0.f) {
+      axis.scaleInPlace(1.f / axisLength);
+    }
+    const auto center = state.centroidSum.scale(1.f / static_cast<float>(state.triangles.size()));
+
+    uint32_t best                = InvalidMeshlet;
+    unsigned int bestNewVertices = std::numeric_limits<unsigned int>::max();
+    float bestScore              = std::numeric_limits<float>::max();
+    for (auto it = first; it != last; ++it) {
+      const auto triangle = *it;
+      if (emitted[triangle]) {
+        continue;
+      }
+      const auto newVertices = newVertexCount(triangle);
+      if (newVertices > bestNewVertices) {
+        continue;
+      }
+      const auto cone
+        = std::max(1.f - options.coneWeight * Vector3::Dot(normals[triangle], axis), 1e-3f);
+      const auto distance = Vector3::Distance(centroids[triangle], center);
+      const auto score    = (1.f + distance / expectedRadius * (1.f - options.coneWeight)) * cone;
+      if (newVertices < bestNewVertices || score < bestScore) {
+        best            = triangle;
+        bestNewVertices = newVertices;
+        bestScore       = score;
+      }
+    }
+    return best;
+  };
+
+  size_t seedCursor = 0;
+  while (output.size() < indexCount) {
+    while (emitted[seedCursor]) {
+      ++seedCursor;
+    }
+    addTriangle(static_cast<uint32_t>(seedCursor));
+
+    while (state.triangles.size() < options.maxTriangles) {
+      // Candidates around the last triangle first, then the whole border of the meshlet
+      const auto last = state.triangles.back();
+      around.clear();
+      for (size_t corner = 0; corner < 3; ++corner) {
+        const auto vertex = input[last * 3 + corner] - vertexStart;
+        for (auto offset = adjacencyOffsets[vertex]; offset < adjacencyOffsets[vertex + 1];
+             ++offset) {
+          if (!emitted[adjacency[offset]]) {
+            around.emplace_back(adjacency[offset]);
+          }
+        }
+      }
+      state.candidates.insert(state.candidates.end(), around.begin(), around.end());
+
+      auto next = pickBest(around.data(), around.data() + around.size());
+      if (next == InvalidMeshlet) {
+        state.candidates.erase(std::remove_if(state.candidates.begin(), state.candidates.end(),
+                                              [&](uint32_t triangle) { return emitted[triangle]; }),
+                               state.candidates.end());
+        next = pickBest(state.candidates.data(),
+                        state.candidates.data() + state.candidates.size());
+      }
+      if (next == InvalidMeshlet) {
+        break;
+      }
+      addTriangle(next);
+    }
+
+    closeMeshlet();
+  }
+
+  std::copy(output.begin(), output.end(), input);
+  return meshlets;
+}
+
+size_t MeshletBuilder::CullMeshlets(const std::vector<Meshlet>& meshlets, const Matrix& world,
+                                    const std::array<Plane, 6>& frustumPlanes,
+                                    const Vector3& cameraPosition,
+                                    const MeshletCullingOptions& options,
+                                    std::vector<MeshletDrawRange>& drawRanges)
+{
+  drawRanges.clear();
+
+  // The radius scales with the largest axis, the cones are only valid for uniform scalings
+  // without mirroring
+  const auto& m       = world.m();
+  const auto scaleX   = std::sqrt(m[0] * m[0] + m[1] * m[1] + m[2] * m[2]);
+  const auto scaleY   = std::sqrt(m[4] * m[4] + m[5] * m[5] + m[6] * m[6]);
+  const auto scaleZ   = std::sqrt(m[8] * m[8] + m[9] * m[9] + m[10] * m[10]);
+  const auto maxScale = std::max({scaleX, scaleY, scaleZ});
+  const auto minScale = std::min({scaleX, scaleY, scaleZ});
+
+  const auto backfaceCulling = options.backfaceCulling && minScale > 0.f
+                               && maxScale - minScale <= maxScale * 1e-3f
+                               && world.determinant() > 0.f;
+  Vector3 localCamera;
+  if (backfaceCulling) {
+    Matrix invertedWorld;
+    world.invertToRef(invertedWorld);
+    localCamera = Vector3::TransformCoordinates(cameraPosition, invertedWorld);
+  }
+
+  size_t visibleCount = 0;
+  Vector3 worldCenter;
+  for (const auto& meshlet : meshlets) {
+    if (backfaceCulling && meshlet.coneCutoff < 1.f) {
+      const auto direction = meshlet.center.subtract(localCamera);
+      if (Vector3::Dot(direction, meshlet.coneAxis)
+          >= meshlet.coneCutoff * direction.length() + meshlet.radius) {
+        continue;
+      }
+    }
+
+    if (options.frustumCulling || options.occlusionTest) {
+      Vector3::TransformCoordinatesToRef(meshlet.center, world, worldCenter);
+      const auto worldRadius = meshlet.radius * maxScale;
+      if (options.frustumCulling
+          && std::any_of(frustumPlanes.begin(), frustumPlanes.end(), [&](const Plane& plane) {
+               return plane.dotCoordinate(worldCenter) < -worldRadius;
+             })) {
+        continue;
+      }
+      if (options.occlusionTest && !options.occlusionTest(worldCenter, worldRadius)) {
+        continue;
+      }
+    }
+
+    ++visibleCount;
+    if (!drawRanges.empty()
+        && drawRanges.back().indexStart + drawRanges.back().indexCount == meshlet.indexStart) {
+      drawRanges.back().indexCount += meshlet.indexCount;
+    }
+    else {
+      drawRanges.emplace_back(MeshletDrawRange{meshlet.indexStart, meshlet.indexCount});
+    }
+  }
+
+  return visibleCount;
+}
+
+} // end of namespace BABYLON
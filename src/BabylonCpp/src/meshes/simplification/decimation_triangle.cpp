@@ -2,13 +2,12 @@
 
 namespace BABYLON {
 
-DecimationTriangle::DecimationTriangle(const std::vector<DecimationVertex>& iVertices)
-    : vertices{iVertices}
+DecimationTriangle::DecimationTriangle(const std::array<int, 3>& iVertices, size_t iSubMeshIndex)
+    : subMeshIndex{iSubMeshIndex}, vertices{iVertices}
 {
-  deleted       = false;
-  isDirty       = false;
-  deletePending = false;
-  borderFactor  = 0;
+  error   = {{0.0, 0.0, 0.0, 0.0}};
+  deleted = false;
+  isDirty = false;
 }
 
 DecimationTriangle::~DecimationTriangle() = default;
@@ -4,10 +4,9 @@ namespace BABYLON {
 
 DecimationVertex::DecimationVertex(const Vector3& _position, int _id) : position{_position}, id{_id}
 {
-  isBorder        = true;
-  triangleCount   = 0;
-  triangleStart   = 0;
-  originalOffsets = {};
+  isBorder      = false;
+  triangleCount = 0;
+  triangleStart = 0;
 }
 DecimationVertex::~DecimationVertex() = default;
 
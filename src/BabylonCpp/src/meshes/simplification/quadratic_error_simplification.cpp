@@ -0,0 +1,502 @@
+#include <babylon/meshes/simplification/quadratic_error_simplification.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include <babylon/meshes/simplification/isimplification_settings.h>
+#include <babylon/meshes/vertex_data.h>
+
+namespace BABYLON {
+
+QuadraticErrorSimplification::QuadraticErrorSimplification()
+    : decimationIterations{100}, aggressiveness{7.f}
+{
+}
+
+QuadraticErrorSimplification::~QuadraticErrorSimplification() = default;
+
+std::unique_ptr<VertexData>
+QuadraticErrorSimplification::simplify(const VertexData& vertexData,
+                                       IndicesArray& subMeshIndexCounts,
+                                       const ISimplificationSettings& settings)
+{
+  _vertexData = std::make_unique<VertexData>(vertexData);
+
+  // Duplicated vertices would be seen as borders
+  if (settings.optimizeMesh) {
+    _vertexData->weld(VertexWeldOptions{},
+                      subMeshIndexCounts.empty() ? nullptr : &subMeshIndexCounts);
+  }
+
+  if (_vertexData->positions.empty() || _vertexData->indices.size() < 3) {
+    return std::move(_vertexData);
+  }
+
+  _initDecimatedMesh(*_vertexData, subMeshIndexCounts);
+
+  const auto quality = std::clamp(settings.quality, 0.f, 1.f);
+  _runDecimation(static_cast<size_t>(static_cast<float>(_triangles.size()) * quality));
+
+  auto result = _reconstructMesh(subMeshIndexCounts);
+
+  _vertices.clear();
+  _triangles.clear();
+  _references.clear();
+  _vertexData = nullptr;
+
+  return result;
+}
+
+void QuadraticErrorSimplification::_initDecimatedMesh(const VertexData& vertexData,
+                                                      const IndicesArray& subMeshIndexCounts)
+{
+  const auto& positions  = vertexData.positions;
+  const auto& indices    = vertexData.indices;
+  const auto vertexCount = positions.size() / 3;
+
+  _vertices.clear();
+  _vertices.reserve(vertexCount);
+  for (size_t i = 0; i < vertexCount; ++i) {
+    _vertices.emplace_back(Vector3(positions[i * 3], positions[i * 3 + 1], positions[i * 3 + 2]),
+                           static_cast<int>(i));
+  }
+
+  _triangles.clear();
+  _triangles.reserve(indices.size() / 3);
+  size_t subMeshIndex = 0;
+  size_t subMeshEnd   = subMeshIndexCounts.empty() ? indices.size() : subMeshIndexCounts[0];
+  for (size_t i = 0; i + 2 < indices.size(); i += 3) {
+    while (i >= subMeshEnd && subMeshIndex + 1 < subMeshIndexCounts.size()) {
+      subMeshEnd += subMeshIndexCounts[++subMeshIndex];
+    }
+    const std::array<int, 3> triangleVertices{{static_cast<int>(indices[i]),
+                                               static_cast<int>(indices[i + 1]),
+                                               static_cast<int>(indices[i + 2])}};
+    // Degenerated triangles are dropped
+    if (triangleVertices[0] == triangleVertices[1] || triangleVertices[1] == triangleVertices[2]
+        || triangleVertices[0] == triangleVertices[2]) {
+      continue;
+    }
+    _triangles.emplace_back(triangleVertices, subMeshIndex);
+  }
+}
+
+void QuadraticErrorSimplification::_runDecimation(size_t targetCount)
+{
+  const auto triangleCount = _triangles.size();
+  size_t deletedTriangles  = 0;
+  std::vector<bool> deleted0;
+  std::vector<bool> deleted1;
+
+  for (unsigned int iteration = 0; iteration < decimationIterations; ++iteration) {
+    if (triangleCount - deletedTriangles <= targetCount) {
+      break;
+    }
+
+    if (iteration % 5 == 0) {
+      _updateMesh(iteration);
+    }
+
+    for (auto& triangle : _triangles) {
+      triangle.isDirty = false;
+    }
+
+    // The threshold grows with the iterations so that the cheapest collapses are done first
+    const auto threshold = 0.000000001 * std::pow(static_cast<double>(iteration + 3),
+                                                  static_cast<double>(aggressiveness));
+
+    for (auto& triangle : _triangles) {
+      if (triangle.error[3] > threshold || triangle.deleted || triangle.isDirty) {
+        continue;
+      }
+
+      for (unsigned int j = 0; j < 3; ++j) {
+        if (triangle.error[j] >= threshold) {
+          continue;
+        }
+
+        auto i0 = triangle.vertices[j];
+        auto i1 = triangle.vertices[(j + 1) % 3];
+        if (_vertices[i0].isBorder && _vertices[i1].isBorder) {
+          continue;
+        }
+        // The border vertex is kept
+        if (_vertices[i1].isBorder) {
+          std::swap(i0, i1);
+        }
+        auto& v0 = _vertices[i0];
+        auto& v1 = _vertices[i1];
+
+        Vector3 point;
+        _calculateError(v0, v1, point);
+
+        deleted0.assign(static_cast<size_t>(v0.triangleCount), false);
+        deleted1.assign(static_cast<size_t>(v1.triangleCount), false);
+        if (_isFlipped(v0, i1, point, deleted0) || _isFlipped(v1, i0, point, deleted1)) {
+          continue;
+        }
+
+        // Attributes are interpolated at the projection of the new position on the edge
+        const auto edge          = v1.position.subtract(v0.position);
+        const auto lengthSquared = edge.lengthSquared();
+        const auto amount
+          = lengthSquared > 0.f ?
+              std::clamp(Vector3::Dot(point.subtract(v0.position), edge) / lengthSquared, 0.f,
+                         1.f) :
+              0.f;
+        _interpolateAttributes(v0.id, v1.id, amount);
+
+        v0.updatePosition(point);
+        v0.q.addInPlace(v1.q);
+
+        const auto triangleStart = static_cast<int>(_references.size());
+        _updateTriangles(i0, v0, deleted0, deletedTriangles);
+        _updateTriangles(i0, v1, deleted1, deletedTriangles);
+        const auto count = static_cast<int>(_references.size()) - triangleStart;
+        // Reuse the references of the kept vertex when possible
+        if (count <= v0.triangleCount) {
+          std::copy(_references.begin() + triangleStart, _references.end(),
+                    _references.begin() + v0.triangleStart);
+        }
+        else {
+          v0.triangleStart = triangleStart;
+        }
+        v0.triangleCount = count;
+        break;
+      }
+
+      if (triangleCount - deletedTriangles <= targetCount) {
+        break;
+      }
+    }
+  }
+}
+
+void QuadraticErrorSimplification::_updateMesh(unsigned int iteration)
+{
+  if (iteration > 0) {
+    _triangles.erase(std::remove_if(_triangles.begin(), _triangles.end(),
+                                    [](const DecimationTriangle& t) { return t.deleted; }),
+                     _triangles.end());
+  }
+
+  // Triangles adjacent to each vertex
+  for (auto& vertex : _vertices) {
+    vertex.triangleStart = 0;
+    vertex.triangleCount = 0;
+  }
+  for (const auto& triangle : _triangles) {
+    for (const auto vertexIndex : triangle.vertices) {
+      ++_vertices[vertexIndex].triangleCount;
+    }
+  }
+  int triangleStart = 0;
+  for (auto& vertex : _vertices) {
+    vertex.triangleStart = triangleStart;
+    triangleStart += vertex.triangleCount;
+    vertex.triangleCount = 0;
+  }
+  _references.assign(_triangles.size() * 3, Reference(0, 0));
+  for (size_t i = 0; i < _triangles.size(); ++i) {
+    for (unsigned int j = 0; j < 3; ++j) {
+      auto& vertex = _vertices[_triangles[i].vertices[j]];
+      _references[static_cast<size_t>(vertex.triangleStart + vertex.triangleCount)]
+        = Reference(static_cast<int>(j), static_cast<int>(i));
+      ++vertex.triangleCount;
+    }
+  }
+
+  if (iteration != 0) {
+    return;
+  }
+
+  _identifyBorder();
+
+  // Quadrics of the triangle planes
+  for (auto& vertex : _vertices) {
+    vertex.q = QuadraticMatrix();
+  }
+  for (auto& triangle : _triangles) {
+    const auto& p0 = _vertices[triangle.vertices[0]].position;
+    const auto& p1 = _vertices[triangle.vertices[1]].position;
+    const auto& p2 = _vertices[triangle.vertices[2]].position;
+    auto normal    = Vector3::Cross(p1.subtract(p0), p2.subtract(p0));
+    normal.normalize();
+    triangle.normal = normal;
+    const auto data
+      = QuadraticMatrix::DataFromNumbers(normal.x, normal.y, normal.z, -Vector3::Dot(normal, p0));
+    for (const auto vertexIndex : triangle.vertices) {
+      _vertices[vertexIndex].q.addArrayInPlace(data);
+    }
+  }
+
+  // Edge errors
+  Vector3 point;
+  for (auto& triangle : _triangles) {
+    for (unsigned int j = 0; j < 3; ++j) {
+      triangle.error[j] = _calculateError(_vertices[triangle.vertices[j]],
+                                          _vertices[triangle.vertices[(j + 1) % 3]], point);
+    }
+    triangle.error[3] = std::min({triangle.error[0], triangle.error[1], triangle.error[2]});
+  }
+}
+
+void QuadraticErrorSimplification::_identifyBorder()
+{
+  for (auto& vertex : _vertices) {
+    vertex.isBorder = false;
+  }
+
+  // An edge used by a single triangle is an open edge or an attribute seam (the vertices are
+  // duplicated), a vertex used by several submeshes is on a submesh boundary
+  std::vector<int> neighborIds;
+  std::vector<int> neighborCounts;
+  for (auto& vertex : _vertices) {
+    neighborIds.clear();
+    neighborCounts.clear();
+    for (int k = 0; k < vertex.triangleCount; ++k) {
+      const auto& triangle
+        = _triangles[static_cast<size_t>(_references[vertex.triangleStart + k].triangleId)];
+      if (triangle.subMeshIndex
+          != _triangles[static_cast<size_t>(_references[vertex.triangleStart].triangleId)]
+               .subMeshIndex) {
+        vertex.isBorder = true;
+      }
+      for (const auto id : triangle.vertices) {
+        const auto it = std::find(neighborIds.begin(), neighborIds.end(), id);
+        if (it == neighborIds.end()) {
+          neighborIds.emplace_back(id);
+          neighborCounts.emplace_back(1);
+        }
+        else {
+          ++neighborCounts[static_cast<size_t>(it - neighborIds.begin())];
+        }
+      }
+    }
+    for (size_t j = 0; j < neighborIds.size(); ++j) {
+      if (neighborCounts[j] == 1) {
+        _vertices[static_cast<size_t>(neighborIds[j])].isBorder = true;
+      }
+    }
+  }
+}
+
+double QuadraticErrorSimplification::_calculateError(const DecimationVertex& vertex1,
+                                                     const DecimationVertex& vertex2,
+                                                     Vector3& pointResult) const
+{
+  const auto q = vertex1.q.add(vertex2.q);
+
+  // A border vertex does not move
+  if (vertex1.isBorder != vertex2.isBorder) {
+    pointResult.copyFrom(vertex1.isBorder ? vertex1.position : vertex2.position);
+    return q.vertexError(pointResult.x, pointResult.y, pointResult.z);
+  }
+
+  // Position minimizing the error, kept when it stays close to the edge
+  const auto det = q.det(0, 1, 2, 1, 4, 5, 2, 5, 7);
+  if (det != 0.0 && !vertex1.isBorder) {
+    pointResult.x = static_cast<float>(-1.0 / det * q.det(1, 2, 3, 4, 5, 6, 5, 7, 8));
+    pointResult.y = static_cast<float>(1.0 / det * q.det(0, 2, 3, 1, 5, 6, 2, 7, 8));
+    pointResult.z = static_cast<float>(-1.0 / det * q.det(0, 1, 3, 1, 4, 6, 2, 5, 8));
+    const auto middle = vertex1.position.add(vertex2.position).scaleInPlace(0.5f);
+    if (Vector3::DistanceSquared(pointResult, middle)
+        <= Vector3::DistanceSquared(vertex1.position, vertex2.position)) {
+      return q.vertexError(pointResult.x, pointResult.y, pointResult.z);
+    }
+  }
+
+  // Best of the end points and the middle of the edge
+  const auto middle = vertex1.position.add(vertex2.position).scaleInPlace(0.5f);
+  const auto error1 = q.vertexError(vertex1.position.x, vertex1.position.y, vertex1.position.z);
+  const auto error2 = q.vertexError(vertex2.position.x, vertex2.position.y, vertex2.position.z);
+  const auto error3 = q.vertexError(middle.x, middle.y, middle.z);
+  const auto error  = std::min({error1, error2, error3});
+  if (error == error1) {
+    pointResult.copyFrom(vertex1.position);
+  }
+  else if (error == error2) {
+    pointResult.copyFrom(vertex2.position);
+  }
+  else {
+    pointResult.copyFrom(middle);
+  }
+  return error;
+}
+
+bool QuadraticErrorSimplification::_isFlipped(const DecimationVertex& vertex1, int index2,
+                                              const Vector3& point,
+                                              std::vector<bool>& deletedArray) const
+{
+  for (int i = 0; i < vertex1.triangleCount; ++i) {
+    const auto& reference = _references[static_cast<size_t>(vertex1.triangleStart + i)];
+    const auto& triangle  = _triangles[static_cast<size_t>(reference.triangleId)];
+    if (triangle.deleted) {
+      continue;
+    }
+
+    const auto s   = static_cast<size_t>(reference.vertexId);
+    const auto id1 = triangle.vertices[(s + 1) % 3];
+    const auto id2 = triangle.vertices[(s + 2) % 3];
+
+    // The triangle shares the collapsed edge and will be deleted
+    if (id1 == index2 || id2 == index2) {
+      deletedArray[static_cast<size_t>(i)] = true;
+      continue;
+    }
+
+    auto d1 = _vertices[static_cast<size_t>(id1)].position.subtract(point);
+    d1.normalize();
+    auto d2 = _vertices[static_cast<size_t>(id2)].position.subtract(point);
+    d2.normalize();
+    if (std::abs(Vector3::Dot(d1, d2)) > 0.999f) {
+      return true;
+    }
+    auto normal = Vector3::Cross(d1, d2);
+    normal.normalize();
+    deletedArray[static_cast<size_t>(i)] = false;
+    if (Vector3::Dot(normal, triangle.normal) < 0.2f) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+void QuadraticErrorSimplification::_updateTriangles(int origVertexIndex,
+                                                    const DecimationVertex& vertex,
+                                                    const std::vector<bool>& deletedArray,
+                                                    size_t& deletedTriangles)
+{
+  Vector3 point;
+  for (int i = 0; i < vertex.triangleCount; ++i) {
+    const auto reference = _references[static_cast<size_t>(vertex.triangleStart + i)];
+    auto& triangle       = _triangles[static_cast<size_t>(reference.triangleId)];
+    if (triangle.deleted) {
+      continue;
+    }
+
+    if (deletedArray[static_cast<size_t>(i)]) {
+      triangle.deleted = true;
+      ++deletedTriangles;
+      continue;
+    }
+
+    triangle.vertices[static_cast<size_t>(reference.vertexId)] = origVertexIndex;
+    triangle.isDirty                                          = true;
+    for (unsigned int j = 0; j < 3; ++j) {
+      triangle.error[j] = _calculateError(_vertices[triangle.vertices[j]],
+                                          _vertices[triangle.vertices[(j + 1) % 3]], point);
+    }
+    triangle.error[3] = std::min({triangle.error[0], triangle.error[1], triangle.error[2]});
+    _references.emplace_back(reference);
+  }
+}
+
+void QuadraticErrorSimplification::_interpolateAttributes(int index1, int index2, float amount)
+{
+  const auto vertexCount = _vertices.size();
+  const auto offset1     = static_cast<size_t>(index1);
+  const auto offset2     = static_cast<size_t>(index2);
+
+  const auto lerp = [&](Float32Array& data, size_t size, size_t normalizedSize) {
+    if (data.size() != vertexCount * size) {
+      return;
+    }
+    auto* values1       = data.data() + offset1 * size;
+    const auto* values2 = data.data() + offset2 * size;
+    for (size_t i = 0; i < size; ++i) {
+      values1[i] += (values2[i] - values1[i]) * amount;
+    }
+    if (normalizedSize > 0) {
+      auto length = 0.f;
+      for (size_t i = 0; i < normalizedSize; ++i) {
+        length += values1[i] * values1[i];
+      }
+      if (length > 0.f) {
+        length = 1.f / std::sqrt(length);
+        for (size_t i = 0; i < normalizedSize; ++i) {
+          values1[i] *= length;
+        }
+      }
+    }
+  };
+
+  lerp(_vertexData->normals, 3, 3);
+  lerp(_vertexData->tangents, 4, 3);
+  for (auto uvs : {&_vertexData->uvs, &_vertexData->uvs2, &_vertexData->uvs3, &_vertexData->uvs4,
+                   &_vertexData->uvs5, &_vertexData->uvs6}) {
+    lerp(*uvs, 2, 0);
+  }
+  lerp(_vertexData->colors, 4, 0);
+
+  // Bone influences cannot be interpolated, the ones of the closest vertex are used
+  if (amount > 0.5f) {
+    for (auto data : {&_vertexData->matricesIndices, &_vertexData->matricesWeights,
+                      &_vertexData->matricesIndicesExtra, &_vertexData->matricesWeightsExtra}) {
+      if (data->size() == vertexCount * 4) {
+        std::copy(data->begin() + static_cast<std::ptrdiff_t>(offset2 * 4),
+                  data->begin() + static_cast<std::ptrdiff_t>(offset2 * 4 + 4),
+                  data->begin() + static_cast<std::ptrdiff_t>(offset1 * 4));
+      }
+    }
+  }
+}
+
+std::unique_ptr<VertexData>
+QuadraticErrorSimplification::_reconstructMesh(IndicesArray& subMeshIndexCounts)
+{
+  const auto vertexCount = _vertices.size();
+  auto result            = std::make_unique<VertexData>();
+
+  // Vertices are numbered in the order of first use
+  IndicesArray newIndices(vertexCount, std::numeric_limits<uint32_t>::max());
+  IndicesArray usedVertices;
+  std::fill(subMeshIndexCounts.begin(), subMeshIndexCounts.end(), 0u);
+  for (const auto& triangle : _triangles) {
+    if (triangle.deleted) {
+      continue;
+    }
+    for (const auto vertexIndex : triangle.vertices) {
+      auto& newIndex = newIndices[static_cast<size_t>(vertexIndex)];
+      if (newIndex == std::numeric_limits<uint32_t>::max()) {
+        newIndex = static_cast<uint32_t>(usedVertices.size());
+        usedVertices.emplace_back(static_cast<uint32_t>(vertexIndex));
+      }
+      result->indices.emplace_back(newIndex);
+    }
+    if (triangle.subMeshIndex < subMeshIndexCounts.size()) {
+      subMeshIndexCounts[triangle.subMeshIndex] += 3;
+    }
+  }
+
+  result->positions.reserve(usedVertices.size() * 3);
+  for (const auto vertexIndex : usedVertices) {
+    const auto& position = _vertices[vertexIndex].position;
+    result->positions.insert(result->positions.end(), {position.x, position.y, position.z});
+  }
+
+  for (auto kind : {&VertexData::normals, &VertexData::tangents, &VertexData::uvs,
+                    &VertexData::uvs2, &VertexData::uvs3, &VertexData::uvs4, &VertexData::uvs5,
+                    &VertexData::uvs6, &VertexData::colors, &VertexData::matricesIndices,
+                    &VertexData::matricesWeights, &VertexData::matricesIndicesExtra,
+                    &VertexData::matricesWeightsExtra}) {
+    const auto& data = (*_vertexData).*kind;
+    if (data.empty() || data.size() % vertexCount != 0) {
+      continue;
+    }
+    const auto size = data.size() / vertexCount;
+    auto& newData   = (*result).*kind;
+    newData.resize(usedVertices.size() * size);
+    for (size_t i = 0; i < usedVertices.size(); ++i) {
+      std::copy(data.begin() + static_cast<std::ptrdiff_t>(usedVertices[i] * size),
+                data.begin() + static_cast<std::ptrdiff_t>((usedVertices[i] + 1) * size),
+                newData.begin() + static_cast<std::ptrdiff_t>(i * size));
+    }
+  }
+
+  return result;
+}
+
+} // end of namespace BABYLON
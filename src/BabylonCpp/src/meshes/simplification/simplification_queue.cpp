@@ -1,9 +1,28 @@
 #include <babylon/meshes/simplification/simplification_queue.h>
 
+#include <algorithm>
+#include <chrono>
+
+#include <babylon/core/thread_pool.h>
+#include <babylon/engines/engine.h>
+#include <babylon/engines/scene.h>
+#include <babylon/meshes/mesh.h>
+#include <babylon/meshes/simplification/quadratic_error_simplification.h>
 #include <babylon/meshes/simplification/simplification_settings.h>
+#include <babylon/meshes/sub_mesh.h>
+#include <babylon/meshes/vertex_data.h>
 
 namespace BABYLON {
 
+/**
+ * @brief Hidden
+ */
+struct _SimplificationResult {
+  std::unique_ptr<VertexData> vertexData = nullptr;
+  IndicesArray subMeshIndexCounts;
+  IndicesArray materialIndices;
+}; // end of struct _SimplificationResult
+
 SimplificationQueue::SimplificationQueue() : running{false}
 {
 }
@@ -18,8 +37,8 @@ void SimplificationQueue::addTask(const ISimplificationTask& task)
 void SimplificationQueue::executeNext()
 {
   if (!_simplificationQueue.empty()) {
-    running                         = true;
-    const ISimplificationTask& task = _simplificationQueue.front();
+    running                        = true;
+    const ISimplificationTask task = _simplificationQueue.front();
     _simplificationQueue.pop();
     runSimplification(task);
   }
@@ -28,18 +47,146 @@ void SimplificationQueue::executeNext()
   }
 }
 
-void SimplificationQueue::runSimplification(const ISimplificationTask& /*task*/)
+void SimplificationQueue::runSimplification(const ISimplificationTask& task)
 {
+  auto mesh = task.mesh;
+  std::shared_ptr<VertexData> vertexData
+    = mesh && !task.settings.empty() ? VertexData::ExtractFromMesh(mesh, true, true) : nullptr;
+  if (!vertexData || vertexData->indices.empty()) {
+    if (task.successCallback) {
+      task.successCallback();
+    }
+    executeNext();
+    return;
+  }
+
+  // The submeshes are kept when they split the index buffer in consecutive ranges
+  auto subMeshes = mesh->subMeshes;
+  std::sort(subMeshes.begin(), subMeshes.end(),
+            [](const SubMeshPtr& a, const SubMeshPtr& b) { return a->indexStart < b->indexStart; });
+  IndicesArray subMeshIndexCounts;
+  IndicesArray materialIndices;
+  size_t indexEnd = 0;
+  for (const auto& subMesh : subMeshes) {
+    if (subMesh->indexStart != indexEnd) {
+      break;
+    }
+    subMeshIndexCounts.emplace_back(static_cast<uint32_t>(subMesh->indexCount));
+    materialIndices.emplace_back(subMesh->materialIndex);
+    indexEnd += subMesh->indexCount;
+  }
+  if (indexEnd != vertexData->indices.size() || subMeshIndexCounts.size() != subMeshes.size()) {
+    subMeshIndexCounts.clear();
+    materialIndices.clear();
+  }
+
+  _runningTask = task;
+  _runningMesh = mesh->shared_from_base<Mesh>();
+  _runningJobs.clear();
+  _runningResults.clear();
+  for (size_t i = 0; i < task.settings.size(); ++i) {
+    auto result                = std::make_shared<_SimplificationResult>();
+    result->subMeshIndexCounts = subMeshIndexCounts;
+    result->materialIndices    = materialIndices;
+    _runningResults.emplace_back(std::move(result));
+  }
+
+  // The simplifications only use copies of the mesh data and run on the engine thread pool
+  auto& threadPool = mesh->getScene()->getEngine()->getThreadPool();
+  if (task.parallelProcessing) {
+    for (size_t i = 0; i < task.settings.size(); ++i) {
+      std::shared_ptr<ISimplifier> simplifier = getSimplifier(task);
+      _runningJobs.emplace_back(threadPool.enqueue(
+        [simplifier, vertexData, settings = task.settings[i], result = _runningResults[i]]() {
+          result->vertexData
+            = simplifier->simplify(*vertexData, result->subMeshIndexCounts, settings);
+        }));
+    }
+  }
+  else {
+    std::shared_ptr<ISimplifier> simplifier = getSimplifier(task);
+    _runningJobs.emplace_back(threadPool.enqueue(
+      [simplifier, vertexData, settings = task.settings, results = _runningResults]() {
+        for (size_t i = 0; i < settings.size(); ++i) {
+          results[i]->vertexData
+            = simplifier->simplify(*vertexData, results[i]->subMeshIndexCounts, settings[i]);
+        }
+      }));
+  }
+}
+
+void SimplificationQueue::checkRunningTask(bool wait)
+{
+  if (!running || _runningJobs.empty()) {
+    return;
+  }
+
+  for (auto& job : _runningJobs) {
+    if (!wait && job.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+      return;
+    }
+  }
+  for (auto& job : _runningJobs) {
+    job.get();
+  }
+  _runningJobs.clear();
+
+  _addLODLevels();
+  _runningResults.clear();
+  _runningMesh.reset();
+
+  const auto successCallback = _runningTask.successCallback;
+  _runningTask               = ISimplificationTask{};
+  if (successCallback) {
+    successCallback();
+  }
+
+  executeNext();
+}
+
+void SimplificationQueue::_addLODLevels()
+{
+  auto mesh = _runningMesh.lock();
+  if (!mesh || mesh->isDisposed()) {
+    return;
+  }
+
+  for (size_t i = 0; i < _runningResults.size(); ++i) {
+    const auto& result = _runningResults[i];
+    if (!result->vertexData || result->vertexData->indices.empty()) {
+      continue;
+    }
+
+    auto simplifiedMesh = Mesh::New(mesh->name + "Decimated", mesh->getScene());
+    result->vertexData->applyToMesh(*simplifiedMesh);
+
+    if (result->subMeshIndexCounts.size() > 1) {
+      simplifiedMesh->releaseSubMeshes();
+      uint32_t indexStart = 0;
+      for (size_t j = 0; j < result->subMeshIndexCounts.size(); ++j) {
+        const auto indexCount = result->subMeshIndexCounts[j];
+        if (indexCount > 0) {
+          SubMesh::CreateFromIndices(result->materialIndices[j], indexStart, indexCount,
+                                     simplifiedMesh);
+        }
+        indexStart += indexCount;
+      }
+    }
+
+    simplifiedMesh->material         = mesh->material();
+    simplifiedMesh->parent           = mesh->parent();
+    simplifiedMesh->renderingGroupId = mesh->renderingGroupId();
+
+    mesh->addLODLevel(_runningTask.settings[i].distance, simplifiedMesh);
+  }
 }
 
-ISimplifier* SimplificationQueue::getSimplifier(const ISimplificationTask& task)
+std::unique_ptr<ISimplifier> SimplificationQueue::getSimplifier(const ISimplificationTask& task)
 {
   switch (task.simplificationType) {
     case SimplificationType::QUADRATIC:
     default:
-      // TODO FIXME
-      return nullptr;
-      // return new QuadraticErrorSimplification(task.mesh);
+      return std::make_unique<QuadraticErrorSimplification>();
   }
 }
 
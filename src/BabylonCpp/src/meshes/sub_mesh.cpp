@@ -43,6 +43,9 @@ SubMesh::SubMesh(unsigned int iMaterialIndex, unsigned int iVerticesStart, size_
     , _renderId{0}
     , _alphaIndex{0}
     , _distanceToCamera{0.f}
+    , _octreeSelectionGeneration{0}
+    , _autoInstances{nullptr}
+    , _meshletDrawRangesFrameId{-1}
     , _mainDrawWrapper{nullptr}
     , _mainDrawWrapperOverride{nullptr}
     , _boundingInfo{nullptr}
@@ -210,6 +213,11 @@ bool SubMesh::_IsMultiMaterial(const Material& material) const
 
 // Methods
 SubMesh& SubMesh::refreshBoundingInfo(const Float32Array& iData)
+{
+  return refreshBoundingInfo(VertexDataView::FromArray(iData, 3));
+}
+
+SubMesh& SubMesh::refreshBoundingInfo(const VertexDataView& iData)
 {
   _lastColliderWorldVertices.clear();
 
@@ -217,14 +225,22 @@ SubMesh& SubMesh::refreshBoundingInfo(const Float32Array& iData)
     return *this;
   }
 
-  auto data = !iData.empty() ? iData : _renderingMesh->getVerticesData(VertexBuffer::PositionKind);
+  // The positions which are not stored as floats are converted
+  Float32Array convertedData;
+  auto data
+    = !iData.empty() ? iData : _renderingMesh->getVerticesDataView(VertexBuffer::PositionKind);
+  if (data.empty()) {
+    convertedData = _renderingMesh->getVerticesData(VertexBuffer::PositionKind);
+    data          = VertexDataView::FromArray(convertedData, 3);
+  }
 
   if (data.empty()) {
     _boundingInfo = std::make_unique<BoundingInfo>(*_mesh->_boundingInfo);
     return *this;
   }
 
-  auto indices = _renderingMesh->getIndices();
+  // Read the geometry indices in place, this is called for each submesh
+  const auto& indices = _renderingMesh->geometry()->_indices;
   MinMax extend;
 
   // Is this the only submesh?
@@ -238,8 +254,8 @@ SubMesh& SubMesh::refreshBoundingInfo(const Float32Array& iData)
     };
   }
   else {
-    extend = extractMinAndMaxIndexed(data, indices, indexStart, indexCount,
-                                     *_renderingMesh->geometry()->boundingBias());
+    extend = extractMinAndMaxIndexed(data.data, indices, indexStart, indexCount,
+                                     _renderingMesh->geometry()->boundingBias(), data.stride);
   }
 
   if (_boundingInfo) {
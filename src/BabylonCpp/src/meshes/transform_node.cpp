@@ -10,6 +10,7 @@
 #include <babylon/engines/scene.h>
 #include <babylon/maths/tmp_vectors.h>
 #include <babylon/meshes/abstract_mesh.h>
+#include <babylon/meshes/transform_system.h>
 
 namespace BABYLON {
 
@@ -32,6 +33,9 @@ TransformNode::TransformNode(const std::string& iName, Scene* scene, bool isPure
     , _localMatrix{Matrix::Zero()}
     , _postMultiplyPivotMatrix{false}
     , _indexInSceneTransformNodesArray{-1}
+    , _deferWorldMatrixSideEffects{false}
+    , _transformSystemIndex{-1}
+    , _transformSystemGeneration{0}
     , position{this, &TransformNode::get_position, &TransformNode::set_position}
     , rotation{this, &TransformNode::get_rotation, &TransformNode::set_rotation}
     , scaling{this, &TransformNode::get_scaling, &TransformNode::set_scaling}
@@ -855,11 +859,46 @@ Matrix& TransformNode::computeWorldMatrix(bool force, bool /*useWasUpdatedFlag*/
   }
 
   const auto currentRenderId = getScene()->getRenderId();
-  if (!_isDirty && !force && isSynchronized()) {
-    _currentRenderId = currentRenderId;
-    return _worldMatrix;
+  auto transformSystem       = getScene()->getTransformSystem();
+  if (!_isDirty && !force) {
+    // The ancestors validated by the transform system did not change since its update
+    const auto synchronized = transformSystem && transformSystem->_isValidated(this) ?
+                                _isSynchronized() :
+                                isSynchronized();
+    if (synchronized) {
+      _currentRenderId = currentRenderId;
+      return _worldMatrix;
+    }
+  }
+
+  if (transformSystem) {
+    transformSystem->_onWorldMatrixUpdated(this);
+  }
+
+  return _updateWorldMatrix(force, currentRenderId);
+}
+
+bool TransformNode::_needsWorldMatrixUpdate(bool parentUpdated)
+{
+  if (_isWorldMatrixFrozen) {
+    return _isDirty;
+  }
+
+  if (parentUpdated || _isDirty) {
+    return true;
   }
 
+  // Re-parented, or parent updated outside of the pass since the last update of this node
+  if (_cache.parent != parent()) {
+    _cache.parent = parent();
+    return true;
+  }
+
+  return !_isSyncedWithParent() || !_isSynchronized();
+}
+
+Matrix& TransformNode::_updateWorldMatrix(bool force, int currentRenderId)
+{
   auto& camera = getScene()->activeCamera();
   const auto useBillboardPosition
     = (_billboardMode & TransformNode::BILLBOARDMODE_USE_POSITION) != 0;
@@ -1084,6 +1123,20 @@ Matrix& TransformNode::computeWorldMatrix(bool force, bool /*useWasUpdatedFlag*/
   return _worldMatrix;
 }
 
+bool TransformNode::_canComputeWorldMatrixConcurrently() const
+{
+  // Billboards and pivots use the shared temporary matrices, infinite distance nodes read the
+  // camera and observers run user code
+  return _billboardMode == TransformNode::BILLBOARDMODE_NONE && !_usePivotMatrix
+         && !_infiniteDistance && !_transformToBoneReferal
+         && !onAfterWorldMatrixUpdateObservable.hasObservers();
+}
+
+void TransformNode::_applyDeferredWorldMatrixSideEffects()
+{
+  _deferWorldMatrixSideEffects = false;
+}
+
 void TransformNode::resetLocalMatrix(bool independentOfChildren)
 {
   computeWorldMatrix();
@@ -0,0 +1,241 @@
+#include <babylon/meshes/transform_system.h>
+
+#include <algorithm>
+#include <limits>
+#include <unordered_map>
+
+#include <babylon/core/thread_pool.h>
+#include <babylon/engines/scene.h>
+#include <babylon/meshes/abstract_mesh.h>
+#include <babylon/meshes/transform_node.h>
+
+namespace BABYLON {
+
+TransformSystem::TransformSystem(Scene* scene)
+    : _scene{scene}
+    , _isHierarchyDirty{true}
+    , _isUpdating{false}
+    , _updatedCount{0}
+    , _generation{1}
+{
+  _onNewMeshAddedObserver = _scene->onNewMeshAddedObservable.add(
+    [this](AbstractMesh* /*mesh*/, EventState& /*es*/) { markHierarchyAsDirty(); });
+  _onMeshRemovedObserver = _scene->onMeshRemovedObservable.add(
+    [this](AbstractMesh* /*mesh*/, EventState& /*es*/) { markHierarchyAsDirty(); });
+  _onNewTransformNodeAddedObserver = _scene->onNewTransformNodeAddedObservable.add(
+    [this](TransformNode* /*node*/, EventState& /*es*/) { markHierarchyAsDirty(); });
+  _onTransformNodeRemovedObserver = _scene->onTransformNodeRemovedObservable.add(
+    [this](TransformNode* /*node*/, EventState& /*es*/) { markHierarchyAsDirty(); });
+}
+
+TransformSystem::~TransformSystem()
+{
+  _scene->onNewMeshAddedObservable.remove(_onNewMeshAddedObserver);
+  _scene->onMeshRemovedObservable.remove(_onMeshRemovedObserver);
+  _scene->onNewTransformNodeAddedObservable.remove(_onNewTransformNodeAddedObserver);
+  _scene->onTransformNodeRemovedObservable.remove(_onTransformNodeRemovedObserver);
+}
+
+void TransformSystem::markHierarchyAsDirty()
+{
+  _isHierarchyDirty = true;
+  ++_generation;
+}
+
+size_t TransformSystem::size() const
+{
+  return _nodes.size();
+}
+
+size_t TransformSystem::levelCount() const
+{
+  return _levelOffsets.empty() ? 0 : _levelOffsets.size() - 1;
+}
+
+size_t TransformSystem::updatedCount() const
+{
+  return _updatedCount;
+}
+
+bool TransformSystem::_isValidated(const TransformNode* node) const
+{
+  return node->_transformSystemGeneration == _generation;
+}
+
+void TransformSystem::_onWorldMatrixUpdated(const TransformNode* node)
+{
+  if (_isUpdating) {
+    return;
+  }
+
+  // Only the descendants of the node rely on its world matrix
+  const auto index = node->_transformSystemIndex;
+  if (index >= 0 && static_cast<size_t>(index) < _nodes.size() && _nodes[index] == node
+      && _hasChildren[static_cast<size_t>(index)]) {
+    ++_generation;
+  }
+}
+
+void TransformSystem::_rebuild()
+{
+  std::vector<TransformNode*> nodes;
+  nodes.reserve(_scene->transformNodes.size() + _scene->meshes.size());
+  for (const auto& transformNode : _scene->transformNodes) {
+    nodes.emplace_back(transformNode.get());
+  }
+  for (const auto& mesh : _scene->meshes) {
+    nodes.emplace_back(mesh.get());
+  }
+
+  std::unordered_map<Node*, size_t> indices;
+  indices.reserve(nodes.size());
+  for (size_t i = 0; i < nodes.size(); ++i) {
+    indices[nodes[i]] = i;
+  }
+
+  // Depth of each node in the tracked hierarchy (nodes with an untracked parent are roots)
+  constexpr auto unknownDepth = std::numeric_limits<size_t>::max();
+  std::vector<size_t> depths(nodes.size(), unknownDepth);
+  std::vector<size_t> chain;
+  size_t maxDepth = 0;
+  for (size_t i = 0; i < nodes.size(); ++i) {
+    auto index = i;
+    while (depths[index] == unknownDepth) {
+      chain.emplace_back(index);
+      auto it = nodes[index]->parent() ? indices.find(nodes[index]->parent()) : indices.end();
+      if (it == indices.end()) {
+        break;
+      }
+      index = it->second;
+    }
+    auto depth = depths[index] == unknownDepth ? 0 : depths[index] + 1;
+    for (auto it = chain.rbegin(); it != chain.rend(); ++it) {
+      if (depths[*it] == unknownDepth) {
+        depths[*it] = depth++;
+      }
+    }
+    maxDepth = std::max(maxDepth, depths[i]);
+    chain.clear();
+  }
+
+  // Counting sort by depth, preserving the scene order within a level
+  _levelOffsets.assign(nodes.empty() ? 1 : maxDepth + 2, 0);
+  for (const auto depth : depths) {
+    ++_levelOffsets[depth + 1];
+  }
+  for (size_t level = 1; level < _levelOffsets.size(); ++level) {
+    _levelOffsets[level] += _levelOffsets[level - 1];
+  }
+
+  std::vector<size_t> sortedIndices(nodes.size());
+  auto insertPositions = _levelOffsets;
+  for (size_t i = 0; i < nodes.size(); ++i) {
+    sortedIndices[i] = insertPositions[depths[i]]++;
+  }
+
+  _nodes.resize(nodes.size());
+  _parents.resize(nodes.size());
+  _parentIndices.resize(nodes.size());
+  _hasChildren.assign(nodes.size(), 0);
+  for (size_t i = 0; i < nodes.size(); ++i) {
+    const auto sortedIndex = sortedIndices[i];
+    auto iParent           = nodes[i]->parent();
+    _nodes[sortedIndex]    = nodes[i];
+    _parents[sortedIndex]  = iParent;
+    auto it                = iParent ? indices.find(iParent) : indices.end();
+    _parentIndices[sortedIndex]
+      = it == indices.end() ? -1 : static_cast<int>(sortedIndices[it->second]);
+    if (it != indices.end()) {
+      _hasChildren[sortedIndices[it->second]] = 1;
+    }
+    nodes[i]->_transformSystemIndex      = static_cast<int>(sortedIndex);
+    nodes[i]->_transformSystemGeneration = 0;
+  }
+
+  _updated.assign(_nodes.size(), 0);
+  _validated.assign(_nodes.size(), 0);
+  _isHierarchyDirty = false;
+}
+
+void TransformSystem::_updateExternalNode(size_t index)
+{
+  // Regular synchronization checks, used when the parent is not part of the tracked hierarchy
+  auto node             = _nodes[index];
+  const auto updateFlag = node->worldMatrixFromCache().updateFlag;
+  node->computeWorldMatrix();
+  _updated[index] = node->worldMatrixFromCache().updateFlag != updateFlag ? 1 : 0;
+  if (_updated[index]) {
+    ++_updatedCount;
+  }
+}
+
+void TransformSystem::update(ThreadPool* threadPool)
+{
+  _isUpdating = true;
+  ++_generation;
+  if (_isHierarchyDirty) {
+    _rebuild();
+  }
+
+  const auto renderId = _scene->getRenderId();
+  _updatedCount       = 0;
+
+  for (size_t level = 0; level + 1 < _levelOffsets.size(); ++level) {
+    _concurrentIndices.clear();
+    for (auto i = _levelOffsets[level]; i < _levelOffsets[level + 1]; ++i) {
+      auto node              = _nodes[i];
+      const auto parentIndex = _parentIndices[i];
+      _updated[i]            = 0;
+      _validated[i]          = 0;
+
+      // Disabled sub trees are left to computeWorldMatrix()
+      if (!node->isEnabled()) {
+        continue;
+      }
+
+      if (parentIndex < 0 && _parents[i]) {
+        _updateExternalNode(i);
+        continue;
+      }
+
+      const auto parent = static_cast<size_t>(parentIndex);
+      _validated[i]     = parentIndex < 0 || _validated[parent];
+      if (_validated[i]) {
+        node->_transformSystemGeneration = _generation;
+      }
+
+      const auto parentUpdated = parentIndex >= 0 && _updated[parent];
+      if (!node->_needsWorldMatrixUpdate(parentUpdated)) {
+        node->_currentRenderId = renderId;
+        continue;
+      }
+
+      _updated[i] = 1;
+      ++_updatedCount;
+      if (threadPool && node->_canComputeWorldMatrixConcurrently()) {
+        node->_deferWorldMatrixSideEffects = true;
+        _concurrentIndices.emplace_back(i);
+      }
+      else {
+        node->_updateWorldMatrix(false, renderId);
+      }
+    }
+
+    if (threadPool) {
+      threadPool->parallelFor(_concurrentIndices.size(), 64,
+                              [this, renderId](size_t /*chunkIndex*/, size_t begin, size_t end) {
+                                for (auto i = begin; i < end; ++i) {
+                                  _nodes[_concurrentIndices[i]]->_updateWorldMatrix(false,
+                                                                                    renderId);
+                                }
+                              });
+      for (const auto i : _concurrentIndices) {
+        _nodes[i]->_applyDeferredWorldMatrixSideEffects();
+      }
+    }
+  }
+
+  _isUpdating = false;
+}
+
+} // end of namespace BABYLON
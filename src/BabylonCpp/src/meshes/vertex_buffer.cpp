@@ -135,7 +135,7 @@ Float32Array& VertexBuffer::getData()
 
 Float32Array VertexBuffer::getFloatData(size_t totalVertices, const std::optional<bool>& forceCopy)
 {
-  auto data = getData();
+  const auto& data = getData();
   if (data.empty()) {
     return Float32Array();
   }
@@ -156,6 +156,49 @@ Float32Array VertexBuffer::getFloatData(size_t totalVertices, const std::optiona
   return data;
 }
 
+VertexDataView VertexBuffer::getFloatDataView(size_t totalVertices) const
+{
+  // The offset and stride of the other types are not expressed in floats, their data has to be
+  // converted by getFloatData
+  if (type != VertexBuffer::FLOAT) {
+    return VertexDataView{};
+  }
+
+  const auto& data   = _getBuffer()->_data;
+  const auto offset  = byteOffset / sizeof(float);
+  const auto stride  = byteStride / sizeof(float);
+  const auto size    = getSize();
+  const auto maxSize = totalVertices == 0 ? 0 : offset + (totalVertices - 1) * stride + size;
+  if (data.empty() || totalVertices == 0 || data.size() < maxSize) {
+    return VertexDataView{};
+  }
+
+  return VertexDataView{data.data() + offset, totalVertices, size, stride, type};
+}
+
+MutableVertexDataView VertexBuffer::mapFloatDataForWrite(size_t totalVertices)
+{
+  const auto view = getFloatDataView(totalVertices);
+  if (view.empty()) {
+    return MutableVertexDataView{};
+  }
+
+  auto buffer = _getBuffer();
+  buffer->_markDataAsDirty();
+  return MutableVertexDataView{buffer->_data.data() + byteOffset / sizeof(float), view.count,
+                               view.size, view.stride, view.type};
+}
+
+bool VertexBuffer::_isDataDirty() const
+{
+  return _getBuffer()->_isDataDirty();
+}
+
+void VertexBuffer::_uploadDirtyData()
+{
+  _getBuffer()->_uploadDirtyData();
+}
+
 WebGLDataBufferPtr& VertexBuffer::getBuffer()
 {
   return _getBuffer()->getBuffer();
@@ -1,5 +1,10 @@
 #include <babylon/meshes/vertex_data.h>
 
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
 #include <babylon/babylon_stl_util.h>
 #include <babylon/core/json_util.h>
 #include <babylon/core/logging.h>
@@ -342,6 +347,247 @@ Float32Array VertexData::_mergeElement(const Float32Array& source, const Float32
   return ret32;
 }
 
+namespace {
+
+constexpr uint32_t WeldInvalidVertex = std::numeric_limits<uint32_t>::max();
+
+/**
+ * Open addressing hash table mapping a spatial hash cell to the first welded vertex of the cell,
+ * the other vertices of the cell are chained.
+ */
+class WeldSpatialHash {
+
+public:
+  explicit WeldSpatialHash(size_t vertexCount)
+  {
+    size_t capacity = 16;
+    while (capacity < vertexCount * 2) {
+      capacity *= 2;
+    }
+    _keys.resize(capacity);
+    _heads.resize(capacity, WeldInvalidVertex);
+    _next.reserve(vertexCount);
+  }
+
+  [[nodiscard]] uint32_t first(uint64_t key) const
+  {
+    return _heads[_find(key)];
+  }
+
+  [[nodiscard]] uint32_t next(uint32_t vertex) const
+  {
+    return _next[vertex];
+  }
+
+  // Vertices are added in increasing order (0, 1, 2, ...)
+  void add(uint64_t key, uint32_t vertex)
+  {
+    const auto slot = _find(key);
+    _keys[slot]     = key;
+    _next.emplace_back(_heads[slot]);
+    _heads[slot] = vertex;
+  }
+
+private:
+  [[nodiscard]] size_t _find(uint64_t key) const
+  {
+    const auto mask = _keys.size() - 1;
+    auto slot       = static_cast<size_t>((key * 0x9E3779B97F4A7C15ull) >> 32) & mask;
+    while (_heads[slot] != WeldInvalidVertex && _keys[slot] != key) {
+      slot = (slot + 1) & mask;
+    }
+    return slot;
+  }
+
+private:
+  std::vector<uint64_t> _keys;
+  std::vector<uint32_t> _heads;
+  std::vector<uint32_t> _next;
+
+}; // end of class WeldSpatialHash
+
+uint64_t WeldCellKey(int64_t x, int64_t y, int64_t z)
+{
+  // 21 bits per axis, distant cells sharing a key only cost extra comparisons
+  constexpr uint64_t mask = 0x1FFFFFull;
+  return (static_cast<uint64_t>(x) & mask) << 42 | (static_cast<uint64_t>(y) & mask) << 21
+         | (static_cast<uint64_t>(z) & mask);
+}
+
+} // end of anonymous namespace
+
+VertexData& VertexData::weld(const VertexWeldOptions& options, IndicesArray* subMeshIndexCounts)
+{
+  const auto vertexCount = positions.size() / 3;
+  if (vertexCount == 0 || indices.empty()) {
+    return *this;
+  }
+
+  // Attributes that must match for two vertices to be welded
+  std::vector<std::pair<const Float32Array*, size_t>> comparedAttributes;
+  const auto compareAttribute = [&](const Float32Array& data, size_t size) {
+    if (data.size() == vertexCount * size) {
+      comparedAttributes.emplace_back(&data, size);
+    }
+  };
+  if (options.compareNormals) {
+    compareAttribute(normals, 3);
+  }
+  if (options.compareUVs) {
+    for (const auto uvSet : {&uvs, &uvs2, &uvs3, &uvs4, &uvs5, &uvs6}) {
+      compareAttribute(*uvSet, 2);
+    }
+  }
+  if (options.compareColors) {
+    compareAttribute(colors, 4);
+  }
+
+  // Group (submesh) of each index
+  const auto weldAcrossGroups = options.weldAcrossSubMeshes || !subMeshIndexCounts;
+  IndicesArray groupEnds;
+  if (subMeshIndexCounts) {
+    uint32_t end = 0;
+    for (const auto count : *subMeshIndexCounts) {
+      end += count;
+      groupEnds.emplace_back(end);
+    }
+  }
+
+  // Cells are twice as large as epsilon: a position within epsilon of another one is in the same
+  // cell or in the neighbor cell on the side it is the closest to, so 8 cells are visited
+  const auto exact       = !(options.epsilon > 0.f);
+  const auto invCellSize = exact ? 0.f : 0.5f / options.epsilon;
+
+  const auto matches = [&](uint32_t a, uint32_t b) {
+    for (size_t component = 0; component < 3; ++component) {
+      const auto delta = std::abs(positions[a * 3 + component] - positions[b * 3 + component]);
+      if (exact ? delta != 0.f : delta > options.epsilon) {
+        return false;
+      }
+    }
+    for (const auto& attribute : comparedAttributes) {
+      const auto& data = *attribute.first;
+      const auto size  = attribute.second;
+      for (size_t component = 0; component < size; ++component) {
+        if (std::abs(data[a * size + component] - data[b * size + component])
+            > options.attributeEpsilon) {
+          return false;
+        }
+      }
+    }
+    return true;
+  };
+
+  WeldSpatialHash spatialHash(vertexCount);
+  IndicesArray weldedSources; // original vertex of each welded vertex
+  IndicesArray weldedGroups;  // group of each welded vertex
+  IndicesArray remap(vertexCount, WeldInvalidVertex);
+  IndicesArray remapGroups(vertexCount, 0);
+  weldedSources.reserve(vertexCount);
+
+  IndicesArray weldedIndices(indices.size());
+  uint32_t group = 0;
+  for (size_t index = 0; index < indices.size(); ++index) {
+    while (group < groupEnds.size() && index >= groupEnds[group]) {
+      ++group;
+    }
+
+    const auto vertex = indices[index];
+    if (remap[vertex] != WeldInvalidVertex && (weldAcrossGroups || remapGroups[vertex] == group)) {
+      weldedIndices[index] = remap[vertex];
+      continue;
+    }
+
+    std::array<int64_t, 3> cell{};
+    std::array<int64_t, 3> side{};
+    for (size_t component = 0; component < 3; ++component) {
+      // + 0.f turns -0.f into 0.f
+      const auto value = positions[vertex * 3 + component] + 0.f;
+      if (exact) {
+        uint32_t bits = 0;
+        std::memcpy(&bits, &value, sizeof(bits));
+        cell[component] = bits;
+      }
+      else {
+        const auto scaled = value * invCellSize;
+        const auto floor  = std::floor(scaled);
+        cell[component]   = static_cast<int64_t>(floor);
+        side[component]   = scaled - floor < 0.5f ? -1 : 1;
+      }
+    }
+
+    auto welded = WeldInvalidVertex;
+    for (uint32_t neighbor = 0; neighbor < (exact ? 1u : 8u) && welded == WeldInvalidVertex;
+         ++neighbor) {
+      const auto key = WeldCellKey(cell[0] + ((neighbor & 1) ? side[0] : 0),
+                                   cell[1] + ((neighbor & 2) ? side[1] : 0),
+                                   cell[2] + ((neighbor & 4) ? side[2] : 0));
+      for (auto candidate = spatialHash.first(key); candidate != WeldInvalidVertex;
+           candidate      = spatialHash.next(candidate)) {
+        if ((weldAcrossGroups || weldedGroups[candidate] == group)
+            && matches(weldedSources[candidate], vertex)) {
+          welded = candidate;
+          break;
+        }
+      }
+    }
+
+    if (welded == WeldInvalidVertex) {
+      welded = static_cast<uint32_t>(weldedSources.size());
+      weldedSources.emplace_back(vertex);
+      weldedGroups.emplace_back(group);
+      spatialHash.add(WeldCellKey(cell[0], cell[1], cell[2]), welded);
+    }
+
+    remap[vertex]        = welded;
+    remapGroups[vertex]  = group;
+    weldedIndices[index] = welded;
+  }
+
+  // Collapsed triangles
+  if (options.removeDegenerateTriangles) {
+    size_t writeIndex = 0;
+    group             = 0;
+    for (size_t index = 0; index + 2 < weldedIndices.size(); index += 3) {
+      while (group < groupEnds.size() && index >= groupEnds[group]) {
+        ++group;
+      }
+      const auto a = weldedIndices[index], b = weldedIndices[index + 1],
+                 c = weldedIndices[index + 2];
+      if (a == b || b == c || a == c) {
+        if (subMeshIndexCounts && group < subMeshIndexCounts->size()) {
+          (*subMeshIndexCounts)[group] -= 3;
+        }
+        continue;
+      }
+      weldedIndices[writeIndex++] = a;
+      weldedIndices[writeIndex++] = b;
+      weldedIndices[writeIndex++] = c;
+    }
+    weldedIndices.resize(writeIndex);
+  }
+
+  // Per vertex data of the welded vertices (the first vertex of each cluster is kept)
+  for (auto data : {&positions, &normals, &tangents, &uvs, &uvs2, &uvs3, &uvs4, &uvs5, &uvs6,
+                    &colors, &matricesIndices, &matricesWeights, &matricesIndicesExtra,
+                    &matricesWeightsExtra}) {
+    if (data->empty() || data->size() % vertexCount != 0) {
+      continue;
+    }
+    const auto size = data->size() / vertexCount;
+    Float32Array weldedData(weldedSources.size() * size);
+    for (size_t welded = 0; welded < weldedSources.size(); ++welded) {
+      std::copy(data->begin() + static_cast<std::ptrdiff_t>(weldedSources[welded] * size),
+                data->begin() + static_cast<std::ptrdiff_t>((weldedSources[welded] + 1) * size),
+                weldedData.begin() + static_cast<std::ptrdiff_t>(welded * size));
+    }
+    *data = std::move(weldedData);
+  }
+  indices = std::move(weldedIndices);
+
+  return *this;
+}
+
 void VertexData::_validate()
 {
   if (positions.empty()) {
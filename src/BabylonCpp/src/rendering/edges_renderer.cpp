@@ -357,8 +357,14 @@ void EdgesRenderer::_tessellateTriangle(
 
 void EdgesRenderer::_generateEdgesLinesAlternate()
 {
-  const auto positions = _source->getVerticesData(VertexBuffer::PositionKind);
-  auto indices         = _source->getIndices();
+  // The positions are read in place, the positions which are not stored as floats are converted
+  Float32Array convertedPositions;
+  auto positions = _source->getVerticesDataView(VertexBuffer::PositionKind);
+  if (positions.empty()) {
+    convertedPositions = _source->getVerticesData(VertexBuffer::PositionKind);
+    positions          = VertexDataView::FromArray(convertedPositions, 3);
+  }
+  auto indices = _source->getIndices();
 
   if (indices.empty() || positions.empty()) {
     return;
@@ -384,8 +390,8 @@ void EdgesRenderer::_generateEdgesLinesAlternate()
 
   if (useFastVertexMerger) {
     std::unordered_map<std::string, uint32_t> mapVertices;
-    for (auto v1 = 0u; v1 < positions.size(); v1 += 3) {
-      const auto x1 = positions[v1 + 0], y1 = positions[v1 + 1], z1 = positions[v1 + 2];
+    for (auto v1 = 0u; v1 < positions.count; ++v1) {
+      const auto x1 = positions[v1][0], y1 = positions[v1][1], z1 = positions[v1][2];
 
       const auto key
         = StringTools::printf("%f|%f|%f", toFixed(x1, epsVertexMerge), toFixed(y1, epsVertexMerge),
@@ -395,7 +401,7 @@ void EdgesRenderer::_generateEdgesLinesAlternate()
         remapVertexIndices.emplace_back(mapVertices[key]);
       }
       else {
-        const auto idx   = v1 / 3u;
+        const auto idx   = v1;
         mapVertices[key] = idx;
         remapVertexIndices.emplace_back(idx);
         uniquePositions.emplace_back(idx);
@@ -403,23 +409,23 @@ void EdgesRenderer::_generateEdgesLinesAlternate()
     }
   }
   else {
-    for (auto v1 = 0u; v1 < positions.size(); v1 += 3) {
-      const auto x1 = positions[v1 + 0], y1 = positions[v1 + 1], z1 = positions[v1 + 2];
+    for (auto v1 = 0u; v1 < positions.count; ++v1) {
+      const auto x1 = positions[v1][0], y1 = positions[v1][1], z1 = positions[v1][2];
       auto found = false;
-      for (auto v2 = 0u; v2 < v1 && !found; v2 += 3) {
-        const auto x2 = positions[v2 + 0], y2 = positions[v2 + 1], z2 = positions[v2 + 2];
+      for (auto v2 = 0u; v2 < v1 && !found; ++v2) {
+        const auto x2 = positions[v2][0], y2 = positions[v2][1], z2 = positions[v2][2];
 
         if (std::abs(x1 - x2) < epsVertexMerge && std::abs(y1 - y2) < epsVertexMerge
             && std::abs(z1 - z2) < epsVertexMerge) {
-          remapVertexIndices.emplace_back(v2 / 3u);
+          remapVertexIndices.emplace_back(v2);
           found = true;
           break;
         }
       }
 
       if (!found) {
-        remapVertexIndices.emplace_back(v1 / 3u);
-        uniquePositions.emplace_back(v1 / 3u);
+        remapVertexIndices.emplace_back(v1);
+        uniquePositions.emplace_back(v1);
       }
     }
   }
@@ -467,10 +473,10 @@ void EdgesRenderer::_generateEdgesLinesAlternate()
           continue;
         } // degenerated triangle - don't process
 
-        const auto p0x = positions[p0Index * 3 + 0], p0y = positions[p0Index * 3 + 1],
-                   p0z = positions[p0Index * 3 + 2];
-        const auto p1x = positions[p1Index * 3 + 0], p1y = positions[p1Index * 3 + 1],
-                   p1z = positions[p1Index * 3 + 2];
+        const auto p0x = positions[p0Index][0], p0y = positions[p0Index][1],
+                   p0z = positions[p0Index][2];
+        const auto p1x = positions[p1Index][0], p1y = positions[p1Index][1],
+                   p1z = positions[p1Index][2];
 
         const auto p0p1 = std::sqrt((p1x - p0x) * (p1x - p0x) + (p1y - p0y) * (p1y - p0y)
                                     + (p1z - p0z) * (p1z - p0z));
@@ -484,8 +490,7 @@ void EdgesRenderer::_generateEdgesLinesAlternate()
             continue;
           } // don't handle the vertex if it is a vertex of the current triangle
 
-          const auto x = positions[vIndex * 3 + 0], y = positions[vIndex * 3 + 1],
-                     z = positions[vIndex * 3 + 2];
+          const auto x = positions[vIndex][0], y = positions[vIndex][1], z = positions[vIndex][2];
 
           const auto p0p
             = std::sqrt((x - p0x) * (x - p0x) + (y - p0y) * (y - p0y) + (z - p0z) * (z - p0z));
@@ -539,12 +544,9 @@ void EdgesRenderer::_generateEdgesLinesAlternate()
         continue;
       }
 
-      TmpVectors::Vector3Array[0].copyFromFloats(
-        positions[p0Index * 3 + 0], positions[p0Index * 3 + 1], positions[p0Index * 3 + 2]);
-      TmpVectors::Vector3Array[1].copyFromFloats(
-        positions[p1Index * 3 + 0], positions[p1Index * 3 + 1], positions[p1Index * 3 + 2]);
-      TmpVectors::Vector3Array[2].copyFromFloats(
-        positions[p2Index * 3 + 0], positions[p2Index * 3 + 1], positions[p2Index * 3 + 2]);
+      TmpVectors::Vector3Array[0].copyFrom(positions.getVector3(p0Index));
+      TmpVectors::Vector3Array[1].copyFrom(positions.getVector3(p1Index));
+      TmpVectors::Vector3Array[2].copyFrom(positions.getVector3(p2Index));
 
       if (!faceNormal) {
         TmpVectors::Vector3Array[1].subtractToRef(TmpVectors::Vector3Array[0],
@@ -594,10 +596,8 @@ void EdgesRenderer::_generateEdgesLinesAlternate()
       const auto p0Index = remapVertexIndices[indices[ei.index + ei.i]];
       const auto p1Index = remapVertexIndices[indices[ei.index + (ei.i + 1) % 3]];
 
-      TmpVectors::Vector3Array[0].copyFromFloats(
-        positions[p0Index * 3 + 0], positions[p0Index * 3 + 1], positions[p0Index * 3 + 2]);
-      TmpVectors::Vector3Array[1].copyFromFloats(
-        positions[p1Index * 3 + 0], positions[p1Index * 3 + 1], positions[p1Index * 3 + 2]);
+      TmpVectors::Vector3Array[0].copyFrom(positions.getVector3(p0Index));
+      TmpVectors::Vector3Array[1].copyFrom(positions.getVector3(p1Index));
 
       createLine(TmpVectors::Vector3Array[0], TmpVectors::Vector3Array[1],
                  static_cast<uint32_t>(_linesPositions.size() / 3));
@@ -624,8 +624,14 @@ void EdgesRenderer::_generateEdgesLinesAlternate()
 
 void EdgesRenderer::_generateEdgesLines()
 {
-  auto positions = _source->getVerticesData(VertexBuffer::PositionKind);
-  auto indices   = _source->getIndices();
+  // The positions are read in place, the positions which are not stored as floats are converted
+  Float32Array convertedPositions;
+  auto positions = _source->getVerticesDataView(VertexBuffer::PositionKind);
+  if (positions.empty()) {
+    convertedPositions = _source->getVerticesData(VertexBuffer::PositionKind);
+    positions          = VertexDataView::FromArray(convertedPositions, 3);
+  }
+  auto indices = _source->getIndices();
 
   if (indices.empty() || positions.empty()) {
     return;
@@ -644,12 +650,9 @@ void EdgesRenderer::_generateEdgesLines()
 
     _faceAdjacencies.edges = {0, 0, 0};
 
-    _faceAdjacencies.p0
-      = Vector3(positions[p0Index * 3 + 0], positions[p0Index * 3 + 1], positions[p0Index * 3 + 2]);
-    _faceAdjacencies.p1
-      = Vector3(positions[p1Index * 3 + 0], positions[p1Index * 3 + 1], positions[p1Index * 3 + 2]);
-    _faceAdjacencies.p2
-      = Vector3(positions[p2Index * 3 + 0], positions[p2Index * 3 + 1], positions[p2Index * 3 + 2]);
+    _faceAdjacencies.p0 = positions.getVector3(p0Index);
+    _faceAdjacencies.p1 = positions.getVector3(p1Index);
+    _faceAdjacencies.p2 = positions.getVector3(p2Index);
     auto faceNormal = Vector3::Cross(_faceAdjacencies.p1.subtract(_faceAdjacencies.p0),
                                      _faceAdjacencies.p2.subtract(_faceAdjacencies.p1));
 
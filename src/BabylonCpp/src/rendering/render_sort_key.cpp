@@ -0,0 +1,90 @@
+#include <babylon/rendering/render_sort_key.h>
+
+#include <algorithm>
+#include <array>
+
+namespace BABYLON {
+
+namespace {
+
+uint64_t Field(size_t value, unsigned int bits, unsigned int shift)
+{
+  return (static_cast<uint64_t>(value) & ((1ull << bits) - 1)) << shift;
+}
+
+uint64_t QuantizedDepth(float depth, unsigned int bits)
+{
+  const auto maxValue = static_cast<float>((1ull << bits) - 1);
+  return static_cast<uint64_t>(std::clamp(depth, 0.f, 1.f) * maxValue);
+}
+
+} // end of anonymous namespace
+
+uint64_t RenderSortKey::Opaque(uint32_t layer, uint32_t alphaMode, size_t effectId,
+                               size_t materialId, size_t vertexArrayId, float depth)
+{
+  return Field(layer, 8, 56)            //
+         | Field(alphaMode, 4, 52)      //
+         | Field(effectId, 14, 38)      //
+         | Field(materialId, 14, 24)    //
+         | Field(vertexArrayId, 12, 12) //
+         | QuantizedDepth(depth, 12);
+}
+
+uint64_t RenderSortKey::Transparent(uint32_t layer, float depth, uint32_t alphaMode,
+                                    size_t effectId, size_t materialId)
+{
+  const auto invertedDepth = ((1ull << 24) - 1) - QuantizedDepth(depth, 24);
+  return Field(layer, 8, 56)         //
+         | (invertedDepth << 32)     //
+         | Field(alphaMode, 4, 28)   //
+         | Field(effectId, 14, 14)   //
+         | Field(materialId, 14, 0);
+}
+
+void RenderSortKey::RadixSort(std::vector<RenderSortKey>& keys,
+                              std::vector<RenderSortKey>& scratch)
+{
+  const auto count = keys.size();
+  if (count < 2) {
+    return;
+  }
+
+  // Histograms of the 8 digits in a single pass
+  std::array<std::array<uint32_t, 256>, 8> histograms{};
+  for (const auto& key : keys) {
+    for (unsigned int digit = 0; digit < 8; ++digit) {
+      ++histograms[digit][(key.key >> (digit * 8)) & 0xFF];
+    }
+  }
+
+  scratch.resize(count);
+  auto* source      = &keys;
+  auto* destination = &scratch;
+  for (unsigned int digit = 0; digit < 8; ++digit) {
+    auto& histogram  = histograms[digit];
+    const auto shift = digit * 8;
+    // Every key has the same digit, the pass would not change the order
+    if (histogram[(source->front().key >> shift) & 0xFF] == count) {
+      continue;
+    }
+
+    uint32_t offset = 0;
+    for (auto& bucket : histogram) {
+      const auto bucketCount = bucket;
+      bucket                 = offset;
+      offset += bucketCount;
+    }
+
+    for (const auto& key : *source) {
+      (*destination)[histogram[(key.key >> shift) & 0xFF]++] = key;
+    }
+    std::swap(source, destination);
+  }
+
+  if (source != &keys) {
+    keys.swap(scratch);
+  }
+}
+
+} // end of namespace BABYLON
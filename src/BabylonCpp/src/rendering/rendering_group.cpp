@@ -1,5 +1,8 @@
 #include <babylon/rendering/rendering_group.h>
 
+#include <algorithm>
+#include <limits>
+
 #include <babylon/babylon_stl_util.h>
 #include <babylon/cameras/camera.h>
 #include <babylon/culling/bounding_info.h>
@@ -7,7 +10,9 @@
 #include <babylon/engines/constants.h>
 #include <babylon/engines/engine.h>
 #include <babylon/engines/scene.h>
+#include <babylon/materials/effect.h>
 #include <babylon/materials/material.h>
+#include <babylon/meshes/_instance_data_storage.h>
 #include <babylon/meshes/abstract_mesh.h>
 #include <babylon/meshes/sub_mesh.h>
 #include <babylon/particles/particle_system.h>
@@ -56,41 +61,22 @@ void RenderingGroup::set_opaqueSortCompareFn(
   const std::function<bool(const SubMesh* a, const SubMesh* b)>& value)
 {
   _opaqueSortCompareFn = value;
-  if (value) {
-    _renderOpaque
-      = [this](const std::vector<SubMesh*>& subMeshes) { renderOpaqueSorted(subMeshes); };
-  }
-  else {
-    _renderOpaque
-      = [](const std::vector<SubMesh*>& subMeshes) { RenderingGroup::renderUnsorted(subMeshes); };
-  }
+  _renderOpaque
+    = [this](const std::vector<SubMesh*>& subMeshes) { renderOpaqueSorted(subMeshes); };
 }
 
 void RenderingGroup::set_alphaTestSortCompareFn(
   const std::function<bool(const SubMesh* a, const SubMesh* b)>& value)
 {
   _alphaTestSortCompareFn = value;
-  if (value) {
-    _renderAlphaTest
-      = [this](const std::vector<SubMesh*>& subMeshes) { renderAlphaTestSorted(subMeshes); };
-  }
-  else {
-    _renderAlphaTest
-      = [](const std::vector<SubMesh*>& subMeshes) { RenderingGroup::renderUnsorted(subMeshes); };
-  }
+  _renderAlphaTest
+    = [this](const std::vector<SubMesh*>& subMeshes) { renderAlphaTestSorted(subMeshes); };
 }
 
 void RenderingGroup::set_transparentSortCompareFn(
   const std::function<bool(const SubMesh* a, const SubMesh* b)>& value)
 {
-  if (value) {
-    _transparentSortCompareFn = value;
-  }
-  else {
-    _transparentSortCompareFn = [](const SubMesh* a, const SubMesh* b) {
-      return RenderingGroup::defaultTransparentSortCompare(a, b);
-    };
-  }
+  _transparentSortCompareFn = value;
   _renderTransparent
     = [this](const std::vector<SubMesh*>& subMeshes) { renderTransparentSorted(subMeshes); };
 }
@@ -104,6 +90,12 @@ void RenderingGroup::render(
   bool renderSprites, bool renderParticles, const std::vector<AbstractMesh*>& activeMeshes)
 {
   if (customRenderFunction) {
+    if (!_autoInstances.empty()) {
+      customRenderFunction(_withAutoInstances(_opaqueSubMeshes),
+                           _withAutoInstances(_alphaTestSubMeshes), _transparentSubMeshes,
+                           _withAutoInstances(_depthOnlySubMeshes), nullptr);
+      return;
+    }
     customRenderFunction(_opaqueSubMeshes, _alphaTestSubMeshes, _transparentSubMeshes,
                          _depthOnlySubMeshes, nullptr);
     return;
@@ -192,20 +184,77 @@ void RenderingGroup::renderSorted(
   const CameraPtr& camera, bool transparent)
 {
   auto cameraPosition = camera ? camera->globalPosition() : RenderingGroup::_zeroVector;
+  auto maxDistance    = 0.f;
   for (const auto& subMesh : subMeshes) {
     subMesh->_alphaIndex = subMesh->getMesh()->alphaIndex;
     subMesh->_distanceToCamera
       = Vector3::Distance(subMesh->getBoundingInfo()->boundingSphere.centerWorld, cameraPosition);
+    maxDistance = std::max(maxDistance, subMesh->_distanceToCamera);
   }
 
-  auto sortedArray = subMeshes;
-
   // sort using a custom function object
   if (sortCompareFn) {
-    std::stable_sort(sortedArray.begin(), sortedArray.end(), sortCompareFn);
+    _sortedSubMeshes.assign(subMeshes.begin(), subMeshes.end());
+    std::stable_sort(_sortedSubMeshes.begin(), _sortedSubMeshes.end(), sortCompareFn);
   }
+  // sort by packed key
+  else {
+    const auto invMaxDistance = maxDistance > 0.f ? 1.f / maxDistance : 0.f;
+    auto alphaIndicesFitLayer = true;
+    _sortKeys.resize(subMeshes.size());
+    for (size_t i = 0; i < subMeshes.size(); ++i) {
+      const auto& subMesh    = subMeshes[i];
+      const auto material    = subMesh->getMaterial();
+      const auto& effect     = subMesh->effect();
+      const auto& mesh       = subMesh->getRenderingMesh();
+      // The alpha index is mapped to the 8 bits layer, the default (max) index is the last layer
+      const auto alphaIndex = subMesh->_alphaIndex;
+      uint32_t layer        = 0;
+      if (alphaIndex == std::numeric_limits<int>::max()) {
+        layer = 255;
+      }
+      else if (alphaIndex >= -128 && alphaIndex <= 126) {
+        layer = static_cast<uint32_t>(alphaIndex + 128);
+      }
+      else {
+        alphaIndicesFitLayer = false;
+      }
+      const auto depth       = subMesh->_distanceToCamera * invMaxDistance;
+      const auto alphaMode   = material ? material->alphaMode() : 0u;
+      const auto effectId    = effect ? effect->uniqueId : 0;
+      const auto materialId  = material ? material->uniqueId : 0;
+      const auto vertexArray = mesh ? mesh->uniqueId : 0;
+      _sortKeys[i].index     = static_cast<uint32_t>(i);
+      _sortKeys[i].key
+        = transparent ?
+            RenderSortKey::Transparent(layer, depth, alphaMode, effectId, materialId) :
+            RenderSortKey::Opaque(layer, alphaMode, effectId, materialId, vertexArray, depth);
+    }
+    if (alphaIndicesFitLayer) {
+      RenderSortKey::RadixSort(_sortKeys, _sortKeysScratch);
+    }
+    else {
+      // Alpha indices out of the layer range, compare the full alpha indices first
+      std::stable_sort(_sortKeys.begin(), _sortKeys.end(),
+                       [&subMeshes](const RenderSortKey& a, const RenderSortKey& b) {
+                         const auto alphaIndexA = subMeshes[a.index]->_alphaIndex;
+                         const auto alphaIndexB = subMeshes[b.index]->_alphaIndex;
+                         return alphaIndexA != alphaIndexB ? alphaIndexA < alphaIndexB :
+                                                             a.key < b.key;
+                       });
+    }
+    _sortedSubMeshes.resize(subMeshes.size());
+    for (size_t i = 0; i < _sortKeys.size(); ++i) {
+      _sortedSubMeshes[i] = subMeshes[_sortKeys[i].index];
+    }
+  }
+
+  for (const auto& subMesh : _sortedSubMeshes) {
+    if (!_autoInstances.empty()) {
+      auto it                 = _autoInstances.find(subMesh);
+      subMesh->_autoInstances = it != _autoInstances.end() ? &it->second.meshes : nullptr;
+    }
 
-  for (const auto& subMesh : sortedArray) {
     if (transparent) {
       auto material = subMesh->getMaterial();
 
@@ -219,13 +268,7 @@ void RenderingGroup::renderSorted(
     }
 
     subMesh->render(transparent);
-  }
-}
-
-void RenderingGroup::renderUnsorted(const std::vector<SubMesh*>& subMeshes)
-{
-  for (const auto& subMesh : subMeshes) {
-    subMesh->render(false);
+    subMesh->_autoInstances = nullptr;
   }
 }
 
@@ -267,6 +310,8 @@ bool RenderingGroup::frontToBackSortCompare(SubMesh* a, SubMesh* b)
 
 void RenderingGroup::prepare()
 {
+  _autoInstancesLeaders.clear();
+  _autoInstances.clear();
   _opaqueSubMeshes.clear();
   _transparentSubMeshes.clear();
   _alphaTestSubMeshes.clear();
@@ -278,6 +323,8 @@ void RenderingGroup::prepare()
 
 void RenderingGroup::dispose()
 {
+  _autoInstancesLeaders.clear();
+  _autoInstances.clear();
   _opaqueSubMeshes.clear();
   _transparentSubMeshes.clear();
   _alphaTestSubMeshes.clear();
@@ -305,6 +352,9 @@ void RenderingGroup::dispatch(SubMesh* subMesh, AbstractMesh* mesh, MaterialPtr
   if (material->needAlphaBlendingForMesh(*mesh)) { // Transparent
     _transparentSubMeshes.emplace_back(subMesh);
   }
+  else if (_scene->automaticInstancing && _dispatchAsAutoInstance(subMesh, mesh, material)) {
+    // Drawn with the instanced draw call of a previously dispatched sub mesh
+  }
   else if (material->needAlphaTesting()) { // Alpha test
     if (material->needDepthPrePass()) {
       _depthOnlySubMeshes.emplace_back(subMesh);
@@ -327,6 +377,86 @@ void RenderingGroup::dispatch(SubMesh* subMesh, AbstractMesh* mesh, MaterialPtr
   }
 }
 
+bool RenderingGroup::_dispatchAsAutoInstance(SubMesh* subMesh, AbstractMesh* mesh,
+                                             const MaterialPtr& material)
+{
+  // Regular meshes only, instances and thin instances already have their own instanced path
+  const auto& renderingMesh = subMesh->getRenderingMesh();
+  if (!renderingMesh || renderingMesh.get() != mesh
+      || !renderingMesh->_instanceDataStorage->hardwareInstancedRendering
+      || !renderingMesh->geometry()) {
+    return false;
+  }
+
+  // Everything that is not shared by the instanced draw call: per mesh vertex data, per mesh
+  // callbacks and the renderers drawing the mesh on their own
+  const auto canBeInstanced = [](const MeshPtr& candidate) {
+    return !candidate->hasThinInstances() && candidate->instances.empty()
+           && !candidate->skeleton() && !candidate->morphTargetManager()
+           && !candidate->overrideMaterialSideOrientation.has_value()
+           && !candidate->renderOutline() && !candidate->renderOverlay()
+           && !candidate->onBeforeRenderObservable().hasObservers()
+           && !candidate->onBeforeDrawObservable().hasObservers()
+           && !candidate->onAfterRenderObservable().hasObservers();
+  };
+  if (!canBeInstanced(renderingMesh)) {
+    return false;
+  }
+
+  auto& leaders = _autoInstancesLeaders[renderingMesh->geometry().get()];
+  for (const auto& leader : leaders) {
+    // Same draw range and material
+    if (leader->verticesStart != subMesh->verticesStart
+        || leader->verticesCount != subMesh->verticesCount
+        || leader->indexStart != subMesh->indexStart || leader->indexCount != subMesh->indexCount
+        || leader->getMaterial() != material) {
+      continue;
+    }
+
+    // Same effect defines and uniforms: the effect of the sub mesh is built from the material and
+    // these mesh states
+    const auto& leaderMesh = leader->getRenderingMesh();
+    if (leaderMesh->receiveShadows() != renderingMesh->receiveShadows()
+        || leaderMesh->useVertexColors() != renderingMesh->useVertexColors()
+        || leaderMesh->hasVertexAlpha() != renderingMesh->hasVertexAlpha()
+        || leaderMesh->visibility() != renderingMesh->visibility()
+        || leaderMesh->layerMask != renderingMesh->layerMask
+        || leaderMesh->lightSources() != renderingMesh->lightSources()) {
+      continue;
+    }
+
+    // Same draw state (culling orientation)
+    if ((leaderMesh->_getWorldMatrixDeterminant() < 0.f)
+        != (renderingMesh->_getWorldMatrixDeterminant() < 0.f)) {
+      continue;
+    }
+
+    auto& batch = _autoInstances[leader];
+    batch.meshes.emplace_back(mesh);
+    batch.subMeshes.emplace_back(subMesh);
+    return true;
+  }
+
+  // First sub mesh of its kind, drawn normally and grouping the next ones
+  leaders.emplace_back(subMesh);
+  return false;
+}
+
+std::vector<SubMesh*>
+RenderingGroup::_withAutoInstances(const std::vector<SubMesh*>& subMeshes) const
+{
+  std::vector<SubMesh*> result;
+  result.reserve(subMeshes.size());
+  for (const auto& subMesh : subMeshes) {
+    result.emplace_back(subMesh);
+    auto it = _autoInstances.find(subMesh);
+    if (it != _autoInstances.end()) {
+      result.insert(result.end(), it->second.subMeshes.begin(), it->second.subMeshes.end());
+    }
+  }
+  return result;
+}
+
 void RenderingGroup::dispatchSprites(ISpriteManager* spriteManager)
 {
   _spriteManagers.emplace_back(spriteManager);
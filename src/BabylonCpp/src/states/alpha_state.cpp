@@ -2,6 +2,7 @@
 
 #include <babylon/babylon_stl_util.h>
 #include <babylon/interfaces/igl_rendering_context.h>
+#include <babylon/states/gl_state_cache.h>
 
 namespace BABYLON {
 
@@ -21,7 +22,8 @@ AlphaState::~AlphaState() = default;
 
 bool AlphaState::get_isDirty() const
 {
-  return _isAlphaBlendDirty || _isBlendFunctionParametersDirty;
+  return _isAlphaBlendDirty || _isBlendFunctionParametersDirty || _isBlendEquationParametersDirty
+         || _isBlendConstantsDirty;
 }
 
 bool AlphaState::get_alphaBlend() const
@@ -109,7 +111,29 @@ void AlphaState::reset()
   _isBlendConstantsDirty          = false;
 }
 
-void AlphaState::apply(GL::IGLRenderingContext& gl)
+void AlphaState::copyFrom(const AlphaState& other)
+{
+  set_alphaBlend(other._alphaBlend);
+
+  const auto& functionParameters = other._blendFunctionParameters;
+  if (functionParameters[0] && functionParameters[1] && functionParameters[2]
+      && functionParameters[3]) {
+    setAlphaBlendFunctionParameters(*functionParameters[0], *functionParameters[1],
+                                    *functionParameters[2], *functionParameters[3]);
+  }
+
+  const auto& equationParameters = other._blendEquationParameters;
+  if (equationParameters[0] && equationParameters[1]) {
+    setAlphaEquationParameters(*equationParameters[0], *equationParameters[1]);
+  }
+
+  const auto& constants = other._blendConstants;
+  if (constants[0] && constants[1] && constants[2] && constants[3]) {
+    setAlphaBlendConstants(*constants[0], *constants[1], *constants[2], *constants[3]);
+  }
+}
+
+void AlphaState::apply(GLStateCache& glState)
 {
   if (!isDirty()) {
     return;
@@ -117,33 +141,27 @@ void AlphaState::apply(GL::IGLRenderingContext& gl)
 
   // Alpha blend
   if (_isAlphaBlendDirty) {
-    if (_alphaBlend) {
-      gl.enable(GL::BLEND);
-    }
-    else {
-      gl.disable(GL::BLEND);
-    }
-
+    glState.setCapability(GL::BLEND, _alphaBlend);
     _isAlphaBlendDirty = false;
   }
 
   // Alpha function
   if (_isBlendFunctionParametersDirty) {
-    gl.blendFuncSeparate(*_blendFunctionParameters[0], *_blendFunctionParameters[1],
-                         *_blendFunctionParameters[2], *_blendFunctionParameters[3]);
+    glState.blendFuncSeparate(*_blendFunctionParameters[0], *_blendFunctionParameters[1],
+                              *_blendFunctionParameters[2], *_blendFunctionParameters[3]);
     _isBlendFunctionParametersDirty = false;
   }
 
   // Alpha equation
   if (_isBlendEquationParametersDirty) {
-    gl.blendEquationSeparate(*_blendEquationParameters[0], *_blendEquationParameters[1]);
+    glState.blendEquationSeparate(*_blendEquationParameters[0], *_blendEquationParameters[1]);
     _isBlendEquationParametersDirty = false;
   }
 
   // Constants
   if (_isBlendConstantsDirty) {
-    gl.blendColor(*_blendConstants[0], *_blendConstants[1], *_blendConstants[2],
-                  *_blendConstants[3]);
+    glState.blendColor(*_blendConstants[0], *_blendConstants[1], *_blendConstants[2],
+                       *_blendConstants[3]);
     _isBlendConstantsDirty = false;
   }
 }
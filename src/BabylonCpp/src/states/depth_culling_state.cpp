@@ -2,6 +2,7 @@
 
 #include <babylon/babylon_stl_util.h>
 #include <babylon/interfaces/igl_rendering_context.h>
+#include <babylon/states/gl_state_cache.h>
 
 namespace BABYLON {
 
@@ -180,7 +181,26 @@ void DepthCullingState::reset()
   _isFrontFaceDirty = false;
 }
 
-void DepthCullingState::apply(GL::IGLRenderingContext& gl)
+void DepthCullingState::copyFrom(const DepthCullingState& other)
+{
+  set_zOffset(other._zOffset);
+  set_depthMask(other._depthMask);
+  set_depthTest(other._depthTest);
+  if (other._cull.has_value()) {
+    set_cull(other._cull);
+  }
+  if (other._cullFace.has_value()) {
+    set_cullFace(other._cullFace);
+  }
+  if (other._depthFunc.has_value()) {
+    set_depthFunc(other._depthFunc);
+  }
+  if (other._frontFace.has_value()) {
+    set_frontFace(other._frontFace);
+  }
+}
+
+void DepthCullingState::apply(GLStateCache& glState)
 {
   if (!isDirty()) {
     return;
@@ -189,53 +209,42 @@ void DepthCullingState::apply(GL::IGLRenderingContext& gl)
   // Cull
   if (_isCullDirty) {
     const auto& iCullFace = cull();
-    if (iCullFace && *iCullFace) {
-      gl.enable(GL::CULL_FACE);
-    }
-    else {
-      gl.disable(GL::CULL_FACE);
-    }
-
+    glState.setCapability(GL::CULL_FACE, iCullFace && *iCullFace);
     _isCullDirty = false;
   }
 
   // Cull face
   if (_isCullFaceDirty) {
-    gl.cullFace(static_cast<unsigned int>(*cullFace()));
+    glState.cullFace(static_cast<unsigned int>(*cullFace()));
     _isCullFaceDirty = false;
   }
 
   // Depth mask
   if (_isDepthMaskDirty) {
-    gl.depthMask(depthMask());
+    glState.depthMask(depthMask());
     _isDepthMaskDirty = false;
   }
 
   // Depth test
   if (_isDepthTestDirty) {
-    if (depthTest()) {
-      gl.enable(GL::DEPTH_TEST);
-    }
-    else {
-      gl.disable(GL::DEPTH_TEST);
-    }
+    glState.setCapability(GL::DEPTH_TEST, depthTest());
     _isDepthTestDirty = false;
   }
 
   // Depth func
   if (_isDepthFuncDirty) {
-    gl.depthFunc(static_cast<unsigned int>(*depthFunc()));
+    glState.depthFunc(static_cast<unsigned int>(*depthFunc()));
     _isDepthFuncDirty = false;
   }
 
   // zOffset
   if (_isZOffsetDirty) {
     if (!stl_util::almost_equal(zOffset(), 0.f)) {
-      gl.enable(GL::POLYGON_OFFSET_FILL);
-      gl.polygonOffset(zOffset(), 0);
+      glState.setCapability(GL::POLYGON_OFFSET_FILL, true);
+      glState.polygonOffset(zOffset(), 0);
     }
     else {
-      gl.disable(GL::POLYGON_OFFSET_FILL);
+      glState.setCapability(GL::POLYGON_OFFSET_FILL, false);
     }
 
     _isZOffsetDirty = false;
@@ -243,7 +252,7 @@ void DepthCullingState::apply(GL::IGLRenderingContext& gl)
 
   // Front face
   if (_isFrontFaceDirty) {
-    gl.frontFace(*frontFace());
+    glState.frontFace(*frontFace());
     _isFrontFaceDirty = false;
   }
 }
@@ -0,0 +1,208 @@
+#include <babylon/states/gl_state_cache.h>
+
+#include <cstring>
+
+#include <babylon/interfaces/igl_rendering_context.h>
+
+namespace BABYLON {
+
+void GLStateCounters::reset()
+{
+  glCalls         = 0;
+  filteredGLCalls = 0;
+  programSwitches = 0;
+  textureBinds    = 0;
+}
+
+GLStateCache::GLStateCache() : _gl{nullptr}
+{
+}
+
+GLStateCache::~GLStateCache() = default;
+
+void GLStateCache::setContext(GL::IGLRenderingContext* gl)
+{
+  _gl = gl;
+  invalidate();
+}
+
+void GLStateCache::invalidate()
+{
+  _capabilities.clear();
+  _depthMask     = std::nullopt;
+  _depthFunc     = std::nullopt;
+  _cullFace      = std::nullopt;
+  _frontFace     = std::nullopt;
+  _polygonOffset = std::nullopt;
+  _blendFunc     = std::nullopt;
+  _blendEquation = std::nullopt;
+  _blendColor    = std::nullopt;
+  _colorMask     = std::nullopt;
+  _stencilFunc   = std::nullopt;
+  _stencilOp     = std::nullopt;
+  _stencilMask   = std::nullopt;
+}
+
+const GLStateCounters& GLStateCache::counters() const
+{
+  return _counters;
+}
+
+void GLStateCache::resetCounters()
+{
+  _counters.reset();
+}
+
+void GLStateCache::countIssued(size_t count)
+{
+  _counters.glCalls += count;
+}
+
+void GLStateCache::countFiltered(size_t count)
+{
+  _counters.filteredGLCalls += count;
+}
+
+void GLStateCache::countProgramSwitch()
+{
+  ++_counters.glCalls;
+  ++_counters.programSwitches;
+}
+
+void GLStateCache::countTextureBind()
+{
+  ++_counters.glCalls;
+  ++_counters.textureBinds;
+}
+
+template <typename T>
+bool GLStateCache::_update(std::optional<T>& shadow, const T& value)
+{
+  if (shadow && *shadow == value) {
+    ++_counters.filteredGLCalls;
+    return false;
+  }
+
+  shadow = value;
+  ++_counters.glCalls;
+  return true;
+}
+
+bool GLStateCache::uniform(GL::IGLUniformLocation& location, const void* data, size_t byteLength)
+{
+  auto& cachedValue = location._cachedValue;
+  if (cachedValue.size() == byteLength && std::memcmp(cachedValue.data(), data, byteLength) == 0) {
+    ++_counters.filteredGLCalls;
+    return false;
+  }
+
+  const auto bytes = static_cast<const uint8_t*>(data);
+  cachedValue.assign(bytes, bytes + byteLength);
+  ++_counters.glCalls;
+  return true;
+}
+
+void GLStateCache::setCapability(unsigned int capability, bool enabled)
+{
+  auto it = _capabilities.find(capability);
+  if (it != _capabilities.end() && it->second == enabled) {
+    ++_counters.filteredGLCalls;
+    return;
+  }
+
+  _capabilities[capability] = enabled;
+  ++_counters.glCalls;
+  if (enabled) {
+    _gl->enable(capability);
+  }
+  else {
+    _gl->disable(capability);
+  }
+}
+
+void GLStateCache::depthMask(bool flag)
+{
+  if (_update(_depthMask, flag)) {
+    _gl->depthMask(flag);
+  }
+}
+
+void GLStateCache::depthFunc(unsigned int func)
+{
+  if (_update(_depthFunc, func)) {
+    _gl->depthFunc(func);
+  }
+}
+
+void GLStateCache::cullFace(unsigned int mode)
+{
+  if (_update(_cullFace, mode)) {
+    _gl->cullFace(mode);
+  }
+}
+
+void GLStateCache::frontFace(unsigned int mode)
+{
+  if (_update(_frontFace, mode)) {
+    _gl->frontFace(mode);
+  }
+}
+
+void GLStateCache::polygonOffset(float factor, float units)
+{
+  if (_update(_polygonOffset, {factor, units})) {
+    _gl->polygonOffset(factor, units);
+  }
+}
+
+void GLStateCache::blendFuncSeparate(unsigned int srcRGB, unsigned int dstRGB,
+                                     unsigned int srcAlpha, unsigned int dstAlpha)
+{
+  if (_update(_blendFunc, {srcRGB, dstRGB, srcAlpha, dstAlpha})) {
+    _gl->blendFuncSeparate(srcRGB, dstRGB, srcAlpha, dstAlpha);
+  }
+}
+
+void GLStateCache::blendEquationSeparate(unsigned int modeRGB, unsigned int modeAlpha)
+{
+  if (_update(_blendEquation, {modeRGB, modeAlpha})) {
+    _gl->blendEquationSeparate(modeRGB, modeAlpha);
+  }
+}
+
+void GLStateCache::blendColor(float red, float green, float blue, float alpha)
+{
+  if (_update(_blendColor, {red, green, blue, alpha})) {
+    _gl->blendColor(red, green, blue, alpha);
+  }
+}
+
+void GLStateCache::colorMask(bool red, bool green, bool blue, bool alpha)
+{
+  if (_update(_colorMask, {red, green, blue, alpha})) {
+    _gl->colorMask(red, green, blue, alpha);
+  }
+}
+
+void GLStateCache::stencilFunc(unsigned int func, int ref, unsigned int mask)
+{
+  if (_update(_stencilFunc, {func, static_cast<unsigned int>(ref), mask})) {
+    _gl->stencilFunc(func, ref, mask);
+  }
+}
+
+void GLStateCache::stencilOp(unsigned int fail, unsigned int zfail, unsigned int zpass)
+{
+  if (_update(_stencilOp, {fail, zfail, zpass})) {
+    _gl->stencilOp(fail, zfail, zpass);
+  }
+}
+
+void GLStateCache::stencilMask(unsigned int mask)
+{
+  if (_update(_stencilMask, mask)) {
+    _gl->stencilMask(mask);
+  }
+}
+
+} // end of namespace BABYLON
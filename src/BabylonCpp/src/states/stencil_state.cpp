@@ -2,6 +2,7 @@
 
 #include <babylon/engines/engine.h>
 #include <babylon/interfaces/igl_rendering_context.h>
+#include <babylon/states/gl_state_cache.h>
 
 namespace BABYLON {
 
@@ -36,6 +37,18 @@ void StencilState::reset()
   opStencilDepthPass = StencilState::REPLACE;
 }
 
+void StencilState::apply(GLStateCache& glState)
+{
+  glState.setCapability(GL::STENCIL_TEST, _enabled);
+  if (!_enabled) {
+    return;
+  }
+
+  glState.stencilMask(_mask);
+  glState.stencilFunc(_func, static_cast<int>(_funcRef), _funcMask);
+  glState.stencilOp(_opStencilFail, _opDepthFail, _opStencilDepthPass);
+}
+
 unsigned int StencilState::get_func() const
 {
   return _func;
@@ -0,0 +1,71 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <vector>
+
+#include <babylon/core/thread_pool.h>
+
+TEST(TestThreadPool, parallelForCoversRangeOnce)
+{
+  using namespace BABYLON;
+
+  ThreadPool threadPool(3);
+  std::vector<int> counts(10000, 0);
+  const auto numChunks
+    = threadPool.parallelFor(counts.size(), 64, [&counts](size_t, size_t begin, size_t end) {
+        for (auto i = begin; i < end; ++i) {
+          ++counts[i];
+        }
+      });
+  EXPECT_EQ(numChunks, 4ull);
+  for (const auto count : counts) {
+    EXPECT_EQ(count, 1);
+  }
+}
+
+TEST(TestThreadPool, parallelForChunksAreOrdered)
+{
+  using namespace BABYLON;
+
+  ThreadPool threadPool(3);
+  std::vector<std::pair<size_t, size_t>> ranges(4);
+  const auto numChunks
+    = threadPool.parallelFor(1000, 1, [&ranges](size_t chunkIndex, size_t begin, size_t end) {
+        ranges[chunkIndex] = {begin, end};
+      });
+  EXPECT_EQ(numChunks, 4ull);
+  size_t expectedBegin = 0;
+  for (const auto& range : ranges) {
+    EXPECT_EQ(range.first, expectedBegin);
+    expectedBegin = range.second;
+  }
+  EXPECT_EQ(expectedBegin, 1000ull);
+}
+
+TEST(TestThreadPool, inlineWithoutWorkers)
+{
+  using namespace BABYLON;
+
+  ThreadPool threadPool(0);
+  std::atomic<size_t> sum{0};
+  EXPECT_EQ(threadPool.parallelFor(100, 1, [&sum](size_t, size_t begin,
+                                                    size_t end) { sum += end - begin; }),
+            1ull);
+  EXPECT_EQ(sum.load(), 100ull);
+  EXPECT_EQ(threadPool.enqueue([]() { return 42; }).get(), 42);
+}
+
+TEST(TestThreadPool, enqueue)
+{
+  using namespace BABYLON;
+
+  ThreadPool threadPool(2);
+  std::vector<std::future<int>> futures;
+  for (int i = 0; i < 16; ++i) {
+    futures.emplace_back(threadPool.enqueue([i]() { return i * i; }));
+  }
+  for (int i = 0; i < 16; ++i) {
+    EXPECT_EQ(futures[static_cast<size_t>(i)].get(), i * i);
+  }
+}
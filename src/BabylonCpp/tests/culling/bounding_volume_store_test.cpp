@@ -0,0 +1,90 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <array>
+#include <vector>
+
+#include <babylon/culling/bounding_info.h>
+#include <babylon/culling/bounding_volume_store.h>
+#include <babylon/maths/plane.h>
+#include <babylon/maths/vector3.h>
+
+namespace {
+
+// Frustum enclosing the [-10, 10] cube
+std::array<BABYLON::Plane, 6> CubeFrustumPlanes()
+{
+  using namespace BABYLON;
+  return {{
+    Plane(1.f, 0.f, 0.f, 10.f),  //
+    Plane(-1.f, 0.f, 0.f, 10.f), //
+    Plane(0.f, 1.f, 0.f, 10.f),  //
+    Plane(0.f, -1.f, 0.f, 10.f), //
+    Plane(0.f, 0.f, 1.f, 10.f),  //
+    Plane(0.f, 0.f, -1.f, 10.f), //
+  }};
+}
+
+BABYLON::BoundingInfo UnitBoxAt(float x, float y, float z)
+{
+  using namespace BABYLON;
+  return BoundingInfo(Vector3(x - 1.f, y - 1.f, z - 1.f), Vector3(x + 1.f, y + 1.f, z + 1.f));
+}
+
+} // end of anonymous namespace
+
+TEST(TestBoundingVolumeStore, cull)
+{
+  using namespace BABYLON;
+
+  BoundingVolumeStore store;
+  const auto inside       = store.allocate();
+  const auto outside      = store.allocate();
+  const auto intersecting = store.allocate();
+  const auto empty        = store.allocate();
+  store.update(inside, UnitBoxAt(0.f, 0.f, 0.f));
+  store.update(outside, UnitBoxAt(20.f, 0.f, 0.f));
+  store.update(intersecting, UnitBoxAt(0.f, 10.5f, 0.f));
+  EXPECT_EQ(store.size(), 4ull);
+
+  std::vector<uint64_t> visibility;
+  store.cull(CubeFrustumPlanes(), visibility);
+  EXPECT_TRUE(BoundingVolumeStore::IsVisible(visibility, inside));
+  EXPECT_FALSE(BoundingVolumeStore::IsVisible(visibility, outside));
+  EXPECT_TRUE(BoundingVolumeStore::IsVisible(visibility, intersecting));
+  EXPECT_FALSE(BoundingVolumeStore::IsVisible(visibility, empty));
+
+  // Released slots are reused and culled until updated
+  store.release(inside);
+  EXPECT_EQ(store.size(), 3ull);
+  EXPECT_EQ(store.allocate(), inside);
+  store.cull(CubeFrustumPlanes(), visibility);
+  EXPECT_FALSE(BoundingVolumeStore::IsVisible(visibility, inside));
+}
+
+TEST(TestBoundingVolumeStore, simdMatchesScalar)
+{
+  using namespace BABYLON;
+
+  BoundingVolumeStore store;
+  std::vector<BoundingInfo> boundingInfos;
+  for (int i = 0; i < 100; ++i) {
+    const auto slot = store.allocate();
+    boundingInfos.emplace_back(UnitBoxAt(static_cast<float>(i % 10) * 3.f - 15.f,
+                                         static_cast<float>(i / 10) * 3.f - 15.f, 0.f));
+    store.update(slot, boundingInfos.back());
+  }
+
+  const auto frustumPlanes = CubeFrustumPlanes();
+  std::vector<uint64_t> simdVisibility, scalarVisibility;
+  store.cull(frustumPlanes, simdVisibility);
+  store.cull(frustumPlanes, scalarVisibility, true);
+  EXPECT_EQ(simdVisibility, scalarVisibility);
+
+  // The batch test is conservative
+  for (size_t slot = 0; slot < boundingInfos.size(); ++slot) {
+    if (boundingInfos[slot].isInFrustum(frustumPlanes)) {
+      EXPECT_TRUE(BoundingVolumeStore::IsVisible(simdVisibility, slot));
+    }
+  }
+}
@@ -0,0 +1,85 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "../test_utils.h"
+
+#include <memory>
+
+#include <babylon/culling/bvh/bvh_active_mesh_candidate_provider.h>
+#include <babylon/engines/scene.h>
+#include <babylon/maths/matrix.h>
+#include <babylon/meshes/builders/mesh_builder_options.h>
+#include <babylon/meshes/mesh.h>
+#include <babylon/meshes/mesh_builder.h>
+#include <babylon/meshes/transform_system.h>
+#include <babylon/meshes/vertex_buffer.h>
+
+TEST(TestBVHActiveMeshCandidateProvider, refitsChangedBoundingInfos)
+{
+  using namespace BABYLON;
+  auto engine = createSubject();
+  auto scene  = Scene::New(engine.get());
+
+  BoxOptions boxOptions;
+  boxOptions.size = 1.f;
+  auto box        = MeshBuilder::CreateBox("box", boxOptions, scene.get());
+  auto other      = MeshBuilder::CreateBox("other", boxOptions, scene.get());
+  other->position().set(3.f, 0.f, 0.f);
+
+  BVHActiveMeshCandidateProvider provider(scene.get());
+  EXPECT_EQ(scene->getTransformSystem(), nullptr);
+  EXPECT_EQ(provider.bvh().size(), 2ull);
+  scene->enableTransformSystem();
+
+  // Frustum keeping x, y and z in [-5, 5]
+  auto view       = Matrix::Identity();
+  auto projection = Matrix::OrthoLH(10.f, 10.f, -5.f, 5.f, engine->isNDCHalfZRange);
+  scene->setTransformMatrix(view, projection);
+  const auto select = [&]() {
+    scene->incrementRenderId();
+    scene->getTransformSystem()->update();
+    return provider.getMeshes(scene.get());
+  };
+  EXPECT_THAT(select(), ::testing::UnorderedElementsAre(box.get(), other.get()));
+
+  // Moved meshes are refitted
+  box->position().set(20.f, 0.f, 0.f);
+  EXPECT_THAT(select(), ::testing::ElementsAre(other.get()));
+
+  // Geometry updates change the bounding info without changing the world matrix
+  auto positions = box->getVerticesData(VertexBuffer::PositionKind);
+  for (auto& position : positions) {
+    position *= 40.f;
+  }
+  box->updateVerticesData(VertexBuffer::PositionKind, positions, true);
+  EXPECT_THAT(select(), ::testing::UnorderedElementsAre(box.get(), other.get()));
+
+  // Always selected meshes are returned even outside of the frustum
+  other->position().set(-20.f, 0.f, 0.f);
+  other->alwaysSelectAsActiveMesh = true;
+  EXPECT_THAT(select(), ::testing::UnorderedElementsAre(box.get(), other.get()));
+
+  // In the order they were flagged
+  box->alwaysSelectAsActiveMesh = true;
+  provider.updateMesh(box.get());
+  EXPECT_THAT(select(), ::testing::ElementsAre(other.get(), box.get()));
+
+  other->dispose();
+  EXPECT_EQ(provider.bvh().size(), 1ull);
+}
+
+TEST(TestBVHActiveMeshCandidateProvider, stopsTrackingTheDisposedScene)
+{
+  using namespace BABYLON;
+  auto engine   = createSubject();
+  auto scene    = Scene::New(engine.get());
+  auto provider = std::make_unique<BVHActiveMeshCandidateProvider>(scene.get());
+  scene->setActiveMeshCandidateProvider(provider.get());
+
+  scene->dispose();
+  EXPECT_EQ(scene->getActiveMeshCandidateProvider(), nullptr);
+
+  // The provider outlives the scene
+  scene.reset();
+  provider.reset();
+}
@@ -0,0 +1,108 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include <babylon/culling/bvh/dynamic_bvh.h>
+#include <babylon/maths/plane.h>
+#include <babylon/maths/vector3.h>
+
+namespace BABYLON {
+class AbstractMesh;
+} // end of namespace BABYLON
+
+namespace {
+
+// The tree only stores the entries, fake mesh pointers are enough
+BABYLON::AbstractMesh* FakeMesh(size_t index)
+{
+  return reinterpret_cast<BABYLON::AbstractMesh*>(static_cast<uintptr_t>(index + 1) * 16);
+}
+
+} // end of anonymous namespace
+
+TEST(TestDynamicBVH, insertMoveRemove)
+{
+  using namespace BABYLON;
+
+  DynamicBVH<AbstractMesh*> bvh(0.f);
+  std::mt19937 generator(42);
+  std::uniform_real_distribution<float> position(-100.f, 100.f);
+
+  const size_t count = 256;
+  std::vector<int> proxies;
+  std::vector<Vector3> centers;
+  for (size_t i = 0; i < count; ++i) {
+    centers.emplace_back(position(generator), position(generator), position(generator));
+    proxies.emplace_back(bvh.createProxy(centers[i].subtract(Vector3(1.f, 1.f, 1.f)),
+                                         centers[i].add(Vector3(1.f, 1.f, 1.f)), FakeMesh(i)));
+  }
+  EXPECT_EQ(bvh.size(), count);
+  EXPECT_TRUE(bvh._validate());
+  // Balanced tree
+  EXPECT_LT(bvh.height(), 20);
+
+  // Move everything
+  for (size_t i = 0; i < count; ++i) {
+    centers[i].set(position(generator), position(generator), position(generator));
+    bvh.moveProxy(proxies[i], centers[i].subtract(Vector3(1.f, 1.f, 1.f)),
+                  centers[i].add(Vector3(1.f, 1.f, 1.f)));
+  }
+  EXPECT_TRUE(bvh._validate());
+
+  // Selection matches a brute force test
+  std::vector<AbstractMesh*> selection;
+  const Vector3 minimum(-20.f, -20.f, -20.f), maximum(20.f, 20.f, 20.f);
+  bvh.intersectsMinMax(minimum, maximum, selection);
+  std::vector<AbstractMesh*> expected;
+  for (size_t i = 0; i < count; ++i) {
+    const auto& center = centers[i];
+    if (std::abs(center.x) <= 21.f && std::abs(center.y) <= 21.f && std::abs(center.z) <= 21.f) {
+      expected.emplace_back(FakeMesh(i));
+    }
+  }
+  std::sort(selection.begin(), selection.end());
+  EXPECT_EQ(selection, expected);
+
+  // Remove half of the entries
+  for (size_t i = 0; i < count; i += 2) {
+    bvh.destroyProxy(proxies[i]);
+  }
+  EXPECT_EQ(bvh.size(), count / 2);
+  EXPECT_TRUE(bvh._validate());
+}
+
+TEST(TestDynamicBVH, select)
+{
+  using namespace BABYLON;
+
+  DynamicBVH<AbstractMesh*> bvh;
+  // Frustum enclosing the [-10, 10] cube
+  const std::array<Plane, 6> frustumPlanes{{
+    Plane(1.f, 0.f, 0.f, 10.f),  //
+    Plane(-1.f, 0.f, 0.f, 10.f), //
+    Plane(0.f, 1.f, 0.f, 10.f),  //
+    Plane(0.f, -1.f, 0.f, 10.f), //
+    Plane(0.f, 0.f, 1.f, 10.f),  //
+    Plane(0.f, 0.f, -1.f, 10.f), //
+  }};
+
+  for (size_t i = 0; i < 40; ++i) {
+    const auto x = static_cast<float>(i) * 2.f - 40.f;
+    bvh.createProxy(Vector3(x - 0.5f, -0.5f, -0.5f), Vector3(x + 0.5f, 0.5f, 0.5f), FakeMesh(i));
+  }
+
+  std::vector<AbstractMesh*> selection;
+  bvh.select(frustumPlanes, selection);
+  std::sort(selection.begin(), selection.end());
+  // x in [-10.6, 10.6] (margin included): i from 15 to 25
+  std::vector<AbstractMesh*> expected;
+  for (size_t i = 15; i <= 25; ++i) {
+    expected.emplace_back(FakeMesh(i));
+  }
+  EXPECT_EQ(selection, expected);
+}
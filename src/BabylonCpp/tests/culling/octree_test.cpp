@@ -0,0 +1,134 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "../test_utils.h"
+
+#include <algorithm>
+#include <functional>
+
+#include <babylon/culling/octrees/octree.h>
+#include <babylon/culling/octrees/octree_block.h>
+#include <babylon/engines/scene.h>
+#include <babylon/maths/frustum.h>
+#include <babylon/maths/matrix.h>
+#include <babylon/meshes/builders/mesh_builder_options.h>
+#include <babylon/meshes/mesh.h>
+#include <babylon/meshes/mesh_builder.h>
+
+namespace {
+
+std::vector<BABYLON::MeshPtr> CreateBoxes(BABYLON::Scene* scene)
+{
+  using namespace BABYLON;
+  std::vector<MeshPtr> boxes;
+  // Boxes spanning several blocks
+  for (int i = 0; i < 32; ++i) {
+    BoxOptions boxOptions;
+    boxOptions.size = 3.f;
+    auto box        = MeshBuilder::CreateBox("box" + std::to_string(i), boxOptions, scene);
+    box->position().set(static_cast<float>(i % 8) * 2.f - 8.f, static_cast<float>(i / 8) * 2.f - 4.f,
+                        0.f);
+    box->computeWorldMatrix(true);
+    boxes.emplace_back(box);
+  }
+  return boxes;
+}
+
+} // end of anonymous namespace
+
+TEST(TestOctree, selectWithoutDuplicates)
+{
+  using namespace BABYLON;
+  auto engine = createSubject();
+  auto scene  = Scene::New(engine.get());
+  auto boxes  = CreateBoxes(scene.get());
+
+  auto octree = scene->createOrUpdateSelectionOctree(2, 3);
+  const auto frustumPlanes
+    = Frustum::GetPlanes(Matrix::OrthoLH(40.f, 40.f, -20.f, 20.f, engine->isNDCHalfZRange));
+
+  const auto& withDuplicates = octree->select(frustumPlanes, true);
+  EXPECT_GT(withDuplicates.size(), boxes.size());
+
+  const auto selection = octree->select(frustumPlanes, false);
+  EXPECT_EQ(selection.size(), boxes.size());
+  for (const auto& box : boxes) {
+    EXPECT_EQ(std::count(selection.begin(), selection.end(), box.get()), 1);
+  }
+}
+
+TEST(TestOctree, looseBounds)
+{
+  using namespace BABYLON;
+  auto engine = createSubject();
+  auto scene  = Scene::New(engine.get());
+  auto boxes  = CreateBoxes(scene.get());
+
+  Octree<AbstractMesh*> octree(
+    [](AbstractMesh*& entry, OctreeBlock<AbstractMesh*>& block) {
+      Octree<AbstractMesh*>::CreationFuncForMeshes(entry, block);
+    },
+    2, 3);
+  octree.looseBounds = true;
+  std::vector<AbstractMesh*> entries;
+  for (const auto& box : boxes) {
+    entries.emplace_back(box.get());
+  }
+  octree.update(Vector3(-10.f, -10.f, -10.f), Vector3(10.f, 10.f, 10.f), entries);
+
+  // Every entry is stored once
+  const auto frustumPlanes
+    = Frustum::GetPlanes(Matrix::OrthoLH(40.f, 40.f, -20.f, 20.f, engine->isNDCHalfZRange));
+  EXPECT_EQ(octree.select(frustumPlanes, true).size(), boxes.size());
+
+  // Moving an entry outside of the world bounds
+  AbstractMesh* movedBox = boxes[0].get();
+  movedBox->position().set(100.f, 0.f, 0.f);
+  movedBox->computeWorldMatrix(true);
+  octree.updateMesh(movedBox);
+  EXPECT_EQ(octree.dynamicContent.size(), 1ull);
+  EXPECT_EQ(octree.select(frustumPlanes, true).size(), boxes.size());
+
+  octree.removeMesh(movedBox);
+  EXPECT_TRUE(octree.dynamicContent.empty());
+  EXPECT_EQ(octree.select(frustumPlanes, true).size(), boxes.size() - 1);
+}
+
+TEST(TestOctree, looseBoundsUseCreationFunction)
+{
+  using namespace BABYLON;
+  auto engine = createSubject();
+  auto scene  = Scene::New(engine.get());
+  auto boxes  = CreateBoxes(scene.get());
+
+  // Only the blocks of the first two levels (10 and 5 units wide) accept entries
+  Octree<AbstractMesh*> octree(
+    [](AbstractMesh*& entry, OctreeBlock<AbstractMesh*>& block) {
+      if (block.maxPoint().x - block.minPoint().x >= 5.f) {
+        Octree<AbstractMesh*>::CreationFuncForMeshes(entry, block);
+      }
+    },
+    2, 3);
+  octree.looseBounds = true;
+  std::vector<AbstractMesh*> entries;
+  for (const auto& box : boxes) {
+    entries.emplace_back(box.get());
+  }
+  octree.update(Vector3(-10.f, -10.f, -10.f), Vector3(10.f, 10.f, 10.f), entries);
+
+  size_t entryCount = 0;
+  std::function<void(OctreeBlock<AbstractMesh*>&)> checkBlock
+    = [&](OctreeBlock<AbstractMesh*>& block) {
+        if (block.maxPoint().x - block.minPoint().x < 5.f) {
+          EXPECT_TRUE(block.entries.empty());
+        }
+        entryCount += block.entries.size();
+        for (auto& child : block.blocks) {
+          checkBlock(*child);
+        }
+      };
+  for (auto& block : octree.blocks) {
+    checkBlock(*block);
+  }
+  EXPECT_EQ(entryCount, boxes.size());
+}
@@ -0,0 +1,73 @@
+#include <gtest/gtest.h>
+
+#include <babylon/culling/software_occlusion_culler.h>
+#include <babylon/maths/matrix.h>
+#include <babylon/maths/vector3.h>
+
+namespace {
+
+// Camera at the origin looking down +z
+BABYLON::Matrix ViewProjection()
+{
+  using namespace BABYLON;
+  Vector3 target{0.f, 0.f, 1.f};
+  auto view       = Matrix::LookAtLH(Vector3::Zero(), target, Vector3::Up());
+  auto projection = Matrix::PerspectiveFovLH(0.8f, 2.f, 0.1f, 100.f);
+  return view.multiply(projection);
+}
+
+// Wall (two triangles) facing the camera at depth z covering [-size, size]^2
+void RasterizeWall(BABYLON::SoftwareOcclusionCuller& culler, float z, float size)
+{
+  using namespace BABYLON;
+  const Float32Array positions{-size, -size, z, size, -size, z, size, size, z, -size, size, z};
+  const IndicesArray indices{0, 1, 2, 0, 2, 3};
+  culler.rasterizeTriangles(positions, indices, Matrix::IdentityReadOnly());
+}
+
+} // end of anonymous namespace
+
+TEST(TestSoftwareOcclusionCuller, BoxBehindWallIsOccluded)
+{
+  using namespace BABYLON;
+
+  for (const auto forceScalar : {false, true}) {
+    SoftwareOcclusionCuller culler(100, 60);
+    culler.forceScalar = forceScalar;
+    EXPECT_EQ(culler.width(), 104ull);
+    EXPECT_EQ(culler.height(), 64ull);
+
+    culler.clear(ViewProjection());
+    RasterizeWall(culler, 10.f, 20.f);
+    culler.updateHierarchicalDepth();
+    EXPECT_EQ(culler.rasterizedTriangleCount(), 2ull);
+
+    // Behind the wall
+    EXPECT_TRUE(culler.isOccluded(Vector3(-1.f, -1.f, 20.f), Vector3(1.f, 1.f, 22.f)));
+    // In front of the wall
+    EXPECT_FALSE(culler.isOccluded(Vector3(-1.f, -1.f, 5.f), Vector3(1.f, 1.f, 6.f)));
+    // Straddling the wall
+    EXPECT_FALSE(culler.isOccluded(Vector3(-1.f, -1.f, 9.f), Vector3(1.f, 1.f, 11.f)));
+    // Crossing the near plane
+    EXPECT_FALSE(culler.isOccluded(Vector3(-1.f, -1.f, -1.f), Vector3(1.f, 1.f, 22.f)));
+  }
+}
+
+TEST(TestSoftwareOcclusionCuller, PartiallyCoveredBoxIsVisible)
+{
+  using namespace BABYLON;
+
+  SoftwareOcclusionCuller culler;
+  culler.clear(ViewProjection());
+  // Small wall only hiding the center of the screen
+  RasterizeWall(culler, 10.f, 1.f);
+  culler.updateHierarchicalDepth();
+
+  EXPECT_TRUE(culler.isOccluded(Vector3(-0.5f, -0.5f, 30.f), Vector3(0.5f, 0.5f, 31.f)));
+  EXPECT_FALSE(culler.isOccluded(Vector3(-5.f, -0.5f, 30.f), Vector3(5.f, 0.5f, 31.f)));
+
+  // Clearing removes the occluders
+  culler.clear(ViewProjection());
+  culler.updateHierarchicalDepth();
+  EXPECT_FALSE(culler.isOccluded(Vector3(-0.5f, -0.5f, 30.f), Vector3(0.5f, 0.5f, 31.f)));
+}
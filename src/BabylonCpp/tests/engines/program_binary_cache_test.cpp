@@ -0,0 +1,92 @@
+#include <gtest/gtest.h>
+
+#include <babylon/core/filesystem.h>
+#include <babylon/engines/program_binary_cache.h>
+
+namespace {
+
+std::string cacheDirectory(const std::string& name)
+{
+  const auto directory = BABYLON::Filesystem::joinPath(::testing::TempDir(), name);
+  // Start from an empty cache
+  BABYLON::ProgramBinaryCache(directory).clear();
+  return directory;
+}
+
+} // end of anonymous namespace
+
+TEST(TestProgramBinaryCache, StoresAndReloadsBinaries)
+{
+  using namespace BABYLON;
+
+  const auto directory = cacheDirectory("program_binary_cache_reload");
+  const auto key       = ProgramBinaryCache::ComputeKey("vertex", "fragment", "vendor");
+  EXPECT_NE(key, ProgramBinaryCache::ComputeKey("vertex", "fragment", "other vendor"));
+  EXPECT_NE(key, ProgramBinaryCache::ComputeKey("vertexf", "ragment", "vendor"));
+  EXPECT_NE(key, ProgramBinaryCache::ComputeKey("vertex", "fragment", "vendor", {"outPosition"}));
+  EXPECT_NE(ProgramBinaryCache::ComputeKey("vertex", "fragment", "vendor", {"a", "b"}),
+            ProgramBinaryCache::ComputeKey("vertex", "fragment", "vendor", {"ab"}));
+
+  const ArrayBuffer binary{1, 2, 3, 4, 5};
+  {
+    ProgramBinaryCache cache(directory);
+    unsigned int binaryFormat = 0;
+    ArrayBuffer loaded;
+    EXPECT_FALSE(cache.load(key, binaryFormat, loaded));
+    EXPECT_TRUE(cache.store(key, 0x1234, binary));
+    EXPECT_EQ(cache.size(), binary.size());
+  }
+
+  // The index and the binaries survive the cache
+  ProgramBinaryCache cache(directory);
+  unsigned int binaryFormat = 0;
+  ArrayBuffer loaded;
+  EXPECT_TRUE(cache.load(key, binaryFormat, loaded));
+  EXPECT_EQ(binaryFormat, 0x1234u);
+  EXPECT_EQ(loaded, binary);
+
+  // Rejected binaries are removed
+  cache.remove(key);
+  EXPECT_FALSE(cache.load(key, binaryFormat, loaded));
+  EXPECT_EQ(cache.count(), 0ull);
+}
+
+TEST(TestProgramBinaryCache, EvictsLeastRecentlyUsedBinaries)
+{
+  using namespace BABYLON;
+
+  ProgramBinaryCache cache(cacheDirectory("program_binary_cache_lru"), 10);
+  const ArrayBuffer binary(4, 0xAB);
+  EXPECT_TRUE(cache.store("a", 1, binary));
+  EXPECT_TRUE(cache.store("b", 1, binary));
+
+  // "a" becomes the most recently used binary
+  unsigned int binaryFormat = 0;
+  ArrayBuffer loaded;
+  EXPECT_TRUE(cache.load("a", binaryFormat, loaded));
+
+  EXPECT_TRUE(cache.store("c", 1, binary));
+  EXPECT_EQ(cache.count(), 2ull);
+  EXPECT_EQ(cache.size(), 8ull);
+  EXPECT_TRUE(cache.load("a", binaryFormat, loaded));
+  EXPECT_FALSE(cache.load("b", binaryFormat, loaded));
+  EXPECT_TRUE(cache.load("c", binaryFormat, loaded));
+
+  // Binaries larger than the cache are not stored
+  EXPECT_FALSE(cache.store("d", 1, ArrayBuffer(11, 0)));
+}
+
+TEST(TestProgramBinaryCache, WritesTheIndexOnFlush)
+{
+  using namespace BABYLON;
+
+  const auto directory = cacheDirectory("program_binary_cache_flush");
+  ProgramBinaryCache cache(directory);
+  EXPECT_TRUE(cache.store("a", 1, ArrayBuffer(4, 0xAB)));
+  EXPECT_TRUE(cache.store("b", 1, ArrayBuffer(4, 0xCD)));
+
+  // Stored binaries are listed in the index once flushed
+  EXPECT_EQ(ProgramBinaryCache(directory).count(), 0ull);
+  cache.flush();
+  EXPECT_EQ(ProgramBinaryCache(directory).count(), 2ull);
+}
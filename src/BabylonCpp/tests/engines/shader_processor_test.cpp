@@ -0,0 +1,171 @@
+#include <gtest/gtest.h>
+
+#include <future>
+#include <memory>
+
+#include <babylon/engines/processors/ishader_processor.h>
+#include <babylon/engines/processors/shader_processing_options.h>
+#include <babylon/engines/processors/shader_processor.h>
+#include <babylon/engines/webgl/webgl_shader_processor.h>
+#include <babylon/materials/effect.h>
+#include <babylon/misc/string_tools.h>
+
+namespace {
+
+std::string process(const std::string& sourceCode, BABYLON::ProcessingOptions& options)
+{
+  std::string result;
+  BABYLON::ShaderProcessor::Process(sourceCode, options,
+                                    [&result](const std::string& code) { result = code; });
+  return result;
+}
+
+} // end of anonymous namespace
+
+TEST(TestShaderProcessor, ExpandsIncludes)
+{
+  using namespace BABYLON;
+
+  auto includesShadersStore = std::make_shared<std::unordered_map<std::string, std::string>>(
+    std::unordered_map<std::string, std::string>{
+      {"lightFragment", "light{X}();"},
+      {"samplerDeclaration", "uniform sampler2D _SAMPLERNAME_Sampler;#include<helper>"},
+      {"helper", "helper();"},
+      {"lightUboDeclaration", "ubo;"},
+    });
+
+  ProcessingOptions options;
+  options.includesShadersStore         = includesShadersStore;
+  options.indexParameters              = {{"maxSimultaneousLights", 3}};
+  options.shouldUseHighPrecisionShader = true;
+  options.supportsUniformBuffers       = true;
+
+  EXPECT_EQ(process("#include<lightFragment>[0..maxSimultaneousLights]", options),
+            "precision highp float;\nlight0();\nlight1();\nlight2();\n");
+  EXPECT_EQ(process("a #include<lightFragment>[5] b", options),
+            "precision highp float;\na light5(); b");
+  // Parameters and nested includes
+  EXPECT_EQ(process("#include<samplerDeclaration>(_SAMPLERNAME_,albedo)", options),
+            "precision highp float;\nuniform sampler2D albedoSampler;helper();");
+  // Uniform declarations
+  EXPECT_EQ(process("#include<__decl__lightFragment>", options),
+            "precision highp float;\nubo;");
+
+  // Memoized expansions follow the snapshots of the store
+  auto nextIncludesShadersStore
+    = std::make_shared<std::unordered_map<std::string, std::string>>(*includesShadersStore);
+  (*nextIncludesShadersStore)["lightFragment"] = "spot{X}();";
+  options.includesShadersStore                 = nextIncludesShadersStore;
+  EXPECT_EQ(process("#include<lightFragment>[0..2]", options),
+            "precision highp float;\nspot0();\nspot1();\n");
+}
+
+TEST(TestShaderProcessor, EvaluatesConditions)
+{
+  using namespace BABYLON;
+
+  auto includesShadersStore = std::make_shared<std::unordered_map<std::string, std::string>>();
+  ProcessingOptions options;
+  options.includesShadersStore         = includesShadersStore;
+  options.shouldUseHighPrecisionShader = true;
+  options.processor                    = std::make_shared<IShaderProcessor>();
+  options.defines                      = {"#define DIFFUSE", "#define NUM_LIGHTS 2"};
+
+  const std::string sourceCode = "#ifdef DIFFUSE\n"
+                                 "diffuse();\n"
+                                 "#else\n"
+                                 "noDiffuse();\n"
+                                 "#endif\n"
+                                 "#ifndef BUMP\n"
+                                 "noBump();\n"
+                                 "#endif\n"
+                                 "#if defined(DIFFUSE) && NUM_LIGHTS > 1\n"
+                                 "lights();\n"
+                                 "#elif defined(BUMP)\n"
+                                 "bump();\n"
+                                 "#endif\n";
+
+  const auto code = process(sourceCode, options);
+  EXPECT_NE(code.find("diffuse();"), std::string::npos);
+  EXPECT_EQ(code.find("noDiffuse();"), std::string::npos);
+  EXPECT_NE(code.find("noBump();"), std::string::npos);
+  EXPECT_NE(code.find("lights();"), std::string::npos);
+  EXPECT_EQ(code.find("bump();"), std::string::npos);
+}
+
+TEST(TestShaderProcessor, ProcessesOnSeveralThreads)
+{
+  using namespace BABYLON;
+
+  const auto includesShadersStore
+    = std::make_shared<const std::unordered_map<std::string, std::string>>(
+      std::unordered_map<std::string, std::string>{{"lightFragment", "light{X}();"}});
+
+  std::vector<std::future<std::string>> results;
+  for (unsigned int i = 0; i < 8; ++i) {
+    results.emplace_back(std::async(std::launch::async, [includesShadersStore, i]() {
+      ProcessingOptions options;
+      options.includesShadersStore         = includesShadersStore;
+      options.indexParameters              = {{"maxSimultaneousLights", i % 3 + 1}};
+      options.shouldUseHighPrecisionShader = true;
+      return process("#include<lightFragment>[0..maxSimultaneousLights]", options);
+    }));
+  }
+
+  for (unsigned int i = 0; i < results.size(); ++i) {
+    std::string expected = "precision highp float;\n";
+    for (unsigned int j = 0; j < i % 3 + 1; ++j) {
+      expected += "light" + std::to_string(j) + "();\n";
+    }
+    EXPECT_EQ(results[i].get(), expected);
+  }
+}
+
+TEST(TestShaderProcessor, RunsTheWebGLProcessorWithoutTheEngine)
+{
+  using namespace BABYLON;
+
+  auto includesShadersStore = std::make_shared<std::unordered_map<std::string, std::string>>();
+  const std::string sourceCode
+    = "#extension GL_EXT_draw_buffers : require\nvoid main(void) {}";
+
+  // Processed on a worker thread as an effect is, from the engine state captured beforehand
+  const auto processInBackground = [&](bool drawBuffersExtensionDisabled) {
+    return std::async(std::launch::async, [&, drawBuffersExtensionDisabled]() {
+             ProcessingOptions options;
+             options.includesShadersStore = includesShadersStore;
+             options.isFragment           = true;
+             options.processor            = std::make_shared<WebGLShaderProcessor>();
+             options.processorParameters.drawBuffersExtensionDisabled
+               = drawBuffersExtensionDisabled;
+             return process(sourceCode, options);
+           })
+      .get();
+  };
+
+  EXPECT_EQ(StringTools::indexOf(processInBackground(true), "GL_EXT_draw_buffers"), -1);
+  EXPECT_NE(StringTools::indexOf(processInBackground(false), "GL_EXT_draw_buffers"), -1);
+}
+
+TEST(TestShaderProcessor, KeepsTheIncludesSnapshotsImmutable)
+{
+  using namespace BABYLON;
+
+  const auto snapshot = Effect::IncludesShadersStore();
+  ASSERT_TRUE(snapshot != nullptr);
+  const auto size = snapshot->size();
+
+  // Publishing an include leaves the snapshots taken before untouched
+  Effect::SetIncludeShader("shaderProcessorTestInclude", "test();");
+  EXPECT_EQ(snapshot->size(), size);
+  EXPECT_EQ(snapshot->count("shaderProcessorTestInclude"), 0u);
+
+  const auto nextSnapshot = Effect::IncludesShadersStore();
+  ASSERT_EQ(nextSnapshot->count("shaderProcessorTestInclude"), 1u);
+  EXPECT_EQ(nextSnapshot->at("shaderProcessorTestInclude"), "test();");
+
+  ProcessingOptions options;
+  options.includesShadersStore = nextSnapshot;
+  EXPECT_EQ(process("#include<shaderProcessorTestInclude>", options),
+            "precision mediump float;\ntest();");
+}
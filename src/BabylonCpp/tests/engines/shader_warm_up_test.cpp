@@ -0,0 +1,128 @@
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+
+#include <babylon/engines/null_engine.h>
+#include <babylon/engines/scene.h>
+#include <babylon/engines/shader_warm_up.h>
+#include <babylon/materials/draw_wrapper.h>
+#include <babylon/materials/effect.h>
+#include <babylon/materials/ieffect_creation_options.h>
+#include <babylon/materials/material.h>
+#include <babylon/meshes/builders/mesh_builder_options.h>
+#include <babylon/meshes/mesh.h>
+#include <babylon/meshes/mesh_builder.h>
+
+namespace {
+
+/**
+ * @brief Null engine failing to link the programs.
+ */
+class LinkFailureEngine : public BABYLON::NullEngine {
+
+public:
+  LinkFailureEngine()
+  {
+    parallelShaderProcessing = false;
+  }
+
+  // As a GL context, no program is created when the link fails
+  BABYLON::GL::IGLProgramPtr
+  createShaderProgram(const BABYLON::IPipelineContextPtr& /*pipelineContext*/,
+                      const std::string& /*vertexCode*/, const std::string& /*fragmentCode*/,
+                      const std::string& /*defines*/, BABYLON::GL::IGLRenderingContext* /*context*/,
+                      const std::vector<std::string>& /*transformFeedbackVaryings*/) override
+  {
+    throw std::runtime_error("Unable to link the program");
+  }
+
+}; // end of class LinkFailureEngine
+
+/**
+ * @brief Material checked through Material::isReady, with a single effect.
+ */
+class SingleEffectMaterial : public BABYLON::Material {
+
+public:
+  SingleEffectMaterial(const std::string& iName, BABYLON::Scene* scene, bool createEffect)
+      : Material(iName, scene), _createEffect{createEffect}
+  {
+  }
+
+  bool isReady(BABYLON::AbstractMesh* /*mesh*/, bool /*useInstances*/,
+               BABYLON::SubMesh* /*subMesh*/) override
+  {
+    using namespace BABYLON;
+    // Without effect, nothing tells that the material will never be ready
+    if (!_createEffect) {
+      return false;
+    }
+
+    if (!getEffect()) {
+      IEffectCreationOptions options;
+      options.attributes = {"position"};
+      _drawWrapper->effect = Effect::New(
+        std::unordered_map<std::string, std::string>{
+          {"vertexSource", "void main(void) { gl_Position = vec4(0.); }"},
+          {"fragmentSource", "void main(void) { gl_FragColor = vec4(1.); }"}},
+        options, getScene()->getEngine());
+    }
+
+    return getEffect()->isReady();
+  }
+
+private:
+  bool _createEffect;
+
+}; // end of class SingleEffectMaterial
+
+} // end of anonymous namespace
+
+TEST(TestShaderWarmUp, CountsTheEffectsWhichFailToCompileAsFailed)
+{
+  using namespace BABYLON;
+
+  LinkFailureEngine engine;
+  auto scene = Scene::New(&engine);
+
+  BoxOptions boxOptions;
+  auto box      = MeshBuilder::CreateBox("box", boxOptions, scene.get());
+  auto material = std::make_shared<SingleEffectMaterial>("material", scene.get(), true);
+  box->material = material;
+
+  IShaderWarmUpOptions options;
+  options.maxAttempts = 0;
+  ShaderWarmUp warmUp(scene.get(), options);
+  ASSERT_EQ(warmUp.totalCount(), 1ull);
+
+  // The effect failed without fallbacks, the warm-up does not wait for it
+  EXPECT_TRUE(warmUp.step());
+  ASSERT_NE(material->getEffect(), nullptr);
+  EXPECT_FALSE(material->getEffect()->getCompilationError().empty());
+  EXPECT_EQ(warmUp.readyCount(), 0ull);
+  EXPECT_EQ(warmUp.failedCount(), 1ull);
+  EXPECT_FLOAT_EQ(warmUp.progress(), 1.f);
+}
+
+TEST(TestShaderWarmUp, GivesUpOnTheCombinationsWhichAreNeverReady)
+{
+  using namespace BABYLON;
+
+  LinkFailureEngine engine;
+  auto scene = Scene::New(&engine);
+
+  BoxOptions boxOptions;
+  auto box      = MeshBuilder::CreateBox("box", boxOptions, scene.get());
+  box->material = std::make_shared<SingleEffectMaterial>("material", scene.get(), false);
+
+  IShaderWarmUpOptions options;
+  options.maxAttempts = 3;
+  ShaderWarmUp warmUp(scene.get(), options);
+
+  EXPECT_FALSE(warmUp.step());
+  EXPECT_FALSE(warmUp.step());
+  EXPECT_EQ(warmUp.failedCount(), 0ull);
+  EXPECT_TRUE(warmUp.step());
+  EXPECT_TRUE(warmUp.isDone());
+  EXPECT_EQ(warmUp.failedCount(), 1ull);
+}
@@ -0,0 +1,106 @@
+#include <gtest/gtest.h>
+
+#include "../test_utils.h"
+
+#include <babylon/engines/snapshot_rendering_stream.h>
+#include <babylon/materials/effect.h>
+#include <babylon/materials/ieffect_creation_options.h>
+#include <babylon/meshes/webgl/webgl_data_buffer.h>
+#include <babylon/states/alpha_state.h>
+#include <babylon/states/depth_culling_state.h>
+
+TEST(TestSnapshotRenderingStream, RecordsDrawsAndStateChanges)
+{
+  using namespace BABYLON;
+  using UniformType = SnapshotRenderingStream::UniformType;
+
+  DepthCullingState depthCullingState;
+  AlphaState alphaState;
+  SnapshotRenderingStream stream(nullptr);
+  EXPECT_FALSE(stream.isRecorded());
+
+  stream.beginRecording(3);
+  stream.recordUniform(UniformType::Float4, nullptr, 1.f, 2.f, 3.f, 4.f);
+  // The first draw always captures the states
+  stream.recordDraw(true, 0, 0, 36, 0, depthCullingState, alphaState, true, false);
+  stream.recordUniform(UniformType::Int, nullptr, 1);
+  stream.recordDraw(true, 0, 36, 36, 0, depthCullingState, alphaState, true, false);
+  // Dirty states are captured before the draw
+  alphaState.alphaBlend = true;
+  stream.recordDraw(false, 0, 0, 3, 2, depthCullingState, alphaState, true, true);
+  stream.endRecording({});
+
+  EXPECT_TRUE(stream.isRecorded());
+  EXPECT_EQ(stream.drawCount(), 3ull);
+  EXPECT_EQ(stream.commandCount(), 7ull);
+}
+
+TEST(TestSnapshotRenderingStream, SkipsLiveBuffers)
+{
+  using namespace BABYLON;
+
+  auto sceneBuffer    = std::make_shared<WebGLDataBuffer>(nullptr);
+  auto materialBuffer = std::make_shared<WebGLDataBuffer>(nullptr);
+  const Float32Array data(16, 1.f);
+
+  SnapshotRenderingStream stream(nullptr);
+  stream.beginRecording(0);
+  stream.addLiveBuffer(sceneBuffer);
+  stream.recordUpdateUniformBuffer(sceneBuffer, data, -1, -1);
+  stream.recordUpdateUniformBuffer(materialBuffer, data, -1, -1);
+  stream.recordBindUniformBufferBase(sceneBuffer, 0, "Scene");
+  stream.endRecording({});
+
+  // Only the scene buffer update is left out
+  EXPECT_EQ(stream.commandCount(), 2ull);
+}
+
+TEST(TestSnapshotRenderingStream, IsValidForRecordedCameraAndGeneration)
+{
+  using namespace BABYLON;
+
+  auto* camera = reinterpret_cast<Camera*>(0x10);
+  SnapshotRenderingStream stream(camera);
+  EXPECT_FALSE(stream.isValidFor(camera, 0));
+
+  stream.beginRecording(5);
+  EXPECT_FALSE(stream.isValidFor(camera, 5));
+  stream.endRecording({});
+
+  EXPECT_TRUE(stream.isValidFor(camera, 5));
+  EXPECT_FALSE(stream.isValidFor(camera, 6));
+  EXPECT_FALSE(stream.isValidFor(nullptr, 5));
+}
+
+TEST(TestSnapshotRenderingStream, RecordsUniformBufferBindsAlreadyCached)
+{
+  using namespace BABYLON;
+
+  auto engine = createSubject();
+  IEffectCreationOptions options;
+  options.attributes          = {"position"};
+  options.uniformBuffersNames = {"Scene", "Material"};
+  auto effect                 = Effect::New(
+    std::unordered_map<std::string, std::string>{
+      {"vertexSource", "void main(void) { gl_Position = vec4(0.); }"},
+      {"fragmentSource", "void main(void) { gl_FragColor = vec4(1.); }"}},
+    options, engine.get());
+
+  auto sceneBuffer    = std::make_shared<WebGLDataBuffer>(nullptr);
+  auto materialBuffer = std::make_shared<WebGLDataBuffer>(nullptr);
+  // Bound before the recording starts, the effect binding cache knows both buffers
+  effect->bindUniformBuffer(sceneBuffer, "Scene");
+  effect->bindUniformBuffer(materialBuffer, "Material");
+
+  SnapshotRenderingStream stream(nullptr);
+  engine->_beginSnapshotRecording(&stream);
+  effect->bindUniformBuffer(sceneBuffer, "Scene");
+  effect->bindUniformBuffer(materialBuffer, "Material");
+  // Cached from now on
+  effect->bindUniformBuffer(sceneBuffer, "Scene");
+  engine->_endSnapshotRecording();
+  stream.endRecording({});
+
+  // The replayed frame does not depend on the bindings made before the recording
+  EXPECT_EQ(stream.commandCount(), 2ull);
+}
@@ -0,0 +1,108 @@
+#include <gtest/gtest.h>
+
+#include <babylon/engines/null_engine.h>
+#include <babylon/engines/uniform_buffer_ring.h>
+#include <babylon/meshes/webgl/webgl_data_buffer.h>
+
+namespace {
+
+/**
+ * @brief Null engine recording the uniform buffer uploads.
+ */
+class UploadRecordingEngine : public BABYLON::NullEngine {
+
+public:
+  struct Upload {
+    BABYLON::WebGLDataBufferPtr buffer;
+    BABYLON::Float32Array elements;
+    int offset;
+  }; // end of struct Upload
+
+  void updateUniformBuffer(const BABYLON::WebGLDataBufferPtr& uniformBuffer,
+                           const BABYLON::Float32Array& elements, int offset = -1,
+                           int count = -1) override
+  {
+    NullEngine::updateUniformBuffer(uniformBuffer, elements, offset, count);
+    uploads.emplace_back(Upload{uniformBuffer, elements, offset});
+  }
+
+  std::vector<Upload> uploads;
+
+}; // end of class UploadRecordingEngine
+
+} // end of anonymous namespace
+
+TEST(TestUniformBufferRing, MovesToANewChunkWhenTheChunkIsFull)
+{
+  using namespace BABYLON;
+
+  UploadRecordingEngine engine;
+  // Ranges aligned on 4 floats, chunks of 16 floats
+  UniformBufferRing ring(&engine, 16, 64, 2);
+  const Float32Array data{1.f, 2.f, 3.f, 4.f, 5.f, 6.f};
+
+  const auto first  = ring.allocate(data);
+  const auto second = ring.allocate(data);
+  EXPECT_EQ(first.byteOffset, 0ull);
+  EXPECT_EQ(first.byteLength, 24ull);
+  EXPECT_EQ(second.buffer, first.buffer);
+  EXPECT_EQ(second.byteOffset, 32ull);
+  EXPECT_TRUE(engine.uploads.empty());
+
+  // No room left at offset 16, the pending data of the full chunk is uploaded first
+  const auto third = ring.allocate(data);
+  EXPECT_NE(third.buffer, first.buffer);
+  EXPECT_EQ(third.byteOffset, 0ull);
+  EXPECT_EQ(ring.chunkCount(), 2ull);
+  ASSERT_EQ(engine.uploads.size(), 1ull);
+  EXPECT_EQ(engine.uploads[0].buffer, first.buffer);
+  EXPECT_EQ(engine.uploads[0].offset, 0);
+  ASSERT_EQ(engine.uploads[0].elements.size(), 14ull);
+  EXPECT_EQ(Float32Array(engine.uploads[0].elements.begin() + 8, engine.uploads[0].elements.end()),
+            data);
+
+  // A single upload of what was allocated since the last flush
+  ring.flush();
+  ring.flush();
+  ASSERT_EQ(engine.uploads.size(), 2ull);
+  EXPECT_EQ(engine.uploads[1].buffer, third.buffer);
+  EXPECT_EQ(engine.uploads[1].elements, data);
+  EXPECT_EQ(ring.uploads(), 2ull);
+
+  // Data larger than a chunk gets its own chunk
+  const auto large = ring.allocate(Float32Array(20, 1.f));
+  EXPECT_EQ(large.byteOffset, 0ull);
+  EXPECT_EQ(large.byteLength, 80ull);
+  EXPECT_EQ(ring.chunkCount(), 3ull);
+}
+
+TEST(TestUniformBufferRing, RecyclesChunksOnceTheirFrameIsNoLongerInFlight)
+{
+  using namespace BABYLON;
+
+  UploadRecordingEngine engine;
+  UniformBufferRing ring(&engine, 16, 64, 3);
+  const Float32Array data(4, 1.f);
+
+  std::vector<UniformBufferRing::Range> ranges;
+  for (unsigned int frame = 0; frame < 4; ++frame) {
+    ranges.emplace_back(ring.allocate(data));
+    EXPECT_TRUE(ring.isValid(ranges.back()));
+    engine.endFrame();
+    // The ranges are only valid in the frame they were allocated in
+    EXPECT_FALSE(ring.isValid(ranges.back()));
+  }
+
+  // The frames in flight use distinct buffers, the oldest buffer is reused afterwards
+  EXPECT_NE(ranges[1].buffer, ranges[0].buffer);
+  EXPECT_NE(ranges[2].buffer, ranges[0].buffer);
+  EXPECT_NE(ranges[2].buffer, ranges[1].buffer);
+  EXPECT_EQ(ranges[3].buffer, ranges[0].buffer);
+  EXPECT_EQ(ring.chunkCount(), 3ull);
+
+  // The data left of a frame is uploaded before moving to the next frame
+  ASSERT_EQ(engine.uploads.size(), 4ull);
+  for (size_t i = 0; i < ranges.size(); ++i) {
+    EXPECT_EQ(engine.uploads[i].buffer, ranges[i].buffer);
+  }
+}
@@ -0,0 +1,82 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <random>
+
+#include <babylon/core/thread_pool.h>
+#include <babylon/lights/clustered/clustered_light_grid.h>
+#include <babylon/maths/vector3.h>
+
+TEST(TestClusteredLightGrid, binsLightInItsCluster)
+{
+  using namespace BABYLON;
+
+  // 16 x 9 tiles of 0.125 x 0.125 (x / z and y / z), 24 slices between 1 and 100
+  ClusteredLightGrid grid(16, 9, 24, 63);
+  grid.setPerspective(-1.f, 1.f, -0.5625f, 0.5625f, 1.f, 100.f);
+  EXPECT_EQ(grid.computeSlice(7.f), 10ull);
+
+  // Center of the tile (8, 4) at depth 7
+  const auto lightIndex = grid.addLight(Vector3(0.0625f * 7.f, 0.f, 7.f), 0.05f);
+  // Behind the camera
+  grid.addLight(Vector3(0.f, 0.f, -5.f), 1.f);
+  grid.bin();
+
+  const auto cluster = grid.getClusterIndex(8, 4, 10);
+  ASSERT_EQ(grid.getClusterLightCount(cluster), 1u);
+  EXPECT_EQ(grid.getClusterLights(cluster)[0], lightIndex);
+
+  size_t binnedCount = 0;
+  for (size_t i = 0; i < grid.clusterCount(); ++i) {
+    binnedCount += grid.getClusterLightCount(i);
+  }
+  EXPECT_EQ(binnedCount, 1ull);
+  EXPECT_EQ(grid.overflowCount(), 0ull);
+}
+
+TEST(TestClusteredLightGrid, scalarSimdAndThreadedBinningsMatch)
+{
+  using namespace BABYLON;
+
+  std::mt19937 generator(7);
+  std::uniform_real_distribution<float> horizontal(-60.f, 60.f);
+  std::uniform_real_distribution<float> depth(-5.f, 120.f);
+  std::uniform_real_distribution<float> range(0.5f, 8.f);
+
+  ClusteredLightGrid scalarGrid, simdGrid, threadedGrid;
+  for (auto grid : {&scalarGrid, &simdGrid, &threadedGrid}) {
+    grid->setPerspective(-0.8f, 0.8f, -0.45f, 0.45f, 0.5f, 100.f);
+  }
+  for (size_t i = 0; i < 2000; ++i) {
+    const Vector3 position(horizontal(generator), horizontal(generator) * 0.5f, depth(generator));
+    const auto lightRange = range(generator);
+    for (auto grid : {&scalarGrid, &simdGrid, &threadedGrid}) {
+      grid->addLight(position, lightRange);
+    }
+  }
+
+  ThreadPool threadPool(3);
+  scalarGrid.bin(nullptr, true);
+  simdGrid.bin();
+  threadedGrid.bin(&threadPool);
+
+  size_t binnedCount = 0;
+  for (size_t cluster = 0; cluster < scalarGrid.clusterCount(); ++cluster) {
+    const auto lightCount = scalarGrid.getClusterLightCount(cluster);
+    ASSERT_EQ(simdGrid.getClusterLightCount(cluster), lightCount);
+    ASSERT_EQ(threadedGrid.getClusterLightCount(cluster), lightCount);
+    for (uint32_t i = 0; i < lightCount; ++i) {
+      EXPECT_EQ(simdGrid.getClusterLights(cluster)[i], scalarGrid.getClusterLights(cluster)[i]);
+      EXPECT_EQ(threadedGrid.getClusterLights(cluster)[i],
+                scalarGrid.getClusterLights(cluster)[i]);
+      if (i > 0) {
+        EXPECT_LT(scalarGrid.getClusterLights(cluster)[i - 1],
+                  scalarGrid.getClusterLights(cluster)[i]);
+      }
+    }
+    binnedCount += lightCount;
+  }
+  EXPECT_GT(binnedCount, 0ull);
+  EXPECT_EQ(simdGrid.overflowCount(), scalarGrid.overflowCount());
+  EXPECT_EQ(threadedGrid.overflowCount(), scalarGrid.overflowCount());
+}
@@ -0,0 +1,55 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "../test_utils.h"
+
+#include <babylon/engines/scene.h>
+#include <babylon/lights/hemispheric_light.h>
+#include <babylon/lights/light_spatial_index.h>
+#include <babylon/lights/point_light.h>
+#include <babylon/meshes/builders/mesh_builder_options.h>
+#include <babylon/meshes/mesh.h>
+#include <babylon/meshes/mesh_builder.h>
+
+TEST(TestLightSpatialIndex, rankedLightSources)
+{
+  using namespace BABYLON;
+  auto engine = createSubject();
+  auto scene  = Scene::New(engine.get());
+
+  BoxOptions boxOptions;
+  boxOptions.size = 1.f;
+  auto box        = MeshBuilder::CreateBox("box", boxOptions, scene.get());
+  box->computeWorldMatrix(true);
+
+  auto hemisphericLight = HemisphericLight::New("hemi", Vector3(0.f, 1.f, 0.f), scene.get());
+  auto nearLight        = PointLight::New("near", Vector3(2.f, 0.f, 0.f), scene.get());
+  auto farLight         = PointLight::New("far", Vector3(4.f, 0.f, 0.f), scene.get());
+  auto outOfRangeLight  = PointLight::New("out", Vector3(50.f, 0.f, 0.f), scene.get());
+  for (const auto& light : {nearLight, farLight, outOfRangeLight}) {
+    light->range = 5.f;
+  }
+
+  LightSpatialIndex index(scene.get());
+  EXPECT_EQ(index.localLightCount(), 3ull);
+  EXPECT_EQ(index.globalLightCount(), 1ull);
+
+  std::vector<LightPtr> lightSources;
+  index.getLightSources(box.get(), lightSources);
+  ASSERT_EQ(lightSources.size(), 3ull);
+  EXPECT_EQ(lightSources[0], hemisphericLight);
+  EXPECT_EQ(lightSources[1], nearLight);
+  EXPECT_EQ(lightSources[2], farLight);
+
+  // Moving the box in the influence of the last light only
+  box->position().set(48.f, 0.f, 0.f);
+  box->computeWorldMatrix(true);
+  index.getLightSources(box.get(), lightSources);
+  ASSERT_EQ(lightSources.size(), 2ull);
+  EXPECT_EQ(lightSources[0], hemisphericLight);
+  EXPECT_EQ(lightSources[1], outOfRangeLight);
+
+  // Removing a light
+  scene->removeLight(outOfRangeLight);
+  EXPECT_EQ(index.localLightCount(), 2ull);
+}
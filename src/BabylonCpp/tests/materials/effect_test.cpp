@@ -0,0 +1,142 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <stdexcept>
+#include <thread>
+
+#include <babylon/engines/null_engine.h>
+#include <babylon/materials/effect.h>
+#include <babylon/materials/effect_fallbacks.h>
+#include <babylon/materials/ieffect_creation_options.h>
+#include <babylon/materials/material_defines.h>
+
+namespace {
+
+/**
+ * @brief Null engine failing to link the programs a given number of times.
+ */
+class FlakyLinkEngine : public BABYLON::NullEngine {
+
+public:
+  FlakyLinkEngine(bool iParallelShaderProcessing, size_t iLinkFailures)
+      : linkFailures{iLinkFailures}
+  {
+    parallelShaderProcessing = iParallelShaderProcessing;
+  }
+
+  std::vector<BABYLON::WebGLUniformLocationPtr>
+  getUniforms(BABYLON::IPipelineContext* pipelineContext,
+              const std::vector<std::string>& uniformsNames) override
+  {
+    if (linkFailures > 0) {
+      --linkFailures;
+      throw std::runtime_error("Unable to link the program");
+    }
+    return NullEngine::getUniforms(pipelineContext, uniformsNames);
+  }
+
+  size_t linkFailures;
+
+}; // end of class FlakyLinkEngine
+
+BABYLON::EffectPtr CreateEffect(BABYLON::ThinEngine* engine)
+{
+  using namespace BABYLON;
+  auto fallbacks = std::make_unique<EffectFallbacks>();
+  fallbacks->addFallback(0, "BUMP");
+  fallbacks->addFallback(1, "FOG");
+
+  IEffectCreationOptions options;
+  options.attributes = {"position"};
+  options.defines    = "#define BUMP\n#define FOG\n";
+  options.fallbacks  = std::move(fallbacks);
+  return Effect::New(
+    std::unordered_map<std::string, std::string>{
+      {"vertexSource", "void main(void) { gl_Position = vec4(0.); }"},
+      {"fragmentSource", "void main(void) { gl_FragColor = vec4(1.); }"}},
+    options, engine);
+}
+
+// Polls the readiness as the materials do, through the const accessor, until the effect compiled
+// or ran out of fallbacks
+bool WaitForTheCompilation(const BABYLON::Effect& effect)
+{
+  const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+  while (!effect.isReady() && !effect.allFallbacksProcessed()
+         && std::chrono::steady_clock::now() < deadline) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  return effect.isReady();
+}
+
+} // end of anonymous namespace
+
+TEST(TestEffect, BecomesReadyWhenTheShadersAreProcessedInParallel)
+{
+  using namespace BABYLON;
+
+  FlakyLinkEngine engine(true, 0);
+  auto effect = CreateEffect(&engine);
+  ASSERT_TRUE(WaitForTheCompilation(*effect));
+
+  EXPECT_TRUE(effect->getCompilationError().empty());
+  EXPECT_FALSE(effect->allFallbacksProcessed());
+  EXPECT_EQ(effect->defines, "#define BUMP\n#define FOG\n");
+  EXPECT_NE(effect->vertexSourceCode().find("gl_Position"), std::string::npos);
+}
+
+TEST(TestEffect, UsesTheFallbacksAsWhenTheShadersAreProcessedInline)
+{
+  using namespace BABYLON;
+
+  for (const auto linkFailures : {1ull, 2ull, 3ull}) {
+    FlakyLinkEngine inlineEngine(false, linkFailures);
+    FlakyLinkEngine parallelEngine(true, linkFailures);
+    auto inlineEffect   = CreateEffect(&inlineEngine);
+    auto parallelEffect = CreateEffect(&parallelEngine);
+
+    // Without fallbacks left, the last link failure leaves the effect without program
+    const auto compiles = linkFailures < 3;
+    EXPECT_TRUE(inlineEffect->isReady() == compiles);
+    EXPECT_TRUE(WaitForTheCompilation(*parallelEffect) == compiles);
+
+    EXPECT_EQ(parallelEffect->defines, inlineEffect->defines);
+    EXPECT_EQ(parallelEffect->allFallbacksProcessed(), inlineEffect->allFallbacksProcessed());
+    EXPECT_EQ(parallelEffect->getCompilationError(), inlineEffect->getCompilationError());
+    EXPECT_EQ(parallelEngine.linkFailures, 0ull);
+  }
+}
+
+TEST(TestEffect, CachesTheMaterialEffectsOnTheHashOfTheirDefines)
+{
+  using namespace BABYLON;
+
+  FlakyLinkEngine engine(false, 0);
+  const auto createEffect = [&engine](MaterialDefines& defines) {
+    IEffectCreationOptions options;
+    options.attributes      = {"position"};
+    options.materialDefines = &defines;
+    options.defines         = defines.toString();
+    return engine.createEffect(
+      std::unordered_map<std::string, std::string>{
+        {"vertexSource", "void main(void) { gl_Position = vec4(0.); }"},
+        {"fragmentSource", "void main(void) { gl_FragColor = vec4(1.); }"}},
+      options, &engine);
+  };
+
+  MaterialDefines defines1, defines2;
+  defines1.boolDef = {{"DIFFUSE", true}, {"BUMP", false}};
+  defines2.boolDef = {{"BUMP", false}, {"DIFFUSE", true}};
+  const auto effect = createEffect(defines1);
+  EXPECT_EQ(createEffect(defines2), effect);
+
+  defines2.boolDef["BUMP"] = true;
+  const auto bumpEffect    = createEffect(defines2);
+  EXPECT_NE(bumpEffect, effect);
+  EXPECT_EQ(bumpEffect->defines, defines2.toString());
+
+  // A released effect leaves the cache
+  effect->dispose();
+  EXPECT_NE(createEffect(defines1), effect);
+  EXPECT_EQ(createEffect(defines2), bumpEffect);
+}
@@ -0,0 +1,79 @@
+#include <gtest/gtest.h>
+
+#include <thread>
+
+#include <babylon/materials/material_define_set.h>
+#include <babylon/materials/material_defines.h>
+
+TEST(TestMaterialDefines, ComparesDefineSets)
+{
+  using namespace BABYLON;
+
+  MaterialDefines defines1, defines2;
+  defines1.boolDef = {{"DIFFUSE", false}, {"BUMP", true}};
+  defines2.boolDef = {{"BUMP", true}, {"DIFFUSE", false}};
+  defines1.intDef["NUM_BONE_INFLUENCERS"] = 4;
+  defines2.intDef["NUM_BONE_INFLUENCERS"] = 4;
+  EXPECT_TRUE(defines1.isEqual(defines2));
+  EXPECT_EQ(defines1.hashCode(), defines2.hashCode());
+
+  // A present false define differs from a missing define
+  defines2.boolDef["SPECULAR"] = false;
+  EXPECT_FALSE(defines1.isEqual(defines2));
+  EXPECT_NE(defines1.hashCode(), defines2.hashCode());
+  defines2.boolDef.erase("SPECULAR");
+  EXPECT_TRUE(defines1.isEqual(defines2));
+
+  defines2.intDef["NUM_BONE_INFLUENCERS"] = 2;
+  EXPECT_FALSE(defines1.isEqual(defines2));
+  EXPECT_NE(defines1.hashCode(), defines2.hashCode());
+
+  defines1.cloneTo(defines2);
+  EXPECT_TRUE(defines1.isEqual(defines2));
+  EXPECT_TRUE(defines2["BUMP"]);
+  EXPECT_FALSE(defines2["DIFFUSE"]);
+  EXPECT_FALSE(defines2["UNKNOWN_DEFINE"]);
+  EXPECT_TRUE(defines2.boolDef.contains("DIFFUSE"));
+  EXPECT_FALSE(defines2.boolDef.contains("UNKNOWN_DEFINE"));
+}
+
+TEST(TestMaterialDefines, WritesDefinesInCanonicalOrder)
+{
+  using namespace BABYLON;
+
+  MaterialDefines defines1, defines2;
+  defines1.boolDef["ZDEFINE"] = true;
+  defines1.boolDef["ADEFINE"] = true;
+  defines1.boolDef["MDEFINE"] = false;
+  defines1.intDef["ZCOUNT"]   = 2;
+  defines1.intDef["ACOUNT"]   = 1;
+
+  defines2.intDef["ACOUNT"]   = 1;
+  defines2.intDef["ZCOUNT"]   = 2;
+  defines2.boolDef["MDEFINE"] = false;
+  defines2.boolDef["ADEFINE"] = true;
+  defines2.boolDef["ZDEFINE"] = true;
+
+  const std::string expected
+    = "#define ADEFINE\n#define ZDEFINE\n#define ACOUNT 1\n#define ZCOUNT 2\n";
+  EXPECT_EQ(defines1.toString(), expected);
+  EXPECT_EQ(defines2.toString(), expected);
+}
+
+TEST(TestMaterialDefineRegistry, SharesIdentifiersAcrossThreads)
+{
+  using namespace BABYLON;
+
+  MaterialDefineId id = 0;
+  EXPECT_FALSE(MaterialDefineRegistry::Find("REGISTRY_TEST_DEFINE", id));
+
+  // Interned by another thread, seen by the lookups of this one
+  MaterialDefineId internedId = 0;
+  std::thread([&internedId]() {
+    internedId = MaterialDefineRegistry::Intern("REGISTRY_TEST_DEFINE");
+  }).join();
+  ASSERT_TRUE(MaterialDefineRegistry::Find("REGISTRY_TEST_DEFINE", id));
+  EXPECT_EQ(id, internedId);
+  EXPECT_EQ(MaterialDefineRegistry::Intern("REGISTRY_TEST_DEFINE"), internedId);
+  EXPECT_EQ(MaterialDefineRegistry::Name(internedId), "REGISTRY_TEST_DEFINE");
+}
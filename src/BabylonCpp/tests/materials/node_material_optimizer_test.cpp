@@ -0,0 +1,102 @@
+#include <gtest/gtest.h>
+
+#include <babylon/animations/animation_value.h>
+#include <babylon/materials/node/blocks/add_block.h>
+#include <babylon/materials/node/blocks/fragment/fragment_output_block.h>
+#include <babylon/materials/node/blocks/input/input_block.h>
+#include <babylon/materials/node/blocks/scale_block.h>
+#include <babylon/materials/node/node_material_connection_point.h>
+#include <babylon/materials/node/optimizers/node_material_optimizer.h>
+#include <babylon/maths/color3.h>
+
+namespace {
+
+BABYLON::InputBlockPtr CreateColor3(const std::string& name, const BABYLON::Color3& color)
+{
+  using namespace BABYLON;
+  auto input = InputBlock::New(name, NodeMaterialBlockTargets::Vertex,
+                               NodeMaterialBlockConnectionPointTypes::Color3);
+  input->value      = std::make_shared<AnimationValue>(color);
+  input->isConstant = true;
+  return input;
+}
+
+} // end of anonymous namespace
+
+TEST(TestNodeMaterialOptimizer, FoldsConstantColorsAndRestoresTheGraph)
+{
+  using namespace BABYLON;
+
+  auto left           = CreateColor3("left", Color3(0.25f, 0.5f, 0.75f));
+  auto right          = CreateColor3("right", Color3(0.5f, 0.25f, 0.125f));
+  auto add            = AddBlock::New("add");
+  auto fragmentOutput = FragmentOutputBlock::New("fragmentOutput");
+  left->output()->connectTo(add->left());
+  right->output()->connectTo(add->right());
+  add->output()->connectTo(fragmentOutput->rgb());
+
+  NodeMaterialOptimizer optimizer;
+  optimizer.optimize({}, {fragmentOutput}, {left, right, add, fragmentOutput});
+  EXPECT_EQ(optimizer.statistics.foldedBlocks, 1ull);
+  EXPECT_EQ(optimizer.statistics.fragmentInstructionsBefore, 2ull);
+  EXPECT_EQ(optimizer.statistics.fragmentInstructionsAfter, 1ull);
+
+  // The constant keeps the color type of the folded block
+  const auto& connectedPoint = fragmentOutput->rgb()->connectedPoint();
+  ASSERT_NE(connectedPoint, nullptr);
+  ASSERT_NE(connectedPoint->ownerBlock(), add);
+  ASSERT_TRUE(connectedPoint->ownerBlock()->isInput());
+  auto constant = std::static_pointer_cast<InputBlock>(connectedPoint->ownerBlock());
+  EXPECT_EQ(constant->type(), NodeMaterialBlockConnectionPointTypes::Color3);
+  EXPECT_TRUE(constant->isConstant);
+  EXPECT_TRUE(constant->value()->get<Color3>().equals(Color3(0.75f, 0.75f, 0.875f)));
+
+  // The graph authored by the user is left untouched
+  const auto createdBlocks = optimizer.restore();
+  ASSERT_EQ(createdBlocks.size(), 1ull);
+  EXPECT_EQ(createdBlocks[0], constant);
+  EXPECT_EQ(fragmentOutput->rgb()->connectedPoint(), add->output());
+  EXPECT_EQ(add->left()->connectedPoint(), left->output());
+  EXPECT_EQ(add->right()->connectedPoint(), right->output());
+  EXPECT_FALSE(constant->output()->hasEndpoints());
+}
+
+TEST(TestNodeMaterialOptimizer, RemovesTheDeadBlocksOfTheAttachedBlocks)
+{
+  using namespace BABYLON;
+
+  auto left           = CreateColor3("left", Color3(0.25f, 0.5f, 0.75f));
+  auto right          = CreateColor3("right", Color3(0.5f, 0.25f, 0.125f));
+  auto factor         = InputBlock::New("factor", NodeMaterialBlockTargets::Vertex,
+                                NodeMaterialBlockConnectionPointTypes::Float);
+  auto add            = AddBlock::New("add");
+  auto fragmentOutput = FragmentOutputBlock::New("fragmentOutput");
+  left->output()->connectTo(add->left());
+  right->output()->connectTo(add->right());
+  add->output()->connectTo(fragmentOutput->rgb());
+
+  // Dead chain, the scale block is only connected to the dead add block
+  auto deadAdd   = AddBlock::New("deadAdd");
+  auto deadScale = ScaleBlock::New("deadScale");
+  left->output()->connectTo(deadAdd->left());
+  right->output()->connectTo(deadAdd->right());
+  deadAdd->output()->connectTo(deadScale->input());
+  factor->output()->connectTo(deadScale->factor());
+
+  NodeMaterialOptimizer optimizer;
+  optimizer.foldConstants        = false;
+  optimizer.mergeIdenticalBlocks = false;
+  optimizer.optimize({}, {fragmentOutput}, {left, right, add, fragmentOutput, deadScale});
+  EXPECT_EQ(optimizer.statistics.removedBlocks, 2ull);
+  EXPECT_EQ(left->output()->endpoints().size(), 1ull);
+  EXPECT_EQ(right->output()->endpoints().size(), 1ull);
+  EXPECT_FALSE(deadScale->input()->isConnected());
+  EXPECT_FALSE(deadScale->factor()->isConnected());
+  EXPECT_EQ(fragmentOutput->rgb()->connectedPoint(), add->output());
+
+  EXPECT_TRUE(optimizer.restore().empty());
+  EXPECT_EQ(deadAdd->left()->connectedPoint(), left->output());
+  EXPECT_EQ(deadAdd->right()->connectedPoint(), right->output());
+  EXPECT_EQ(deadScale->input()->connectedPoint(), deadAdd->output());
+  EXPECT_EQ(deadScale->factor()->connectedPoint(), factor->output());
+}
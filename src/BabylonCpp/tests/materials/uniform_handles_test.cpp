@@ -0,0 +1,138 @@
+#include <gtest/gtest.h>
+
+#include <babylon/engines/null_engine.h>
+#include <babylon/engines/webgl/webgl_pipeline_context.h>
+#include <babylon/interfaces/igl_rendering_context.h>
+#include <babylon/materials/effect.h>
+#include <babylon/materials/ieffect_creation_options.h>
+#include <babylon/materials/uniform_buffer.h>
+
+namespace {
+
+/**
+ * @brief Null engine giving a location to every uniform and recording the float uploads.
+ */
+class UniformRecordingEngine : public BABYLON::NullEngine {
+
+public:
+  UniformRecordingEngine()
+  {
+    parallelShaderProcessing = false;
+  }
+
+  std::vector<BABYLON::WebGLUniformLocationPtr>
+  getUniforms(BABYLON::IPipelineContext* /*pipelineContext*/,
+              const std::vector<std::string>& uniformsNames) override
+  {
+    std::vector<BABYLON::WebGLUniformLocationPtr> uniforms;
+    for (size_t i = 0; i < uniformsNames.size(); ++i) {
+      uniforms.emplace_back(
+        std::make_shared<BABYLON::GL::IGLUniformLocation>(static_cast<int>(i)));
+    }
+    return uniforms;
+  }
+
+  bool setFloat(const BABYLON::WebGLUniformLocationPtr& uniform, float value) override
+  {
+    uploads.emplace_back(uniform.get(), value);
+    return true;
+  }
+
+  std::vector<std::pair<BABYLON::GL::IGLUniformLocation*, float>> uploads;
+
+}; // end of class UniformRecordingEngine
+
+BABYLON::EffectPtr CreateEffect(BABYLON::ThinEngine* engine,
+                                const std::vector<std::string>& uniformsNames,
+                                const std::vector<std::string>& samplers = {})
+{
+  using namespace BABYLON;
+  IEffectCreationOptions options;
+  options.attributes    = {"position"};
+  options.uniformsNames = uniformsNames;
+  options.samplers      = samplers;
+  return Effect::New(
+    std::unordered_map<std::string, std::string>{
+      {"vertexSource", "void main(void) { gl_Position = vec4(0.); }"},
+      {"fragmentSource", "void main(void) { gl_FragColor = vec4(1.); }"}},
+    options, engine);
+}
+
+} // end of anonymous namespace
+
+TEST(TestUniformHandles, EffectHandlesShareTheValueCacheOfTheNames)
+{
+  using namespace BABYLON;
+
+  UniformRecordingEngine engine;
+  auto effect = CreateEffect(&engine, {"world", "color"}, {"diffuseSampler"});
+  ASSERT_TRUE(effect->isReady());
+
+  // Handles follow the uniform names, the samplers come last
+  EXPECT_EQ(effect->getUniformHandle("world"), 0);
+  EXPECT_EQ(effect->getUniformHandle("color"), 1);
+  EXPECT_EQ(effect->getUniformHandle("diffuseSampler"), 2);
+  EXPECT_EQ(effect->getUniformHandle("missing"), -1);
+
+  const auto color = effect->getUniformHandle("color");
+  effect->setFloat(color, 1.f);
+  effect->setFloat(color, 1.f);
+  effect->setFloat("color", 1.f);
+  ASSERT_EQ(engine.uploads.size(), 1ull);
+  EXPECT_EQ(engine.uploads.back().first, effect->getUniform("color").get());
+
+  effect->setFloat("color", 2.f);
+  effect->setFloat(color, 2.f);
+  EXPECT_EQ(engine.uploads.size(), 2ull);
+
+  // Forgotten values are uploaded again
+  std::static_pointer_cast<WebGLPipelineContext>(effect->getPipelineContext())->_clearValueCache();
+  effect->setFloat(color, 2.f);
+  EXPECT_EQ(engine.uploads.size(), 3ull);
+
+  // Unknown handles are ignored
+  effect->setFloat(-1, 3.f);
+  effect->setFloat(42, 3.f);
+  EXPECT_EQ(engine.uploads.size(), 3ull);
+}
+
+TEST(TestUniformHandles, BufferHandlesAreResolvedAgainWhenTheEffectChanges)
+{
+  using namespace BABYLON;
+
+  UniformRecordingEngine engine;
+  ASSERT_FALSE(engine.supportsUniformBuffers());
+
+  UniformBuffer buffer(&engine);
+  buffer.addUniform("world", 16);
+  buffer.addUniform("color", 1);
+  buffer.create();
+  const auto color = buffer.getUniformHandle("color");
+  EXPECT_EQ(color, 1);
+  EXPECT_EQ(buffer.getUniformHandle("missing"), -1);
+
+  // Same uniforms, declared in a different order
+  auto first  = CreateEffect(&engine, {"color", "world"});
+  auto second = CreateEffect(&engine, {"world", "color"});
+  ASSERT_TRUE(first->isReady());
+  ASSERT_TRUE(second->isReady());
+
+  buffer.bindToEffect(first.get(), "Material");
+  buffer.updateFloatByHandle(color, 1.f);
+  ASSERT_EQ(engine.uploads.size(), 1ull);
+  EXPECT_EQ(engine.uploads.back().first, first->getUniform("color").get());
+
+  buffer.bindToEffect(second.get(), "Material");
+  buffer.updateFloatByHandle(color, 1.f);
+  ASSERT_EQ(engine.uploads.size(), 2ull);
+  EXPECT_EQ(engine.uploads.back().first, second->getUniform("color").get());
+
+  // Back to the first effect, its own value cache is used
+  buffer.bindToEffect(first.get(), "Material");
+  buffer.updateFloatByHandle(color, 1.f);
+  EXPECT_EQ(engine.uploads.size(), 2ull);
+  buffer.updateFloatByHandle(color, 2.f);
+  ASSERT_EQ(engine.uploads.size(), 3ull);
+  EXPECT_EQ(engine.uploads.back().first, first->getUniform("color").get());
+  EXPECT_EQ(engine.uploads.back().second, 2.f);
+}
@@ -29,3 +29,55 @@ TEST(TestGeometry, TestGetVerticesData_Vec3FloatColor)
   auto result = geometry->getVerticesData(VertexBuffer::ColorKind);
   EXPECT_THAT(result, ::testing::ContainerEq(data));
 }
+
+TEST(TestGeometry, TestGetVerticesDataView_Interleaved)
+{
+  using namespace BABYLON;
+  // interleaved position (vec3) and uv (vec2)
+  auto subject = createSubject();
+  auto scene   = Scene::New(subject.get());
+  Float32Array data{0.f, 1.f, 2.f, 0.1f, 0.2f, 3.f, 4.f, 5.f, 0.3f, 0.4f};
+  auto buffer = std::make_shared<Buffer>(subject.get(), data, true, 5);
+  auto positionBuffer
+    = std::make_shared<VertexBuffer>(subject.get(), buffer, VertexBuffer::PositionKind, true,
+                                     std::nullopt, 5, std::nullopt, 0, 3);
+  auto uvBuffer = std::make_shared<VertexBuffer>(subject.get(), buffer, VertexBuffer::UVKind, true,
+                                                 std::nullopt, 5, std::nullopt, 3, 2);
+
+  auto geometry = Geometry::New("geometry1", scene.get());
+  geometry->setVerticesBuffer(positionBuffer);
+  geometry->setVerticesBuffer(uvBuffer);
+
+  auto positions = geometry->getVerticesDataView(VertexBuffer::PositionKind);
+  ASSERT_EQ(positions.count, 2ull);
+  EXPECT_EQ(positions.stride, 5ull);
+  EXPECT_FALSE(positions.isTightlyPacked());
+  EXPECT_EQ(positions.data, buffer->getData().data());
+  EXPECT_TRUE(positions.getVector3(1).equals(Vector3(3.f, 4.f, 5.f)));
+  EXPECT_THAT(positions.toArray(),
+              ::testing::ContainerEq(Float32Array{0.f, 1.f, 2.f, 3.f, 4.f, 5.f}));
+
+  auto uvs = geometry->mapVerticesDataForWrite(VertexBuffer::UVKind);
+  ASSERT_EQ(uvs.count, 2ull);
+  uvs[1][0] = 0.5f;
+  EXPECT_FLOAT_EQ(buffer->getData()[8], 0.5f);
+  EXPECT_TRUE(buffer->_isDataDirty());
+
+  EXPECT_TRUE(geometry->getVerticesDataView(VertexBuffer::NormalKind).empty());
+}
+
+TEST(TestGeometry, TestGetVerticesDataView_NotFloat)
+{
+  using namespace BABYLON;
+  // normalized unsigned byte colors, the components are not stored as floats in the buffer
+  auto subject = createSubject();
+  auto scene   = Scene::New(subject.get());
+  Float32Array data{0.f, 0.f, 0.f, 0.f, 0.f, 0.f, 0.f, 0.f};
+  auto buffer      = std::make_shared<Buffer>(subject.get(), data, false);
+  auto colorBuffer = std::make_shared<VertexBuffer>(
+    subject.get(), buffer, VertexBuffer::ColorKind, false, std::nullopt, std::nullopt, std::nullopt,
+    std::nullopt, 4, VertexBuffer::UNSIGNED_BYTE, true);
+
+  EXPECT_TRUE(colorBuffer->getFloatDataView(2).empty());
+  EXPECT_EQ(colorBuffer->getFloatData(2, false).size(), 8ull);
+}
@@ -0,0 +1,103 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <numeric>
+#include <random>
+#include <set>
+
+#include <babylon/meshes/optimization/index_optimizer.h>
+
+namespace {
+
+void CreateGrid(size_t size, BABYLON::Float32Array& positions, BABYLON::IndicesArray& indices)
+{
+  for (size_t y = 0; y <= size; ++y) {
+    for (size_t x = 0; x <= size; ++x) {
+      positions.insert(positions.end(), {static_cast<float>(x), static_cast<float>(y),
+                                         std::sin(static_cast<float>(x) * 0.3f)});
+    }
+  }
+  for (size_t y = 0; y < size; ++y) {
+    for (size_t x = 0; x < size; ++x) {
+      const auto a = static_cast<uint32_t>(y * (size + 1) + x);
+      const auto c = static_cast<uint32_t>(a + size + 1);
+      indices.insert(indices.end(), {a, a + 1, c, a + 1, c + 1, c});
+    }
+  }
+}
+
+// Triangles with their winding, independently of the first vertex and of the triangle order
+std::multiset<std::array<uint32_t, 3>> GetTriangles(const BABYLON::IndicesArray& indices)
+{
+  std::multiset<std::array<uint32_t, 3>> triangles;
+  for (size_t index = 0; index < indices.size(); index += 3) {
+    std::array<uint32_t, 3> triangle{indices[index], indices[index + 1], indices[index + 2]};
+    std::rotate(triangle.begin(), std::min_element(triangle.begin(), triangle.end()),
+                triangle.end());
+    triangles.insert(triangle);
+  }
+  return triangles;
+}
+
+} // end of anonymous namespace
+
+TEST(TestIndexOptimizer, reordersShuffledGridForTheVertexCache)
+{
+  using namespace BABYLON;
+
+  Float32Array positions;
+  IndicesArray grid;
+  CreateGrid(64, positions, grid);
+
+  // Shuffle the triangles
+  std::vector<size_t> order(grid.size() / 3);
+  std::iota(order.begin(), order.end(), 0);
+  std::shuffle(order.begin(), order.end(), std::mt19937(42));
+  IndicesArray indices;
+  for (const auto triangle : order) {
+    indices.insert(indices.end(), grid.begin() + static_cast<std::ptrdiff_t>(triangle * 3),
+                   grid.begin() + static_cast<std::ptrdiff_t>(triangle * 3 + 3));
+  }
+  const auto triangles = GetTriangles(indices);
+  const auto before    = IndexOptimizer::AnalyzeVertexCache(indices, 0, indices.size());
+
+  IndexOptimizer::OptimizeVertexCache(indices, 0, indices.size());
+  const auto cacheOptimized = IndexOptimizer::AnalyzeVertexCache(indices, 0, indices.size());
+  IndexOptimizer::OptimizeOverdraw(indices, 0, indices.size(),
+                                   VertexDataView::FromArray(positions, 3), 16, 1.05f);
+  const auto after = IndexOptimizer::AnalyzeVertexCache(indices, 0, indices.size());
+
+  EXPECT_EQ(GetTriangles(indices), triangles);
+  EXPECT_GT(before.acmr, 2.f);
+  EXPECT_LT(cacheOptimized.acmr, 0.75f);
+  EXPECT_LE(after.acmr, cacheOptimized.acmr * 1.1f);
+  EXPECT_LT(after.atvr, 1.6f);
+  EXPECT_EQ(after.vertexCount, positions.size() / 3);
+}
+
+TEST(TestIndexOptimizer, remapsVerticesInTheOrderOfFirstUse)
+{
+  using namespace BABYLON;
+
+  Float32Array positions{0.f, 0.f, 0.f, 1.f, 1.f, 1.f, 2.f, 2.f, 2.f, 3.f, 3.f, 3.f, 4.f, 4.f, 4.f};
+  IndicesArray indices{3, 1, 4, 4, 1, 2};
+
+  IndicesArray remap;
+  ASSERT_TRUE(IndexOptimizer::GenerateVertexFetchRemap(indices, 0, indices.size(), 0, 5, remap));
+  EXPECT_THAT(remap, ::testing::ElementsAre(4u, 1u, 3u, 0u, 2u));
+
+  auto remappedIndices = indices;
+  IndexOptimizer::RemapIndices(remappedIndices, remap);
+  EXPECT_THAT(remappedIndices, ::testing::ElementsAre(0u, 1u, 2u, 2u, 1u, 3u));
+
+  const auto remappedPositions = IndexOptimizer::RemapVertexData(positions, 3, remap);
+  for (size_t index = 0; index < indices.size(); ++index) {
+    EXPECT_EQ(remappedPositions[remappedIndices[index] * 3], positions[indices[index] * 3]);
+  }
+
+  // Indices outside of the vertex range
+  EXPECT_FALSE(IndexOptimizer::GenerateVertexFetchRemap(indices, 0, indices.size(), 1, 3, remap));
+}
@@ -0,0 +1,129 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+
+#include <babylon/maths/matrix.h>
+#include <babylon/meshes/optimization/meshlet_builder.h>
+
+namespace {
+
+// Flat grid in the z = 0 plane, the front faces look toward -z
+void CreateGrid(size_t size, BABYLON::Float32Array& positions, BABYLON::IndicesArray& indices)
+{
+  for (size_t y = 0; y <= size; ++y) {
+    for (size_t x = 0; x <= size; ++x) {
+      positions.insert(positions.end(), {static_cast<float>(x), static_cast<float>(y), 0.f});
+    }
+  }
+  for (size_t y = 0; y < size; ++y) {
+    for (size_t x = 0; x < size; ++x) {
+      const auto a = static_cast<uint32_t>(y * (size + 1) + x);
+      const auto c = static_cast<uint32_t>(a + size + 1);
+      indices.insert(indices.end(), {a, a + 1, c, a + 1, c + 1, c});
+    }
+  }
+}
+
+std::vector<std::array<uint32_t, 3>> SortedTriangles(const BABYLON::IndicesArray& indices)
+{
+  std::vector<std::array<uint32_t, 3>> triangles;
+  for (size_t index = 0; index + 2 < indices.size(); index += 3) {
+    triangles.push_back({indices[index], indices[index + 1], indices[index + 2]});
+  }
+  std::sort(triangles.begin(), triangles.end());
+  return triangles;
+}
+
+std::array<BABYLON::Plane, 6> OpenFrustum()
+{
+  using namespace BABYLON;
+  return {Plane(0.f, 0.f, 0.f, 1.f), Plane(0.f, 0.f, 0.f, 1.f), Plane(0.f, 0.f, 0.f, 1.f),
+          Plane(0.f, 0.f, 0.f, 1.f), Plane(0.f, 0.f, 0.f, 1.f), Plane(0.f, 0.f, 0.f, 1.f)};
+}
+
+} // end of anonymous namespace
+
+TEST(TestMeshletBuilder, BuildMeshlets)
+{
+  using namespace BABYLON;
+
+  Float32Array positions;
+  IndicesArray indices;
+  CreateGrid(40, positions, indices);
+  const auto originalTriangles = SortedTriangles(indices);
+
+  const auto meshlets = MeshletBuilder::BuildMeshlets(indices, 0, indices.size(),
+                                                      VertexDataView::FromArray(positions, 3));
+
+  // Same triangles, reordered in contiguous meshlets of at most 128 triangles
+  EXPECT_EQ(SortedTriangles(indices), originalTriangles);
+  ASSERT_GE(meshlets.size(), indices.size() / (3 * 128));
+  uint32_t indexStart = 0;
+  for (const auto& meshlet : meshlets) {
+    EXPECT_EQ(meshlet.indexStart, indexStart);
+    EXPECT_GT(meshlet.indexCount, 0u);
+    EXPECT_LE(meshlet.indexCount, 128u * 3u);
+    for (uint32_t index = meshlet.indexStart; index < meshlet.indexStart + meshlet.indexCount;
+         ++index) {
+      const auto position = Vector3::FromArray(positions, indices[index] * 3);
+      EXPECT_LE(Vector3::Distance(position, meshlet.center), meshlet.radius + 1e-4f);
+    }
+    // Flat meshlets have a zero angle normal cone
+    EXPECT_NEAR(meshlet.coneAxis.z, -1.f, 1e-4f);
+    EXPECT_LT(meshlet.coneCutoff, 1e-2f);
+    indexStart += meshlet.indexCount;
+  }
+  EXPECT_EQ(indexStart, indices.size());
+}
+
+TEST(TestMeshletBuilder, CullMeshlets)
+{
+  using namespace BABYLON;
+
+  Float32Array positions;
+  IndicesArray indices;
+  CreateGrid(40, positions, indices);
+  const auto meshlets = MeshletBuilder::BuildMeshlets(indices, 0, indices.size(),
+                                                      VertexDataView::FromArray(positions, 3));
+  const auto world = Matrix::Identity();
+  std::vector<MeshletDrawRange> ranges;
+
+  // Everything visible from the front: one merged range
+  MeshletCullingOptions options;
+  EXPECT_EQ(MeshletBuilder::CullMeshlets(meshlets, world, OpenFrustum(), Vector3(20.f, 20.f, -10.f),
+                                         options, ranges),
+            meshlets.size());
+  ASSERT_EQ(ranges.size(), 1ull);
+  EXPECT_EQ(ranges[0].indexStart, 0u);
+  EXPECT_EQ(ranges[0].indexCount, indices.size());
+
+  // Back faces
+  EXPECT_EQ(MeshletBuilder::CullMeshlets(meshlets, world, OpenFrustum(), Vector3(20.f, 20.f, 100.f),
+                                         options, ranges),
+            0ull);
+  EXPECT_TRUE(ranges.empty());
+
+  // Frustum, only the meshlets crossing x <= 10 are kept
+  auto frustumPlanes = OpenFrustum();
+  frustumPlanes[0]        = Plane(-1.f, 0.f, 0.f, 10.f);
+  const auto visibleCount = MeshletBuilder::CullMeshlets(
+    meshlets, world, frustumPlanes, Vector3(20.f, 20.f, -10.f), options, ranges);
+  EXPECT_GT(visibleCount, 0ull);
+  EXPECT_LT(visibleCount, meshlets.size());
+  for (const auto& meshlet : meshlets) {
+    const auto visible = std::any_of(ranges.begin(), ranges.end(), [&](const auto& range) {
+      return meshlet.indexStart >= range.indexStart
+             && meshlet.indexStart < range.indexStart + range.indexCount;
+    });
+    EXPECT_EQ(visible, meshlet.center.x - meshlet.radius <= 10.f);
+  }
+
+  // Occlusion callback
+  options.occlusionTest = [](const Vector3& center, float /*radius*/) { return center.y < 20.f; };
+  const auto unoccludedCount = MeshletBuilder::CullMeshlets(
+    meshlets, world, OpenFrustum(), Vector3(20.f, 20.f, -10.f), options, ranges);
+  EXPECT_GT(unoccludedCount, 0ull);
+  EXPECT_LT(unoccludedCount, meshlets.size());
+}
@@ -0,0 +1,78 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+#include <babylon/meshes/simplification/quadratic_error_simplification.h>
+#include <babylon/meshes/simplification/simplification_settings.h>
+#include <babylon/meshes/vertex_data.h>
+
+namespace {
+
+void CreateGrid(size_t size, BABYLON::VertexData& vertexData)
+{
+  for (size_t y = 0; y <= size; ++y) {
+    for (size_t x = 0; x <= size; ++x) {
+      vertexData.positions.insert(vertexData.positions.end(),
+                                  {static_cast<float>(x), static_cast<float>(y), 0.f});
+      vertexData.normals.insert(vertexData.normals.end(), {0.f, 0.f, 1.f});
+      vertexData.uvs.insert(vertexData.uvs.end(), {static_cast<float>(x) / size,
+                                                   static_cast<float>(y) / size});
+    }
+  }
+  for (size_t y = 0; y < size; ++y) {
+    for (size_t x = 0; x < size; ++x) {
+      const auto a = static_cast<uint32_t>(y * (size + 1) + x);
+      const auto c = static_cast<uint32_t>(a + size + 1);
+      vertexData.indices.insert(vertexData.indices.end(), {a, a + 1, c, a + 1, c + 1, c});
+    }
+  }
+}
+
+} // end of anonymous namespace
+
+TEST(TestQuadraticErrorSimplification, SimplifyGrid)
+{
+  using namespace BABYLON;
+
+  constexpr size_t size = 40;
+  VertexData grid;
+  CreateGrid(size, grid);
+  const auto triangleCount = grid.indices.size() / 3;
+
+  // Two submeshes: bottom and top halves
+  IndicesArray subMeshIndexCounts{static_cast<uint32_t>(grid.indices.size() / 2),
+                                  static_cast<uint32_t>(grid.indices.size() / 2)};
+
+  QuadraticErrorSimplification simplifier;
+  const auto result
+    = simplifier.simplify(grid, subMeshIndexCounts, SimplificationSettings(0.2f, 0.f, false));
+  ASSERT_TRUE(result);
+
+  // The flat interior collapses, the border vertices stay
+  const auto simplifiedTriangleCount = result->indices.size() / 3;
+  EXPECT_LE(simplifiedTriangleCount, triangleCount / 2);
+  EXPECT_GE(result->positions.size() / 3, size * 4);
+  EXPECT_EQ(subMeshIndexCounts[0] + subMeshIndexCounts[1], result->indices.size());
+  EXPECT_GT(subMeshIndexCounts[0], 0u);
+  EXPECT_GT(subMeshIndexCounts[1], 0u);
+
+  // The attributes follow the positions
+  const auto vertexCount = result->positions.size() / 3;
+  ASSERT_EQ(result->uvs.size(), vertexCount * 2);
+  ASSERT_EQ(result->normals.size(), vertexCount * 3);
+  for (size_t i = 0; i < vertexCount; ++i) {
+    EXPECT_NEAR(result->uvs[i * 2], result->positions[i * 3] / size, 1e-4f);
+    EXPECT_NEAR(result->uvs[i * 2 + 1], result->positions[i * 3 + 1] / size, 1e-4f);
+    EXPECT_NEAR(result->normals[i * 3 + 2], 1.f, 1e-4f);
+  }
+
+  // No triangle is flipped
+  for (size_t i = 0; i < result->indices.size(); i += 3) {
+    const auto* a = &result->positions[result->indices[i] * 3];
+    const auto* b = &result->positions[result->indices[i + 1] * 3];
+    const auto* c = &result->positions[result->indices[i + 2] * 3];
+    const auto z  = (b[0] - a[0]) * (c[1] - a[1]) - (b[1] - a[1]) * (c[0] - a[0]);
+    EXPECT_GT(z, 0.f);
+  }
+}
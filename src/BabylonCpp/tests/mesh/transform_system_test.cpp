@@ -0,0 +1,120 @@
+#include <gtest/gtest.h>
+
+#include "../test_utils.h"
+
+#include <babylon/engines/scene.h>
+#include <babylon/meshes/abstract_mesh.h>
+#include <babylon/meshes/transform_node.h>
+#include <babylon/meshes/transform_system.h>
+
+TEST(TestTransformSystem, UpdatesOnlyDirtySubTrees)
+{
+  using namespace BABYLON;
+
+  auto subject         = createSubject();
+  auto scene           = Scene::New(subject.get());
+  auto transformSystem = scene->enableTransformSystem();
+
+  auto root  = TransformNode::New("root", scene.get());
+  auto child = TransformNode::New("child", scene.get());
+  auto leaf  = AbstractMesh::New("leaf", scene.get());
+  auto other = AbstractMesh::New("other", scene.get());
+  child->parent = root.get();
+  leaf->parent  = child.get();
+
+  // First update builds the hierarchy
+  scene->incrementRenderId();
+  transformSystem->update();
+  EXPECT_EQ(transformSystem->size(), 4ull);
+  EXPECT_EQ(transformSystem->levelCount(), 3ull);
+
+  // Nothing changed
+  scene->incrementRenderId();
+  transformSystem->update();
+  EXPECT_EQ(transformSystem->updatedCount(), 0ull);
+
+  // Moving the root updates the whole sub tree
+  root->position().set(1.f, 2.f, 3.f);
+  scene->incrementRenderId();
+  transformSystem->update();
+  EXPECT_EQ(transformSystem->updatedCount(), 3ull);
+  EXPECT_TRUE(leaf->getAbsolutePosition().equals(Vector3(1.f, 2.f, 3.f)));
+
+  // Moving the leaf only updates the leaf
+  leaf->position().set(0.f, 1.f, 0.f);
+  scene->incrementRenderId();
+  transformSystem->update();
+  EXPECT_EQ(transformSystem->updatedCount(), 1ull);
+  EXPECT_TRUE(leaf->getAbsolutePosition().equals(Vector3(1.f, 3.f, 3.f)));
+
+  // Re-parenting rebuilds the hierarchy
+  other->parent = leaf.get();
+  scene->incrementRenderId();
+  transformSystem->update();
+  EXPECT_EQ(transformSystem->levelCount(), 4ull);
+  EXPECT_TRUE(other->getAbsolutePosition().equals(Vector3(1.f, 3.f, 3.f)));
+}
+
+TEST(TestTransformSystem, ModificationsAfterTheUpdate)
+{
+  using namespace BABYLON;
+
+  auto subject         = createSubject();
+  auto scene           = Scene::New(subject.get());
+  auto transformSystem = scene->enableTransformSystem();
+
+  auto parent   = TransformNode::New("parent", scene.get());
+  auto child    = AbstractMesh::New("child", scene.get());
+  child->parent = parent.get();
+  scene->incrementRenderId();
+  transformSystem->update();
+
+  // Parent then child modified in the same frame, after the update
+  parent->position().set(1.f, 0.f, 0.f);
+  EXPECT_TRUE(parent->computeWorldMatrix().getTranslation().equals(Vector3(1.f, 0.f, 0.f)));
+  child->position().set(0.f, 2.f, 0.f);
+  EXPECT_TRUE(child->computeWorldMatrix().getTranslation().equals(Vector3(1.f, 2.f, 0.f)));
+
+  // Parent updated alone between two frames, the child is updated by the next pass
+  parent->position().set(3.f, 0.f, 0.f);
+  parent->computeWorldMatrix();
+  scene->incrementRenderId();
+  transformSystem->update();
+  EXPECT_EQ(transformSystem->updatedCount(), 1ull);
+  EXPECT_TRUE(child->worldMatrixFromCache().getTranslation().equals(Vector3(3.f, 2.f, 0.f)));
+}
+
+TEST(TestTransformSystem, ValidatedNodesAndDisabledSubTrees)
+{
+  using namespace BABYLON;
+
+  auto subject         = createSubject();
+  auto scene           = Scene::New(subject.get());
+  auto transformSystem = scene->enableTransformSystem();
+
+  auto parent   = TransformNode::New("parent", scene.get());
+  auto child    = AbstractMesh::New("child", scene.get());
+  child->parent = parent.get();
+  scene->incrementRenderId();
+  transformSystem->update();
+
+  // The later calls of the frame do not recompute the validated nodes
+  ASSERT_TRUE(transformSystem->_isValidated(child.get()));
+  const auto updateFlag = child->worldMatrixFromCache().updateFlag;
+  child->computeWorldMatrix();
+  EXPECT_EQ(child->worldMatrixFromCache().updateFlag, updateFlag);
+
+  // A parent updated outside of the pass invalidates its descendants
+  parent->position().set(0.f, 1.f, 0.f);
+  parent->computeWorldMatrix();
+  EXPECT_FALSE(transformSystem->_isValidated(child.get()));
+  EXPECT_TRUE(child->computeWorldMatrix().getTranslation().equals(Vector3(0.f, 1.f, 0.f)));
+
+  // Disabled sub trees are skipped by the pass
+  parent->setEnabled(false);
+  parent->position().set(2.f, 0.f, 0.f);
+  scene->incrementRenderId();
+  transformSystem->update();
+  EXPECT_EQ(transformSystem->updatedCount(), 0ull);
+  EXPECT_FALSE(transformSystem->_isValidated(child.get()));
+}
@@ -231,3 +231,38 @@ TEST(TestVertexData, CreateTiledGround)
   EXPECT_THAT(tiledGround->normals, ::testing::ContainerEq(expectedNormals));
   EXPECT_THAT(tiledGround->uvs, ::testing::ContainerEq(expectedUVs));
 }
+
+TEST(TestVertexData, Weld)
+{
+  using namespace BABYLON;
+  BoxOptions options;
+  options.size = 2.f;
+
+  // Faces keep their own vertices when the normals and uvs are compared
+  auto box = VertexData::CreateBox(options);
+  box->weld();
+  EXPECT_EQ(box->positions.size(), 24ull * 3);
+  EXPECT_EQ(box->indices.size(), 36ull);
+
+  // The 8 corners are shared when only the positions are compared
+  VertexWeldOptions positionsOnly;
+  positionsOnly.compareNormals = false;
+  positionsOnly.compareUVs     = false;
+  box                          = VertexData::CreateBox(options);
+  box->weld(positionsOnly);
+  EXPECT_EQ(box->positions.size(), 8ull * 3);
+  EXPECT_EQ(box->normals.size(), 8ull * 3);
+  EXPECT_EQ(box->uvs.size(), 8ull * 2);
+  EXPECT_EQ(box->indices.size(), 36ull);
+
+  // Triangles collapsed by the welding are removed from their submesh
+  VertexData strip;
+  strip.positions
+    = {0.f, 0.f, 0.f, 1.f, 0.f, 0.f, 0.f, 1.f, 0.f, 1.f, 1.f, 0.f, 1.f, 1.00001f, 0.f};
+  strip.indices   = {0, 1, 2, 1, 3, 2, 1, 3, 4};
+  IndicesArray subMeshIndexCounts{6, 3};
+  strip.weld(positionsOnly, &subMeshIndexCounts);
+  EXPECT_EQ(strip.positions.size(), 4ull * 3);
+  EXPECT_THAT(strip.indices, ::testing::ContainerEq(IndicesArray{0, 1, 2, 1, 3, 2}));
+  EXPECT_THAT(subMeshIndexCounts, ::testing::ContainerEq(IndicesArray{6, 0}));
+}
@@ -0,0 +1,141 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "../test_utils.h"
+
+#include <functional>
+
+#include <babylon/engines/engine_capabilities.h>
+#include <babylon/engines/scene.h>
+#include <babylon/materials/material.h>
+#include <babylon/materials/standard_material.h>
+#include <babylon/maths/matrix.h>
+#include <babylon/meshes/_instance_data_storage.h>
+#include <babylon/meshes/builders/mesh_builder_options.h>
+#include <babylon/meshes/mesh.h>
+#include <babylon/meshes/mesh_builder.h>
+#include <babylon/meshes/sub_mesh.h>
+#include <babylon/meshes/vertex_buffer.h>
+#include <babylon/rendering/rendering_group.h>
+
+namespace {
+
+std::vector<BABYLON::SubMesh*> DispatchedOpaqueSubMeshes(BABYLON::RenderingGroup& group)
+{
+  using namespace BABYLON;
+  std::vector<SubMesh*> opaqueSubMeshes;
+  std::function<void(const std::vector<SubMesh*>&, const std::vector<SubMesh*>&,
+                     const std::vector<SubMesh*>&, const std::vector<SubMesh*>&,
+                     const std::function<void()>&)>
+    customRenderFunction
+    = [&opaqueSubMeshes](const std::vector<SubMesh*>& opaque,
+                         const std::vector<SubMesh*>& /*alphaTest*/,
+                         const std::vector<SubMesh*>& /*transparent*/,
+                         const std::vector<SubMesh*>& /*depthOnly*/,
+                         const std::function<void()>& /*beforeTransparents*/) {
+        opaqueSubMeshes = opaque;
+      };
+  group.render(customRenderFunction, false, false, {});
+  return opaqueSubMeshes;
+}
+
+} // end of anonymous namespace
+
+TEST(TestAutomaticInstancing, groupsSubMeshesSharingGeometryAndMaterial)
+{
+  using namespace BABYLON;
+  auto engine = createSubject();
+  // The null engine does not report instancing support, the meshes read it when created
+  engine->getCaps().instancedArrays = true;
+  auto scene                        = Scene::New(engine.get());
+  scene->automaticInstancing        = true;
+
+  auto material      = StandardMaterial::New("material", scene.get());
+  auto otherMaterial = StandardMaterial::New("otherMaterial", scene.get());
+
+  BoxOptions boxOptions;
+  auto leader      = MeshBuilder::CreateBox("leader", boxOptions, scene.get());
+  leader->material = material;
+  // Same material, own geometry
+  auto otherGeometry      = MeshBuilder::CreateBox("otherGeometry", boxOptions, scene.get());
+  otherGeometry->material = material;
+  // Same geometry and material
+  auto grouped = leader->clone("grouped");
+  grouped->position().set(2.f, 0.f, 0.f);
+  // Same geometry, other material
+  auto otherMaterialMesh      = leader->clone("otherMaterialMesh");
+  otherMaterialMesh->material = otherMaterial;
+  // Same geometry and material, other culling orientation
+  auto mirrored = leader->clone("mirrored");
+  mirrored->scaling().set(-1.f, 1.f, 1.f);
+
+  const std::vector<MeshPtr> meshes{leader, otherGeometry, grouped, otherMaterialMesh, mirrored};
+  for (const auto& mesh : meshes) {
+    mesh->computeWorldMatrix(true);
+  }
+
+  RenderingGroup group(0, scene.get());
+  for (const auto& mesh : meshes) {
+    group.dispatch(mesh->subMeshes[0].get());
+  }
+
+  // The grouped sub mesh follows its leader, the others are drawn on their own
+  EXPECT_THAT(DispatchedOpaqueSubMeshes(group),
+              ::testing::ElementsAre(leader->subMeshes[0].get(), grouped->subMeshes[0].get(),
+                                     otherGeometry->subMeshes[0].get(),
+                                     otherMaterialMesh->subMeshes[0].get(),
+                                     mirrored->subMeshes[0].get()));
+
+  // Disabled: dispatch order
+  scene->automaticInstancing = false;
+  group.prepare();
+  for (const auto& mesh : meshes) {
+    group.dispatch(mesh->subMeshes[0].get());
+  }
+  EXPECT_THAT(DispatchedOpaqueSubMeshes(group),
+              ::testing::ElementsAre(leader->subMeshes[0].get(), otherGeometry->subMeshes[0].get(),
+                                     grouped->subMeshes[0].get(),
+                                     otherMaterialMesh->subMeshes[0].get(),
+                                     mirrored->subMeshes[0].get()));
+}
+
+TEST(TestAutomaticInstancing, uploadsGroupedWorldMatrices)
+{
+  using namespace BABYLON;
+  auto engine = createSubject();
+  engine->getCaps().instancedArrays = true;
+  auto scene                        = Scene::New(engine.get());
+
+  BoxOptions boxOptions;
+  auto leader = MeshBuilder::CreateBox("leader", boxOptions, scene.get());
+  auto first  = leader->clone("first");
+  auto second = leader->clone("second");
+  first->position().set(1.f, 2.f, 3.f);
+  second->position().set(4.f, 5.f, 6.f);
+  for (const auto& mesh : {leader, first, second}) {
+    mesh->computeWorldMatrix(true);
+  }
+
+  // Group set by the rendering group when the leader is rendered
+  std::vector<AbstractMesh*> autoInstances{first.get(), second.get()};
+  auto subMesh            = leader->subMeshes[0].get();
+  subMesh->_autoInstances = &autoInstances;
+  auto batch              = leader->_getInstancesRenderList(subMesh->_id);
+  leader->_renderWithInstances(subMesh, Material::TriangleFillMode, batch, nullptr, engine.get());
+  subMesh->_autoInstances = nullptr;
+
+  // Leader first, then the grouped meshes in group order
+  const auto& instancesData = leader->_instanceDataStorage->instancesData;
+  ASSERT_GE(instancesData.size(), 48ull);
+  EXPECT_TRUE(Matrix::FromArray(instancesData, 0).equals(leader->getWorldMatrix()));
+  EXPECT_TRUE(Matrix::FromArray(instancesData, 16).equals(first->getWorldMatrix()));
+  EXPECT_TRUE(Matrix::FromArray(instancesData, 32).equals(second->getWorldMatrix()));
+
+  // The world matrices are bound as the per instance attributes
+  for (const auto& kind : {VertexBuffer::World0Kind, VertexBuffer::World1Kind,
+                           VertexBuffer::World2Kind, VertexBuffer::World3Kind}) {
+    const auto vertexBuffer = leader->getVertexBuffer(kind);
+    ASSERT_NE(vertexBuffer, nullptr);
+    EXPECT_TRUE(vertexBuffer->getIsInstanced());
+  }
+}
@@ -0,0 +1,48 @@
+#include <gtest/gtest.h>
+
+#include <babylon/interfaces/igl_rendering_context.h>
+#include <babylon/states/gl_state_cache.h>
+
+TEST(TestGLStateCache, FiltersRedundantUniformWrites)
+{
+  using namespace BABYLON;
+
+  GLStateCache glState;
+  GL::IGLUniformLocation location(0);
+
+  const float color[] = {1.f, 0.5f, 0.25f, 1.f};
+  EXPECT_TRUE(glState.uniform(location, color, sizeof(color)));
+  EXPECT_FALSE(glState.uniform(location, color, sizeof(color)));
+
+  // A different value or size is issued
+  const float otherColor[] = {1.f, 0.5f, 0.25f, 0.f};
+  EXPECT_TRUE(glState.uniform(location, otherColor, sizeof(otherColor)));
+  EXPECT_TRUE(glState.uniform(location, otherColor, 3 * sizeof(float)));
+
+  EXPECT_EQ(glState.counters().glCalls, 3ull);
+  EXPECT_EQ(glState.counters().filteredGLCalls, 1ull);
+}
+
+TEST(TestGLStateCache, CountsAndResetsFrameStatistics)
+{
+  using namespace BABYLON;
+
+  GLStateCache glState;
+  glState.countProgramSwitch();
+  glState.countTextureBind();
+  glState.countTextureBind();
+  glState.countIssued(2);
+  glState.countFiltered();
+
+  const auto& counters = glState.counters();
+  EXPECT_EQ(counters.glCalls, 5ull);
+  EXPECT_EQ(counters.filteredGLCalls, 1ull);
+  EXPECT_EQ(counters.programSwitches, 1ull);
+  EXPECT_EQ(counters.textureBinds, 2ull);
+
+  glState.resetCounters();
+  EXPECT_EQ(counters.glCalls, 0ull);
+  EXPECT_EQ(counters.filteredGLCalls, 0ull);
+  EXPECT_EQ(counters.programSwitches, 0ull);
+  EXPECT_EQ(counters.textureBinds, 0ull);
+}
@@ -24,6 +24,8 @@ public:
   void bindBuffer(GLenum target, IGLBuffer* buffer) override;
   void bindFramebuffer(GLenum target, IGLFramebuffer* framebuffer) override;
   void bindBufferBase(GLenum target, GLuint index, IGLBuffer* buffer) override;
+  void bindBufferRange(GLenum target, GLuint index, IGLBuffer* buffer, GLintptr offset,
+                       GLsizeiptr size) override;
   void bindRenderbuffer(GLenum target, IGLRenderbuffer* renderbuffer) override;
   void bindTexture(GLenum target, IGLTexture* texture) override;
   void bindTransformFeedback(GLenum target, IGLTransformFeedback* transformFeedback) override;
@@ -129,6 +131,7 @@ public:
   const char* getErrorString(GLenum err) override;
   GLint getProgramParameter(IGLProgram* program, GLenum pname) override;
   std::string getProgramInfoLog(IGLProgram* program) override;
+  ArrayBuffer getProgramBinary(IGLProgram* program, GLenum& binaryFormat) override;
   GLint getRenderbufferParameter(GLenum target, GLenum pname) override;
   std::string getShaderInfoLog(IGLShader* shader) override;
   GLint getShaderParameter(IGLShader* shader, GLenum pname) override;
@@ -148,6 +151,8 @@ public:
   GLboolean isTexture(IGLTexture* texture) override;
   void lineWidth(GLfloat width) override;
   bool linkProgram(IGLProgram* program) override;
+  bool programBinary(IGLProgram* program, GLenum binaryFormat, const ArrayBuffer& binary) override;
+  void programParameteri(IGLProgram* program, GLenum pname, GLint value) override;
   void pixelStorei(GLenum pname, GLint param) override;
   void polygonOffset(GLfloat factor, GLfloat units) override;
   void readBuffer(GLenum src) override;
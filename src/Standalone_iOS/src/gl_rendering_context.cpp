@@ -187,6 +187,12 @@ void GLRenderingContext::bindBufferBase(GLenum target, GLuint index, IGLBuffer*
   glBindBufferBase(target, index, buffer ? buffer->value : 0);
 }
 
+void GLRenderingContext::bindBufferRange(GLenum target, GLuint index, IGLBuffer* buffer,
+                                         GLintptr offset, GLsizeiptr size)
+{
+  glBindBufferRange(target, index, buffer ? buffer->value : 0, offset, size);
+}
+
 void GLRenderingContext::bindRenderbuffer(GLenum target, IGLRenderbuffer* renderbuffer)
 {
   glBindRenderbuffer(target, renderbuffer ? renderbuffer->value : 0);
@@ -720,6 +726,21 @@ std::string GLRenderingContext::getProgramInfoLog(IGLProgram* program)
   return result;
 }
 
+ArrayBuffer GLRenderingContext::getProgramBinary(IGLProgram* program, GLenum& binaryFormat)
+{
+  GLint length = 0;
+  glGetProgramiv(program->value, GL_PROGRAM_BINARY_LENGTH, &length);
+  if (length <= 0) {
+    return ArrayBuffer();
+  }
+
+  ArrayBuffer binary(static_cast<size_t>(length));
+  GLsizei writtenLength = 0;
+  glGetProgramBinary(program->value, length, &writtenLength, &binaryFormat, binary.data());
+  binary.resize(static_cast<size_t>(writtenLength));
+  return binary;
+}
+
 GLint GLRenderingContext::getRenderbufferParameter(GLenum target, GLenum pname)
 {
   GLint params;
@@ -837,6 +858,23 @@ bool GLRenderingContext::linkProgram(IGLProgram* program)
   return linkSucceed != GL_FALSE;
 }
 
+bool GLRenderingContext::programBinary(IGLProgram* program, GLenum binaryFormat,
+                                       const ArrayBuffer& binary)
+{
+  glProgramBinary(program->value, binaryFormat, binary.data(),
+                  static_cast<GLsizei>(binary.size()));
+
+  GLint linkSucceed = GL_FALSE;
+  glGetProgramiv(program->value, GL_LINK_STATUS, &linkSucceed);
+
+  return linkSucceed != GL_FALSE;
+}
+
+void GLRenderingContext::programParameteri(IGLProgram* program, GLenum pname, GLint value)
+{
+  glProgramParameteri(program->value, pname, value);
+}
+
 void GLRenderingContext::pixelStorei(GLenum pname, GLint param)
 {
   if (pname != UNPACK_FLIP_Y_WEBGL) {